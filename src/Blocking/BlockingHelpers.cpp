@@ -126,7 +126,9 @@ void BlockingHelpers::createBlockingDomainHelper(std::set<std::shared_ptr<Node>>
 
     //Create Blocking Inputs and Outputs
     std::map<std::pair<std::shared_ptr<OutputPort>, int>, std::shared_ptr<BlockingInput>> outputPortsToBlockingInputs; //Crete Seperate Blocking Inputs For Different Partitions
-    for(const std::shared_ptr<Arc> &inputArc : arcsIntoDomain) {
+    //Arcs are visited in ID order so that the blocking inputs are created (and later numbered) in the same order between runs
+    std::set<std::shared_ptr<Arc>, Arc::PtrID_Compare> arcsIntoDomainOrdered(arcsIntoDomain.begin(), arcsIntoDomain.end());
+    for(const std::shared_ptr<Arc> &inputArc : arcsIntoDomainOrdered) {
 
         //      We create blocking inputs for All I/O Input Arcs EXCEPT ones destined for clock domains that
         //      cannot operate in vector mode (or clock domains nested in clock domains that cannot execute in vector mode)
@@ -208,7 +210,8 @@ void BlockingHelpers::createBlockingDomainHelper(std::set<std::shared_ptr<Node>>
     }
 
     std::map<std::shared_ptr<OutputPort>, std::shared_ptr<BlockingOutput>> outputPortsToBlockingOutputs; //Do not need partition number since the blocking output is in the partition of the src port
-    for(const std::shared_ptr<Arc> &outputArc : arcsOutOfDomain){
+    std::set<std::shared_ptr<Arc>, Arc::PtrID_Compare> arcsOutOfDomainOrdered(arcsOutOfDomain.begin(), arcsOutOfDomain.end());
+    for(const std::shared_ptr<Arc> &outputArc : arcsOutOfDomainOrdered){
         if(!MultiRateHelpers::arcIsIOAndNotAtBaseRate(outputArc)) {
             //Only insert the blocking Input if the Arc is Not To/From I/O or is To/From I/O At the Base Rate
 
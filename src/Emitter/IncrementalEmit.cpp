@@ -0,0 +1,54 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "IncrementalEmit.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "General/FileIOHelpers.h"
+#include "General/ErrorHelpers.h"
+
+std::string IncrementalEmit::getStagingDir(std::string outputDir) {
+    return outputDir + "/.staging";
+}
+
+void IncrementalEmit::prepareStagingDir(std::string outputDir) {
+    FileIOHelpers::createDirectoryIfDoesNotExist(getStagingDir(outputDir), false);
+}
+
+void IncrementalEmit::removeStagingDir(std::string outputDir) {
+    FileIOHelpers::deleteDirectoryRecursive(getStagingDir(outputDir), false);
+}
+
+std::string IncrementalEmit::readFile(std::string filePath) {
+    std::ifstream file(filePath, std::ifstream::in | std::ifstream::binary);
+    if(!file.is_open()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unable to read file: " + filePath));
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+bool IncrementalEmit::commitFile(std::string outputDir, std::string fileName) {
+    boost::filesystem::path stagedPath(getStagingDir(outputDir) + "/" + fileName);
+    boost::filesystem::path outputPath(outputDir + "/" + fileName);
+
+    //The size is checked first so that the output file only needs to be read when it is likely unchanged
+    if(boost::filesystem::exists(outputPath) &&
+       boost::filesystem::file_size(outputPath) == boost::filesystem::file_size(stagedPath) &&
+       readFile(outputPath.string()) == readFile(stagedPath.string())){
+        boost::filesystem::remove(stagedPath);
+        return false;
+    }
+
+    //The staging directory is inside of the output directory so the staged file can be renamed over the output file
+    boost::filesystem::rename(stagedPath, outputPath);
+    return true;
+}
@@ -0,0 +1,61 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_INCREMENTALEMIT_H
+#define VITIS_INCREMENTALEMIT_H
+
+#include <string>
+
+/**
+ * \addtogroup Emitter Emitter Helpers and Functions
+ * @{
+*/
+
+/**
+ * @brief Helpers for only rewriting emitted files whose contents changed so that unchanged files keep their timestamps
+ *
+ * Files are first emitted to a staging directory inside of the output directory.  Each staged file is then compared
+ * against the file with the same name in the output directory.  If the contents are identical, the output file is not
+ * rewritten and keeps its timestamp.  Downstream make based builds therefore only rebuild the files whose contents
+ * changed.
+ */
+namespace IncrementalEmit {
+    /**
+     * @brief Get the staging directory inside of the output directory which files should be emitted into before being committed
+     */
+    std::string getStagingDir(std::string outputDir);
+
+    /**
+     * @brief Creates the staging directory if it does not already exist
+     * @param outputDir the output directory
+     */
+    void prepareStagingDir(std::string outputDir);
+
+    /**
+     * @brief Removes the staging directory (and any files which were not committed)
+     * @param outputDir the output directory
+     */
+    void removeStagingDir(std::string outputDir);
+
+    /**
+     * @brief Moves a file from the staging directory to the output directory if its contents differ from the existing output file
+     *
+     * If the output file exists and has the same contents as the staged file, the output file is left untouched.
+     * Otherwise, the staged file replaces the output file.  The staged file is removed in either case.
+     *
+     * @param outputDir the directory the file should be placed in
+     * @param fileName the name of the file (in the staging directory)
+     * @return true if the output file was rewritten, false if it was left untouched
+     */
+    bool commitFile(std::string outputDir, std::string fileName);
+
+    /**
+     * @brief Reads the contents of a file into a string.  Throws an error if the file cannot be read
+     */
+    std::string readFile(std::string filePath);
+};
+
+/*! @} */
+
+#endif //VITIS_INCREMENTALEMIT_H
@@ -97,7 +97,7 @@ std::string MultiThreadEmit::emitCopyCThreadArgs(std::vector<std::shared_ptr<Thr
     return statements;
 }
 
-std::string MultiThreadEmit::emitFIFOChecks(std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos, bool producer, std::string checkVarName, bool shortCircuit, bool blocking, bool includeThreadCancelCheck, PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior){
+std::string MultiThreadEmit::emitFIFOChecks(std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos, bool producer, std::string checkVarName, bool shortCircuit, bool blocking, bool includeThreadCancelCheck, PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior, std::vector<std::string> stallStatements, PartitionParams::FIFOWaitPolicy waitPolicy){
     //Began work on version which replicates context check below.  Requires context check to be replicated
     //This version simply checks
 
@@ -105,7 +105,19 @@ std::string MultiThreadEmit::emitFIFOChecks(std::vector<std::shared_ptr<ThreadCr
 
     //Now, emit the beginning of the check
     std::string check = "";
+    std::string waitStateName = checkVarName + "_wait";
     if(blocking) {
+        //Wake threads parked on FIFOs this thread has published to and wait according to the wait policy
+        std::vector<std::string> wakeStatements = wakeFIFOWaiters(waitPolicy);
+        stallStatements.insert(stallStatements.end(), wakeStatements.begin(), wakeStatements.end());
+        std::vector<std::string> waitStatements = waitOnFIFOs(waitPolicy, waitStateName);
+        stallStatements.insert(stallStatements.end(), waitStatements.begin(), waitStatements.end());
+
+        std::vector<std::string> waitStateDecl = createFIFOWaitState(waitPolicy, waitStateName);
+        for(unsigned int i = 0; i<waitStateDecl.size(); i++){
+            check += waitStateDecl[i] + "\n";
+        }
+
         check += "bool " + checkVarName +" = false;\n";
         check += "while(!" + checkVarName + "){\n";
         check += checkVarName + " =  true;\n";
@@ -143,6 +155,9 @@ std::string MultiThreadEmit::emitFIFOChecks(std::vector<std::shared_ptr<ThreadCr
 
         if(shortCircuit && blocking){
             check += "if(!" + checkVarName + "){\n";
+            for(unsigned int j = 0; j<stallStatements.size(); j++){
+                check += stallStatements[j] + "\n";
+            }
             check += "continue;\n";
             check += "}\n";
         }else if(shortCircuit && i < (fifos.size()-1)){ //Short circuit and not blocking (and not the last FIFO)
@@ -160,12 +175,76 @@ std::string MultiThreadEmit::emitFIFOChecks(std::vector<std::shared_ptr<ThreadCr
 
     //Close the check
     if(blocking) {
+        if(!shortCircuit && !stallStatements.empty()){
+            //The thread is about to spin on the check
+            check += "if(!" + checkVarName + "){\n";
+            for(unsigned int j = 0; j<stallStatements.size(); j++){
+                check += stallStatements[j] + "\n";
+            }
+            check += "}\n";
+        }
         check += "}\n";
+
+        std::vector<std::string> doneStatements = doneWaitingOnFIFOs(waitPolicy, waitStateName);
+        for(unsigned int i = 0; i<doneStatements.size(); i++){
+            check += doneStatements[i] + "\n";
+        }
     }
 
     return check;
 }
 
+std::vector<std::string> MultiThreadEmit::flushFIFOsPendingCommits(std::vector<std::shared_ptr<ThreadCrossingFIFO>> inputFIFOs, std::vector<std::shared_ptr<ThreadCrossingFIFO>> outputFIFOs){
+    std::vector<std::string> flushExprs;
+
+    for(int i = 0; i<inputFIFOs.size(); i++){
+        inputFIFOs[i]->emitCFlushPendingCommits(flushExprs, ThreadCrossingFIFO::Role::CONSUMER);
+    }
+    for(int i = 0; i<outputFIFOs.size(); i++){
+        outputFIFOs[i]->emitCFlushPendingCommits(flushExprs, ThreadCrossingFIFO::Role::PRODUCER);
+    }
+
+    std::vector<std::string> exprs;
+    if(!flushExprs.empty()){
+        exprs.push_back("//Publishing pending FIFO reads/writes");
+        exprs.insert(exprs.end(), flushExprs.begin(), flushExprs.end());
+    }
+
+    return exprs;
+}
+
+std::vector<std::string> MultiThreadEmit::createFIFOWaitState(PartitionParams::FIFOWaitPolicy waitPolicy, std::string waitStateName){
+    std::vector<std::string> exprs;
+    if(waitPolicy != PartitionParams::FIFOWaitPolicy::SPIN){
+        exprs.push_back("vitis_fifo_wait_state_t " + waitStateName + " = VITIS_FIFO_WAIT_STATE_INIT;");
+    }
+    return exprs;
+}
+
+std::vector<std::string> MultiThreadEmit::waitOnFIFOs(PartitionParams::FIFOWaitPolicy waitPolicy, std::string waitStateName){
+    std::vector<std::string> exprs;
+    if(waitPolicy != PartitionParams::FIFOWaitPolicy::SPIN){
+        exprs.push_back("vitis_fifo_wait(&" + waitStateName + ");");
+    }
+    return exprs;
+}
+
+std::vector<std::string> MultiThreadEmit::doneWaitingOnFIFOs(PartitionParams::FIFOWaitPolicy waitPolicy, std::string waitStateName){
+    std::vector<std::string> exprs;
+    if(waitPolicy != PartitionParams::FIFOWaitPolicy::SPIN){
+        exprs.push_back("vitis_fifo_wait_done(&" + waitStateName + ");");
+    }
+    return exprs;
+}
+
+std::vector<std::string> MultiThreadEmit::wakeFIFOWaiters(PartitionParams::FIFOWaitPolicy waitPolicy){
+    std::vector<std::string> exprs;
+    if(waitPolicy == PartitionParams::FIFOWaitPolicy::FUTEX){
+        exprs.push_back("vitis_fifo_wake();");
+    }
+    return exprs;
+}
+
 //Version with scheduling
 //std::string MultiThreadEmit::emitFIFOChecks(std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos, int partition, bool checkFull, std::string checkVarName, bool shortCircuit){
 //    //create a map of nodes to parents
@@ -490,7 +569,8 @@ std::pair<std::string, std::string> MultiThreadEmit::getCThreadArgStructDefn(std
     return std::pair<std::string, std::string> (prototype, structureType);
 }
 
-std::string MultiThreadEmit::emitFIFOStructHeader(std::string path, std::string fileNamePrefix, std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos) {
+std::string MultiThreadEmit::emitFIFOStructHeader(std::string path, std::string fileNamePrefix, std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos,
+                                                  EmitterHelpers::ComplexLayout complexLayout) {
     std::string fileName = fileNamePrefix + "_fifoTypes";
     std::cout << "Emitting C File: " << path << "/" << fileName << ".h" << std::endl;
     //#### Emit .h file ####
@@ -503,9 +583,13 @@ std::string MultiThreadEmit::emitFIFOStructHeader(std::string path, std::string
     headerFile << "#include <stdint.h>" << std::endl;
     headerFile << "#include <stdbool.h>" << std::endl;
     headerFile << "#include \"" << VITIS_TYPE_NAME << ".h\"" << std::endl;
+    if(complexLayout == EmitterHelpers::ComplexLayout::PLANAR_ALIGNED){
+        //The planes are aligned to VITIS_MEM_ALIGNMENT
+        headerFile << "#include \"" << VITIS_PLATFORM_PARAMS_NAME << ".h\"" << std::endl;
+    }
 
     for(int i = 0; i<fifos.size(); i++){
-        std::string fifoStruct = fifos[i]->createFIFOStruct();
+        std::string fifoStruct = fifos[i]->createFIFOStruct(complexLayout);
         headerFile << fifoStruct << std::endl;
     }
 
@@ -515,7 +599,7 @@ std::string MultiThreadEmit::emitFIFOStructHeader(std::string path, std::string
     return fileName+".h";
 }
 
-std::string MultiThreadEmit::emitFIFOSupportFile(std::string path, std::string fileNamePrefix, std::set<ThreadCrossingFIFOParameters::CopyMode> copyModes) {
+std::string MultiThreadEmit::emitFIFOSupportFile(std::string path, std::string fileNamePrefix, std::set<ThreadCrossingFIFOParameters::CopyMode> copyModes, PartitionParams::FIFOWaitPolicy fifoWaitPolicy, int fifoWaitSpins) {
     bool shouldEmit = false;
 
     //Get the required header and body support from the FIFOs
@@ -580,6 +664,113 @@ std::string MultiThreadEmit::emitFIFOSupportFile(std::string path, std::string f
                 "}\n";
     }
 
+    std::string waitIncludes;
+    if(fifoWaitPolicy != PartitionParams::FIFOWaitPolicy::SPIN) {
+        shouldEmit = true;
+
+        headerContents +=
+                "\n"
+                "//==== FIFO Wait Policy: " + PartitionParams::fifoWaitPolicyToString(fifoWaitPolicy) + " ====\n"
+                "typedef struct{\n"
+                "    uint32_t attempts; //The number of failed FIFO checks since the thread started waiting\n"
+                "    uint32_t parkSeq; //The wake sequence number observed when the thread registered as parked\n"
+                "    bool parked; //True if the thread is registered as parked\n"
+                "} vitis_fifo_wait_state_t;\n"
+                "\n"
+                "#define VITIS_FIFO_WAIT_STATE_INIT {0, 0, false}\n";
+
+        if(fifoWaitPolicy == PartitionParams::FIFOWaitPolicy::SPIN_PAUSE) {
+            headerContents +=
+                    "\n"
+                    "static inline void vitis_fifo_wait(vitis_fifo_wait_state_t *state){\n"
+                    "    _mm_pause();\n"
+                    "}\n"
+                    "\n"
+                    "static inline void vitis_fifo_wait_done(vitis_fifo_wait_state_t *state){\n"
+                    "}\n";
+        }else if(fifoWaitPolicy == PartitionParams::FIFOWaitPolicy::BACKOFF) {
+            headerContents +=
+                    "\n"
+                    "#ifndef VITIS_FIFO_BACKOFF_MAX_SHIFT\n"
+                    "#define VITIS_FIFO_BACKOFF_MAX_SHIFT 10 //Up to 1024 pauses between FIFO checks\n"
+                    "#endif\n"
+                    "\n"
+                    "static inline void vitis_fifo_wait(vitis_fifo_wait_state_t *state){\n"
+                    "    uint32_t shift = state->attempts < VITIS_FIFO_BACKOFF_MAX_SHIFT ? state->attempts : VITIS_FIFO_BACKOFF_MAX_SHIFT;\n"
+                    "    uint32_t pauses = ((uint32_t) 1) << shift;\n"
+                    "    for(uint32_t i = 0; i<pauses; i++){\n"
+                    "        _mm_pause();\n"
+                    "    }\n"
+                    "    state->attempts = state->attempts < VITIS_FIFO_BACKOFF_MAX_SHIFT ? state->attempts+1 : VITIS_FIFO_BACKOFF_MAX_SHIFT;\n"
+                    "}\n"
+                    "\n"
+                    "static inline void vitis_fifo_wait_done(vitis_fifo_wait_state_t *state){\n"
+                    "    state->attempts = 0;\n"
+                    "}\n";
+        }else if(fifoWaitPolicy == PartitionParams::FIFOWaitPolicy::FUTEX) {
+            waitIncludes =
+                    "#include <stdatomic.h>\n"
+                    "#include <limits.h>\n"
+                    "#include <time.h>\n"
+                    "#include <unistd.h>\n"
+                    "#include <sys/syscall.h>\n"
+                    "#include <linux/futex.h>\n";
+
+            headerContents +=
+                    "\n"
+                    "#ifndef VITIS_FIFO_PARK_AFTER_SPINS\n"
+                    "#define VITIS_FIFO_PARK_AFTER_SPINS " + GeneralHelper::to_string(fifoWaitSpins) + "\n"
+                    "#endif\n"
+                    "\n"
+                    "#ifndef VITIS_FIFO_PARK_TIMEOUT_NS\n"
+                    "#define VITIS_FIFO_PARK_TIMEOUT_NS 100000 //Bounds the time between polls of external resources by the I/O thread\n"
+                    "#endif\n"
+                    "\n"
+                    "//Shared by all threads.  These are weak so that a single instance exists even though this header is included\n"
+                    "//by multiple translation units.  Each is placed on its own cache line since vitis_fifo_parked is read\n"
+                    "//by each thread every time it publishes FIFO updates\n"
+                    "_Atomic uint32_t vitis_fifo_wake_seq __attribute__((weak, aligned(64))) = 0;\n"
+                    "_Atomic int32_t vitis_fifo_parked __attribute__((weak, aligned(64))) = 0;\n"
+                    "\n"
+                    "static inline void vitis_fifo_wait(vitis_fifo_wait_state_t *state){\n"
+                    "    if(state->attempts < VITIS_FIFO_PARK_AFTER_SPINS){\n"
+                    "        state->attempts++;\n"
+                    "        _mm_pause();\n"
+                    "    }else if(!state->parked){\n"
+                    "        //Register as parked then return so that the FIFOs are checked again before sleeping.  Any thread\n"
+                    "        //publishing after the check will see this registration and advance the wake sequence\n"
+                    "        atomic_fetch_add_explicit(&vitis_fifo_parked, 1, memory_order_seq_cst);\n"
+                    "        state->parkSeq = atomic_load_explicit(&vitis_fifo_wake_seq, memory_order_seq_cst);\n"
+                    "        state->parked = true;\n"
+                    "    }else{\n"
+                    "        //Returns immediately if the wake sequence has advanced since it was last observed\n"
+                    "        struct timespec timeout = {0, VITIS_FIFO_PARK_TIMEOUT_NS};\n"
+                    "        syscall(SYS_futex, (uint32_t*) &vitis_fifo_wake_seq, FUTEX_WAIT_PRIVATE, state->parkSeq, &timeout, NULL, 0);\n"
+                    "        state->parkSeq = atomic_load_explicit(&vitis_fifo_wake_seq, memory_order_seq_cst);\n"
+                    "    }\n"
+                    "}\n"
+                    "\n"
+                    "static inline void vitis_fifo_wait_done(vitis_fifo_wait_state_t *state){\n"
+                    "    if(state->parked){\n"
+                    "        atomic_fetch_sub_explicit(&vitis_fifo_parked, 1, memory_order_relaxed);\n"
+                    "        state->parked = false;\n"
+                    "    }\n"
+                    "    state->attempts = 0;\n"
+                    "}\n"
+                    "\n"
+                    "static inline void vitis_fifo_wake(void){\n"
+                    "    //Orders the preceding FIFO updates before the check for parked threads (pairs with the registration in vitis_fifo_wait)\n"
+                    "    atomic_thread_fence(memory_order_seq_cst);\n"
+                    "    if(atomic_load_explicit(&vitis_fifo_parked, memory_order_relaxed) > 0){\n"
+                    "        atomic_fetch_add_explicit(&vitis_fifo_wake_seq, 1, memory_order_seq_cst);\n"
+                    "        syscall(SYS_futex, (uint32_t*) &vitis_fifo_wake_seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);\n"
+                    "    }\n"
+                    "}\n";
+        }else{
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown FIFO wait policy"));
+        }
+    }
+
     if(shouldEmit) {
         std::string fileName = fileNamePrefix + "_fifoSupport";
         std::cout << "Emitting C File: " << path << "/" << fileName << ".h" << std::endl;
@@ -593,6 +784,7 @@ std::string MultiThreadEmit::emitFIFOSupportFile(std::string path, std::string f
         headerFile << "#include <stdint.h>" << std::endl;
         headerFile << "#include <stdbool.h>" << std::endl;
         headerFile << "#include <immintrin.h>" << std::endl;
+        headerFile << waitIncludes;
         headerFile << "#include \"" << VITIS_TYPE_NAME << ".h\"" << std::endl;
 
         headerFile << headerContents << std::endl;
@@ -722,12 +914,14 @@ void MultiThreadEmit::emitMultiThreadedBenchmarkKernel(std::map<std::pair<int, i
     for(auto it = fifoMap.begin(); it != fifoMap.end(); it++){
         std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos = it->second;
         int srcPartition  = it->first.first;
-        int core = MultiThreadEmit::getCore(srcPartition, partitionMap);
+        int dstPartition  = it->first.second;
+        int producerCore = MultiThreadEmit::getCore(srcPartition, partitionMap);
+        int consumerCore = MultiThreadEmit::getCore(dstPartition, partitionMap);
 
         std::vector<std::string> statements;
         for(int i = 0; i<fifos.size(); i++){
 
-            fifos[i]->createSharedVariables(statements, core); //Note, if the CPU is -1, which occurs if no CPU map is provided (no thresd pinning is performed), the array is allocated on the CPU running the setup code
+            fifos[i]->createSharedVariables(statements, producerCore, consumerCore); //Note, if the CPU is -1, which occurs if no CPU map is provided (no thresd pinning is performed), the array is allocated on the CPU running the setup code
             fifos[i]->initializeSharedVariables(statements);
         }
 
@@ -1228,7 +1422,8 @@ void MultiThreadEmit::emitMultiThreadedMakefileMain(std::string path, std::strin
                                                               std::string ioBenchmarkSuffix, bool includeLrt,
                                                               std::vector<std::string> additionalSystemSrc,
                                                               bool includePAPI,
-                                                              bool enableBenchmarkSetAffinity) {
+                                                              bool enableBenchmarkSetAffinity,
+                                                              std::vector<std::string> additionalLibs) {
     //#### Emit Makefiles ####
 
     std::string systemSrcs = "";
@@ -1264,6 +1459,9 @@ void MultiThreadEmit::emitMultiThreadedMakefileMain(std::string path, std::strin
     if(includePAPI){
         makefileContent += "LIB+= -lpapi\n";
     }
+    for(int i = 0; i<additionalLibs.size(); i++){
+        makefileContent += "LIB+= " + additionalLibs[i] + "\n";
+    }
     makefileContent += "\n"
                        "DEFINES=\n"
                        "DEPENDS=\n";
@@ -1302,17 +1500,19 @@ void MultiThreadEmit::emitMultiThreadedMakefileMain(std::string path, std::strin
     makefile.close();
 }
 
-std::vector<std::string> MultiThreadEmit::getPartitionStateStructTypeDef(std::vector<Variable> partitionStateVars, int partitionNum){
+std::vector<std::string> MultiThreadEmit::getPartitionStateStructTypeDef(std::vector<Variable> partitionStateVars, int partitionNum,
+                                                                         EmitterHelpers::ComplexLayout complexLayout){
     std::vector<std::string> structDef;
 
     structDef.push_back("typedef struct{");
 
     for(unsigned long j = 0; j<partitionStateVars.size(); j++){
         //cFile << "_Thread_local static " << stateVars[j].getCVarDecl(false, true, true) << ";" << std::endl;
-        structDef.push_back(partitionStateVars[j].getCVarDecl(false, true, false, true, false, false) + ";");
+        std::string planeAlignment = EmitterHelpers::getPlaneAlignmentAttribute(complexLayout, partitionStateVars[j].getDataType());
+        structDef.push_back(partitionStateVars[j].getCVarDecl(false, true, false, true, false, false) + planeAlignment + ";");
 
         if(partitionStateVars[j].getDataType().isComplex()){
-            structDef.push_back(partitionStateVars[j].getCVarDecl(true, true, false, true, false, false) + ";");
+            structDef.push_back(partitionStateVars[j].getCVarDecl(true, true, false, true, false, false) + planeAlignment + ";");
         }
     }
 
@@ -1337,7 +1537,10 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
                                                      std::string telemDumpFilePrefix, bool telemAvg,
                                                      std::string papiHelperHeader,
                                                      PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
-                                                     ComputeIODoubleBufferType doubleBuffer){
+                                                     PartitionParams::FIFOWaitPolicy fifoWaitPolicy,
+                                                     ComputeIODoubleBufferType doubleBuffer, bool fifoEarlyPublish,
+                                                     EmitterHelpers::ComplexLayout complexLayout,
+                                                     std::ostream &statusOut){
     bool collectTelem = EmitterHelpers::shouldCollectTelemetry(telemLevel);
     bool collectPAPI = EmitterHelpers::usesPAPI(telemLevel);
     bool collectPAPIComputeOnly = EmitterHelpers::papiComputeOnly(telemLevel);
@@ -1363,6 +1566,19 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
         }
     }
 
+    if(fifoEarlyPublish){
+        if(!fifoInPlace && !(inputFIFOs.empty() && outputFIFOs.empty())){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Early publishing of FIFO reads/writes requires in-place FIFOs"));
+        }
+        if(doubleBuffer != ComputeIODoubleBufferType::NONE){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Early publishing of FIFO reads/writes is not supported with FIFO double buffering"));
+        }
+        if(collectBreakdownTelem || collectPAPIComputeOnly){
+            //The time spent waiting on and accessing the FIFOs is interleaved with the computation
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Early publishing of FIFO reads/writes is not supported with telemetry which is broken down by phase"));
+        }
+    }
+
     if(doubleBuffer != ComputeIODoubleBufferType::NONE && !fifoInPlace){
         //TODO: Possibly provide double buffer implementation without in-place FIFOs
         //      ie. by implementing the double buffering outside of the compute function
@@ -1371,7 +1587,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
 
 
     std::string fileName = fileNamePrefix+"_partition"+(partitionNum >= 0?GeneralHelper::to_string(partitionNum):"N"+GeneralHelper::to_string(-partitionNum));
-    std::cout << "Emitting C File: " << path << "/" << fileName << ".h" << std::endl;
+    statusOut << "Emitting C File: " << path << "/" << fileName << ".h" << std::endl;
     //#### Emit .h file ####
     std::ofstream headerFile;
     headerFile.open(path+"/"+fileName+".h", std::ofstream::out | std::ofstream::trunc);
@@ -1388,6 +1604,10 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
     includesHFile.insert("#include <pthread.h>");
     includesHFile.insert("#include \"" + std::string(VITIS_TYPE_NAME) + ".h\"");
     includesHFile.insert("#include \"" + fifoHeaderFile + "\"");
+    if(complexLayout == EmitterHelpers::ComplexLayout::PLANAR_ALIGNED){
+        //The planes of the state structure are aligned to VITIS_MEM_ALIGNMENT
+        includesHFile.insert("#include \"" + std::string(VITIS_PLATFORM_PARAMS_NAME) + ".h\"");
+    }
     if(!fifoSupportFile.empty()) {
         includesHFile.insert("#include \"" + fifoSupportFile + "\"");
     }
@@ -1437,7 +1657,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
     std::string stateStructTypeName = "";
     if(partitionHasState) {
         //Emit State Structure Definition
-        std::vector<std::string> structDefn = getPartitionStateStructTypeDef(stateVars, partitionNum);
+        std::vector<std::string> structDefn = getPartitionStateStructTypeDef(stateVars, partitionNum, complexLayout);
         for (int i = 0; i < structDefn.size(); i++) {
             headerFile << structDefn[i] << std::endl;
         }
@@ -1470,7 +1690,10 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
     std::string computeFctnName = designName + "_partition"+(partitionNum >= 0?GeneralHelper::to_string(partitionNum):"N"+GeneralHelper::to_string(-partitionNum)) + "_compute";
     std::string computeFctnProto = "void " + computeFctnName + "(" + computeFctnProtoArgs + ")";
 
-    headerFile << computeFctnProto << ";" << std::endl;
+    //When FIFO reads/writes are published early, the operators are emitted directly in the thread function (see below)
+    if(!fifoEarlyPublish) {
+        headerFile << computeFctnProto << ";" << std::endl;
+    }
 
     //Output the thread function definition
     std::string threadFctnDecl = "void* " + designName + "_partition" + (partitionNum >= 0?GeneralHelper::to_string(partitionNum):"N"+GeneralHelper::to_string(-partitionNum)) + "_thread(void *args)";
@@ -1501,7 +1724,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
 
     headerFile.close();
 
-    std::cout << "Emitting C File: " << path << "/" << fileName << ".c" << std::endl;
+    statusOut << "Emitting C File: " << path << "/" << fileName << ".c" << std::endl;
     //#### Emit .c file ####
     std::ofstream cFile;
     cFile.open(path+"/"+fileName+".c", std::ofstream::out | std::ofstream::trunc);
@@ -1582,63 +1805,23 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
     cFile << "//==== Functions ====" << std::endl;
 
     //Emit the compute function
+    if(!fifoEarlyPublish) {
+        cFile << computeFctnProto << "{" << std::endl;
 
-    cFile << computeFctnProto << "{" << std::endl;
-
-    //TODO: Create and set counter variables for clock domains not operating in vector mode
-    std::vector<std::shared_ptr<ClockDomain>> clockDomainsOrderedByRate;
-    clockDomainsOrderedByRate.insert(clockDomainsOrderedByRate.begin(), clockDomainsInPartition.begin(), clockDomainsInPartition.end());
-    struct {
-        bool operator() (const std::shared_ptr<ClockDomain> &a,
-                                   const std::shared_ptr<ClockDomain> &b) const {
-            std::pair<int, int> aRate = a->getRateRelativeToBase();
-            double aRateDouble = ((double) aRate.first) / aRate.second;
-            std::pair<int, int> bRate = b->getRateRelativeToBase();
-            double bRateDouble = ((double) aRate.first) / aRate.second;
-
-            if (aRateDouble == bRateDouble) {
-                return a->getId() < b->getId();
-            }
-            return aRateDouble < bRateDouble;
-        };
-    } clockDomainCompare;
-    std::sort(clockDomainsOrderedByRate.begin(), clockDomainsOrderedByRate.end(), clockDomainCompare);
+        emitPartitionComputeOps(cFile, nodesToEmit, clockDomainsInPartition, blockSizeBase, schedType, outputMaster);
 
-    bool emittedClockDomainInd = false;
-    for(const std::shared_ptr<ClockDomain> &clockDomain : clockDomainsOrderedByRate){
-        if(clockDomain->requiresDeclaringExecutionCount()){
-            Variable countVar = clockDomain->getExecutionCountVariable(blockSizeBase);
-            if(countVar.getDataType().isComplex()){
-                throw std::runtime_error(ErrorHelpers::genErrorStr("Clock Domain Count Var expected to be real"));
-            }
-
-            if(!emittedClockDomainInd){
-                cFile << "//Clock Domain Count Variables" << std::endl;
-                emittedClockDomainInd = true;
-            }
-
-            cFile << countVar.getCVarDecl(false, false, true) << ";" << std::endl;
+        //TODO: Fix FIFO double buffering. It was broken by inserting sub-blocking which changed the way clock domain
+        //      indexes were created and incremented.
+        //      See https://github.com/ucb-cyarp/vitis/issues/97
+        if(doubleBuffer != ComputeIODoubleBufferType::NONE){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Double Buffer FIFOs not currently supported after automated sub-blocking introduced.  See https://github.com/ucb-cyarp/vitis/issues/97"));
         }
-    }
-
-    //Emit operators
-    if(schedType == SchedParams::SchedType::TOPOLOGICAL_CONTEXT){
-        emitSelectOpsSchedStateUpdateContext(cFile, nodesToEmit, schedType, outputMaster);
-    }else{
-        throw std::runtime_error("Only TOPOLOGICAL_CONTEXT scheduler varient is supported for multi-threaded emit");
-    }
+    //    std::vector<std::string> dblBufferExprs = computeIODoubleBufferEmit(inputFIFOs, outputFIFOs, clkDomainRate,
+    //                                                                        getClkDomainIndVarName(clkDomainRate, true),
+    //                                                                        getClkDomainIndVarName(clkDomainRate, false), doubleBuffer);
 
-    //TODO: Fix FIFO double buffering. It was broken by inserting sub-blocking which changed the way clock domain
-    //      indexes were created and incremented.
-    //      See https://github.com/ucb-cyarp/vitis/issues/97
-    if(doubleBuffer != ComputeIODoubleBufferType::NONE){
-        throw std::runtime_error(ErrorHelpers::genErrorStr("Double Buffer FIFOs not currently supported after automated sub-blocking introduced.  See https://github.com/ucb-cyarp/vitis/issues/97"));
+        cFile << "}" << std::endl; //Close compute function
     }
-//    std::vector<std::string> dblBufferExprs = computeIODoubleBufferEmit(inputFIFOs, outputFIFOs, clkDomainRate,
-//                                                                        getClkDomainIndVarName(clkDomainRate, true),
-//                                                                        getClkDomainIndVarName(clkDomainRate, false), doubleBuffer);
-
-    cFile << "}" << std::endl; //Close compute function
 
     cFile << std::endl;
 
@@ -1796,6 +1979,10 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
         cFile << outputDoubleBufferEntries[i] << std::endl;
     }
 
+    //Statements run when the thread is about to spin on a FIFO check.  Publishes any FIFO reads/writes which have been
+    //deferred (ex. by batched commit FIFOs) so that other threads are not left waiting on them
+    std::vector<std::string> fifoStallFlush = flushFIFOsPendingCommits(inputFIFOs, outputFIFOs);
+
     //TODO: For double buffer, handle the initial load and store
     if(doubleBuffer == ComputeIODoubleBufferType::INPUT_AND_OUTPUT || doubleBuffer == ComputeIODoubleBufferType::INPUT) {
         cFile << std::endl;
@@ -1804,7 +1991,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
 
         //Need to initially read from the input FIFO without running compute
         //First, wait for input FIFOs
-        cFile << MultiThreadEmit::emitFIFOChecks(inputFIFOs, false, "inputFIFOsReady", false, true, false, fifoIndexCachingBehavior); //Include pthread_testcancel check
+        cFile << MultiThreadEmit::emitFIFOChecks(inputFIFOs, false, "inputFIFOsReady", false, true, false, fifoIndexCachingBehavior, fifoStallFlush, fifoWaitPolicy); //Include pthread_testcancel check
 
         //TODO: currently assumes inPlace FIFOs is true, modify if this changes in the future
         std::vector<std::string> readFIFOExprs = MultiThreadEmit::readFIFOsToTemps(inputFIFOs, false, false, false);
@@ -1839,7 +2026,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
         //The _prev value will be discarded in any case and will become the buffer where the next itteration's compute output will be written
 
         //First, wait for input FIFOs
-        cFile << MultiThreadEmit::emitFIFOChecks(inputFIFOs, false, "inputFIFOsReady", false, true, false, fifoIndexCachingBehavior); //Include pthread_testcancel check
+        cFile << MultiThreadEmit::emitFIFOChecks(inputFIFOs, false, "inputFIFOsReady", false, true, false, fifoIndexCachingBehavior, fifoStallFlush, fifoWaitPolicy); //Include pthread_testcancel check
 
         //Do not need to wait for output FIFOs since we are not actually writing into them
 
@@ -2047,8 +2234,10 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
         cFile << "asm volatile (\"\" ::: \"memory\"); //Stop Re-ordering of timer" << std::endl;
     }
 
-    //Check FIFO input FIFOs (will spin until ready)
-    cFile << MultiThreadEmit::emitFIFOChecks(inputFIFOs, false, "inputFIFOsReady", false, true, false, fifoIndexCachingBehavior); //Include pthread_testcancel check
+    //Check FIFO input FIFOs (will spin until ready).  When publishing early, each FIFO is checked just before it is used
+    if(!fifoEarlyPublish) {
+        cFile << MultiThreadEmit::emitFIFOChecks(inputFIFOs, false, "inputFIFOsReady", false, true, false, fifoIndexCachingBehavior, fifoStallFlush, fifoWaitPolicy); //Include pthread_testcancel check
+    }
 
     //This is a special case where the duration for this cycle is calculated later (after reporting).  That way,
     //each metric has undergone the same number of cycles
@@ -2065,7 +2254,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
     }
 
     //=== Check Write FIFO (for in-place)
-    if(fifoInPlace){
+    if(fifoInPlace && !fifoEarlyPublish){
         //Check output FIFOs (will spin until ready)
         if(threadDebugPrint) {
             cFile << "printf(\"Partition " + GeneralHelper::to_string(partitionNum) +
@@ -2079,7 +2268,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
             cFile << "asm volatile (\"\" ::: \"memory\"); //Stop Re-ordering of timer" << std::endl;
         }
 
-        cFile << MultiThreadEmit::emitFIFOChecks(outputFIFOs, true, "outputFIFOsReady", false, true, false, fifoIndexCachingBehavior); //Include pthread_testcancel check
+        cFile << MultiThreadEmit::emitFIFOChecks(outputFIFOs, true, "outputFIFOsReady", false, true, false, fifoIndexCachingBehavior, fifoStallFlush, fifoWaitPolicy); //Include pthread_testcancel check
 
         if(collectBreakdownTelem) {
             cFile << "timespec_t waitingForOutputFIFOsStop;" << std::endl;
@@ -2093,7 +2282,11 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
     }
 
     //=== Read FIFOs (and write for in-place) ===
-    if(fifoInPlace){
+    if(fifoEarlyPublish){
+        if(collectTelem){
+            cFile << "rxSamples += " << blockSizeBase << ";" << std::endl;
+        }
+    }else if(fifoInPlace){
         //Need to do both FIFO read (get read ptr) and FIFO write
         std::vector<std::string> readFIFOExprs = MultiThreadEmit::readFIFOsToTemps(inputFIFOs, false, false, false);
         for (int i = 0; i < readFIFOExprs.size(); i++) {
@@ -2162,20 +2355,54 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
         cFile << "asm volatile (\"\" ::: \"memory\"); //Stop Re-ordering of PAPI reset" << std::endl;
     }
 
-    //Call compute function (recall that the compute function is declared with outputs as references)
-    std::string stateArg = "";
-    if(partitionHasState){
-        stateArg = std::string("&") + VITIS_STATE_STRUCT_NAME;
-    }
-    std::string call = getCallPartitionComputeCFunction(computeFctnName, inputFIFOs, outputFIFOs, fifoInPlace,
-                                                        stateArg, doubleBuffer,
-                                                        "_readTmp",
-                                                        "_writeTmp",
-                                                        "_next",
-                                                        "_current",
-                                                        "_current",
-                                                        "_prev");
-    cFile << call << std::endl;
+    if(fifoEarlyPublish){
+        //Emit the operators directly with the FIFO accesses interleaved.  Locals with the names used in the compute
+        //function are declared which point to the state structure and FIFO buffers
+        std::map<std::shared_ptr<Node>, std::vector<std::string>> statementsBeforeNode;
+        std::map<std::shared_ptr<Node>, std::vector<std::string>> statementsAfterNode;
+        std::vector<std::string> blockStartStatements;
+        std::vector<std::string> blockEndStatements;
+        getEarlyPublishFIFOStatements(nodesToEmit, inputFIFOs, outputFIFOs, fifoIndexCachingBehavior, fifoStallFlush,
+                                      fifoWaitPolicy, statementsBeforeNode, statementsAfterNode,
+                                      blockStartStatements, blockEndStatements);
+
+        cFile << "{" << std::endl;
+        if(partitionHasState){
+            //The pointer to the state structure shadows the state structure in a nested scope
+            cFile << stateStructTypeName << " *" << VITIS_STATE_STRUCT_NAME << "_ptr = &" << VITIS_STATE_STRUCT_NAME << ";" << std::endl;
+            cFile << "{" << std::endl;
+            cFile << stateStructTypeName << " *" << VITIS_STATE_STRUCT_NAME << " = " << VITIS_STATE_STRUCT_NAME << "_ptr;" << std::endl;
+        }
+        for(const std::string &statement : blockStartStatements){
+            cFile << statement << std::endl;
+        }
+
+        emitPartitionComputeOps(cFile, nodesToEmit, clockDomainsInPartition, blockSizeBase, schedType, outputMaster,
+                                statementsBeforeNode, statementsAfterNode);
+
+        for(const std::string &statement : blockEndStatements){
+            cFile << statement << std::endl;
+        }
+        if(partitionHasState){
+            cFile << "}" << std::endl;
+        }
+        cFile << "}" << std::endl;
+    }else {
+        //Call compute function (recall that the compute function is declared with outputs as references)
+        std::string stateArg = "";
+        if (partitionHasState) {
+            stateArg = std::string("&") + VITIS_STATE_STRUCT_NAME;
+        }
+        std::string call = getCallPartitionComputeCFunction(computeFctnName, inputFIFOs, outputFIFOs, fifoInPlace,
+                                                            stateArg, doubleBuffer,
+                                                            "_readTmp",
+                                                            "_writeTmp",
+                                                            "_next",
+                                                            "_current",
+                                                            "_current",
+                                                            "_prev");
+        cFile << call << std::endl;
+    }
 
     //If collecting the telemetry breakdown, do this
     if(collectBreakdownTelem) {
@@ -2228,7 +2455,7 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
             cFile << "asm volatile (\"\" ::: \"memory\"); //Stop Re-ordering of timer" << std::endl;
         }
 
-        cFile << MultiThreadEmit::emitFIFOChecks(outputFIFOs, true, "outputFIFOsReady", false, true, false, fifoIndexCachingBehavior); //Include pthread_testcancel check
+        cFile << MultiThreadEmit::emitFIFOChecks(outputFIFOs, true, "outputFIFOsReady", false, true, false, fifoIndexCachingBehavior, fifoStallFlush, fifoWaitPolicy); //Include pthread_testcancel check
 
         if(collectBreakdownTelem) {
             cFile << "timespec_t waitingForOutputFIFOsStop;" << std::endl;
@@ -2277,8 +2504,8 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
         }
     }
 
-    //==== If in-place, push the updates to the FIFOs here ====
-    if(fifoInPlace){
+    //==== If in-place, push the updates to the FIFOs here (already pushed if publishing early) ====
+    if(fifoInPlace && !fifoEarlyPublish){
         std::vector<std::string> readStatePush = pushReadFIFOsStatus(inputFIFOs);
         for (int i = 0; i < readStatePush.size(); i++) {
             cFile << readStatePush[i] << std::endl;
@@ -2290,6 +2517,12 @@ void MultiThreadEmit::emitPartitionThreadC(int partitionNum, std::vector<std::sh
         }
     }
 
+    //Wake any threads parked on the FIFOs updated in this iteration
+    std::vector<std::string> wakeStatements = wakeFIFOWaiters(fifoWaitPolicy);
+    for (int i = 0; i < wakeStatements.size(); i++) {
+        cFile << wakeStatements[i] << std::endl;
+    }
+
     //Swap double buffer arrays here
     if(doubleBuffer != ComputeIODoubleBufferType::NONE){
         cFile << "//Swap Double Buffer Ptrs" << std::endl;
@@ -2851,7 +3084,202 @@ std::vector<std::string> MultiThreadEmit::computeIODoubleBufferEmit(
 }
 
 //NOTE: if scheduling the output master is desired, it must be included in the nodes to emit
-void MultiThreadEmit::emitSelectOpsSchedStateUpdateContext(std::ofstream &cFile, std::vector<std::shared_ptr<Node>> &nodesToEmit, SchedParams::SchedType schedType, std::shared_ptr<MasterOutput> outputMaster){
+void MultiThreadEmit::emitPartitionComputeOps(std::ofstream &cFile, std::vector<std::shared_ptr<Node>> &nodesToEmit,
+                                              std::set<std::shared_ptr<ClockDomain>> clockDomainsInPartition,
+                                              unsigned long blockSizeBase, SchedParams::SchedType schedType,
+                                              std::shared_ptr<MasterOutput> outputMaster,
+                                              const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode,
+                                              const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode){
+    //TODO: Create and set counter variables for clock domains not operating in vector mode
+    std::vector<std::shared_ptr<ClockDomain>> clockDomainsOrderedByRate;
+    clockDomainsOrderedByRate.insert(clockDomainsOrderedByRate.begin(), clockDomainsInPartition.begin(), clockDomainsInPartition.end());
+    struct {
+        bool operator() (const std::shared_ptr<ClockDomain> &a,
+                                   const std::shared_ptr<ClockDomain> &b) const {
+            std::pair<int, int> aRate = a->getRateRelativeToBase();
+            double aRateDouble = ((double) aRate.first) / aRate.second;
+            std::pair<int, int> bRate = b->getRateRelativeToBase();
+            double bRateDouble = ((double) bRate.first) / bRate.second;
+
+            if (aRateDouble == bRateDouble) {
+                return a->getId() < b->getId();
+            }
+            return aRateDouble < bRateDouble;
+        };
+    } clockDomainCompare;
+    std::sort(clockDomainsOrderedByRate.begin(), clockDomainsOrderedByRate.end(), clockDomainCompare);
+
+    bool emittedClockDomainInd = false;
+    for(const std::shared_ptr<ClockDomain> &clockDomain : clockDomainsOrderedByRate){
+        if(clockDomain->requiresDeclaringExecutionCount()){
+            Variable countVar = clockDomain->getExecutionCountVariable(blockSizeBase);
+            if(countVar.getDataType().isComplex()){
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Clock Domain Count Var expected to be real"));
+            }
+
+            if(!emittedClockDomainInd){
+                cFile << "//Clock Domain Count Variables" << std::endl;
+                emittedClockDomainInd = true;
+            }
+
+            cFile << countVar.getCVarDecl(false, false, true) << ";" << std::endl;
+        }
+    }
+
+    //Emit operators
+    if(schedType == SchedParams::SchedType::TOPOLOGICAL_CONTEXT){
+        emitSelectOpsSchedStateUpdateContext(cFile, nodesToEmit, schedType, outputMaster, statementsBeforeNode, statementsAfterNode);
+    }else{
+        throw std::runtime_error("Only TOPOLOGICAL_CONTEXT scheduler varient is supported for multi-threaded emit");
+    }
+}
+
+void MultiThreadEmit::getEarlyPublishFIFOStatements(std::vector<std::shared_ptr<Node>> &nodesToEmit,
+                                                    std::vector<std::shared_ptr<ThreadCrossingFIFO>> inputFIFOs,
+                                                    std::vector<std::shared_ptr<ThreadCrossingFIFO>> outputFIFOs,
+                                                    PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                                                    std::vector<std::string> stallStatements,
+                                                    PartitionParams::FIFOWaitPolicy fifoWaitPolicy,
+                                                    std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode,
+                                                    std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode,
+                                                    std::vector<std::string> &blockStartStatements,
+                                                    std::vector<std::string> &blockEndStatements){
+    //Declares a local, with the name of a compute function argument, which points to the FIFO buffer.  Array arguments
+    //are declared as a pointer to their first element (which is what the argument decays to) and scalar outputs are
+    //declared as a pointer (as they are in the compute function).  Scalar inputs are passed by value
+    auto getBufferLocalDecl = [](Variable var, bool imag, bool isInput, std::string buffer) -> std::string{
+        var.setAtomicVar(false);
+        DataType dataType = var.getDataType();
+        std::string typeName = dataType.getCPUStorageType().toString(DataType::StringStyle::C, false, false);
+        std::string decl = isInput ? "const " + typeName + " " : typeName + " ";
+        if(dataType.isScalar()){
+            decl += (isInput ? "" : "*") + var.getCVarName(imag, false, false);
+        }else{
+            std::vector<int> dimensions = dataType.getDimensions();
+            if(dimensions.size() == 1){
+                decl += "*" + var.getCVarName(imag, false, false);
+            }else{
+                decl += "(*" + var.getCVarName(imag, false, false) + ")";
+                for(unsigned long i = 1; i<dimensions.size(); i++){
+                    decl += "[" + GeneralHelper::to_string(dimensions[i]) + "]";
+                }
+            }
+        }
+        return decl + " = " + buffer + ";";
+    };
+
+    //Only nodes which are scheduled are emitted
+    std::set<std::shared_ptr<Node>> scheduledNodes;
+    for(const std::shared_ptr<Node> &node : nodesToEmit){
+        if(node->getSchedOrder() >= 0){
+            scheduledNodes.insert(node);
+        }
+    }
+
+    //==== Input FIFOs ====
+    for(const std::shared_ptr<ThreadCrossingFIFO> &fifo : inputFIFOs){
+        std::set<std::shared_ptr<Node>> consumers;
+        std::set<std::shared_ptr<ContextRoot>> consumerContextRoots;
+        std::set<std::shared_ptr<Arc>> outputArcs = fifo->getOutputArcs();
+        for(const std::shared_ptr<Arc> &arc : outputArcs){
+            std::shared_ptr<Node> dst = arc->getDstPort()->getParent();
+            consumers.insert(dst);
+
+            //The context conditions of a context root can reference its inputs
+            std::shared_ptr<ContextRoot> dstAsContextRoot = std::dynamic_pointer_cast<ContextRoot>(dst);
+            if(dstAsContextRoot){
+                consumerContextRoots.insert(dstAsContextRoot);
+            }
+        }
+
+        std::shared_ptr<Node> firstAccess = nullptr;
+        std::shared_ptr<Node> lastAccess = nullptr;
+        for(const std::shared_ptr<Node> &node : scheduledNodes){
+            bool accessesFIFO = consumers.find(node) != consumers.end();
+            if(!accessesFIFO && !consumerContextRoots.empty()){
+                std::vector<Context> nodeContext = node->getContext();
+                for(const Context &context : nodeContext){
+                    if(consumerContextRoots.find(context.getContextRoot()) != consumerContextRoots.end()){
+                        accessesFIFO = true;
+                        break;
+                    }
+                }
+            }
+
+            if(accessesFIFO){
+                if(firstAccess == nullptr || Node::lessThanSchedOrder(node, firstAccess)){
+                    firstAccess = node;
+                }
+                if(lastAccess == nullptr || Node::lessThanSchedOrder(lastAccess, node)){
+                    lastAccess = node;
+                }
+            }
+        }
+
+        std::vector<std::string> acquireStatements;
+        std::vector<std::string> releaseStatements;
+        acquireStatements.push_back("//Acquire Input FIFO: " + fifo->getName());
+        acquireStatements.push_back(emitFIFOChecks({fifo}, false, fifo->getName() + "_inputFIFOReady", false, true, false, fifoIndexCachingBehavior, stallStatements, fifoWaitPolicy));
+        std::vector<std::string> readFIFOExprs = readFIFOsToTemps({fifo}, false, false, false);
+        acquireStatements.insert(acquireStatements.end(), readFIFOExprs.begin(), readFIFOExprs.end());
+
+        //Point the compute function arguments to the FIFO buffer
+        releaseStatements.push_back("//Release Input FIFO: " + fifo->getName());
+        for(unsigned long portNum = 0; portNum < fifo->getInputPorts().size(); portNum++){
+            Variable var = fifo->getCStateVarExpandedForBlockSize(portNum);
+            std::string bufferName = fifo->getName() + "_readTmp->port" + GeneralHelper::to_string(portNum);
+
+            acquireStatements.push_back(getBufferLocalDecl(var, false, true, bufferName + "_real"));
+            if(var.getDataType().isComplex()){
+                acquireStatements.push_back(getBufferLocalDecl(var, true, true, bufferName + "_imag"));
+            }
+        }
+        std::vector<std::string> readStatePush = pushReadFIFOsStatus({fifo});
+        releaseStatements.insert(releaseStatements.end(), readStatePush.begin(), readStatePush.end());
+
+        std::vector<std::string> &acquireDst = firstAccess ? statementsBeforeNode[firstAccess] : blockStartStatements;
+        acquireDst.insert(acquireDst.end(), acquireStatements.begin(), acquireStatements.end());
+        std::vector<std::string> &releaseDst = lastAccess ? statementsAfterNode[lastAccess] : blockEndStatements;
+        releaseDst.insert(releaseDst.end(), releaseStatements.begin(), releaseStatements.end());
+    }
+
+    //==== Output FIFOs ====
+    for(const std::shared_ptr<ThreadCrossingFIFO> &fifo : outputFIFOs){
+        //The FIFO node is scheduled in the source partition and copies its inputs into the FIFO buffer
+        bool fifoScheduled = scheduledNodes.find(fifo) != scheduledNodes.end();
+
+        std::vector<std::string> acquireStatements;
+        std::vector<std::string> releaseStatements;
+        acquireStatements.push_back("//Acquire Output FIFO: " + fifo->getName());
+        acquireStatements.push_back(emitFIFOChecks({fifo}, true, fifo->getName() + "_outputFIFOReady", false, true, false, fifoIndexCachingBehavior, stallStatements, fifoWaitPolicy));
+        std::vector<std::string> writeFIFOExprs = writeFIFOsFromTemps({fifo}, false, false, false);
+        acquireStatements.insert(acquireStatements.end(), writeFIFOExprs.begin(), writeFIFOExprs.end());
+
+        //Point the compute function arguments to the FIFO buffer.  Scalar outputs are passed as pointers
+        releaseStatements.push_back("//Publish Output FIFO: " + fifo->getName());
+        for(unsigned long portNum = 0; portNum < fifo->getInputPorts().size(); portNum++){
+            Variable var = fifo->getCStateInputVarExpandedForBlockSize(portNum);
+            DataType fifoDataType = fifo->getCStateVarExpandedForBlockSize(portNum).getDataType();
+            std::string bufferName = (fifoDataType.numberOfElements() == 1 ? "&" : "") + fifo->getName() + "_writeTmp->port" + GeneralHelper::to_string(portNum);
+
+            acquireStatements.push_back(getBufferLocalDecl(var, false, false, bufferName + "_real"));
+            if(fifoDataType.isComplex()){
+                acquireStatements.push_back(getBufferLocalDecl(var, true, false, bufferName + "_imag"));
+            }
+        }
+        std::vector<std::string> writeStatePush = pushWriteFIFOsStatus({fifo});
+        releaseStatements.insert(releaseStatements.end(), writeStatePush.begin(), writeStatePush.end());
+
+        std::vector<std::string> &acquireDst = fifoScheduled ? statementsBeforeNode[fifo] : blockStartStatements;
+        acquireDst.insert(acquireDst.end(), acquireStatements.begin(), acquireStatements.end());
+        std::vector<std::string> &releaseDst = fifoScheduled ? statementsAfterNode[fifo] : blockEndStatements;
+        releaseDst.insert(releaseDst.end(), releaseStatements.begin(), releaseStatements.end());
+    }
+}
+
+void MultiThreadEmit::emitSelectOpsSchedStateUpdateContext(std::ofstream &cFile, std::vector<std::shared_ptr<Node>> &nodesToEmit, SchedParams::SchedType schedType, std::shared_ptr<MasterOutput> outputMaster,
+                                                           const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode,
+                                                           const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode){
 
     cFile << std::endl << "//==== Compute Operators ====" << std::endl;
 
@@ -2867,7 +3295,7 @@ void MultiThreadEmit::emitSelectOpsSchedStateUpdateContext(std::ofstream &cFile,
     std::vector<std::shared_ptr<Node>> toBeEmittedInThisOrder;
     std::copy(schedIt, orderedNodes.end(), std::back_inserter(toBeEmittedInThisOrder));
 
-    EmitterHelpers::emitOpsStateUpdateContext(cFile, schedType, toBeEmittedInThisOrder, outputMaster);
+    EmitterHelpers::emitOpsStateUpdateContext(cFile, schedType, toBeEmittedInThisOrder, outputMaster, true, statementsBeforeNode, statementsAfterNode);
 }
 
 bool MultiThreadEmit::checkNoNodesInIO(std::vector<std::shared_ptr<Node>> nodes) {
@@ -2959,7 +3387,7 @@ void MultiThreadEmit::writePlatformParameters(std::string path, std::string file
     headerFile.close();
 }
 
-void MultiThreadEmit::writeNUMAAllocHelperFiles(std::string path, std::string filename){
+void MultiThreadEmit::writeNUMAAllocHelperFiles(std::string path, std::string filename, PartitionParams::NUMAAllocPolicy numaAllocPolicy){
     std::cout << "Emitting C File: " << path << "/" << filename << ".h" << std::endl;
 
     std::ofstream headerFile;
@@ -2979,6 +3407,40 @@ void MultiThreadEmit::writeNUMAAllocHelperFiles(std::string path, std::string fi
     headerFile << "void* vitis_aligned_alloc_core(size_t alignment, size_t size, int core);" << std::endl;
     headerFile << "void* vitis_aligned_alloc(size_t alignment, size_t size);" << std::endl;
 
+    //The policy can be overridden when compiling by defining VITIS_NUMA_ALLOC_POLICY
+    int policyNum;
+    switch(numaAllocPolicy){
+        case PartitionParams::NUMAAllocPolicy::BIND:
+            policyNum = 1;
+            break;
+        case PartitionParams::NUMAAllocPolicy::BIND_THP:
+            policyNum = 2;
+            break;
+        case PartitionParams::NUMAAllocPolicy::BIND_HUGETLB:
+            policyNum = 3;
+            break;
+        default:
+            policyNum = 0;
+            break;
+    }
+    headerFile << std::endl;
+    headerFile << "//Policy used by vitis_large_alloc_core (" << PartitionParams::numaAllocPolicyToString(numaAllocPolicy) << ")" << std::endl;
+    headerFile << "#define VITIS_NUMA_ALLOC_POLICY_FIRST_TOUCH 0" << std::endl;
+    headerFile << "#define VITIS_NUMA_ALLOC_POLICY_BIND 1" << std::endl;
+    headerFile << "#define VITIS_NUMA_ALLOC_POLICY_BIND_THP 2" << std::endl;
+    headerFile << "#define VITIS_NUMA_ALLOC_POLICY_BIND_HUGETLB 3" << std::endl;
+    headerFile << "#ifndef VITIS_NUMA_ALLOC_POLICY" << std::endl;
+    headerFile << "#define VITIS_NUMA_ALLOC_POLICY " << policyNum << std::endl;
+    headerFile << "#endif" << std::endl;
+    headerFile << "#ifndef VITIS_HUGE_PAGE_SIZE" << std::endl;
+    headerFile << "#define VITIS_HUGE_PAGE_SIZE (2*1024*1024)" << std::endl;
+    headerFile << "#endif" << std::endl;
+    headerFile << "//Allocates a large buffer (ex. a FIFO array) which is accessed from the given core (-1 if threads are not pinned).  Must be freed with vitis_large_free" << std::endl;
+    headerFile << "void* vitis_large_alloc_core(size_t alignment, size_t size, int core);" << std::endl;
+    headerFile << "//Allocates a large buffer with its pages interleaved across the NUMA nodes of the two cores.  Must be freed with vitis_large_free" << std::endl;
+    headerFile << "void* vitis_large_alloc_interleaved(size_t alignment, size_t size, int coreA, int coreB);" << std::endl;
+    headerFile << "void vitis_large_free(void* ptr, size_t size);" << std::endl;
+
     headerFile << "#endif" << std::endl;
     headerFile.close();
 
@@ -2993,6 +3455,9 @@ void MultiThreadEmit::writeNUMAAllocHelperFiles(std::string path, std::string fi
     cFile << "#include <sched.h>" << std::endl;
     cFile << "#include <unistd.h>" << std::endl;
     cFile << "#include <pthread.h>" << std::endl;
+    cFile << "#include <dirent.h>" << std::endl;
+    cFile << "#include <sys/mman.h>" << std::endl;
+    cFile << "#include <sys/syscall.h>" << std::endl;
 
     cFile << "typedef struct{\n"
              "    size_t size;\n"
@@ -3032,6 +3497,18 @@ void MultiThreadEmit::writeNUMAAllocHelperFiles(std::string path, std::string fi
              "    return ptr;\n"
              "}\n"
              "\n"
+             "void* vitis_large_alloc_core(size_t alignment, size_t size, int core){\n"
+             "    return vitis_aligned_alloc(alignment, size);\n"
+             "}\n"
+             "\n"
+             "void* vitis_large_alloc_interleaved(size_t alignment, size_t size, int coreA, int coreB){\n"
+             "    return vitis_aligned_alloc(alignment, size);\n"
+             "}\n"
+             "\n"
+             "void vitis_large_free(void* ptr, size_t size){\n"
+             "    free(ptr);\n"
+             "}\n"
+             "\n"
              "#else\n"
              "    //Worker Threads\n"
              "    void* vitis_malloc_core_thread(void* arg_uncast){\n"
@@ -3229,6 +3706,266 @@ void MultiThreadEmit::writeNUMAAllocHelperFiles(std::string path, std::string fi
              "        void* rtnVal = aligned_alloc(alignment, allocSize);\n"
              "        return rtnVal;\n"
              "}\n"
+             "\n"
+             "    void* vitis_run_on_core(void* (*fctn)(void*), void* arg, int core){\n"
+             "        cpu_set_t cpuset;\n"
+             "        pthread_t thread;\n"
+             "        pthread_attr_t attr;\n"
+             "        void *res;\n"
+             "\n"
+             "        int status;\n"
+             "\n"
+             "        //Create pthread attributes\n"
+             "        status = pthread_attr_init(&attr);\n"
+             "        if(status != 0)\n"
+             "        {\n"
+             "            printf(\"Could not create pthread attributes for run_on_core ... exiting\\n\");\n"
+             "            exit(1);\n"
+             "        }\n"
+             "\n"
+             "        //Set CPU affinity\n"
+             "        CPU_ZERO(&cpuset);\n"
+             "        CPU_SET(core, &cpuset);\n"
+             "        status = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpuset);\n"
+             "        if(status != 0)\n"
+             "        {\n"
+             "            printf(\"Could not set thread core affinity for run_on_core ... exiting\\n\");\n"
+             "            exit(1);\n"
+             "        }\n"
+             "\n"
+             "        status = pthread_create(&thread, &attr, fctn, arg);\n"
+             "        if(status != 0)\n"
+             "        {\n"
+             "            printf(\"Could not create a thread for run_on_core ... exiting\\n\");\n"
+             "            perror(NULL);\n"
+             "            exit(1);\n"
+             "        }\n"
+             "\n"
+             "        //Wait for thread to finish\n"
+             "        status = pthread_join(thread, &res);\n"
+             "        if(status != 0)\n"
+             "        {\n"
+             "            printf(\"Could not join a thread for run_on_core ... exiting\\n\");\n"
+             "            perror(NULL);\n"
+             "            exit(1);\n"
+             "        }\n"
+             "\n"
+             "        return res;\n"
+             "    }\n"
+             "//==== Large Buffer Allocation ====\n"
+             "//Used for large shared buffers (ex. FIFO arrays).  See VITIS_NUMA_ALLOC_POLICY\n"
+             "    typedef struct{\n"
+             "        char* ptr;\n"
+             "        size_t size;\n"
+             "        size_t pageSize;\n"
+             "        size_t firstPage;\n"
+             "        size_t pageStride;\n"
+             "    } vitis_prefault_args_t;\n"
+             "\n"
+             "    //Touches every pageStride-th page of the buffer starting at firstPage\n"
+             "    void* vitis_prefault_thread(void* arg_uncast){\n"
+             "        vitis_prefault_args_t* arg = (vitis_prefault_args_t*) arg_uncast;\n"
+             "        for(size_t offset = arg->firstPage*arg->pageSize; offset < arg->size; offset += arg->pageStride*arg->pageSize){\n"
+             "            size_t len = arg->size-offset < arg->pageSize ? arg->size-offset : arg->pageSize;\n"
+             "            memset(arg->ptr+offset, 0, len);\n"
+             "        }\n"
+             "        return NULL;\n"
+             "    }\n"
+             "\n"
+             "    //Pre-faults the buffer with consecutive pages touched by each of the cores in turn.  Pages which are not bound are\n"
+             "    //placed on the NUMA node of the core which touches them first.  A core of -1 touches pages from the calling thread\n"
+             "    void vitis_prefault_interleaved(void* ptr, size_t size, int* cores, int numCores){\n"
+             "        size_t pageSize = sysconf(_SC_PAGESIZE);\n"
+             "        for(int i = 0; i<numCores; i++){\n"
+             "            vitis_prefault_args_t prefaultArgs;\n"
+             "            prefaultArgs.ptr = (char*) ptr;\n"
+             "            prefaultArgs.size = size;\n"
+             "            prefaultArgs.pageSize = pageSize;\n"
+             "            prefaultArgs.firstPage = i;\n"
+             "            prefaultArgs.pageStride = numCores;\n"
+             "            if(cores[i] >= 0){\n"
+             "                vitis_run_on_core(vitis_prefault_thread, &prefaultArgs, cores[i]);\n"
+             "            }else{\n"
+             "                vitis_prefault_thread(&prefaultArgs);\n"
+             "            }\n"
+             "        }\n"
+             "    }\n"
+             "\n"
+             "#if VITIS_NUMA_ALLOC_POLICY != VITIS_NUMA_ALLOC_POLICY_FIRST_TOUCH\n"
+             "    //From numaif.h (not included to avoid requiring libnuma)\n"
+             "    #define VITIS_MPOL_BIND 2\n"
+             "    #define VITIS_MPOL_INTERLEAVE 3\n"
+             "    #define VITIS_MPOL_MF_MOVE (1<<1)\n"
+             "    #define VITIS_NUMA_MAX_NODES 1024\n"
+             "\n"
+             "    size_t vitis_large_alloc_mapped_size(size_t size){\n"
+             "        size_t pageSize = sysconf(_SC_PAGESIZE);\n"
+             "        #if VITIS_NUMA_ALLOC_POLICY != VITIS_NUMA_ALLOC_POLICY_BIND\n"
+             "        if(size >= VITIS_HUGE_PAGE_SIZE){\n"
+             "            pageSize = VITIS_HUGE_PAGE_SIZE;\n"
+             "        }\n"
+             "        #endif\n"
+             "        return size + (size%pageSize == 0 ? 0 : pageSize-(size%pageSize));\n"
+             "    }\n"
+             "\n"
+             "    int vitis_numa_node_of_core(int core){\n"
+             "        //The cpu directory in sysfs contains a link to the node the cpu belongs to\n"
+             "        char path[64];\n"
+             "        snprintf(path, sizeof(path), \"/sys/devices/system/cpu/cpu%d\", core);\n"
+             "        DIR* dir = opendir(path);\n"
+             "        if(dir == NULL){\n"
+             "            return -1;\n"
+             "        }\n"
+             "\n"
+             "        int node = -1;\n"
+             "        struct dirent* entry;\n"
+             "        while((entry = readdir(dir)) != NULL){\n"
+             "            if(strncmp(entry->d_name, \"node\", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9'){\n"
+             "                node = atoi(entry->d_name+4);\n"
+             "                break;\n"
+             "            }\n"
+             "        }\n"
+             "        closedir(dir);\n"
+             "\n"
+             "        return node;\n"
+             "    }\n"
+             "\n"
+             "    //Maps (but does not fault in) a buffer of mappedSize bytes, using huge pages if requested by the policy\n"
+             "    void* vitis_large_alloc_map(size_t alignment, size_t mappedSize){\n"
+             "        if(alignment > (size_t) sysconf(_SC_PAGESIZE)){\n"
+             "            printf(\"Large allocations cannot be aligned to more than the page size ... exiting\\n\");\n"
+             "            exit(1);\n"
+             "        }\n"
+             "\n"
+             "        void* ptr = MAP_FAILED;\n"
+             "        #if VITIS_NUMA_ALLOC_POLICY == VITIS_NUMA_ALLOC_POLICY_BIND_HUGETLB\n"
+             "        if(mappedSize >= VITIS_HUGE_PAGE_SIZE){\n"
+             "            ptr = mmap(NULL, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);\n"
+             "            if(ptr == MAP_FAILED){\n"
+             "                printf(\"Warning: Unable to map huge pages (check /proc/sys/vm/nr_hugepages), using transparent huge pages\\n\");\n"
+             "            }\n"
+             "        }\n"
+             "        #endif\n"
+             "\n"
+             "        if(ptr == MAP_FAILED){\n"
+             "            ptr = mmap(NULL, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);\n"
+             "            if(ptr == MAP_FAILED){\n"
+             "                return NULL;\n"
+             "            }\n"
+             "\n"
+             "            #if VITIS_NUMA_ALLOC_POLICY != VITIS_NUMA_ALLOC_POLICY_BIND\n"
+             "            if(mappedSize >= VITIS_HUGE_PAGE_SIZE){\n"
+             "                //Only advice, the kernel may not provide huge pages\n"
+             "                madvise(ptr, mappedSize, MADV_HUGEPAGE);\n"
+             "            }\n"
+             "            #endif\n"
+             "        }\n"
+             "\n"
+             "        return ptr;\n"
+             "    }\n"
+             "\n"
+             "    //Applies the memory policy (mode) over the given NUMA nodes to the mapped buffer.  Returns true on success\n"
+             "    bool vitis_large_alloc_bind(void* ptr, size_t mappedSize, int mode, int* nodes, int numNodes){\n"
+             "        #ifdef SYS_mbind\n"
+             "        unsigned long nodeMask[VITIS_NUMA_MAX_NODES/(8*sizeof(unsigned long))];\n"
+             "        memset(nodeMask, 0, sizeof(nodeMask));\n"
+             "        for(int i = 0; i<numNodes; i++){\n"
+             "            if(nodes[i] < 0 || nodes[i] >= VITIS_NUMA_MAX_NODES-1){\n"
+             "                return false;\n"
+             "            }\n"
+             "            nodeMask[nodes[i]/(8*sizeof(unsigned long))] |= 1UL << (nodes[i]%(8*sizeof(unsigned long)));\n"
+             "        }\n"
+             "        return syscall(SYS_mbind, ptr, mappedSize, mode, nodeMask, VITIS_NUMA_MAX_NODES, VITIS_MPOL_MF_MOVE) == 0;\n"
+             "        #else\n"
+             "        return false;\n"
+             "        #endif\n"
+             "    }\n"
+             "\n"
+             "    void* vitis_large_alloc_core(size_t alignment, size_t size, int core){\n"
+             "        size_t mappedSize = vitis_large_alloc_mapped_size(size);\n"
+             "        void* ptr = vitis_large_alloc_map(alignment, mappedSize);\n"
+             "        if(ptr == NULL){\n"
+             "            return NULL;\n"
+             "        }\n"
+             "\n"
+             "        //Bind the pages to the NUMA node of the core\n"
+             "        bool bound = false;\n"
+             "        if(core >= 0){\n"
+             "            int node = vitis_numa_node_of_core(core);\n"
+             "            bound = vitis_large_alloc_bind(ptr, mappedSize, VITIS_MPOL_BIND, &node, 1);\n"
+             "            if(!bound){\n"
+             "                printf(\"Warning: Unable to bind allocation to the NUMA node of core %d, relying on first touch\\n\", core);\n"
+             "            }\n"
+             "        }\n"
+             "\n"
+             "        //Pre-fault the pages so that page faults do not occur while the threads warm up.  If the pages could not be\n"
+             "        //bound, they are touched from the core so that they are placed on its node\n"
+             "        int prefaultCore = bound ? -1 : core;\n"
+             "        vitis_prefault_interleaved(ptr, mappedSize, &prefaultCore, 1);\n"
+             "\n"
+             "        return ptr;\n"
+             "    }\n"
+             "\n"
+             "    void* vitis_large_alloc_interleaved(size_t alignment, size_t size, int coreA, int coreB){\n"
+             "        if(coreA < 0 || coreB < 0 || coreA == coreB){\n"
+             "            return vitis_large_alloc_core(alignment, size, coreA < 0 ? coreB : coreA);\n"
+             "        }\n"
+             "\n"
+             "        int cores[2] = {coreA, coreB};\n"
+             "        int nodes[2] = {vitis_numa_node_of_core(coreA), vitis_numa_node_of_core(coreB)};\n"
+             "        if(nodes[0] >= 0 && nodes[0] == nodes[1]){\n"
+             "            //Both cores are on the same node, nothing to interleave\n"
+             "            return vitis_large_alloc_core(alignment, size, coreA);\n"
+             "        }\n"
+             "\n"
+             "        size_t mappedSize = vitis_large_alloc_mapped_size(size);\n"
+             "        void* ptr = vitis_large_alloc_map(alignment, mappedSize);\n"
+             "        if(ptr == NULL){\n"
+             "            return NULL;\n"
+             "        }\n"
+             "\n"
+             "        //Interleave the pages across the NUMA nodes of both cores\n"
+             "        bool bound = vitis_large_alloc_bind(ptr, mappedSize, VITIS_MPOL_INTERLEAVE, nodes, 2);\n"
+             "        if(bound){\n"
+             "            int prefaultCore = -1;\n"
+             "            vitis_prefault_interleaved(ptr, mappedSize, &prefaultCore, 1);\n"
+             "        }else{\n"
+             "            printf(\"Warning: Unable to interleave allocation across the NUMA nodes of cores %d and %d, relying on first touch\\n\", coreA, coreB);\n"
+             "            vitis_prefault_interleaved(ptr, mappedSize, cores, 2);\n"
+             "        }\n"
+             "\n"
+             "        return ptr;\n"
+             "    }\n"
+             "\n"
+             "    void vitis_large_free(void* ptr, size_t size){\n"
+             "        munmap(ptr, vitis_large_alloc_mapped_size(size));\n"
+             "    }\n"
+             "#else\n"
+             "    void* vitis_large_alloc_core(size_t alignment, size_t size, int core){\n"
+             "        if(core < 0){\n"
+             "            return vitis_aligned_alloc(alignment, size);\n"
+             "        }\n"
+             "        return vitis_aligned_alloc_core(alignment, size, core);\n"
+             "    }\n"
+             "\n"
+             "    void* vitis_large_alloc_interleaved(size_t alignment, size_t size, int coreA, int coreB){\n"
+             "        if(coreA < 0 || coreB < 0 || coreA == coreB){\n"
+             "            return vitis_large_alloc_core(alignment, size, coreA < 0 ? coreB : coreA);\n"
+             "        }\n"
+             "\n"
+             "        //Without binding, pages are placed by touching them first from each core in turn\n"
+             "        void* ptr = vitis_aligned_alloc(alignment, size);\n"
+             "        if(ptr != NULL){\n"
+             "            int cores[2] = {coreA, coreB};\n"
+             "            vitis_prefault_interleaved(ptr, size, cores, 2);\n"
+             "        }\n"
+             "        return ptr;\n"
+             "    }\n"
+             "\n"
+             "    void vitis_large_free(void* ptr, size_t size){\n"
+             "        free(ptr);\n"
+             "    }\n"
+             "#endif\n"
              "#endif" << std::endl;
 
     cFile.close();
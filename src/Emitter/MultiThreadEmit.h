@@ -14,6 +14,7 @@
 #include "MultiThread/ThreadCrossingFIFOParameters.h"
 #include "General/EmitterHelpers.h"
 #include <set>
+#include <iostream>
 #include <map>
 #include <vector>
 
@@ -82,9 +83,60 @@ namespace MultiThreadEmit {
      * @param blocking if true, the FIFO check will repeat until all are ready.  If false, the FIFO check will not block the execution of the code proceeding it
      * @param includeThreadCancelCheck if true, includes a call to pthread_testcancel durring the FIFO check (to determine if the thread should exit)
      * @param fifoIndexCachingBehavior defines the FIFO index caching behavior for the check
+     * @param stallStatements if blocking, C statements which are run each time the check fails before it is repeated (ex. from flushFIFOsPendingCommits)
+     * @param waitPolicy if blocking, what the thread does between failed checks.  The wait state is named checkVarName_wait
      * @return
      */
-    std::string emitFIFOChecks(std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos, bool producer, std::string checkVarName, bool shortCircuit, bool blocking, bool includeThreadCancelCheck, PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior);
+    std::string emitFIFOChecks(std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos, bool producer, std::string checkVarName, bool shortCircuit, bool blocking, bool includeThreadCancelCheck, PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior, std::vector<std::string> stallStatements = std::vector<std::string>(), PartitionParams::FIFOWaitPolicy waitPolicy = PartitionParams::FIFOWaitPolicy::SPIN);
+
+    /**
+     * @brief Emits C code to publish any reads/writes which a thread has performed but not yet made visible (see ThreadCrossingFIFO::emitCFlushPendingCommits)
+     *
+     * This should be emitted wherever a thread may stall so that other threads are not left waiting on blocks which have
+     * already been produced or consumed.
+     *
+     * @param inputFIFOs the FIFOs the thread reads from
+     * @param outputFIFOs the FIFOs the thread writes to
+     * @return the C statements.  Empty if none of the FIFOs defer publication
+     */
+    std::vector<std::string> flushFIFOsPendingCommits(std::vector<std::shared_ptr<ThreadCrossingFIFO>> inputFIFOs, std::vector<std::shared_ptr<ThreadCrossingFIFO>> outputFIFOs);
+
+    /**
+     * @brief Emits C code declaring the state used by a thread while it waits on FIFOs (see emitFIFOSupportFile)
+     *
+     * @param waitPolicy the FIFO wait policy
+     * @param waitStateName the name of the wait state variable
+     * @return the C statements.  Empty for FIFOWaitPolicy::SPIN
+     */
+    std::vector<std::string> createFIFOWaitState(PartitionParams::FIFOWaitPolicy waitPolicy, std::string waitStateName);
+
+    /**
+     * @brief Emits C code which is run each time a thread finds that the FIFOs it is waiting on are not ready
+     *
+     * @param waitPolicy the FIFO wait policy
+     * @param waitStateName the name of the wait state variable
+     * @return the C statements.  Empty for FIFOWaitPolicy::SPIN
+     */
+    std::vector<std::string> waitOnFIFOs(PartitionParams::FIFOWaitPolicy waitPolicy, std::string waitStateName);
+
+    /**
+     * @brief Emits C code which is run once the FIFOs a thread was waiting on are ready.  Resets the wait state
+     *
+     * @param waitPolicy the FIFO wait policy
+     * @param waitStateName the name of the wait state variable
+     * @return the C statements.  Empty for FIFOWaitPolicy::SPIN
+     */
+    std::vector<std::string> doneWaitingOnFIFOs(PartitionParams::FIFOWaitPolicy waitPolicy, std::string waitStateName);
+
+    /**
+     * @brief Emits C code which wakes any threads parked waiting on FIFOs.
+     *
+     * This should be emitted after a thread publishes FIFO reads/writes and before it waits on FIFOs itself.
+     *
+     * @param waitPolicy the FIFO wait policy
+     * @return the C statements.  Empty unless the policy is FIFOWaitPolicy::FUTEX
+     */
+    std::vector<std::string> wakeFIFOWaiters(PartitionParams::FIFOWaitPolicy waitPolicy);
 
     std::vector<std::string> createAndInitFIFOLocalVars(std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos);
 
@@ -161,18 +213,32 @@ namespace MultiThreadEmit {
      * @param path
      * @param filenamePrefix
      * @param fifos
+     * @param complexLayout the placement of the real and imaginary planes within the FIFO structures
      * @returns the filename of the header file
      */
-    std::string emitFIFOStructHeader(std::string path, std::string fileNamePrefix, std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos);
+    std::string emitFIFOStructHeader(std::string path, std::string fileNamePrefix, std::vector<std::shared_ptr<ThreadCrossingFIFO>> fifos,
+                                     EmitterHelpers::ComplexLayout complexLayout = EmitterHelpers::ComplexLayout::SPLIT_PACKED);
 
     /**
-     * @brief Emits a FIFO support files for fast read/write if applicable
+     * @brief Emits a FIFO support files for fast read/write and for waiting on FIFOs if applicable
+     *
+     * For FIFO wait policies other than FIFOWaitPolicy::SPIN, defines vitis_fifo_wait_state_t along with
+     * vitis_fifo_wait, vitis_fifo_wait_done, and vitis_fifo_wake which implement the selected policy.
+     *
+     * For FIFOWaitPolicy::FUTEX, threads which have waited for fifoWaitSpins attempts register themselves as parked,
+     * re-check the FIFOs, then sleep on a futex shared by all threads in the process.  Threads wake any parked threads
+     * after publishing FIFO updates.  Because a single futex word is used, all parked threads are woken and re-check
+     * their FIFOs.  Parking is given a timeout so that threads which also poll external resources (ex. the I/O
+     * thread) continue to make progress.
+     *
      * @param path
      * @param filenamePrefix
      * @param copyModes a set of copy modes used by FIFOs in the design
+     * @param fifoWaitPolicy the FIFO wait policy
+     * @param fifoWaitSpins for FIFOWaitPolicy::FUTEX, the number of failed FIFO checks before a thread is parked
      * @returns the filename of the header file
      */
-    std::string emitFIFOSupportFile(std::string path, std::string fileNamePrefix, std::set<ThreadCrossingFIFOParameters::CopyMode> copyModes);
+    std::string emitFIFOSupportFile(std::string path, std::string fileNamePrefix, std::set<ThreadCrossingFIFOParameters::CopyMode> copyModes, PartitionParams::FIFOWaitPolicy fifoWaitPolicy, int fifoWaitSpins);
 
     /**
      * @brief Find the copy modes used by a set of FIFOs
@@ -266,13 +332,15 @@ namespace MultiThreadEmit {
      * @param ioBenchmarkSuffix
      * @param includeLrt if true, includes -lrt to the linker options
      * @param includePAPI if true, includes -lpapi to the linker options
+     * @param additionalLibs additional libraries to add to the linker options (ex. -luring)
      */
     void emitMultiThreadedMakefileMain(std::string path, std::string fileNamePrefix,
                                        std::string designName, std::set<int> partitions,
                                        std::string ioBenchmarkSuffix, bool includeLrt,
                                        std::vector<std::string> additionalSystemSrc,
                                        bool includePAPI,
-                                       bool enableBenchmarkSetAffinity);
+                                       bool enableBenchmarkSetAffinity,
+                                       std::vector<std::string> additionalLibs = std::vector<std::string>());
 
     /**
      * @brief Emits the C code for a thread for the a given partition (except the I/O thread which is handled seperatly)
@@ -303,7 +371,17 @@ namespace MultiThreadEmit {
      * @param telemAvg if true, the telemetry is averaged over the entire run.  If false, the telemetry is only an average of the measurement period
      * @param papiHelperHeader if not empty, collects performance counter information from the PAPI library.  Note that this will have an adverse effect on performance.  printTelem || !telemDumpFilePrefix.empty() must be true for this to be collected
      * @param fifoIndexCachingBehavior selects the FIFO index caching behavior
+     * @param fifoWaitPolicy selects what the thread does while waiting on FIFOs
      * @param doubleBuffer specifies the double buffering behavior of FIFOs
+     * @param fifoEarlyPublish if true, the operators are emitted directly in the thread loop and each input FIFO is
+     * acquired just before its first consumer and released after its last consumer.  Each output FIFO is acquired
+     * just before the FIFO node and published right after it rather than after the entire block has been computed.
+     * This allows downstream partitions to start before this partition finishes its schedule.  Requires in-place FIFOs
+     * and is not supported with double buffering or telemetry broken down by phase.  See getEarlyPublishFIFOStatements
+     * @param complexLayout the placement of the real and imaginary planes within the partition state structure (which
+     * contains the delay buffers)
+     * @param statusOut the stream status messages (ex. the files being emitted) are written to.  Allows the messages to
+     * be buffered when partitions are emitted concurrently
      */
     void emitPartitionThreadC(int partitionNum, std::vector<std::shared_ptr<Node>> nodesToEmit,
                               std::vector<std::shared_ptr<ThreadCrossingFIFO>> inputFIFOs,
@@ -316,7 +394,10 @@ namespace MultiThreadEmit {
                               double reportPeriodSeconds, std::string telemDumpFilePrefix, bool telemAvg,
                               std::string papiHelperHeader,
                               PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
-                              ComputeIODoubleBufferType doubleBuffer);
+                              PartitionParams::FIFOWaitPolicy fifoWaitPolicy,
+                              ComputeIODoubleBufferType doubleBuffer, bool fifoEarlyPublish = false,
+                              EmitterHelpers::ComplexLayout complexLayout = EmitterHelpers::ComplexLayout::SPLIT_PACKED,
+                              std::ostream &statusOut = std::cout);
 
     /**
      * @brief Defines the structure containing the state for a particular partition
@@ -326,9 +407,11 @@ namespace MultiThreadEmit {
      *
      * @param partitionStateVars the state variables in the partition
      * @param partitionNum the partition number
+     * @param complexLayout the placement of the real and imaginary planes of the state variables within the structure
      * @return
      */
-    std::vector<std::string> getPartitionStateStructTypeDef(std::vector<Variable> partitionStateVars, int partitionNum);
+    std::vector<std::string> getPartitionStateStructTypeDef(std::vector<Variable> partitionStateVars, int partitionNum,
+                                                            EmitterHelpers::ComplexLayout complexLayout = EmitterHelpers::ComplexLayout::SPLIT_PACKED);
 
     /**
      * @brief Get the argument portion of the C function prototype for the partition compute function
@@ -404,6 +487,65 @@ namespace MultiThreadEmit {
                                                              bool &openedCounterCheck, //This variable is modified inside the function.  It is also read.  It denotes if the downsample check had been previously emitted.  If it is emitted in this function, it will be set to true
                                                              bool input);
 
+    /**
+     * @brief Emits the body of a partition's compute function: the clock domain count variables followed by the
+     * partition's operators in schedule order
+     *
+     * @param cFile the cFile to emit to
+     * @param nodesToEmit the nodes in the partition
+     * @param clockDomainsInPartition the clock domains in the partition
+     * @param blockSizeBase the block size (in samples) at the base rate
+     * @param schedType the schedule type
+     * @param outputMaster a pointer to the output master of the design being emitted
+     * @param statementsBeforeNode statements to emit before the given nodes (see EmitterHelpers::emitOpsStateUpdateContext)
+     * @param statementsAfterNode statements to emit after the given nodes (see EmitterHelpers::emitOpsStateUpdateContext)
+     */
+    void emitPartitionComputeOps(std::ofstream &cFile, std::vector<std::shared_ptr<Node>> &nodesToEmit,
+                                 std::set<std::shared_ptr<ClockDomain>> clockDomainsInPartition,
+                                 unsigned long blockSizeBase, SchedParams::SchedType schedType,
+                                 std::shared_ptr<MasterOutput> outputMaster,
+                                 const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode = std::map<std::shared_ptr<Node>, std::vector<std::string>>(),
+                                 const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode = std::map<std::shared_ptr<Node>, std::vector<std::string>>());
+
+    /**
+     * @brief Gets the statements which acquire and release FIFOs next to the nodes which access them.  Used when FIFO
+     * reads/writes are published early
+     *
+     * For each input FIFO, the FIFO is checked and its read pointer fetched before the first node (in schedule order)
+     * which consumes it.  The read is pushed after the last node consuming it.  For each output FIFO, the FIFO is
+     * checked and its write pointer fetched before the FIFO node (which copies its input into the FIFO) and the write
+     * is pushed immediately after the FIFO node.  Nodes in contexts whose context root consumes an input FIFO are also
+     * treated as consumers since the context conditions may reference the FIFO.
+     *
+     * When a FIFO is acquired, locals with the names of the partition compute function arguments for the FIFO are
+     * declared which point to the FIFO buffer so that the operators can be emitted directly in the thread function.
+     *
+     * FIFOs without any scheduled node accessing them are acquired at the start of the block and released at the end
+     *
+     * @note In-place FIFOs are assumed
+     *
+     * @param nodesToEmit the nodes in the partition
+     * @param inputFIFOs the input FIFOs of the partition
+     * @param outputFIFOs the output FIFOs of the partition
+     * @param fifoIndexCachingBehavior selects the FIFO index caching behavior
+     * @param stallStatements statements run when the thread is about to spin on a FIFO check
+     * @param fifoWaitPolicy selects what the thread does while waiting on FIFOs
+     * @param statementsBeforeNode map to add statements to emit before nodes to
+     * @param statementsAfterNode map to add statements to emit after nodes to
+     * @param blockStartStatements statements to emit at the start of the block
+     * @param blockEndStatements statements to emit at the end of the block
+     */
+    void getEarlyPublishFIFOStatements(std::vector<std::shared_ptr<Node>> &nodesToEmit,
+                                       std::vector<std::shared_ptr<ThreadCrossingFIFO>> inputFIFOs,
+                                       std::vector<std::shared_ptr<ThreadCrossingFIFO>> outputFIFOs,
+                                       PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                                       std::vector<std::string> stallStatements,
+                                       PartitionParams::FIFOWaitPolicy fifoWaitPolicy,
+                                       std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode,
+                                       std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode,
+                                       std::vector<std::string> &blockStartStatements,
+                                       std::vector<std::string> &blockEndStatements);
+
     /**
      * @brief Emits a given set operators using the schedule emitter.  This emitter is context aware and supports emitting scheduled state updates
      *
@@ -411,8 +553,12 @@ namespace MultiThreadEmit {
      * like to schedule
      *
      * @param cFile the cFile to emit to
+     * @param statementsBeforeNode statements to emit before the given nodes (see EmitterHelpers::emitOpsStateUpdateContext)
+     * @param statementsAfterNode statements to emit after the given nodes (see EmitterHelpers::emitOpsStateUpdateContext)
      */
-    void emitSelectOpsSchedStateUpdateContext(std::ofstream &cFile, std::vector<std::shared_ptr<Node>> &nodesToEmit, SchedParams::SchedType schedType, std::shared_ptr<MasterOutput> outputMaster);
+    void emitSelectOpsSchedStateUpdateContext(std::ofstream &cFile, std::vector<std::shared_ptr<Node>> &nodesToEmit, SchedParams::SchedType schedType, std::shared_ptr<MasterOutput> outputMaster,
+                                              const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode = std::map<std::shared_ptr<Node>, std::vector<std::string>>(),
+                                              const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode = std::map<std::shared_ptr<Node>, std::vector<std::string>>());
 
     //Checks that the only nodes that are in the I/O partition are ThreadCrossingFIFOs or subsystems
     bool checkNoNodesInIO(std::vector<std::shared_ptr<Node>> nodes);
@@ -426,7 +572,18 @@ namespace MultiThreadEmit {
      */
     void writePlatformParameters(std::string path, std::string filename, int memAlignment);
 
-    void writeNUMAAllocHelperFiles(std::string path, std::string filename);
+    /**
+     * @brief Writes the helper functions used to allocate memory on the NUMA node of a particular core
+     *
+     * Includes vitis_large_alloc_core which is used for large shared buffers such as FIFO arrays.  Its behavior is
+     * set by the NUMA alloc policy (see PartitionParams::NUMAAllocPolicy) and can be overridden when compiling the
+     * generated code by defining VITIS_NUMA_ALLOC_POLICY
+     *
+     * @param path the directory to write the files to
+     * @param filename the name of the files (without extension)
+     * @param numaAllocPolicy the policy used for large buffer allocations
+     */
+    void writeNUMAAllocHelperFiles(std::string path, std::string filename, PartitionParams::NUMAAllocPolicy numaAllocPolicy = PartitionParams::NUMAAllocPolicy::FIRST_TOUCH);
 
     /**
      * @brief Get the index variable name for a particular clock domain rate relative to the base rate
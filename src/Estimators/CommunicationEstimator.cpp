@@ -13,6 +13,8 @@
 #include "Scheduling/IntraPartitionScheduling.h"
 
 #include <iostream>
+#include <cctype>
+#include <boost/filesystem.hpp>
 
 int CommunicationEstimator::getCommunicationBitsForType(DataType dt){
     //Communication occurs with valid CPU types
@@ -37,7 +39,7 @@ int CommunicationEstimator::getCommunicationBitsForType(DataType dt){
 
 std::map<std::pair<int, int>, EstimatorCommon::InterThreadCommunicationWorkload>
 CommunicationEstimator::reportCommunicationWorkload(
-        std::map<std::pair<int, int>, std::vector<std::shared_ptr<ThreadCrossingFIFO>>> fifoMap) {
+        std::map<std::pair<int, int>, std::vector<std::shared_ptr<ThreadCrossingFIFO>>> fifoMap, std::vector<int> partitionMap) {
     std::map<std::pair<int, int>, EstimatorCommon::InterThreadCommunicationWorkload> workload;
 
     for(auto it = fifoMap.begin(); it != fifoMap.end(); it++){
@@ -61,6 +63,13 @@ CommunicationEstimator::reportCommunicationWorkload(
         }
 
         EstimatorCommon::InterThreadCommunicationWorkload commWorkload(bytesPerSample, bytesPerTransaction, numFIFOs);
+        for(const std::shared_ptr<ThreadCrossingFIFO> &fifo : it->second){
+            commWorkload.fifoPlacements.insert(fifo->getFifoPlacement());
+        }
+        if(!partitionMap.empty()){
+            commWorkload.srcNUMANode = getNUMANodeOfCore(MultiThreadEmit::getCore(it->first.first, partitionMap));
+            commWorkload.dstNUMANode = getNUMANodeOfCore(MultiThreadEmit::getCore(it->first.second, partitionMap));
+        }
 
         workload[it->first] = commWorkload;
     }
@@ -76,6 +85,31 @@ void CommunicationEstimator::printComputeInstanceTable(
     std::string bytesPerSampleLabel = "Bytes Per Sample";
     std::string bytesPerBlockLabel = "Bytes Per Block";
     std::string numFIFOsLabel = "# FIFOs";
+    std::string numaNodesLabel = "NUMA Nodes";
+    std::string fifoPlacementLabel = "FIFO Placement";
+
+    //The NUMA nodes and FIFO placements are reported as strings.  Crossings between NUMA nodes are marked
+    std::map<std::pair<int, int>, std::string> numaNodesStrs;
+    std::map<std::pair<int, int>, std::string> fifoPlacementStrs;
+    for(auto it = commWorkload.begin(); it != commWorkload.end(); it++){
+        std::string numaNodesStr = "?";
+        if(it->second.srcNUMANode >= 0 && it->second.dstNUMANode >= 0){
+            numaNodesStr = GeneralHelper::to_string(it->second.srcNUMANode) + "->" + GeneralHelper::to_string(it->second.dstNUMANode);
+            if(it->second.srcNUMANode != it->second.dstNUMANode){
+                numaNodesStr += " (Cross)";
+            }
+        }
+        numaNodesStrs[it->first] = numaNodesStr;
+
+        std::string fifoPlacementStr;
+        for(ThreadCrossingFIFOParameters::FIFOPlacement placement : it->second.fifoPlacements){
+            if(!fifoPlacementStr.empty()){
+                fifoPlacementStr += ", ";
+            }
+            fifoPlacementStr += ThreadCrossingFIFOParameters::fifoPlacementToString(placement);
+        }
+        fifoPlacementStrs[it->first] = fifoPlacementStr;
+    }
 
     //Used for formatting
     size_t maxPartitionFromLen = partitionFromLabel.size();
@@ -83,6 +117,8 @@ void CommunicationEstimator::printComputeInstanceTable(
     size_t maxBytesPerSampleLen = bytesPerSampleLabel.size();
     size_t maxBytesPerBlockLen = bytesPerBlockLabel.size();
     size_t maxNumFIFOsLen = numFIFOsLabel.size();
+    size_t maxNUMANodesLen = numaNodesLabel.size();
+    size_t maxFIFOPlacementLen = fifoPlacementLabel.size();
 
     for(auto it = commWorkload.begin(); it != commWorkload.end(); it++){
         maxPartitionFromLen = std::max(maxPartitionFromLen, GeneralHelper::to_string(it->first.first).size());
@@ -90,6 +126,8 @@ void CommunicationEstimator::printComputeInstanceTable(
         maxBytesPerSampleLen = std::max(maxBytesPerSampleLen, GeneralHelper::to_string(it->second.numBytesPerSample).size());
         maxBytesPerBlockLen = std::max(maxBytesPerBlockLen, GeneralHelper::to_string(it->second.numBytesPerBlock).size());
         maxNumFIFOsLen = std::max(maxNumFIFOsLen, GeneralHelper::to_string(it->second.numFIFOs).size());
+        maxNUMANodesLen = std::max(maxNUMANodesLen, numaNodesStrs[it->first].size());
+        maxFIFOPlacementLen = std::max(maxFIFOPlacementLen, fifoPlacementStrs[it->first].size());
     }
 
     //Print the table
@@ -100,6 +138,8 @@ void CommunicationEstimator::printComputeInstanceTable(
     std::string bytesPerSampleFormatStr = " | %" + GeneralHelper::to_string(maxBytesPerSampleLen) + "d";
     std::string bytesPerBlockFormatStr = " | %" + GeneralHelper::to_string(maxBytesPerBlockLen) + "d";
     std::string numFIFOsFormatStr = " | %" + GeneralHelper::to_string(maxNumFIFOsLen) + "d";
+    std::string numaNodesFormatStr = " | %" + GeneralHelper::to_string(maxNUMANodesLen) + "s";
+    std::string fifoPlacementFormatStr = " | %" + GeneralHelper::to_string(maxFIFOPlacementLen) + "s";
 
     std::string partitionFromLabelFormatStr = "%" + GeneralHelper::to_string(maxPartitionFromLen) + "s";
     std::string partitionToLabelFormatStr = " | %" + GeneralHelper::to_string(maxPartitionToLen) + "s";
@@ -112,6 +152,8 @@ void CommunicationEstimator::printComputeInstanceTable(
     printf(bytesPerSampleLabelFormatStr.c_str(), bytesPerSampleLabel.c_str());
     printf(bytesPerBlockLabelFormatStr.c_str(), bytesPerBlockLabel.c_str());
     printf(numFIFOsLabelFormatStr.c_str(), numFIFOsLabel.c_str());
+    printf(numaNodesFormatStr.c_str(), numaNodesLabel.c_str());
+    printf(fifoPlacementFormatStr.c_str(), fifoPlacementLabel.c_str());
 
     std::cout << std::endl;
 
@@ -122,11 +164,36 @@ void CommunicationEstimator::printComputeInstanceTable(
         printf(bytesPerSampleFormatStr.c_str(), it->second.numBytesPerSample);
         printf(bytesPerBlockFormatStr.c_str(), it->second.numBytesPerBlock);
         printf(numFIFOsFormatStr.c_str(), it->second.numFIFOs);
+        printf(numaNodesFormatStr.c_str(), numaNodesStrs[it->first].c_str());
+        printf(fifoPlacementFormatStr.c_str(), fifoPlacementStrs[it->first].c_str());
 
         std::cout << std::endl;
     }
 }
 
+int CommunicationEstimator::getNUMANodeOfCore(int core){
+    if(core < 0){
+        return -1;
+    }
+
+    //The cpu directory in sysfs contains a link to the node the cpu belongs to
+    boost::filesystem::path cpuDir("/sys/devices/system/cpu/cpu" + GeneralHelper::to_string(core));
+    boost::system::error_code err;
+    boost::filesystem::directory_iterator end;
+    for(boost::filesystem::directory_iterator it(cpuDir, err); !err && it != end; it.increment(err)){
+        std::string name = it->path().filename().string();
+        if(name.size() > 4 && name.substr(0, 4) == "node" && std::isdigit(name[4])){
+            try{
+                return std::stoi(name.substr(4));
+            }catch(std::invalid_argument &e){
+                return -1;
+            }
+        }
+    }
+
+    return -1;
+}
+
 std::shared_ptr<PartitionNode> CommunicationEstimator::createPartitionNode(int partition){
     std::shared_ptr<PartitionNode> node = NodeFactory::createNode<PartitionNode>();
     node->setPartitionNum(partition);
@@ -18,7 +18,20 @@
 */
 
 namespace CommunicationEstimator {
-    std::map<std::pair<int, int>, EstimatorCommon::InterThreadCommunicationWorkload> reportCommunicationWorkload(std::map<std::pair<int, int>, std::vector<std::shared_ptr<ThreadCrossingFIFO>>> fifoMap);
+    /**
+     * @brief Finds the communication workload between each pair of partitions
+     *
+     * @param fifoMap the FIFOs between each pair of partitions
+     * @param partitionMap the partition to core mapping.  If provided, the NUMA nodes of the src and dst partitions are
+     *                     found using the topology of the host running the generator
+     */
+    std::map<std::pair<int, int>, EstimatorCommon::InterThreadCommunicationWorkload> reportCommunicationWorkload(std::map<std::pair<int, int>, std::vector<std::shared_ptr<ThreadCrossingFIFO>>> fifoMap, std::vector<int> partitionMap = std::vector<int>());
+
+    /**
+     * @brief Gets the NUMA node of a core on the host running the generator (from sysfs)
+     * @return the NUMA node or -1 if the core is -1 or the node could not be found
+     */
+    int getNUMANodeOfCore(int core);
 
     void printComputeInstanceTable(std::map<std::pair<int, int>, EstimatorCommon::InterThreadCommunicationWorkload> commWorkload);
 
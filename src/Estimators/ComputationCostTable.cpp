@@ -0,0 +1,633 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "ComputationCostTable.h"
+#include "ComputationEstimator.h"
+#include "General/GeneralHelper.h"
+#include "General/ErrorHelpers.h"
+#include "GraphCore/InputPort.h"
+#include "GraphCore/OutputPort.h"
+#include "PrimitiveNodes/InnerProduct.h"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+ComputationCostTable::OperationKey::OperationKey() : nodeType(""), operandType(EstimatorCommon::OperandType::INT),
+                                                     operandBits(0), numRealInputs(0), numCplxInputs(0), vectorWidth(1) {
+
+}
+
+ComputationCostTable::OperationKey::OperationKey(std::string nodeType, EstimatorCommon::OperandType operandType,
+                                                 int operandBits, int numRealInputs, int numCplxInputs,
+                                                 int vectorWidth) : nodeType(nodeType), operandType(operandType),
+                                                 operandBits(operandBits), numRealInputs(numRealInputs),
+                                                 numCplxInputs(numCplxInputs), vectorWidth(vectorWidth) {
+
+}
+
+bool ComputationCostTable::OperationKey::operator<(const ComputationCostTable::OperationKey &rhs) const {
+    if (nodeType < rhs.nodeType)
+        return true;
+    if (rhs.nodeType < nodeType)
+        return false;
+    if (operandType < rhs.operandType)
+        return true;
+    if (rhs.operandType < operandType)
+        return false;
+    if (operandBits < rhs.operandBits)
+        return true;
+    if (rhs.operandBits < operandBits)
+        return false;
+    if (numRealInputs < rhs.numRealInputs)
+        return true;
+    if (rhs.numRealInputs < numRealInputs)
+        return false;
+    if (numCplxInputs < rhs.numCplxInputs)
+        return true;
+    if (rhs.numCplxInputs < numCplxInputs)
+        return false;
+    return vectorWidth < rhs.vectorWidth;
+}
+
+bool ComputationCostTable::OperationKey::operator==(const ComputationCostTable::OperationKey &rhs) const {
+    return nodeType == rhs.nodeType &&
+           operandType == rhs.operandType &&
+           operandBits == rhs.operandBits &&
+           numRealInputs == rhs.numRealInputs &&
+           numCplxInputs == rhs.numCplxInputs &&
+           vectorWidth == rhs.vectorWidth;
+}
+
+std::string ComputationCostTable::OperationKey::toString() const {
+    return nodeType + "," + EstimatorCommon::operandTypeToString(operandType) + "," +
+           GeneralHelper::to_string(operandBits) + "," + GeneralHelper::to_string(numRealInputs) + "," +
+           GeneralHelper::to_string(numCplxInputs) + "," + GeneralHelper::to_string(vectorWidth);
+}
+
+ComputationCostTable::ComputationCostTable() : fallbackNsPerOperandElement(-1) {
+
+}
+
+//std::stoi and std::stod accept trailing characters (ex. 1.25ns) which are rejected here
+static int parseCostTableInt(const std::string &field){
+    size_t pos = 0;
+    int val = std::stoi(field, &pos);
+    if(pos != field.size()){
+        throw std::invalid_argument(field);
+    }
+    return val;
+}
+
+static double parseCostTableDouble(const std::string &field){
+    size_t pos = 0;
+    double val = std::stod(field, &pos);
+    if(pos != field.size()){
+        throw std::invalid_argument(field);
+    }
+    return val;
+}
+
+ComputationCostTable ComputationCostTable::load(std::string filename) {
+    std::ifstream costTableFile(filename);
+    if(!costTableFile.is_open()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unable to open cost table file: " + filename));
+    }
+
+    ComputationCostTable costTable;
+
+    std::string line;
+    int lineNum = 0;
+    while(std::getline(costTableFile, line)){
+        lineNum++;
+        if(!line.empty() && line[line.size()-1] == '\r'){
+            line = line.substr(0, line.size()-1);
+        }
+        if(line.empty() || line[0] == '#'){
+            continue;
+        }
+
+        std::vector<std::string> fields;
+        std::stringstream lineStream(line);
+        std::string field;
+        while(std::getline(lineStream, field, ',')){
+            fields.push_back(field);
+        }
+
+        try {
+            if (fields.size() == 2 && fields[0] == "fallbackNsPerOperandElement") {
+                costTable.setFallbackNsPerOperandElement(parseCostTableDouble(fields[1]));
+            } else if (fields.size() == 7) {
+                EstimatorCommon::OperandType operandType;
+                if (fields[1] == "INT") {
+                    operandType = EstimatorCommon::OperandType::INT;
+                } else if (fields[1] == "FLOAT") {
+                    operandType = EstimatorCommon::OperandType::FLOAT;
+                } else {
+                    throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown operand type in cost table " + filename + " line " + GeneralHelper::to_string(lineNum) + ": " + fields[1]));
+                }
+
+                OperationKey key(fields[0], operandType, parseCostTableInt(fields[2]), parseCostTableInt(fields[3]),
+                                 parseCostTableInt(fields[4]), parseCostTableInt(fields[5]));
+                costTable.setNsPerSample(key, parseCostTableDouble(fields[6]));
+            } else {
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Malformed cost table " + filename + " line " + GeneralHelper::to_string(lineNum) + ": " + line));
+            }
+        }catch(std::invalid_argument &e){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Malformed number in cost table " + filename + " line " + GeneralHelper::to_string(lineNum) + ": " + line));
+        }catch(std::out_of_range &e){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Number out of range in cost table " + filename + " line " + GeneralHelper::to_string(lineNum) + ": " + line));
+        }
+    }
+
+    return costTable;
+}
+
+bool ComputationCostTable::empty() const {
+    return nsPerSample.empty() && fallbackNsPerOperandElement < 0;
+}
+
+double ComputationCostTable::getNsPerSample(const ComputationCostTable::OperationKey &key) const {
+    auto it = nsPerSample.find(key);
+    if(it == nsPerSample.end()){
+        return -1;
+    }
+    return it->second;
+}
+
+void ComputationCostTable::setNsPerSample(const ComputationCostTable::OperationKey &key, double ns) {
+    nsPerSample[key] = ns;
+}
+
+double ComputationCostTable::getFallbackNsPerOperandElement() const {
+    return fallbackNsPerOperandElement;
+}
+
+void ComputationCostTable::setFallbackNsPerOperandElement(double fallbackNsPerOperandElement) {
+    ComputationCostTable::fallbackNsPerOperandElement = fallbackNsPerOperandElement;
+}
+
+bool ComputationCostTable::getOperationKey(std::shared_ptr<Node> node, ComputationCostTable::OperationKey &key) {
+    std::pair<std::map<EstimatorCommon::NodeOperation, int>, std::map<std::type_index, std::string>> instances = ComputationEstimator::reportComputeInstances({node});
+    if(instances.first.empty()){
+        return false;
+    }
+
+    const EstimatorCommon::NodeOperation &nodeOp = instances.first.begin()->first;
+
+    int elements = 1;
+    std::vector<std::shared_ptr<InputPort>> inputPorts = node->getInputPorts();
+    for(const std::shared_ptr<InputPort> &inputPort : inputPorts){
+        elements = std::max(elements, inputPort->getDataType().numberOfElements());
+    }
+    std::vector<std::shared_ptr<OutputPort>> outputPorts = node->getOutputPorts();
+    for(const std::shared_ptr<OutputPort> &outputPort : outputPorts){
+        elements = std::max(elements, outputPort->getDataType().numberOfElements());
+    }
+
+    //An InnerProduct with folded (symmetric or antisymmetric) coefficients pre-adds mirrored samples and only performs
+    //one multiply per coefficient.  Its width is the number of coefficients rather than the number of samples
+    if(std::shared_ptr<InnerProduct> asInnerProduct = GeneralHelper::isType<Node, InnerProduct>(node)){
+        if(asInnerProduct->getCoefSymmetry() != InnerProduct::CoefSymmetry::NONE){
+            elements = std::max(1, asInnerProduct->getInputPort(0)->getDataType().numberOfElements());
+        }
+    }
+
+    key = OperationKey(instances.second[nodeOp.nodeType], nodeOp.operandType, nodeOp.operandBits,
+                       nodeOp.numRealInputs, nodeOp.numCplxInputs, elements);
+    return true;
+}
+
+std::set<ComputationCostTable::OperationKey> ComputationCostTable::findOperations(std::vector<std::shared_ptr<Node>> nodes) {
+    std::set<OperationKey> operations;
+
+    for(const std::shared_ptr<Node> &node : nodes){
+        OperationKey key;
+        if(getOperationKey(node, key)){
+            operations.insert(key);
+        }
+    }
+
+    return operations;
+}
+
+std::string ComputationCostTable::getCalibrationCType(EstimatorCommon::OperandType operandType, int operandBits) {
+    if(operandType == EstimatorCommon::OperandType::FLOAT){
+        return operandBits <= 32 ? "float" : "double";
+    }
+
+    if(operandBits <= 1){
+        return "bool";
+    }else if(operandBits <= 8){
+        return "int8_t";
+    }else if(operandBits <= 16){
+        return "int16_t";
+    }else if(operandBits <= 32){
+        return "int32_t";
+    }
+    return "int64_t";
+}
+
+bool ComputationCostTable::getCalibrationKernelBody(const ComputationCostTable::OperationKey &key, std::string prefix,
+                                                    std::string cType, std::string &outCType, bool &outComplex,
+                                                    std::string &reductionInit, std::string &body) {
+    int numInputs = key.numRealInputs + key.numCplxInputs;
+    bool anyComplex = key.numCplxInputs > 0;
+    bool isFloat = key.operandType == EstimatorCommon::OperandType::FLOAT;
+    //Real inputs are numbered before complex inputs
+    auto re = [&prefix](int input) -> std::string {
+        return prefix + "_in" + GeneralHelper::to_string(input) + "_re[i]";
+    };
+    auto im = [&prefix, &key](int input) -> std::string {
+        return input >= key.numRealInputs ? prefix + "_in" + GeneralHelper::to_string(input) + "_im[i]" : "0";
+    };
+    std::string outRe = prefix + "_out_re[i]";
+    std::string outIm = prefix + "_out_im[i]";
+
+    outCType = cType;
+    outComplex = false;
+    reductionInit = "";
+    body = "";
+
+    std::string nodeType = key.nodeType;
+
+    if(nodeType == "Sum" || nodeType == "Product" || nodeType == "InnerProduct"){
+        bool isProduct = nodeType != "Sum";
+        outComplex = anyComplex;
+
+        if(nodeType == "InnerProduct" && numInputs == 2){
+            reductionInit = "0";
+            body += "acc_re += " + re(0) + "*" + re(1) + (anyComplex ? " - " + im(0) + "*" + im(1) : "") + ";\n";
+            if(anyComplex){
+                body += "acc_im += " + re(0) + "*" + im(1) + " + " + im(0) + "*" + re(1) + ";\n";
+            }
+        }else if(numInputs == 1){
+            //Reduce across the elements of the input
+            reductionInit = isProduct ? "1" : "0";
+            if(!isProduct){
+                body += "acc_re += " + re(0) + ";\n";
+                if(anyComplex){
+                    body += "acc_im += " + im(0) + ";\n";
+                }
+            }else if(!anyComplex){
+                body += "acc_re *= " + re(0) + ";\n";
+            }else{
+                body += cType + " tmp_re = acc_re*" + re(0) + " - acc_im*" + im(0) + ";\n";
+                body += "acc_im = acc_re*" + im(0) + " + acc_im*" + re(0) + ";\n";
+                body += "acc_re = tmp_re;\n";
+            }
+        }else if(numInputs >= 2 && !isProduct){
+            std::string sumRe = re(0);
+            std::string sumIm = im(0);
+            for(int input = 1; input<numInputs; input++){
+                sumRe += " + " + re(input);
+                sumIm += " + " + im(input);
+            }
+            body += outRe + " = " + sumRe + ";\n";
+            if(anyComplex){
+                body += outIm + " = " + sumIm + ";\n";
+            }
+        }else if(numInputs >= 2 && nodeType == "Product"){
+            if(!anyComplex){
+                std::string prodRe = re(0);
+                for(int input = 1; input<numInputs; input++){
+                    prodRe += "*" + re(input);
+                }
+                body += outRe + " = " + prodRe + ";\n";
+            }else{
+                body += cType + " p_re = " + re(0) + ";\n";
+                body += cType + " p_im = " + im(0) + ";\n";
+                for(int input = 1; input<numInputs; input++){
+                    if(input < key.numRealInputs){
+                        body += "p_re *= " + re(input) + ";\n";
+                        body += "p_im *= " + re(input) + ";\n";
+                    }else{
+                        body += "{\n";
+                        body += cType + " tmp_re = p_re*" + re(input) + " - p_im*" + im(input) + ";\n";
+                        body += "p_im = p_re*" + im(input) + " + p_im*" + re(input) + ";\n";
+                        body += "p_re = tmp_re;\n";
+                        body += "}\n";
+                    }
+                }
+                body += outRe + " = p_re;\n";
+                body += outIm + " = p_im;\n";
+            }
+        }else{
+            return false;
+        }
+    }else if(nodeType == "Compare"){
+        if(numInputs != 2 || anyComplex){
+            return false;
+        }
+        outCType = "bool";
+        body += outRe + " = " + re(0) + " < " + re(1) + ";\n";
+    }else if(nodeType == "LogicalOperator" || nodeType == "BitwiseOperator"){
+        if(numInputs < 1 || anyComplex || (nodeType == "BitwiseOperator" && isFloat)){
+            return false;
+        }
+        bool isLogical = nodeType == "LogicalOperator";
+        if(isLogical){
+            outCType = "bool";
+        }
+        if(numInputs == 1){
+            body += outRe + " = " + (isLogical ? "!" : "~") + re(0) + ";\n";
+        }else{
+            std::string expr = re(0);
+            for(int input = 1; input<numInputs; input++){
+                expr += (isLogical ? " && " : " & ") + re(input);
+            }
+            body += outRe + " = " + expr + ";\n";
+        }
+    }else if(nodeType == "Atan" || nodeType == "Sin" || nodeType == "Cos" || nodeType == "Exp" || nodeType == "Ln" || nodeType == "Atan2"){
+        int expectedInputs = nodeType == "Atan2" ? 2 : 1;
+        if(numInputs != expectedInputs || anyComplex){
+            return false;
+        }
+        std::string fctn = nodeType == "Ln" ? "log" : nodeType == "Atan2" ? "atan2" : nodeType == "Atan" ? "atan" :
+                           nodeType == "Sin" ? "sin" : nodeType == "Cos" ? "cos" : "exp";
+        if(cType == "float"){
+            fctn += "f";
+        }else if(!isFloat){
+            outCType = "double";
+        }
+        body += outRe + " = " + fctn + "(" + re(0) + (expectedInputs == 2 ? ", " + re(1) : "") + ");\n";
+    }else if(nodeType == "Mux"){
+        //The first input is the selector
+        int dataInputs = numInputs-1;
+        if(dataInputs < 1){
+            return false;
+        }
+        outComplex = anyComplex;
+        body += "switch(((unsigned int) " + re(0) + ") % " + GeneralHelper::to_string(dataInputs) + "){\n";
+        for(int input = 1; input<numInputs; input++){
+            body += "case " + GeneralHelper::to_string(input-1) + ":\n";
+            body += outRe + " = " + re(input) + ";\n";
+            if(anyComplex){
+                body += outIm + " = " + im(input) + ";\n";
+            }
+            body += "break;\n";
+        }
+        body += "}\n";
+    }else if(nodeType == "Delay" || nodeType == "TappedDelay"){
+        if(numInputs != 1){
+            return false;
+        }
+        outComplex = anyComplex;
+        body += outRe + " = " + prefix + "_state_re[i];\n";
+        body += prefix + "_state_re[i] = " + re(0) + ";\n";
+        if(anyComplex){
+            body += outIm + " = " + prefix + "_state_im[i];\n";
+            body += prefix + "_state_im[i] = " + im(0) + ";\n";
+        }
+    }else if(nodeType == "DataTypeConversion"){
+        if(numInputs != 1){
+            return false;
+        }
+        outComplex = anyComplex;
+        outCType = isFloat ? "int32_t" : "float";
+        body += outRe + " = (" + outCType + ") " + re(0) + ";\n";
+        if(anyComplex){
+            body += outIm + " = (" + outCType + ") " + im(0) + ";\n";
+        }
+    }else if(nodeType == "Constant"){
+        body += outRe + " = (" + cType + ") 3;\n";
+    }else if(nodeType == "RealImagToComplex"){
+        if(numInputs != 2 || anyComplex){
+            return false;
+        }
+        outComplex = true;
+        body += outRe + " = " + re(0) + ";\n";
+        body += outIm + " = " + re(1) + ";\n";
+    }else if(nodeType == "Concatenate" || nodeType == "Reshape" || nodeType == "Select" ||
+             nodeType == "ComplexToRealImag" || nodeType == "ReinterpretCast" || nodeType == "DataTypeDuplicate"){
+        //These are copies of (some of) the input elements
+        if(numInputs < 1){
+            return false;
+        }
+        outComplex = anyComplex && nodeType != "ComplexToRealImag";
+        body += outRe + " = " + re(numInputs-1) + ";\n";
+        if(nodeType == "ComplexToRealImag" && anyComplex){
+            body += prefix + "_state_re[i] = " + im(numInputs-1) + ";\n";
+        }else if(outComplex){
+            body += outIm + " = " + im(numInputs-1) + ";\n";
+        }
+    }else{
+        return false;
+    }
+
+    return true;
+}
+
+int ComputationCostTable::emitCalibrationHarness(std::string path, std::string fileName,
+                                                 std::set<OperationKey> operations) {
+    //The baseline operation is used to set the fallback cost for operations which are not calibrated
+    OperationKey baseline("Sum", EstimatorCommon::OperandType::INT, 32, 2, 0, 1);
+
+    std::vector<OperationKey> kernelOps;
+    kernelOps.push_back(baseline);
+    std::vector<std::string> kernelDecls;
+    std::vector<std::string> kernelInits;
+    std::vector<std::string> kernelFctns;
+
+    for(auto it = operations.begin(); it != operations.end(); it++){
+        if(*it == baseline){
+            continue;
+        }
+        kernelOps.push_back(*it);
+    }
+
+    std::vector<OperationKey> includedOps;
+    for(const OperationKey &op : kernelOps){
+        std::string prefix = "k" + GeneralHelper::to_string(includedOps.size());
+        std::string cType = getCalibrationCType(op.operandType, op.operandBits);
+        std::string outCType;
+        bool outComplex;
+        std::string reductionInit;
+        std::string body;
+
+        if(!getCalibrationKernelBody(op, prefix, cType, outCType, outComplex, reductionInit, body)){
+            std::cout << "Unable to Calibrate Operation (Fallback Cost Will Be Used): " << op.toString() << std::endl;
+            continue;
+        }
+
+        std::string elements = "CALIBRATION_SAMPLES*" + GeneralHelper::to_string(op.vectorWidth);
+        int numInputs = op.numRealInputs + op.numCplxInputs;
+
+        //Arrays are not declared static so that stores to them are not optimized away
+        std::string decl = "//" + op.toString() + "\n";
+        std::string init = "";
+        for(int input = 0; input<numInputs; input++){
+            std::string inputName = prefix + "_in" + GeneralHelper::to_string(input);
+            std::string initVal = op.operandType == EstimatorCommon::OperandType::FLOAT ? "(" + cType + ") (1.0 + (i%7)*0.125)" : "(" + cType + ") 1";
+            decl += cType + " " + inputName + "_re[" + elements + "];\n";
+            init += "for(int i = 0; i<" + elements + "; i++){\n" + inputName + "_re[i] = " + initVal + ";\n";
+            if(input >= op.numRealInputs){
+                decl += cType + " " + inputName + "_im[" + elements + "];\n";
+                init += inputName + "_im[i] = " + initVal + ";\n";
+            }
+            init += "}\n";
+        }
+        decl += outCType + " " + prefix + "_out_re[" + elements + "];\n";
+        if(outComplex){
+            decl += outCType + " " + prefix + "_out_im[" + elements + "];\n";
+        }
+        if(body.find(prefix + "_state_") != std::string::npos){
+            decl += outCType + " " + prefix + "_state_re[" + elements + "];\n";
+            decl += outCType + " " + prefix + "_state_im[" + elements + "];\n";
+        }
+
+        std::string fctn = "__attribute__((noinline)) void " + prefix + "_kernel(){\n";
+        fctn += "for(int s = 0; s<CALIBRATION_SAMPLES; s++){\n";
+        if(!reductionInit.empty()){
+            fctn += outCType + " acc_re = " + reductionInit + ";\n";
+            fctn += outCType + " acc_im = 0;\n";
+        }
+        fctn += "for(int w = 0; w<" + GeneralHelper::to_string(op.vectorWidth) + "; w++){\n";
+        fctn += "int i = s*" + GeneralHelper::to_string(op.vectorWidth) + "+w;\n";
+        fctn += body;
+        fctn += "}\n";
+        if(!reductionInit.empty()){
+            fctn += prefix + "_out_re[s] = acc_re;\n";
+            if(outComplex){
+                fctn += prefix + "_out_im[s] = acc_im;\n";
+            }else{
+                fctn += "(void) acc_im;\n";
+            }
+        }
+        fctn += "}\n";
+        fctn += "}\n";
+
+        includedOps.push_back(op);
+        kernelDecls.push_back(decl);
+        kernelInits.push_back(init);
+        kernelFctns.push_back(fctn);
+    }
+
+    //#### Emit Harness ####
+    std::cout << "Emitting C File: " << path << "/" << fileName << ".c" << std::endl;
+    std::ofstream cFile;
+    cFile.open(path+"/"+fileName+".c", std::ofstream::out | std::ofstream::trunc);
+
+    cFile << "#include <stdio.h>" << std::endl;
+    cFile << "#include <stdint.h>" << std::endl;
+    cFile << "#include <stdbool.h>" << std::endl;
+    cFile << "#include <math.h>" << std::endl;
+    cFile << "#include <time.h>" << std::endl;
+    cFile << std::endl;
+    cFile << "//The number of samples processed in each call to a kernel" << std::endl;
+    cFile << "#define CALIBRATION_SAMPLES (1024)" << std::endl;
+    cFile << "//The minimum duration (in seconds) of each timing trial" << std::endl;
+    cFile << "#define CALIBRATION_MIN_TRIAL_SEC (0.02)" << std::endl;
+    cFile << "#define CALIBRATION_TRIALS (5)" << std::endl;
+    cFile << std::endl;
+
+    for(const std::string &decl : kernelDecls){
+        cFile << decl << std::endl;
+    }
+
+    for(const std::string &fctn : kernelFctns){
+        cFile << fctn << std::endl;
+    }
+
+    cFile << "double elapsedSec(struct timespec start, struct timespec stop){" << std::endl;
+    cFile << "return (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec)*1.0e-9;" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << std::endl;
+
+    cFile << "//Returns the best time (across several trials) in ns per sample" << std::endl;
+    cFile << "double timeKernel(void (*kernel)(void)){" << std::endl;
+    cFile << "struct timespec start, stop;" << std::endl;
+    cFile << "//Warmup and find the number of iterations required for each trial" << std::endl;
+    cFile << "kernel();" << std::endl;
+    cFile << "unsigned long iterations = 1;" << std::endl;
+    cFile << "while(1){" << std::endl;
+    cFile << "clock_gettime(CLOCK_MONOTONIC, &start);" << std::endl;
+    cFile << "for(unsigned long iter = 0; iter<iterations; iter++){" << std::endl;
+    cFile << "kernel();" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << "clock_gettime(CLOCK_MONOTONIC, &stop);" << std::endl;
+    cFile << "if(elapsedSec(start, stop) >= CALIBRATION_MIN_TRIAL_SEC){" << std::endl;
+    cFile << "break;" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << "iterations *= 2;" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << std::endl;
+    cFile << "double best = -1;" << std::endl;
+    cFile << "for(int trial = 0; trial<CALIBRATION_TRIALS; trial++){" << std::endl;
+    cFile << "clock_gettime(CLOCK_MONOTONIC, &start);" << std::endl;
+    cFile << "for(unsigned long iter = 0; iter<iterations; iter++){" << std::endl;
+    cFile << "kernel();" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << "clock_gettime(CLOCK_MONOTONIC, &stop);" << std::endl;
+    cFile << "double nsPerSample = elapsedSec(start, stop)*1.0e9/(((double) iterations)*CALIBRATION_SAMPLES);" << std::endl;
+    cFile << "if(best < 0 || nsPerSample < best){" << std::endl;
+    cFile << "best = nsPerSample;" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << "return best;" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << std::endl;
+
+    cFile << "int main(int argc, char* argv[]){" << std::endl;
+    cFile << "const char* costTableFilename = argc > 1 ? argv[1] : \"costTable.csv\";" << std::endl;
+    cFile << "FILE* costTable = fopen(costTableFilename, \"w\");" << std::endl;
+    cFile << "if(costTable == NULL){" << std::endl;
+    cFile << "fprintf(stderr, \"Unable to open %s\\n\", costTableFilename);" << std::endl;
+    cFile << "return 1;" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << std::endl;
+
+    for(const std::string &init : kernelInits){
+        cFile << init;
+    }
+    cFile << std::endl;
+
+    cFile << "double ns;" << std::endl;
+    for(int i = 0; i<includedOps.size(); i++){
+        std::string prefix = "k" + GeneralHelper::to_string(i);
+        cFile << "ns = timeKernel(" << prefix << "_kernel);" << std::endl;
+        cFile << "printf(\"" << includedOps[i].toString() << ": %f ns/sample\\n\", ns);" << std::endl;
+        if(i == 0){
+            //The baseline is an operation with 2 operands
+            cFile << "fprintf(costTable, \"# Generated by the compute cost calibration harness\\n\");" << std::endl;
+            cFile << "fprintf(costTable, \"fallbackNsPerOperandElement,%e\\n\", ns/2);" << std::endl;
+            cFile << "fprintf(costTable, \"#nodeType,operandType,operandBits,numRealInputs,numCplxInputs,vectorWidth,nsPerSample\\n\");" << std::endl;
+        }
+        cFile << "fprintf(costTable, \"" << includedOps[i].toString() << ",%e\\n\", ns);" << std::endl;
+    }
+    cFile << std::endl;
+
+    cFile << "fclose(costTable);" << std::endl;
+    cFile << "printf(\"Wrote cost table: %s\\n\", costTableFilename);" << std::endl;
+    cFile << "return 0;" << std::endl;
+    cFile << "}" << std::endl;
+
+    cFile.close();
+
+    //#### Emit Makefile ####
+    std::string makefileContent = "#Kernels are optimized in the same way as the generated system\n"
+                                  "CFLAGS = -Ofast -g -std=gnu11 -march=native\n"
+                                  "LIB = -lm\n"
+                                  "\n"
+                                  "all: " + fileName + "\n"
+                                  "\n"
+                                  + fileName + ": " + fileName + ".c\n"
+                                  "\t$(CC) $(CFLAGS) -o $@ $< $(LIB)\n"
+                                  "\n"
+                                  "clean:\n"
+                                  "\trm -f " + fileName + "\n"
+                                  "\n"
+                                  ".PHONY: all clean\n";
+
+    std::cout << "Emitting Makefile: " << path << "/Makefile_" << fileName << ".mk" << std::endl;
+    std::ofstream makefile;
+    makefile.open(path+"/Makefile_" + fileName + ".mk", std::ofstream::out | std::ofstream::trunc);
+    makefile << makefileContent;
+    makefile.close();
+
+    //The baseline is not counted as it was not requested
+    return includedOps.size() - (operations.find(baseline) == operations.end() ? 1 : 0);
+}
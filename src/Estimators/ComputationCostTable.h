@@ -0,0 +1,159 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_COMPUTATIONCOSTTABLE_H
+#define VITIS_COMPUTATIONCOSTTABLE_H
+
+#include "GraphCore/Node.h"
+#include "EstimatorCommon.h"
+#include <map>
+#include <set>
+#include <string>
+#include <memory>
+
+/**
+ * \addtogroup Estimators Estimators
+ * @{
+*/
+
+/**
+ * @brief A table of measured compute costs (in ns/sample) for operations on the target machine.
+ *
+ * The table is created by running a calibration harness emitted by emitCalibrationHarness on the target machine.
+ * Each entry is identified by the node type, operand type, operand width, number of real and complex inputs, and the
+ * vector width (number of elements per sample).
+ *
+ * The cost table file is a CSV file with the following format:
+ * @code
+ * fallbackNsPerOperandElement,<ns>
+ * <nodeType>,<INT|FLOAT>,<operandBits>,<numRealInputs>,<numCplxInputs>,<vectorWidth>,<ns/sample>
+ * ...
+ * @endcode
+ *
+ * Lines starting with # are comments.  The fallback cost is used for operations which are not present in the table
+ * (see ComputationEstimator::estimateNodeCost).
+ */
+class ComputationCostTable {
+public:
+    /**
+     * @brief Identifies an operation in the cost table
+     */
+    struct OperationKey{
+        std::string nodeType; ///<The node type (as reported by Node::typeNameStr)
+        EstimatorCommon::OperandType operandType; ///<The type of operands (int or float)
+        int operandBits; ///<The maximum number of bits per operand
+        int numRealInputs; ///<The number of real operands to the node
+        int numCplxInputs; ///<The number of complex operands to the node
+        int vectorWidth; ///<The number of elements per sample (the maximum across the ports of the node)
+
+        OperationKey();
+        OperationKey(std::string nodeType, EstimatorCommon::OperandType operandType, int operandBits, int numRealInputs, int numCplxInputs, int vectorWidth);
+
+        bool operator<(const OperationKey &rhs) const;
+        bool operator==(const OperationKey &rhs) const;
+
+        std::string toString() const;
+    };
+
+private:
+    std::map<OperationKey, double> nsPerSample; ///<The measured cost of each operation
+    double fallbackNsPerOperandElement; ///<The cost used for operations not in the table (per operand per element).  -1 if not set
+
+public:
+    /**
+     * @brief Creates an empty cost table
+     */
+    ComputationCostTable();
+
+    /**
+     * @brief Loads a cost table from a file produced by the calibration harness
+     * @param filename the cost table file
+     * @return the cost table
+     */
+    static ComputationCostTable load(std::string filename);
+
+    /**
+     * @brief Returns true if no costs have been loaded
+     */
+    bool empty() const;
+
+    /**
+     * @brief Gets the cost of the operation
+     * @param key the operation
+     * @return the cost in ns/sample or -1 if the operation is not in the table
+     */
+    double getNsPerSample(const OperationKey &key) const;
+
+    void setNsPerSample(const OperationKey &key, double ns);
+
+    double getFallbackNsPerOperandElement() const;
+
+    void setFallbackNsPerOperandElement(double fallbackNsPerOperandElement);
+
+    /**
+     * @brief Gets the operation performed by a node
+     *
+     * The operation is classified using ComputationEstimator::reportComputeInstances.  The vector width is the largest
+     * number of elements across the ports of the node, except for InnerProducts with folded coefficients (see
+     * InnerProduct::CoefSymmetry) where it is the number of coefficients (the number of multiplies).
+     *
+     * @param node the node to classify
+     * @param key set to the operation performed by the node
+     * @return true if the node performs an operation, false if it is not included in compute estimates (ex. subsystems)
+     */
+    static bool getOperationKey(std::shared_ptr<Node> node, OperationKey &key);
+
+    /**
+     * @brief Finds the set of distinct operations performed by the given nodes
+     * @param nodes the nodes to search
+     * @return the set of operations
+     */
+    static std::set<OperationKey> findOperations(std::vector<std::shared_ptr<Node>> nodes);
+
+    /**
+     * @brief Emits a microbenchmark harness which times a kernel for each operation and writes a cost table file
+     *
+     * A C file (fileName.c) and a makefile (Makefile_fileName.mk) are emitted.  When run on the target machine, the
+     * harness writes the cost table to the file given as its first argument (or costTable.csv if not given).
+     *
+     * Kernels are synthesized for the node types with a known C implementation.  Operations for other node types are
+     * reported and omitted from the harness (the fallback cost is used for them).
+     *
+     * @param path the directory to emit the harness into
+     * @param fileName the name of the harness (without extension)
+     * @param operations the operations to calibrate
+     * @return the number of operations included in the harness
+     */
+    static int emitCalibrationHarness(std::string path, std::string fileName, std::set<OperationKey> operations);
+
+    /**
+     * @brief Gets the C statements which implement one element of the operation in the calibration harness
+     *
+     * The statements reference the arrays prefix_in<n>_re, prefix_in<n>_im, prefix_out_re, prefix_out_im, and
+     * prefix_state_re, prefix_state_im indexed by i (the element index).  For operations which reduce the elements of
+     * a sample to a single output, the statements instead update the accumulators acc_re and acc_im (which are
+     * written to the output after all elements of the sample are processed).
+     *
+     * @param key the operation
+     * @param prefix the prefix for the arrays of this kernel
+     * @param cType the C type of the operands
+     * @param outCType set to the C type of the output
+     * @param outComplex set to true if the output is complex
+     * @param reductionInit set to the initial value of the accumulators if the operation reduces the elements of a
+     *                      sample to a single output.  Set to an empty string otherwise
+     * @param body set to the C statements
+     * @return true if a kernel can be synthesized for the operation
+     */
+    static bool getCalibrationKernelBody(const OperationKey &key, std::string prefix, std::string cType,
+                                         std::string &outCType, bool &outComplex, std::string &reductionInit, std::string &body);
+
+    /**
+     * @brief Gets the C type used for operands of the operation in the calibration harness
+     */
+    static std::string getCalibrationCType(EstimatorCommon::OperandType operandType, int operandBits);
+};
+
+/*! @} */
+
+#endif //VITIS_COMPUTATIONCOSTTABLE_H
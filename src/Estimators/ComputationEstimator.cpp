@@ -9,6 +9,9 @@
 #include "GraphCore/ContextFamilyContainer.h"
 #include "GraphCore/ContextContainer.h"
 #include "GraphCore/SubSystem.h"
+#include "MultiRate/ClockDomain.h"
+#include "MultiRate/MultiRateHelpers.h"
+#include "Emitter/MultiThreadEmit.h"
 #include <algorithm>
 #include <iostream>
 #include <cstdio>
@@ -79,6 +82,76 @@ ComputationEstimator::reportComputeInstances(std::vector<std::shared_ptr<Node>>
     return std::pair<std::map<EstimatorCommon::NodeOperation, int>, std::map<std::type_index, std::string>>(counts, names);
 }
 
+double ComputationEstimator::estimateNodeCost(std::shared_ptr<Node> node, const ComputationCostTable &costTable){
+    ComputationCostTable::OperationKey op;
+    if(!ComputationCostTable::getOperationKey(node, op)){
+        return 0;
+    }
+
+    if(!costTable.empty()){
+        double ns = costTable.getNsPerSample(op);
+        if(ns >= 0){
+            return ns;
+        }
+    }
+
+    //Nodes with no inputs (ex. constants) still have a nominal cost
+    int operands = std::max(1, op.numRealInputs + 2*op.numCplxInputs);
+    double cost = ((double) operands)*op.vectorWidth;
+
+    if(costTable.getFallbackNsPerOperandElement() >= 0){
+        cost *= costTable.getFallbackNsPerOperandElement();
+    }
+
+    return cost;
+}
+
+void ComputationEstimator::printEstimatedPartitionComputeTime(std::map<int, std::vector<std::shared_ptr<Node>>> partitions,
+                                                              const ComputationCostTable &costTable){
+    //Operations missing from the table are only converted to ns if the table has a fallback cost.  Otherwise, their cost
+    //is in operand elements and cannot be summed with the measured costs.  In that case, all nodes are reported in
+    //operand elements
+    bool reportNs = true;
+    if(costTable.getFallbackNsPerOperandElement() < 0){
+        for(auto it = partitions.begin(); it != partitions.end() && reportNs; it++){
+            if(it->first == IO_PARTITION_NUM){
+                continue;
+            }
+
+            for(const std::shared_ptr<Node> &node : it->second){
+                ComputationCostTable::OperationKey op;
+                if(ComputationCostTable::getOperationKey(node, op) && costTable.getNsPerSample(op) < 0){
+                    std::cerr << ErrorHelpers::genWarningStr("Cost table has no fallback cost and does not contain " + op.toString() + ", reporting partition compute in operand elements rather than ns") << std::endl;
+                    reportNs = false;
+                    break;
+                }
+            }
+        }
+    }
+    ComputationCostTable emptyCostTable;
+    const ComputationCostTable &reportCostTable = reportNs ? costTable : emptyCostTable;
+
+    printf("%9s | %36s\n", "Partition", reportNs ? "Est. ns/Base Rate Sample" : "Est. Operand Elements/Base Rate Sample");
+    for(auto it = partitions.begin(); it != partitions.end(); it++){
+        if(it->first == IO_PARTITION_NUM){
+            continue;
+        }
+
+        double cost = 0;
+        for(const std::shared_ptr<Node> &node : it->second){
+            double rate = 1;
+            std::shared_ptr<ClockDomain> clockDomain = MultiRateHelpers::findClockDomain(node);
+            if(clockDomain != nullptr){
+                std::pair<int, int> rateRelToBase = clockDomain->getRateRelativeToBase();
+                rate = ((double) rateRelToBase.first)/rateRelToBase.second;
+            }
+            cost += estimateNodeCost(node, reportCostTable)*rate;
+        }
+
+        printf("%9d | %36.3f\n", it->first, cost);
+    }
+}
+
 void ComputationEstimator::printComputeInstanceTable(
         std::map<int, std::map<EstimatorCommon::NodeOperation, int>> partitionOps,
         std::map<std::type_index, std::string> names) {
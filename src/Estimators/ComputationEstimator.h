@@ -7,6 +7,7 @@
 
 #include "GraphCore/Node.h"
 #include "EstimatorCommon.h"
+#include "ComputationCostTable.h"
 #include <typeindex>
 #include <string>
 
@@ -49,6 +50,41 @@ public:
 
     static void printComputeInstanceTable(std::map<int, std::map<EstimatorCommon::NodeOperation, int>> partitionOps, std::map<std::type_index, std::string> names);
 
+    /**
+     * @brief Estimates the compute cost of a single node per sample.
+     *
+     * If the operation performed by the node (see ComputationCostTable::getOperationKey) is in the cost table, the
+     * measured cost (in ns/sample) is returned.
+     *
+     * Otherwise, the cost is estimated by weighting the operation by its number of operands (complex operands count
+     * as 2) and by the number of elements processed per sample (for vector/matrix types, see
+     * ComputationCostTable::getOperationKey).  If the cost table contains
+     * a fallback cost, this is scaled by it to convert to ns/sample.  Otherwise, the result is a unitless heuristic which
+     * can only be used to compare the workload of different groups of nodes (ex. when balancing partitions).
+     *
+     * @param node the node to estimate the cost of
+     * @param costTable the calibrated cost table (may be empty)
+     * @return the cost of the node.  Nodes not included by reportComputeInstances have a cost of 0
+     */
+    static double estimateNodeCost(std::shared_ptr<Node> node, const ComputationCostTable &costTable = ComputationCostTable());
+
+    /**
+     * @brief Prints the estimated compute time of each partition (in ns per base rate sample) using estimateNodeCost.
+     *
+     * The cost of each node is scaled by the rate of the ClockDomain it resides in.  The I/O partition is not included.
+     *
+     * If a node's operation is not in the cost table and the table has no fallback cost, estimateNodeCost cannot
+     * report it in ns.  In this case, the costs of all nodes are reported in operand elements instead (and a warning is
+     * printed).
+     *
+     * @note This should be called before blocking is applied to the design since blocking changes the number of
+     * elements per sample at the ports of nodes.
+     *
+     * @param partitions the nodes in each partition
+     * @param costTable the calibrated cost table
+     */
+    static void printEstimatedPartitionComputeTime(std::map<int, std::vector<std::shared_ptr<Node>>> partitions, const ComputationCostTable &costTable);
+
     //TODO: Implement primitive op estimator versions of the above functions
     //TODO: Include casts in primitive op estimator
 
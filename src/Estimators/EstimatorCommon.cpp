@@ -90,10 +90,10 @@ bool EstimatorCommon::NodeOperationComparatorByName::operator()(const EstimatorC
 
 EstimatorCommon::InterThreadCommunicationWorkload::InterThreadCommunicationWorkload(int numBytesPerSample,
         int numBytesPerBlock, int numFIFOs) : numBytesPerSample(numBytesPerSample),
-        numBytesPerBlock(numBytesPerBlock), numFIFOs(numFIFOs) {
+        numBytesPerBlock(numBytesPerBlock), numFIFOs(numFIFOs), srcNUMANode(-1), dstNUMANode(-1) {
 }
 
 EstimatorCommon::InterThreadCommunicationWorkload::InterThreadCommunicationWorkload() :
-    numBytesPerSample(0), numBytesPerBlock(0), numFIFOs(0){
+    numBytesPerSample(0), numBytesPerBlock(0), numFIFOs(0), srcNUMANode(-1), dstNUMANode(-1){
 
 }
@@ -9,6 +9,7 @@
 #include <set>
 #include <typeindex>
 #include <string>
+#include "MultiThread/ThreadCrossingFIFOParameters.h"
 
 /**
  * \addtogroup Estimators Estimators
@@ -105,6 +106,9 @@ public:
         int numBytesPerSample; ///<The number of bytes per sample period that must be transfered from one partition to another
         int numBytesPerBlock; ///<The number of bytes per block.  This is typically the number of bytes per sample * the block size.
         int numFIFOs; ///<The number of FIFOs from one partition to another
+        std::set<ThreadCrossingFIFOParameters::FIFOPlacement> fifoPlacements; ///<The placements of the FIFOs from one partition to another
+        int srcNUMANode; ///<The NUMA node of the core the src partition is pinned to (-1 if unknown)
+        int dstNUMANode; ///<The NUMA node of the core the dst partition is pinned to (-1 if unknown)
 
         InterThreadCommunicationWorkload();
         InterThreadCommunicationWorkload(int numBytesPerSample, int numBytesPerBlock, int numFIFOs);
@@ -0,0 +1,332 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "DesignSpaceExploration.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <limits>
+#include <random>
+#include <set>
+#include <algorithm>
+#include <cctype>
+
+#include "General/ErrorHelpers.h"
+
+DesignSpaceExploration::Result::Result() : success(false), throughputMSps(0), latencyEstimateUs(0) {
+
+}
+
+DesignSpaceExploration::SweepParameter DesignSpaceExploration::parseSweepParameter(std::string str) {
+    size_t eqPos = str.find('=');
+    if(eqPos == std::string::npos || eqPos == 0 || eqPos == str.size()-1){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Sweep parameter must be of the form name=value1,value2,...: " + str));
+    }
+
+    SweepParameter param;
+    param.name = str.substr(0, eqPos);
+    if(param.name.size() > 2 && param.name.substr(0, 2) == "--"){
+        param.name = param.name.substr(2);
+    }
+
+    std::stringstream valueStream(str.substr(eqPos+1));
+    std::string value;
+    while(std::getline(valueStream, value, ',')){
+        if(value.empty()){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Sweep parameter has an empty value: " + str));
+        }
+        param.values.push_back(value);
+    }
+
+    return param;
+}
+
+unsigned long DesignSpaceExploration::getGridSize(const std::vector<SweepParameter> &params) {
+    unsigned long size = 1;
+    for(const SweepParameter &param : params){
+        if(param.values.empty()){
+            return 0;
+        }
+        if(size > std::numeric_limits<unsigned long>::max()/param.values.size()){
+            return std::numeric_limits<unsigned long>::max();
+        }
+        size *= param.values.size();
+    }
+    return size;
+}
+
+DesignSpaceExploration::Configuration DesignSpaceExploration::getGridConfiguration(const std::vector<SweepParameter> &params, unsigned long index) {
+    Configuration config(params.size());
+
+    //Mixed radix decode with the last parameter varying fastest
+    for(unsigned long i = params.size(); i>0; i--){
+        const SweepParameter &param = params[i-1];
+        config[i-1] = std::pair<std::string, std::string>(param.name, param.values[index % param.values.size()]);
+        index /= param.values.size();
+    }
+
+    return config;
+}
+
+std::vector<DesignSpaceExploration::Configuration> DesignSpaceExploration::enumerateGrid(const std::vector<SweepParameter> &params) {
+    unsigned long gridSize = getGridSize(params);
+
+    std::vector<Configuration> configs;
+    for(unsigned long i = 0; i<gridSize; i++){
+        configs.push_back(getGridConfiguration(params, i));
+    }
+
+    return configs;
+}
+
+std::vector<DesignSpaceExploration::Configuration> DesignSpaceExploration::sampleRandom(const std::vector<SweepParameter> &params, unsigned long budget, unsigned long seed) {
+    unsigned long gridSize = getGridSize(params);
+    if(budget >= gridSize){
+        return enumerateGrid(params);
+    }
+
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<unsigned long> dist(0, gridSize-1);
+
+    std::set<unsigned long> selected;
+    std::vector<Configuration> configs;
+    while(configs.size() < budget){
+        unsigned long index = dist(rng);
+        if(selected.insert(index).second){
+            configs.push_back(getGridConfiguration(params, index));
+        }
+    }
+
+    return configs;
+}
+
+std::vector<std::string> DesignSpaceExploration::configurationToArgs(const Configuration &config) {
+    std::vector<std::string> args;
+    for(const std::pair<std::string, std::string> &param : config){
+        if(param.second == "false"){
+            continue;
+        }
+        args.push_back("--" + param.first);
+        if(param.second != "true"){
+            args.push_back(param.second);
+        }
+    }
+    return args;
+}
+
+std::string DesignSpaceExploration::configurationToString(const Configuration &config) {
+    std::string str = "";
+    for(unsigned long i = 0; i<config.size(); i++){
+        if(i > 0){
+            str += " ";
+        }
+        str += config[i].first + "=" + config[i].second;
+    }
+    return str;
+}
+
+std::string DesignSpaceExploration::getTelemDumpFilePrefix(std::string designName, std::string telemDumpPrefix) {
+    return designName + "_" + telemDumpPrefix;
+}
+
+bool DesignSpaceExploration::isPartitionTelemDumpFile(std::string fileName, std::string telemDumpFilePrefix) {
+    const std::string extension = ".csv";
+    if(fileName.size() <= telemDumpFilePrefix.size() + extension.size() ||
+       fileName.compare(0, telemDumpFilePrefix.size(), telemDumpFilePrefix) != 0 ||
+       fileName.compare(fileName.size()-extension.size(), extension.size(), extension) != 0){
+        return false;
+    }
+
+    //The partition number may be negative
+    std::string partition = fileName.substr(telemDumpFilePrefix.size(), fileName.size()-telemDumpFilePrefix.size()-extension.size());
+    unsigned long start = partition[0] == '-' ? 1 : 0;
+    if(start >= partition.size()){
+        return false;
+    }
+    for(unsigned long i = start; i<partition.size(); i++){
+        if(!std::isdigit(static_cast<unsigned char>(partition[i]))){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DesignSpaceExploration::readTelemetryRate(std::string telemDumpFile, double &rateMSps) {
+    std::ifstream file(telemDumpFile);
+    if(!file.is_open()){
+        return false;
+    }
+
+    std::string line;
+    if(!std::getline(file, line)){
+        return false;
+    }
+
+    //Find the rate and total time columns in the header
+    long rateCol = -1;
+    long totalTimeCol = -1;
+    {
+        std::stringstream headerStream(line);
+        std::string colName;
+        long col = 0;
+        while(std::getline(headerStream, colName, ',')){
+            if(colName == "Rate_msps"){
+                rateCol = col;
+            }else if(colName == "TotalTime_s"){
+                totalTimeCol = col;
+            }
+            col++;
+        }
+    }
+    if(rateCol < 0){
+        return false;
+    }
+
+    //Only the last 2 complete reports are needed
+    std::vector<double> rates;
+    std::vector<double> totalTimes;
+    while(std::getline(file, line)){
+        std::vector<std::string> entries;
+        {
+            std::stringstream lineStream(line);
+            std::string entry;
+            while(std::getline(lineStream, entry, ',')){
+                entries.push_back(entry);
+            }
+        }
+
+        //A partially written line (ex. if the benchmark was stopped while writing) is skipped
+        if((long) entries.size() <= rateCol || (long) entries.size() <= totalTimeCol){
+            continue;
+        }
+        try{
+            double rate = std::stod(entries[rateCol]);
+            double totalTime = totalTimeCol >= 0 ? std::stod(entries[totalTimeCol]) : 0;
+            rates.push_back(rate);
+            totalTimes.push_back(totalTime);
+        }catch(std::invalid_argument &e){
+            continue;
+        }
+    }
+
+    if(rates.empty()){
+        return false;
+    }
+
+    //Rate_msps is the average rate since the start of the benchmark (rxSamples/TotalTime_s).  The rate between the
+    //last 2 reports is found from the number of samples processed between them so that the startup period is excluded.
+    unsigned long last = rates.size()-1;
+    if(last > 0 && totalTimeCol >= 0 && totalTimes[last] > totalTimes[last-1]){
+        double samplesLast = rates[last]*totalTimes[last];
+        double samplesPrev = rates[last-1]*totalTimes[last-1];
+        rateMSps = (samplesLast-samplesPrev)/(totalTimes[last]-totalTimes[last-1]);
+    }else{
+        rateMSps = rates[last];
+    }
+
+    return true;
+}
+
+double DesignSpaceExploration::estimateLatencyUs(unsigned long blockSize, unsigned long fifoLength, double throughputMSps) {
+    if(throughputMSps <= 0){
+        return std::numeric_limits<double>::infinity();
+    }
+
+    //Msamples/s is samples/us
+    double blockPeriodUs = blockSize/throughputMSps;
+    return blockPeriodUs*(fifoLength+1);
+}
+
+bool DesignSpaceExploration::dominates(const Result &a, const Result &b) {
+    if(!a.success){
+        return false;
+    }
+    if(!b.success){
+        return true;
+    }
+
+    bool noWorse = a.throughputMSps >= b.throughputMSps && a.latencyEstimateUs <= b.latencyEstimateUs;
+    bool better = a.throughputMSps > b.throughputMSps || a.latencyEstimateUs < b.latencyEstimateUs;
+    return noWorse && better;
+}
+
+std::vector<unsigned long> DesignSpaceExploration::findParetoFront(const std::vector<Result> &results) {
+    std::vector<unsigned long> front;
+
+    for(unsigned long i = 0; i<results.size(); i++){
+        if(!results[i].success){
+            continue;
+        }
+
+        bool dominated = false;
+        for(unsigned long j = 0; j<results.size() && !dominated; j++){
+            dominated = j != i && dominates(results[j], results[i]);
+        }
+
+        if(!dominated){
+            front.push_back(i);
+        }
+    }
+
+    return front;
+}
+
+long DesignSpaceExploration::selectBest(const std::vector<Result> &results, const std::vector<unsigned long> &paretoFront) {
+    long best = -1;
+    for(unsigned long ind : paretoFront){
+        if(best < 0 || results[ind].throughputMSps > results[best].throughputMSps ||
+           (results[ind].throughputMSps == results[best].throughputMSps && results[ind].latencyEstimateUs < results[best].latencyEstimateUs)){
+            best = ind;
+        }
+    }
+    return best;
+}
+
+void DesignSpaceExploration::writeResultsCSV(std::string filename, const std::vector<SweepParameter> &params,
+                                             const std::vector<Result> &results,
+                                             const std::vector<unsigned long> &paretoFront) {
+    std::ofstream file;
+    file.open(filename, std::ofstream::out | std::ofstream::trunc);
+    if(!file.is_open()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unable to write design space exploration results: " + filename));
+    }
+
+    std::set<unsigned long> onFront(paretoFront.begin(), paretoFront.end());
+
+    file << "Variant";
+    for(const SweepParameter &param : params){
+        file << "," << param.name;
+    }
+    file << ",Status,Throughput_msps,LatencyEstimate_us,ParetoFront" << std::endl;
+
+    for(unsigned long i = 0; i<results.size(); i++){
+        file << i;
+        for(const std::pair<std::string, std::string> &param : results[i].config){
+            file << "," << param.second;
+        }
+        if(results[i].success){
+            file << ",ok," << results[i].throughputMSps << "," << results[i].latencyEstimateUs;
+        }else{
+            file << "," << results[i].failedStage << "_failed,,";
+        }
+        file << "," << (onFront.find(i) != onFront.end() ? "true" : "false") << std::endl;
+    }
+
+    file.close();
+}
+
+std::string DesignSpaceExploration::shellQuote(std::string str) {
+    std::string quoted = "'";
+    for(char c : str){
+        if(c == '\''){
+            quoted += "'\\''";
+        }else{
+            quoted += c;
+        }
+    }
+    quoted += "'";
+    return quoted;
+}
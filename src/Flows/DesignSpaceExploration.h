@@ -0,0 +1,179 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_DESIGNSPACEEXPLORATION_H
+#define VITIS_DESIGNSPACEEXPLORATION_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+/**
+ * \addtogroup Flows Compiler Flows
+ * @{
+ */
+
+/**
+ * @brief Helpers for sweeping the parameters of the multi-threaded generator and selecting the best configuration
+ *
+ * A sweep is described by a set of parameters, each with a list of values.  The parameter names are the names of
+ * multiThreadedGenerator command line options (without the leading --).  Configurations are either every combination
+ * of the values (a grid) or a random subset of the grid.
+ *
+ * Each configuration is generated, built, and benchmarked by the designSpaceExplorer tool.  The throughput is taken
+ * from the telemetry dump files written by the compute partitions.  Since the emitted benchmarks do not timestamp
+ * individual samples, the latency is estimated from the throughput, block size, and FIFO length (see estimateLatencyUs)
+ */
+namespace DesignSpaceExploration {
+    /**
+     * @brief A parameter to sweep and the values it takes
+     */
+    struct SweepParameter{
+        std::string name; ///<The name of the multiThreadedGenerator option (without the leading --)
+        std::vector<std::string> values; ///<The values the parameter takes
+    };
+
+    /**
+     * @brief A configuration is a value for each swept parameter, in the order the parameters were given
+     */
+    typedef std::vector<std::pair<std::string, std::string>> Configuration;
+
+    /**
+     * @brief The result of benchmarking a single configuration
+     */
+    struct Result{
+        Configuration config; ///<The configuration
+        bool success; ///<True if the configuration was generated, built, and benchmarked successfully
+        std::string failedStage; ///<If not successful, the stage which failed (generate, build, run, or telemetry)
+        double throughputMSps; ///<The throughput of the slowest partition in Msamples/s (at the base rate)
+        double latencyEstimateUs; ///<The estimated latency in microseconds (see estimateLatencyUs)
+
+        Result();
+    };
+
+    /**
+     * @brief Parses a sweep parameter of the form name=value1,value2,...
+     *
+     * Throws an error if the string is malformed
+     */
+    SweepParameter parseSweepParameter(std::string str);
+
+    /**
+     * @brief Gets the number of configurations in the grid formed by the parameters.  Saturates at the maximum value of
+     * an unsigned long
+     */
+    unsigned long getGridSize(const std::vector<SweepParameter> &params);
+
+    /**
+     * @brief Gets the configuration at a given index of the grid formed by the parameters.  The last parameter varies
+     * fastest
+     */
+    Configuration getGridConfiguration(const std::vector<SweepParameter> &params, unsigned long index);
+
+    /**
+     * @brief Gets every configuration in the grid formed by the parameters
+     */
+    std::vector<Configuration> enumerateGrid(const std::vector<SweepParameter> &params);
+
+    /**
+     * @brief Selects distinct configurations from the grid formed by the parameters at random
+     *
+     * If the budget is at least the size of the grid, the entire grid is returned (in order)
+     *
+     * @param params the parameters to sweep
+     * @param budget the number of configurations to select
+     * @param seed the seed for the random number generator
+     * @return the selected configurations in the order they were selected
+     */
+    std::vector<Configuration> sampleRandom(const std::vector<SweepParameter> &params, unsigned long budget, unsigned long seed);
+
+    /**
+     * @brief Converts a configuration into multiThreadedGenerator command line arguments
+     *
+     * Values of true and false are treated as flags.  A true flag is passed as --name while false flags are omitted
+     */
+    std::vector<std::string> configurationToArgs(const Configuration &config);
+
+    /**
+     * @brief Gets a human readable string for the configuration (ex. blockSize=4 fifoLength=16)
+     */
+    std::string configurationToString(const Configuration &config);
+
+    /**
+     * @brief Gets the prefix of the telemetry dump files written by a design emitted with the given --telemDumpPrefix
+     *
+     * The design name is prepended to the prefix in the same way as MultiThreadGenerator::emitMultiThreadedC
+     */
+    std::string getTelemDumpFilePrefix(std::string designName, std::string telemDumpPrefix);
+
+    /**
+     * @brief Checks if a file is the telemetry dump file of a compute partition (ie. <telemDumpFilePrefix><partition>.csv)
+     *
+     * Other files sharing the prefix, such as the I/O thread telemetry (<telemDumpFilePrefix>IO.csv) and the telemetry
+     * configuration (<telemDumpFilePrefix>telemConfig.json), are rejected
+     *
+     * @param fileName the name of the file (without the directory)
+     * @param telemDumpFilePrefix the prefix returned by getTelemDumpFilePrefix
+     */
+    bool isPartitionTelemDumpFile(std::string fileName, std::string telemDumpFilePrefix);
+
+    /**
+     * @brief Reads the rate reported in a partition telemetry dump file
+     *
+     * Each Rate_msps report is the average rate since the start of the benchmark.  The rate is computed from the
+     * samples processed between the last 2 complete reports (using the TotalTime_s column) so that the startup period
+     * is excluded.  If there is only one complete report, its Rate_msps is used.
+     *
+     * @param telemDumpFile the telemetry dump file
+     * @param rateMSps set to the rate
+     * @return true if the file contained at least one report, false otherwise
+     */
+    bool readTelemetryRate(std::string telemDumpFile, double &rateMSps);
+
+    /**
+     * @brief Estimates the latency of a configuration in microseconds
+     *
+     * The block period (the time to process one block at the measured throughput) is multiplied by the number of
+     * blocks which can be in flight in a FIFO hop (the FIFO length plus the block being processed).  This is an upper
+     * bound for a single partition crossing, not a measured end to end latency
+     *
+     * @param blockSize the block size (in samples) at the base rate
+     * @param fifoLength the length of the FIFOs (in blocks)
+     * @param throughputMSps the throughput in Msamples/s
+     */
+    double estimateLatencyUs(unsigned long blockSize, unsigned long fifoLength, double throughputMSps);
+
+    /**
+     * @brief Checks if result a dominates result b (higher or equal throughput and lower or equal latency with at least
+     * one strictly better).  Unsuccessful results are dominated by any successful result and never dominate
+     */
+    bool dominates(const Result &a, const Result &b);
+
+    /**
+     * @brief Finds the indexes of the successful results which are not dominated by any other result
+     */
+    std::vector<unsigned long> findParetoFront(const std::vector<Result> &results);
+
+    /**
+     * @brief Selects the best configuration from the Pareto front.  This is the configuration on the front with the
+     * highest throughput (ties broken by the lowest latency)
+     * @return the index of the best result or -1 if no result was successful
+     */
+    long selectBest(const std::vector<Result> &results, const std::vector<unsigned long> &paretoFront);
+
+    /**
+     * @brief Writes the results to a CSV file with a column per swept parameter
+     */
+    void writeResultsCSV(std::string filename, const std::vector<SweepParameter> &params,
+                         const std::vector<Result> &results, const std::vector<unsigned long> &paretoFront);
+
+    /**
+     * @brief Quotes a string so that it is passed as a single argument by the shell
+     */
+    std::string shellQuote(std::string str);
+};
+
+/*! @} */
+
+#endif //VITIS_DESIGNSPACEEXPLORATION_H
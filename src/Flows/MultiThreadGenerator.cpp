@@ -11,8 +11,10 @@
 #include "Passes/DesignPasses.h"
 #include "Passes/DomainPasses.h"
 #include "Passes/ContextPasses.h"
+#include "Passes/PartitioningPasses.h"
 #include "MultiRate/MultiRateHelpers.h"
 #include "MultiThread/LocklessInPlaceThreadCrossingFIFO.h"
+#include "MultiThread/LocklessBatchedCommitThreadCrossingFIFO.h"
 #include "MultiThread/LocklessThreadCrossingFIFO.h"
 #include "Estimators/CommunicationEstimator.h"
 #include "GraphMLTools/GraphMLExporter.h"
@@ -22,21 +24,40 @@
 #include "MultiThread/StreamIOThread.h"
 #include "MultiThread/ThreadCrossingFIFO.h"
 #include "PrimitiveNodes/TappedDelay.h"
+#include "PassProfiler.h"
+#include "Emitter/IncrementalEmit.h"
 
 #include <iostream>
+#include <sstream>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
 
 void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path, std::string fileName, std::string designName,
                                 SchedParams::SchedType schedType, TopologicalSortParameters schedParams,
                                 ThreadCrossingFIFOParameters::ThreadCrossingFIFOType fifoType, bool emitGraphMLSched,
-                                bool printSched, int fifoLength, unsigned long blockSize, unsigned long subBlockSize,
+                                bool printSched, int fifoLength, int fifoCommitBatch, unsigned long blockSize, unsigned long subBlockSize,
+                                PartitionParams::PartitionType partitioner, int numAutoPartitions, bool refinePartitions,
+                                ComputationCostTable costTable,
                                 bool propagatePartitionsFromSubsystems, bool propagateSubBlockingFromSubsystems,
                                 std::vector<int> partitionMap, bool threadDebugPrint,
-                                int ioFifoSize, bool printTelem, std::string telemDumpPrefix,
+                                int ioFifoSize, int socketBatchBlocks, int socketBufferSize, bool socketZeroCopy,
+                                bool sharedMemFutex, bool sharedMemHugePages,
+                                bool printTelem, std::string telemDumpPrefix,
                                 EmitterHelpers::TelemetryLevel telemLevel, int telemCheckBlockFreq, double telemReportPeriodSec,
                                 unsigned long memAlignment, bool useSCHEDFIFO,
                                 PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                                PartitionParams::FIFOWaitPolicy fifoWaitPolicy, int fifoWaitSpins,
                                 MultiThreadEmit::ComputeIODoubleBufferType fifoDoubleBuffer,
-                                std::string pipeNameSuffix) {
+                                std::string pipeNameSuffix, std::string passTimingReport, int jobs,
+                                bool incrementalEmit, bool fifoEarlyPublish,
+                                PartitionParams::NUMAAllocPolicy numaAllocPolicy,
+                                ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement,
+                                SIMDHelpers::SIMDTarget simdTarget,
+                                EmitterHelpers::ComplexLayout complexLayout) {
+
+    PassProfiler passProfiler(design, !passTimingReport.empty());
 
     if(!telemDumpPrefix.empty()){
         telemDumpPrefix = fileName+"_"+telemDumpPrefix;
@@ -49,6 +70,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     design.getVisMaster()->setPartitionNum(IO_PARTITION_NUM);
     //Do not set a base sub-blocking length for the I/O nodes
 
+    passProfiler.startPass("Propagate Partitions and Sub-Blocking");
     //==== Propagate Properties from Subsystems ====
     if(propagatePartitionsFromSubsystems){
         MultiThreadPasses::propagatePartitionsFromSubsystemsToChildren(design);
@@ -64,6 +86,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
         DomainPasses::propagateSubBlockingFromSubsystemsToChildren(design);
     }
 
+    passProfiler.startPass("Prune");
     //==== Prune ====
     DesignPasses::prune(design, true);
 
@@ -76,6 +99,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
 
     DesignPasses::pruneUnconnectedArcs(design, true);
 
+    passProfiler.startPass("Clock Domain Discovery and Specialization");
     //=== Handle Clock Domains ===
     //Should do this after all pruning has taken place (and all node disconnects have taken place)
     //Should do after disconnects take place so that no arcs are going to the terminator master as the clock domain
@@ -96,6 +120,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //This also converts RateChangeNodes to Input or Output implementations.
     //This is done before other operations since these operations replace the objects because the class is changed to a subclass
 
+    passProfiler.startPass("Create Clock Domain Support Nodes");
     //AfterSpecialization, create support nodes for clockdomains, particularly DownsampleClockDomains
     DomainPasses::createClockDomainSupportNodes(design, clockDomains, false, false); //Have not done context discovery & marking yet so do not request context inclusion
     design.assignNodeIDs();
@@ -104,6 +129,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //Check the ClockDomain rates are appropriate
     MultiRateHelpers::validateClockDomainRates(clockDomains);
 
+    passProfiler.startPass("Expand Enabled Subsystem Contexts");
     //==== Proceed with Context Discovery ====
     //This is an optimization pass to widen the enabled subsystem context
     ContextPasses::expandEnabledSubsystemContexts(design);
@@ -121,10 +147,25 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //Cleanup empty branches of the hierarchy after nodes moved under enabled subsystem contexts
     //cleanupEmptyHierarchy("it was empty or all underlying nodes were moved");
 
+    passProfiler.startPass("Partitioning");
     //==== Partitioning ====
-    //TODO: Partition Here
-    //      Currently done manually
+    //Manual partitioning is accomplished with VITIS_PARTITION directives which were propagated above
+    //Automatic partitioning is done after ClockDomain specialization (so that rates are known) and after enabled
+    //subsystem contexts are expanded (so that EnableNodes are in their final positions)
+    if(partitioner == PartitionParams::PartitionType::AUTO){
+        PartitioningPasses::autoPartition(design, numAutoPartitions, 0.1, true, costTable);
+    }
+    if(refinePartitions){
+        PartitioningPasses::refinePartitions(design, 10, true, costTable);
+    }
+    if(!costTable.empty()){
+        //Reported before blocking since blocking changes the number of elements processed by each node
+        std::cout << "Partition Estimated Compute Time Report:" << std::endl;
+        ComputationEstimator::printEstimatedPartitionComputeTime(design.findPartitions(), costTable);
+        std::cout << std::endl;
+    }
 
+    passProfiler.startPass("Assign Partitions to Unassigned Subsystems");
     //==== Set Partitions of Subsystems That Are Currently Unassigned ====
     //This can happen towards the top level of the design when subsystems are used for organization.  It is possible all nodes are assigned a partition
     //but some of these upper level
@@ -133,14 +174,17 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
 
     DesignPasses::assignSubBlockingLengthToUnassignedSubsystems(design, true, true);
 
+    passProfiler.startPass("Place Enable Nodes in Partitions");
     //==== Context Encapsulation Preparation (Organizing Contexts and Dealing with Contexts that Cross Partitions) ====
     //Assign EnableNodes to partitions do before encapsulation and Context/StateUpdate node creation, but after EnabledSubsystem expansion so that EnableNodes are moved/created/deleted as appropriate ahead of time
     ContextPasses::placeEnableNodesInPartitions(design);
 
+    passProfiler.startPass("Context Discovery and Marking");
     //TODO: If FIFO Insertion Moved to Before this Point:
     //      Modify to not stop at FIFOs with no initial state when finding Mux contexts.  FIFOs with initial state are are treated as containing delays.  FIFOs without initial state treated like wires.
     ContextPasses::discoverAndMarkContexts(design);
 
+    passProfiler.startPass("Replicate Context Root Drivers");
     //Replicate ContextRoot Drivers (if should be replicated) for each partition
     //Do this after ContextDiscovery and Marking but before encapsulation
     ContextPasses::replicateContextRootDriversIfRequested(design);
@@ -156,6 +200,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
         GraphMLExporter::exportGraphML(path + "/" + graphMLAfterBlockingFileName, design);
     }
 
+    passProfiler.startPass("Blocking and Sub-Blocking");
     //TODO: Insert blocking and sub-blocking logic here?  Done before context, encpsulation, and FIFO insertion and may effectivly replace determining if a partition has a single clock domain
     //      Done after context discovery because that is when mux contexts are identified but encapsulation has not yet occured
     //      Because it is done after context discovery, sub-blocking needs to update the context stack for nodes
@@ -167,6 +212,11 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
 
     DomainPasses::setMasterBlockSizesBasedOnPortClockDomain(design, blockSize);
 
+    passProfiler.startPass("Fuse Polyphase FIRs");
+    //Fuse FIRs with adjacent Downsamples/Upsamples in vector mode clock domains so that discarded outputs and zero
+    //stuffed inputs are skipped.  Done after blocking so that the sub-blocking lengths and vector modes are known
+    DomainPasses::fusePolyphaseFIRs(design);
+
     if(emitGraphMLSched) {
         //Export GraphML (for debugging)
         std::string graphMLAfterBlockingFileName = fileName + "_afterBlocking.graphml";
@@ -183,6 +233,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //TODO: Modify to check for ContextRootDrivers per partition
     //orderConstrainZeroInputNodes(); //Do this after the contexts being marked since this constraint should not have an impact on contexts
 
+    passProfiler.startPass("Encapsulate Contexts");
     //==== Encapsulate Contexts ====
     //TODO: fix encapsuleate to duplicate driver arc for each ContextFamilyContainer in other partitions
     //to the given partition and add an out
@@ -193,6 +244,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //Cleanup empty branches of the hierarchy after nodes moved under enabled subsystem contexts
     //cleanupEmptyHierarchy("all underlying nodes were moved durring context encapsulation");
 
+    passProfiler.startPass("Create Context Variable Update Nodes");
     //==== Create Context Variable Update Nodes ====
 
     //TODO: investigate moving
@@ -202,6 +254,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     design.assignNodeIDs(); //Need to assign node IDs since the node ID is used for set ordering and new nodes may have been added
     design.assignArcIDs();
 
+    passProfiler.startPass("Insert FIFOs");
     //==== Insert and Configure FIFOs (but do not ingest Delays) ====
     //** Done before state variable updates created
     //Also should be before state update nodes created since FIFOs can absorb delay nodes (which should not create state update nodes)
@@ -230,6 +283,9 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
             case ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_INPLACE_X86:
                 fifoMap = MultiThreadPasses::insertPartitionCrossingFIFOs<LocklessInPlaceThreadCrossingFIFO>(partitionCrossings, new_nodes, deleted_nodes, new_arcs, deleted_arcs);
                 break;
+            case ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_BATCHED_COMMIT_X86:
+                fifoMap = MultiThreadPasses::insertPartitionCrossingFIFOs<LocklessBatchedCommitThreadCrossingFIFO>(partitionCrossings, new_nodes, deleted_nodes, new_arcs, deleted_arcs);
+                break;
             default:
                 throw std::runtime_error(
                         ErrorHelpers::genErrorStr("Unsupported Thread Crossing FIFO Type for Multithreaded Emit"));
@@ -258,6 +314,11 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //Set FIFO length and block size here (do before delay ingest)
     for(int i = 0; i<fifoVec.size(); i++){
         fifoVec[i]->setFifoLength(fifoLength);
+
+        std::shared_ptr<LocklessBatchedCommitThreadCrossingFIFO> fifoAsBatchedCommit = std::dynamic_pointer_cast<LocklessBatchedCommitThreadCrossingFIFO>(fifoVec[i]);
+        if(fifoAsBatchedCommit){
+            fifoAsBatchedCommit->setCommitBatch(fifoCommitBatch);
+        }
     }
 
     //Since FIFOs are placed in the src partition and context (unless the src is an EnableOutput or RateChange output),
@@ -270,6 +331,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //TODO: Retime Here
     //      Not currently implemented
 
+    passProfiler.startPass("Absorb Delays into FIFOs");
     //==== FIFO Delay Ingest ====
     //Should be before state update nodes created since FIFOs can absorb delay nodes (which should not create state update nodes)
     //Currently, only nodes that are soley connected to FIFOs are absorbed.  It is possible to absorb other nodes but delay matching
@@ -289,6 +351,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     design.assignNodeIDs();
     design.assignArcIDs();
 
+    passProfiler.startPass("Merge FIFOs");
     //==== Merge FIFOs ====
     //Clock domain was already set for each FIFO above and will be used in the FIFO merge
     //      Add FIFO merge here (so long as on demand / lazy eval FIFOs in conditional execution regions are not considered)
@@ -321,6 +384,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     design.assignNodeIDs();
     design.assignArcIDs();
 
+    passProfiler.startPass("Specialize Deferred Delays");
     //Specialize Deferred delays
     DomainPasses::specializeDeferredDelays(design);
     design.assignNodeIDs();
@@ -347,6 +411,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
         }
     }
 
+    passProfiler.startPass("Report FIFOs and Check for Deadlock");
     //==== Report FIFOs ====
     std::cout << std::endl;
     std::cout << "========== FIFO Report ==========" << std::endl;
@@ -393,6 +458,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     //Check for deadlock among partitions
     CommunicationEstimator::checkForDeadlock(design, designName, path);
 
+    passProfiler.startPass("Create State Update Nodes");
     //==== FIFO Merge Cleanup ====
     //Need to rebuild fifoVec, inputFIFOs, and outputFIFOs, since merging may have occurred
     fifoVec.clear();
@@ -410,6 +476,20 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
         outputFIFOsRef.insert(outputFIFOsRef.end(), it->second.begin(), it->second.end());
     }
 
+    //==== Resolve FIFO Placement ====
+    //FIFOs without a placement annotation on their crossing use the global placement.  If no global placement was given,
+    //FIFOs are placed with the producer when relying on first touch and with the consumer when the allocation is bound
+    if(fifoPlacement == ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){
+        fifoPlacement = numaAllocPolicy == PartitionParams::NUMAAllocPolicy::FIRST_TOUCH ?
+                        ThreadCrossingFIFOParameters::FIFOPlacement::PRODUCER :
+                        ThreadCrossingFIFOParameters::FIFOPlacement::CONSUMER;
+    }
+    for(const std::shared_ptr<ThreadCrossingFIFO> &fifo : fifoVec){
+        if(fifo->getFifoPlacement() == ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){
+            fifo->setFifoPlacement(fifoPlacement);
+        }
+    }
+
     //==== Create State Update Nodes ====
     //Create state update nodes after delay absorption to avoid creating dependencies that would inhibit delay absorption
     DesignPasses::createStateUpdateNodes(design, true); //Done after EnabledSubsystem Contexts are expanded to avoid issues with deleting and re-wiring EnableOutputs
@@ -425,12 +505,15 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
         }
     }
 
+    passProfiler.startPass("Schedule Partitions");
     //==== Schedule Operations within Partitions ===
     IntraPartitionScheduling::scheduleTopologicalStort(design, schedParams, false, true, designName, path, printSched, true); //Pruned before inserting state update nodes
 
+    passProfiler.startPass("Verify Schedule");
     //Verify the schedule
     design.verifyTopologicalOrder(false, schedType);
 
+    passProfiler.startPass("Report Schedule and Partitions");
     //==== Report Schedule and Partition Information ====
     //Emit the schedule (as a graph)
     std::string graphMLSchedFileName = "";
@@ -465,26 +548,27 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     ComputationEstimator::printComputeInstanceTable(counts, names);
     std::cout << std::endl;
 
-    std::map<std::pair<int, int>, EstimatorCommon::InterThreadCommunicationWorkload> commWorkloads = CommunicationEstimator::reportCommunicationWorkload(fifoMap);
+    std::map<std::pair<int, int>, EstimatorCommon::InterThreadCommunicationWorkload> commWorkloads = CommunicationEstimator::reportCommunicationWorkload(fifoMap, partitionMap);
     std::cout << "Partition Communication Report:" << std::endl;
     CommunicationEstimator::printComputeInstanceTable(commWorkloads);
     std::cout << std::endl;
 
+    passProfiler.startPass("Emit Support Files");
     //==== Emit Design ====
 
     //Emit Types
     EmitterHelpers::stringEmitTypeHeader(path);
 
     //Emit FIFO header (get struct descriptions from FIFOs)
-    std::string fifoHeaderName = MultiThreadEmit::emitFIFOStructHeader(path, fileName, fifoVec);
+    std::string fifoHeaderName = MultiThreadEmit::emitFIFOStructHeader(path, fileName, fifoVec, complexLayout);
 
     //Emit FIFO Support File
     std::set<ThreadCrossingFIFOParameters::CopyMode> copyModesUsed = MultiThreadEmit::findFIFOCopyModesUsed(fifoVec);
-    std::string fifoSupportHeaderName = MultiThreadEmit::emitFIFOSupportFile(path, fileName, copyModesUsed);
+    std::string fifoSupportHeaderName = MultiThreadEmit::emitFIFOSupportFile(path, fileName, copyModesUsed, fifoWaitPolicy, fifoWaitSpins);
 
     //Emit other support files
     MultiThreadEmit::writePlatformParameters(path, VITIS_PLATFORM_PARAMS_NAME, memAlignment);
-    MultiThreadEmit::writeNUMAAllocHelperFiles(path, VITIS_NUMA_ALLOC_HELPERS);
+    MultiThreadEmit::writeNUMAAllocHelperFiles(path, VITIS_NUMA_ALLOC_HELPERS, numaAllocPolicy);
 
     //====Emit PAPI Helpers====
     std::vector<std::string> otherCFiles;
@@ -496,9 +580,28 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
         otherCFiles.push_back(papiHelperCFile);
     }
 
+    passProfiler.startPass("Emit Partitions");
+    //==== Set SIMD Target ====
+    //Set after blocking since blocking specialization and expansion can replace nodes
+    DesignPasses::setSIMDTarget(design, simdTarget);
+
     //==== Emit Partitions ====
 
     //Emit partition functions (computation function and driver function)
+    //Each partition is emitted to its own files so partitions can be emitted concurrently.  The state which is shared
+    //between partitions (FIFOs and the maps of FIFOs) is created before the workers are started so that the workers
+    //only read it.  The status messages of each partition are buffered and printed in partition order so that the
+    //output is identical to emitting the partitions serially
+    //If incremental emit is used, the partitions are emitted to a staging directory and are only moved to the output
+    //directory if their contents differ from the files already there
+    std::string partitionPath = path;
+    if(incrementalEmit){
+        IncrementalEmit::prepareStagingDir(path);
+        partitionPath = IncrementalEmit::getStagingDir(path);
+    }
+
+    std::vector<int> partitionsToEmit;
+    std::vector<std::set<std::shared_ptr<ClockDomain>>> clockDomainsInPartitions;
     for(auto partitionBeingEmitted = partitions.begin(); partitionBeingEmitted != partitions.end(); partitionBeingEmitted++){
         //Emit each partition (except -2, handle specially)
         if(partitionBeingEmitted->first != IO_PARTITION_NUM) {
@@ -507,18 +610,87 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
             //TODO: FIFOs: Discover clock domains and set index expr before calling emitter
 
             //Find the clock domains in this partition.  This is used to create count variables for clock domains not operating in vector mode.
-            std::set<std::shared_ptr<ClockDomain>> clockDomainsInPartition = MultiRateHelpers::findClockDomainsOfNodes(partitionBeingEmitted->second);
-
-            MultiThreadEmit::emitPartitionThreadC(partitionBeingEmitted->first, partitionBeingEmitted->second,
-                                                  inputFIFOs[partitionBeingEmitted->first], outputFIFOs[partitionBeingEmitted->first],
-                                                  clockDomainsInPartition,
-                                                  path, fileName, designName, schedType, design.getOutputMaster(), blockSize, fifoHeaderName,
-                                                  fifoSupportHeaderName,
-                                                  threadDebugPrint, printTelem,
-                                                  telemLevel, telemCheckBlockFreq, telemReportPeriodSec,
-                                                  telemDumpPrefix, false, papiHelperHFile,
-                                                  fifoIndexCachingBehavior, fifoDoubleBuffer);
+            clockDomainsInPartitions.push_back(MultiRateHelpers::findClockDomainsOfNodes(partitionBeingEmitted->second));
+            partitionsToEmit.push_back(partitionBeingEmitted->first);
+
+            //Create the entries for partitions without input or output FIFOs
+            inputFIFOs[partitionBeingEmitted->first];
+            outputFIFOs[partitionBeingEmitted->first];
+        }
+    }
+
+    for(unsigned long i = 0; i<fifoVec.size(); i++){
+        fifoVec[i]->initializeCVars();
+    }
+
+    std::vector<std::string> partitionStatus(partitionsToEmit.size());
+    std::vector<std::exception_ptr> partitionErrors(partitionsToEmit.size());
+    std::atomic<unsigned long> nextPartitionToEmit(0);
+    std::atomic<bool> partitionEmitFailed(false);
+
+    auto emitPartitionWorker = [&](){
+        //Stop taking new partitions once one has failed (as the serial emitter would)
+        for(unsigned long i = nextPartitionToEmit++; i<partitionsToEmit.size() && !partitionEmitFailed; i = nextPartitionToEmit++){
+            int partitionNum = partitionsToEmit[i];
+            std::ostringstream statusOut;
+            try {
+                MultiThreadEmit::emitPartitionThreadC(partitionNum, partitions.at(partitionNum),
+                                                      inputFIFOs.at(partitionNum), outputFIFOs.at(partitionNum),
+                                                      clockDomainsInPartitions[i],
+                                                      partitionPath, fileName, designName, schedType, design.getOutputMaster(), blockSize, fifoHeaderName,
+                                                      fifoSupportHeaderName,
+                                                      threadDebugPrint, printTelem,
+                                                      telemLevel, telemCheckBlockFreq, telemReportPeriodSec,
+                                                      telemDumpPrefix, false, papiHelperHFile,
+                                                      fifoIndexCachingBehavior, fifoWaitPolicy, fifoDoubleBuffer,
+                                                      fifoEarlyPublish, complexLayout, statusOut);
+            }catch(...){
+                partitionErrors[i] = std::current_exception();
+                partitionEmitFailed = true;
+            }
+            partitionStatus[i] = statusOut.str();
+        }
+    };
+
+    //If jobs is <1, a worker is started for each hardware thread
+    unsigned long numEmitWorkers = jobs > 0 ? jobs : std::thread::hardware_concurrency();
+    numEmitWorkers = std::min(numEmitWorkers, (unsigned long) partitionsToEmit.size());
+    if(numEmitWorkers > 1) {
+        std::vector<std::thread> emitWorkers;
+        for (unsigned long i = 0; i < numEmitWorkers; i++) {
+            emitWorkers.push_back(std::thread(emitPartitionWorker));
+        }
+        for (unsigned long i = 0; i < emitWorkers.size(); i++) {
+            emitWorkers[i].join();
+        }
+    }else{
+        emitPartitionWorker();
+    }
+
+    //Report in partition order.  The first error (in partition order) is re-thrown after the messages of the partitions
+    //before it are printed
+    for(unsigned long i = 0; i<partitionsToEmit.size(); i++){
+        std::cout << partitionStatus[i];
+        if(partitionErrors[i] != nullptr){
+            std::rethrow_exception(partitionErrors[i]);
+        }
+    }
+
+    if(incrementalEmit){
+        unsigned long unchangedFiles = 0;
+        for(unsigned long i = 0; i<partitionsToEmit.size(); i++){
+            int partitionNum = partitionsToEmit[i];
+            std::string partitionFileName = fileName+"_partition"+(partitionNum >= 0?GeneralHelper::to_string(partitionNum):"N"+GeneralHelper::to_string(-partitionNum));
+            for(const std::string &ext : std::vector<std::string>{".h", ".c"}){
+                if(IncrementalEmit::commitFile(path, partitionFileName + ext)){
+                    std::cout << "Updated C File: " << path << "/" << partitionFileName << ext << std::endl;
+                }else{
+                    unchangedFiles++;
+                }
+            }
         }
+        IncrementalEmit::removeStagingDir(path);
+        std::cout << "Incremental Emit: " << unchangedFiles << " of " << partitionsToEmit.size()*2 << " partition files unchanged" << std::endl;
     }
 
     EmitterHelpers::emitParametersHeader(path, fileName, blockSize);
@@ -553,6 +725,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
         MultiThreadEmit::writeTelemConfigJSONFile(path, telemDumpPrefix, designName, partitionToCPU, IO_PARTITION_NUM, graphMLSchedFileName);
     }
 
+    passProfiler.startPass("Emit Const I/O Driver");
     //====Emit I/O Divers====
     std::set<int> partitionSet;
     for(auto it = partitions.begin(); it != partitions.end(); it++){
@@ -562,7 +735,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     std::vector<Variable> inputVars = design.getCInputVariables();
 
     //++++Emit Const I/O Driver++++
-    ConstIOThread::emitConstIOThreadC(inputFIFOs[IO_PARTITION_NUM], outputFIFOs[IO_PARTITION_NUM], path, fileName, designName, blockSize, fifoHeaderName, fifoSupportHeaderName, threadDebugPrint, fifoIndexCachingBehavior);
+    ConstIOThread::emitConstIOThreadC(inputFIFOs[IO_PARTITION_NUM], outputFIFOs[IO_PARTITION_NUM], path, fileName, designName, blockSize, fifoHeaderName, fifoSupportHeaderName, threadDebugPrint, fifoIndexCachingBehavior, fifoWaitPolicy);
     std::string constIOSuffix = "io_const";
 
     //Emit the startup function (aka the benchmark kernel)
@@ -576,6 +749,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
                                                    constIOSuffix, false, otherCFiles,
                                                    !papiHelperHFile.empty(), !partitionMap.empty());
 
+    passProfiler.startPass("Emit Linux Pipe I/O Driver");
     //++++Emit Linux Pipe I/O Driver++++
     StreamIOThread::emitFileStreamHelpers(path, fileName);
     std::vector<std::string> otherCFilesFileStream = otherCFiles;
@@ -587,7 +761,9 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
                                         outputFIFOs[IO_PARTITION_NUM], path, fileName, designName,
                                         StreamIOThread::StreamType::PIPE, blockSize, fifoHeaderName, fifoSupportHeaderName, 0, threadDebugPrint, printTelem,
                                         telemLevel, telemCheckBlockFreq, telemReportPeriodSec, telemDumpPrefix, false,
-                                        fifoIndexCachingBehavior, pipeNameSuffix);
+                                        fifoIndexCachingBehavior, fifoWaitPolicy,
+                                        socketBatchBlocks, socketBufferSize, socketZeroCopy,
+                                        sharedMemFutex, sharedMemHugePages, pipeNameSuffix);
 
     //Emit the startup function (aka the benchmark kernel)
     MultiThreadEmit::emitMultiThreadedBenchmarkKernel(fifoMap, inputFIFOs, outputFIFOs, partitionSet, path, fileName, designName, fifoHeaderName, fifoSupportHeaderName, pipeIOSuffix, partitionMap, papiHelperHFile, useSCHEDFIFO);
@@ -596,13 +772,14 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     MultiThreadEmit::emitMultiThreadedMain(path, fileName, designName, pipeIOSuffix, inputVars);
 
     //Emit the client handlers
-    StreamIOThread::emitSocketClientLib(design.getInputMaster(), design.getOutputMaster(), path, fileName, fifoHeaderName, designName);
+    StreamIOThread::emitSocketClientLib(design.getInputMaster(), design.getOutputMaster(), path, fileName, fifoHeaderName, designName, socketBufferSize);
 
     //Emit the benchmark makefile
     MultiThreadEmit::emitMultiThreadedMakefileMain(path, fileName, designName, partitionSet,
                                                    pipeIOSuffix, false, otherCFilesFileStream,
                                                    !papiHelperHFile.empty(), !partitionMap.empty());
 
+    passProfiler.startPass("Emit Socket I/O Driver");
     //++++Emit Socket Pipe I/O Driver++++
     std::string socketIOSuffix = "io_network_socket";
     StreamIOThread::emitStreamIOThreadC(design.getInputMaster(), design.getOutputMaster(), inputFIFOs[IO_PARTITION_NUM],
@@ -610,7 +787,9 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
                                         StreamIOThread::StreamType::SOCKET, blockSize,
                                         fifoHeaderName, fifoSupportHeaderName, 0, threadDebugPrint, printTelem,
                                         telemLevel, telemCheckBlockFreq, telemReportPeriodSec, telemDumpPrefix, false,
-                                        fifoIndexCachingBehavior, pipeNameSuffix);
+                                        fifoIndexCachingBehavior, fifoWaitPolicy,
+                                        socketBatchBlocks, socketBufferSize, socketZeroCopy,
+                                        sharedMemFutex, sharedMemHugePages, pipeNameSuffix);
 
     //Emit the startup function (aka the benchmark kernel)
     MultiThreadEmit::emitMultiThreadedBenchmarkKernel(fifoMap, inputFIFOs, outputFIFOs, partitionSet, path, fileName, designName, fifoHeaderName, fifoSupportHeaderName, socketIOSuffix, partitionMap, papiHelperHFile, useSCHEDFIFO);
@@ -623,6 +802,7 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
                                                    socketIOSuffix, false, otherCFilesFileStream,
                                                    !papiHelperHFile.empty(), !partitionMap.empty());
 
+    passProfiler.startPass("Emit POSIX Shared Memory I/O Driver");
     //++++Emit POSIX Shared Memory FIFO Driver++++
     std::string sharedMemoryFIFOSuffix = "io_posix_shared_mem";
     std::string sharedMemoryFIFOCFileName = "BerkeleySharedMemoryFIFO.c";
@@ -631,7 +811,9 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
                                         StreamIOThread::StreamType::POSIX_SHARED_MEM, blockSize,
                                         fifoHeaderName, fifoSupportHeaderName, ioFifoSize, threadDebugPrint, printTelem,
                                         telemLevel, telemCheckBlockFreq, telemReportPeriodSec, telemDumpPrefix, false,
-                                        fifoIndexCachingBehavior, pipeNameSuffix);
+                                        fifoIndexCachingBehavior, fifoWaitPolicy,
+                                        socketBatchBlocks, socketBufferSize, socketZeroCopy,
+                                        sharedMemFutex, sharedMemHugePages, pipeNameSuffix);
 
     //Emit the startup function (aka the benchmark kernel)
     MultiThreadEmit::emitMultiThreadedBenchmarkKernel(fifoMap, inputFIFOs, outputFIFOs, partitionSet, path, fileName, designName, fifoHeaderName, fifoSupportHeaderName, sharedMemoryFIFOSuffix, partitionMap, papiHelperHFile, useSCHEDFIFO);
@@ -645,4 +827,64 @@ void MultiThreadGenerator::emitMultiThreadedC(Design &design, std::string path,
     MultiThreadEmit::emitMultiThreadedMakefileMain(path, fileName, designName, partitionSet,
                                                    sharedMemoryFIFOSuffix, true, otherCFilesSharedMem,
                                                    !papiHelperHFile.empty(), !partitionMap.empty());
-}
\ No newline at end of file
+
+    passProfiler.startPass("Emit Lockless POSIX Shared Memory I/O Driver");
+    //++++Emit Lockless POSIX Shared Memory FIFO Driver++++
+    std::string locklessSharedMemoryFIFOSuffix = "io_posix_shared_mem_lockless";
+    std::string locklessSharedMemoryFIFOCFileName = "LocklessSharedMemoryFIFO.c";
+    StreamIOThread::emitStreamIOThreadC(design.getInputMaster(), design.getOutputMaster(), inputFIFOs[IO_PARTITION_NUM],
+                                        outputFIFOs[IO_PARTITION_NUM], path, fileName, designName,
+                                        StreamIOThread::StreamType::POSIX_SHARED_MEM_LOCKLESS, blockSize,
+                                        fifoHeaderName, fifoSupportHeaderName, ioFifoSize, threadDebugPrint, printTelem,
+                                        telemLevel, telemCheckBlockFreq, telemReportPeriodSec, telemDumpPrefix, false,
+                                        fifoIndexCachingBehavior, fifoWaitPolicy,
+                                        socketBatchBlocks, socketBufferSize, socketZeroCopy,
+                                        sharedMemFutex, sharedMemHugePages, pipeNameSuffix);
+
+    //Emit the startup function (aka the benchmark kernel)
+    MultiThreadEmit::emitMultiThreadedBenchmarkKernel(fifoMap, inputFIFOs, outputFIFOs, partitionSet, path, fileName, designName, fifoHeaderName, fifoSupportHeaderName, locklessSharedMemoryFIFOSuffix, partitionMap, papiHelperHFile, useSCHEDFIFO);
+
+    //Emit the benchmark driver
+    MultiThreadEmit::emitMultiThreadedMain(path, fileName, designName, locklessSharedMemoryFIFOSuffix, inputVars);
+
+    //Emit the benchmark makefile
+    std::vector<std::string> otherCFilesLocklessSharedMem = otherCFiles;
+    otherCFilesLocklessSharedMem.push_back(locklessSharedMemoryFIFOCFileName);
+    MultiThreadEmit::emitMultiThreadedMakefileMain(path, fileName, designName, partitionSet,
+                                                   locklessSharedMemoryFIFOSuffix, true, otherCFilesLocklessSharedMem,
+                                                   !papiHelperHFile.empty(), !partitionMap.empty());
+
+    passProfiler.startPass("Emit io_uring I/O Driver");
+    //++++Emit io_uring Linux Pipe I/O Driver++++
+    //Uses the same named pipes as the Linux Pipe I/O driver but reads and writes through io_uring (requires liburing)
+    std::string ioUringIOSuffix = "io_linux_uring";
+    StreamIOThread::emitStreamIOThreadC(design.getInputMaster(), design.getOutputMaster(), inputFIFOs[IO_PARTITION_NUM],
+                                        outputFIFOs[IO_PARTITION_NUM], path, fileName, designName,
+                                        StreamIOThread::StreamType::IO_URING, blockSize,
+                                        fifoHeaderName, fifoSupportHeaderName, ioFifoSize, threadDebugPrint, printTelem,
+                                        telemLevel, telemCheckBlockFreq, telemReportPeriodSec, telemDumpPrefix, false,
+                                        fifoIndexCachingBehavior, fifoWaitPolicy,
+                                        socketBatchBlocks, socketBufferSize, socketZeroCopy,
+                                        sharedMemFutex, sharedMemHugePages, pipeNameSuffix);
+
+    //Emit the startup function (aka the benchmark kernel)
+    MultiThreadEmit::emitMultiThreadedBenchmarkKernel(fifoMap, inputFIFOs, outputFIFOs, partitionSet, path, fileName, designName, fifoHeaderName, fifoSupportHeaderName, ioUringIOSuffix, partitionMap, papiHelperHFile, useSCHEDFIFO);
+
+    //Emit the benchmark driver
+    MultiThreadEmit::emitMultiThreadedMain(path, fileName, designName, ioUringIOSuffix, inputVars);
+
+    //Emit the benchmark makefile
+    std::vector<std::string> ioUringLibs = {"-luring"};
+    MultiThreadEmit::emitMultiThreadedMakefileMain(path, fileName, designName, partitionSet,
+                                                   ioUringIOSuffix, false, otherCFiles,
+                                                   !papiHelperHFile.empty(), !partitionMap.empty(), ioUringLibs);
+
+    //==== Report Pass Timing ====
+    passProfiler.finish();
+    if(passProfiler.isEnabled()){
+        std::cout << std::endl;
+        passProfiler.printReport();
+        passProfiler.writeReport(passTimingReport);
+        std::cout << std::endl;
+    }
+}
@@ -7,6 +7,8 @@
 
 #include "GraphCore/Design.h"
 #include "General/TopologicalSortParameters.h"
+#include "Estimators/ComputationCostTable.h"
+#include "General/SIMDHelpers.h"
 
 /**
  * \addtogroup Flows Compiler Flows
@@ -43,13 +45,23 @@ namespace MultiThreadGenerator {
      * @param designName The name of the design (used as the function name)
      * @param schedType Schedule type
      * @param fifoLength the length of the FIFOs in blocks
+     * @param fifoCommitBatch the number of blocks read/written before the FIFO offsets are published.  Only used when fifoType is LOCKLESS_BATCHED_COMMIT_X86
      * @param blockSize the block size
      * @param subBlockSize the sub-block size
+     * @param partitioner the partitioner to use.  If AUTO, the design is partitioned by PartitioningPasses::autoPartition and any partition directives in the design are ignored
+     * @param numAutoPartitions the number of partitions to create when the partitioner is AUTO
+     * @param refinePartitions if true, the partitioning is refined by PartitioningPasses::refinePartitions to reduce the estimated maximum partition workload and inter-partition communication
+     * @param costTable the calibrated compute cost table used when partitioning.  If not empty, the estimated compute time of each partition is reported
      * @param propagatePartitionsFromSubsystems if true, propagates partition information from subsystems to children (from VITIS_PARTITION directives for example)
      * @param propagateSubBlockingFromSubsystems if true, propagates sub-blocking information from subsystems to children (from VITIS_SUBBLOCKING directives for example)
      * @param partitionMap a vector indicating the mapping of partitions to logical CPUs.  The first element is the I/O thread.  The subsequent entries are for partitions 0, 1, 2, .... If an empty array, I/O thread is placed on CPU0 and the other partitions are placed on the CPU that equals their partition number (ex. partition 1 is placed on CPU1)
      * @param threadDebugPrint if true, inserts print statements into the generated code which indicate the progress of the different threads as they execute
-     * @param ioFifoSize the I/O FIFO size in blocks to allocate (only used for shared memory FIFO I/O)
+     * @param ioFifoSize the I/O FIFO size in blocks to allocate (only used for shared memory FIFO and io_uring I/O)
+     * @param socketBatchBlocks if >0, the socket I/O driver moves up to this many blocks per system call through receive/transmit buffers of this size (in blocks)
+     * @param socketBufferSize if >0, the SO_RCVBUF/SO_SNDBUF size in bytes requested by the socket I/O driver and client library
+     * @param socketZeroCopy if true, the batched socket I/O driver sends with MSG_ZEROCOPY
+     * @param sharedMemFutex if true, blocking reads/writes of the lockless shared memory FIFOs sleep on a futex after spinning
+     * @param sharedMemHugePages if true, the lockless shared memory FIFOs are backed by huge pages
      * @param printTelem if true, telemetry is printed
      * @param telemDumpPrefix if not empty, specifies a file prefix into which telemetry from each compute thread is dumped
      * @param telemLevel the level of telemetry collected
@@ -58,22 +70,43 @@ namespace MultiThreadGenerator {
      * @param memAlignment the aligment (in bytes) used for FIFO buffer allocation
      * @param useSCHEDFIFO if true, pthreads are created which will request to be run with the max RT priority under the linux SCHED_FIFO scheduler
      * @param fifoIndexCachingBehavior indicates when FIFOs check the head/tail pointers and when they rely on a priori information first
+     * @param fifoWaitPolicy indicates what threads do while waiting on FIFOs
+     * @param fifoWaitSpins for the FUTEX wait policy, the number of failed FIFO checks before a thread is parked
      * @param fifoDoubleBuffer indicates what FIFO double buffering behavior to use
      * @param pipeNameSuffix defines as a suffix to be appended to the names of POSIX Pipes or Shared Memory streams
+     * @param passTimingReport if not empty, the wall time, node/arc counts, and peak RSS delta of each stage of the flow are recorded (see PassProfiler), printed, and written to this file (CSV if it ends in .csv, JSON otherwise)
+     * @param jobs the number of worker threads used to emit the partitions concurrently.  If <1, one worker is used per hardware thread.  The emitted files are identical regardless of the number of workers
+     * @param incrementalEmit if true, partition files whose contents are identical to the files already in the output directory are not rewritten so that their timestamps are preserved (see IncrementalEmit)
+     * @param fifoEarlyPublish if true, each output FIFO is written as soon as the node feeding it has been computed and each input FIFO is acquired just before its first consumer (see MultiThreadEmit::emitPartitionThreadC).  Requires in-place FIFOs
+     * @param numaAllocPolicy the policy used when allocating FIFO arrays (see PartitionParams::NUMAAllocPolicy)
+     * @param fifoPlacement the placement of FIFOs whose partition crossing does not have a placement annotation (see ThreadCrossingFIFOParameters::FIFOPlacement).  If DEFAULT, FIFOs are placed with the producer for the FIRST_TOUCH NUMA alloc policy and with the consumer otherwise
+     * @param simdTarget the SIMD target to emit explicit vector code for InnerProduct, Sum, and Product nodes (see SIMDHelpers).  If NONE, vectorization is left to the C compiler
+     * @param complexLayout the placement of the real and imaginary planes of complex values within the FIFO and partition state structures (see EmitterHelpers::ComplexLayout)
      */
     void emitMultiThreadedC(Design &design, std::string path, std::string fileName, std::string designName,
                             SchedParams::SchedType schedType, TopologicalSortParameters schedParams,
                             ThreadCrossingFIFOParameters::ThreadCrossingFIFOType fifoType,
-                            bool emitGraphMLSched, bool printSched, int fifoLength, unsigned long blockSize,
+                            bool emitGraphMLSched, bool printSched, int fifoLength, int fifoCommitBatch, unsigned long blockSize,
                             unsigned long subBlockSize,
+                            PartitionParams::PartitionType partitioner, int numAutoPartitions, bool refinePartitions,
+                            ComputationCostTable costTable,
                             bool propagatePartitionsFromSubsystems, bool propagateSubBlockingFromSubsystems,
                             std::vector<int> partitionMap,
-                            bool threadDebugPrint, int ioFifoSize, bool printTelem, std::string telemDumpPrefix,
+                            bool threadDebugPrint, int ioFifoSize,
+                            int socketBatchBlocks, int socketBufferSize, bool socketZeroCopy,
+                            bool sharedMemFutex, bool sharedMemHugePages,
+                            bool printTelem, std::string telemDumpPrefix,
                             EmitterHelpers::TelemetryLevel telemLevel, int telemCheckBlockFreq, double telemReportPeriodSec,
                             unsigned long memAlignment, bool useSCHEDFIFO,
                             PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                            PartitionParams::FIFOWaitPolicy fifoWaitPolicy, int fifoWaitSpins,
                             MultiThreadEmit::ComputeIODoubleBufferType fifoDoubleBuffer,
-                            std::string pipeNameSuffix);
+                            std::string pipeNameSuffix, std::string passTimingReport = "", int jobs = 1,
+                            bool incrementalEmit = false, bool fifoEarlyPublish = false,
+                            PartitionParams::NUMAAllocPolicy numaAllocPolicy = PartitionParams::NUMAAllocPolicy::FIRST_TOUCH,
+                            ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement = ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT,
+                            SIMDHelpers::SIMDTarget simdTarget = SIMDHelpers::SIMDTarget::NONE,
+                            EmitterHelpers::ComplexLayout complexLayout = EmitterHelpers::ComplexLayout::SPLIT_PACKED);
 
 };
 
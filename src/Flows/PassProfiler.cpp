@@ -0,0 +1,149 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "PassProfiler.h"
+
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <sys/resource.h>
+
+#include "General/GeneralHelper.h"
+#include "General/ErrorHelpers.h"
+
+PassProfiler::PassRecord::PassRecord() : wallTimeSec(0), nodesBefore(0), nodesAfter(0), arcsBefore(0), arcsAfter(0),
+                                         peakRSSKB(0), peakRSSDeltaKB(0) {
+
+}
+
+PassProfiler::PassProfiler(Design &design, bool enabled) : design(design), enabled(enabled), passInProgress(false) {
+
+}
+
+long PassProfiler::getPeakRSSKB() {
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0){
+        return 0;
+    }
+    return usage.ru_maxrss; //Reported in KiB on Linux
+}
+
+void PassProfiler::startPass(std::string name) {
+    if(!enabled){
+        return;
+    }
+
+    endPass();
+
+    currentPass = PassRecord();
+    currentPass.name = name;
+    currentPass.nodesBefore = design.getNodes().size();
+    currentPass.arcsBefore = design.getArcs().size();
+    currentPass.peakRSSKB = getPeakRSSKB();
+    passInProgress = true;
+
+    //Start the timer last so that collecting the counts is not included
+    currentPassStart = std::chrono::steady_clock::now();
+}
+
+void PassProfiler::endPass() {
+    if(!enabled || !passInProgress){
+        return;
+    }
+
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    currentPass.wallTimeSec = std::chrono::duration<double>(stop - currentPassStart).count();
+
+    currentPass.nodesAfter = design.getNodes().size();
+    currentPass.arcsAfter = design.getArcs().size();
+    long peakRSSBefore = currentPass.peakRSSKB;
+    currentPass.peakRSSKB = getPeakRSSKB();
+    currentPass.peakRSSDeltaKB = currentPass.peakRSSKB - peakRSSBefore;
+
+    passes.push_back(currentPass);
+    passInProgress = false;
+}
+
+void PassProfiler::finish() {
+    endPass();
+}
+
+std::vector<PassProfiler::PassRecord> PassProfiler::getPasses() const {
+    return passes;
+}
+
+bool PassProfiler::isEnabled() const {
+    return enabled;
+}
+
+void PassProfiler::printReport() const {
+    double totalTime = 0;
+    for(const PassRecord &pass : passes){
+        totalTime += pass.wallTimeSec;
+    }
+
+    std::cout << "Pass Timing Report:" << std::endl;
+    printf("%-45s %12s %7s %10s %10s %10s %10s %14s\n", "Pass", "Time (ms)", "%", "Nodes", "dNodes", "Arcs", "dArcs", "dPeakRSS (KiB)");
+    for(const PassRecord &pass : passes){
+        printf("%-45s %12.3f %7.2f %10lu %10ld %10lu %10ld %14ld\n", pass.name.c_str(), pass.wallTimeSec*1000,
+               totalTime > 0 ? pass.wallTimeSec/totalTime*100 : 0,
+               pass.nodesAfter, ((long) pass.nodesAfter) - ((long) pass.nodesBefore),
+               pass.arcsAfter, ((long) pass.arcsAfter) - ((long) pass.arcsBefore),
+               pass.peakRSSDeltaKB);
+    }
+    printf("%-45s %12.3f\n", "Total", totalTime*1000);
+    std::cout << "Peak RSS (KiB): " << getPeakRSSKB() << std::endl;
+    std::cout.flush();
+}
+
+void PassProfiler::writeReport(std::string filename) const {
+    std::ofstream reportFile;
+    reportFile.open(filename, std::ofstream::out | std::ofstream::trunc);
+    if(!reportFile.is_open()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unable to open pass timing report: " + filename));
+    }
+
+    std::cout << "Emitting Pass Timing Report: " << filename << std::endl;
+
+    bool csv = filename.size() >= 4 && filename.compare(filename.size()-4, 4, ".csv") == 0;
+
+    if(csv){
+        reportFile << "Pass,WallTime_s,NodesBefore,NodesAfter,ArcsBefore,ArcsAfter,PeakRSS_KiB,PeakRSSDelta_KiB" << std::endl;
+        for(const PassRecord &pass : passes){
+            reportFile << "\"" << pass.name << "\"," << GeneralHelper::to_string(pass.wallTimeSec) << ","
+                       << pass.nodesBefore << "," << pass.nodesAfter << ","
+                       << pass.arcsBefore << "," << pass.arcsAfter << ","
+                       << pass.peakRSSKB << "," << pass.peakRSSDeltaKB << std::endl;
+        }
+    }else{
+        double totalTime = 0;
+        for(const PassRecord &pass : passes){
+            totalTime += pass.wallTimeSec;
+        }
+
+        reportFile << "{" << std::endl;
+        reportFile << "\t\"totalWallTimeSec\": " << GeneralHelper::to_string(totalTime) << "," << std::endl;
+        reportFile << "\t\"peakRSSKB\": " << getPeakRSSKB() << "," << std::endl;
+        reportFile << "\t\"passes\": [" << std::endl;
+        for(unsigned long i = 0; i<passes.size(); i++){
+            const PassRecord &pass = passes[i];
+            reportFile << "\t\t{\"name\": \"" << pass.name << "\", "
+                       << "\"wallTimeSec\": " << GeneralHelper::to_string(pass.wallTimeSec) << ", "
+                       << "\"nodesBefore\": " << pass.nodesBefore << ", "
+                       << "\"nodesAfter\": " << pass.nodesAfter << ", "
+                       << "\"arcsBefore\": " << pass.arcsBefore << ", "
+                       << "\"arcsAfter\": " << pass.arcsAfter << ", "
+                       << "\"peakRSSKB\": " << pass.peakRSSKB << ", "
+                       << "\"peakRSSDeltaKB\": " << pass.peakRSSDeltaKB << "}";
+            if(i < passes.size()-1){
+                reportFile << ",";
+            }
+            reportFile << std::endl;
+        }
+        reportFile << "\t]" << std::endl;
+        reportFile << "}" << std::endl;
+    }
+
+    reportFile.close();
+}
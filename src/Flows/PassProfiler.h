@@ -0,0 +1,121 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_PASSPROFILER_H
+#define VITIS_PASSPROFILER_H
+
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "GraphCore/Design.h"
+
+/**
+ * \addtogroup Flows Compiler Flows
+ * @{
+ */
+
+/**
+ * @brief Records the wall time, node/arc counts, and peak memory usage of each stage (pass) of a compiler flow.
+ *
+ * Stages are delimited by calls to startPass.  Starting a pass ends the previous one, allowing the profiler to be
+ * threaded through a flow with a single call at the start of each stage.  finish ends the last pass.
+ *
+ * The peak resident set size (RSS) of the process is obtained from getrusage.  Since this is a high water mark, the
+ * peak RSS delta of a pass is the amount by which the pass raised the peak of the process (0 if the pass stayed within
+ * the memory already used by earlier passes).
+ *
+ * When disabled, all calls return immediately so that the profiler can always be present in a flow.
+ */
+class PassProfiler {
+public:
+    /**
+     * @brief The measurements for a single pass
+     */
+    struct PassRecord{
+        std::string name; ///<The name of the pass
+        double wallTimeSec; ///<The wall time of the pass in seconds
+        unsigned long nodesBefore; ///<The number of nodes in the design before the pass
+        unsigned long nodesAfter; ///<The number of nodes in the design after the pass
+        unsigned long arcsBefore; ///<The number of arcs in the design before the pass
+        unsigned long arcsAfter; ///<The number of arcs in the design after the pass
+        long peakRSSKB; ///<The peak RSS of the process (in KiB) at the end of the pass
+        long peakRSSDeltaKB; ///<The increase of the peak RSS of the process (in KiB) during the pass
+
+        PassRecord();
+    };
+
+private:
+    Design &design; ///<The design being operated on.  Used to collect node and arc counts
+    bool enabled;
+    bool passInProgress;
+    PassRecord currentPass;
+    std::chrono::steady_clock::time_point currentPassStart;
+    std::vector<PassRecord> passes; ///<The completed passes
+
+public:
+    /**
+     * @brief Creates a pass profiler for the given design
+     * @param design the design which the profiled passes operate on
+     * @param enabled if false, no measurements are taken
+     */
+    PassProfiler(Design &design, bool enabled);
+
+    /**
+     * @brief Starts timing a new pass.  If a pass is in progress, it is ended first
+     * @param name the name of the pass
+     */
+    void startPass(std::string name);
+
+    /**
+     * @brief Ends the pass in progress (if any)
+     */
+    void endPass();
+
+    /**
+     * @brief Ends the pass in progress (if any).  Should be called at the end of the flow
+     */
+    void finish();
+
+    /**
+     * @brief Get the records of the completed passes
+     */
+    std::vector<PassRecord> getPasses() const;
+
+    bool isEnabled() const;
+
+    /**
+     * @brief Prints a table of the completed passes, sorted by the order in which they ran, along with the total time
+     */
+    void printReport() const;
+
+    /**
+     * @brief Writes the completed passes to a report file.
+     *
+     * If the filename ends in .csv, a CSV file with a header row is written.  Otherwise a JSON file is written with
+     * the following format:
+     * @code
+     * {
+     *     "totalWallTimeSec": <s>,
+     *     "passes": [
+     *         {"name": "<pass>", "wallTimeSec": <s>, "nodesBefore": <n>, "nodesAfter": <n>, "arcsBefore": <n>,
+     *          "arcsAfter": <n>, "peakRSSKB": <KiB>, "peakRSSDeltaKB": <KiB>},
+     *         ...
+     *     ]
+     * }
+     * @endcode
+     *
+     * @param filename the report file to write
+     */
+    void writeReport(std::string filename) const;
+
+    /**
+     * @brief Get the peak resident set size of this process in KiB
+     */
+    static long getPeakRSSKB();
+};
+
+/*! @} */
+
+#endif //VITIS_PASSPROFILER_H
@@ -0,0 +1,221 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "BlockFIRHelpers.h"
+#include "ErrorHelpers.h"
+#include "GeneralHelper.h"
+#include "EmitterHelpers.h"
+#include <cmath>
+#include <stdexcept>
+
+BlockFIRHelpers::BlockFIRImplementation BlockFIRHelpers::parseBlockFIRImplementationStr(std::string str) {
+    if(str == "AUTO" || str == "auto"){
+        return BlockFIRImplementation::AUTO;
+    }else if(str == "DIRECT" || str == "direct"){
+        return BlockFIRImplementation::DIRECT;
+    }else if(str == "TILED" || str == "tiled"){
+        return BlockFIRImplementation::TILED;
+    }else if(str == "FFT_OVERLAP_SAVE" || str == "fft_overlap_save" || str == "fftOverlapSave"){
+        return BlockFIRImplementation::FFT_OVERLAP_SAVE;
+    }
+
+    throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown block FIR implementation: " + str));
+}
+
+std::string BlockFIRHelpers::blockFIRImplementationToString(BlockFIRHelpers::BlockFIRImplementation implementation) {
+    switch(implementation){
+        case BlockFIRImplementation::AUTO:
+            return "AUTO";
+        case BlockFIRImplementation::DIRECT:
+            return "DIRECT";
+        case BlockFIRImplementation::TILED:
+            return "TILED";
+        case BlockFIRImplementation::FFT_OVERLAP_SAVE:
+            return "FFT_OVERLAP_SAVE";
+        default:
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown block FIR implementation"));
+    }
+}
+
+int BlockFIRHelpers::getFFTLength(int taps, int blockLen) {
+    int segmentLen = taps-1+blockLen;
+    int fftLen = 1;
+    while(fftLen < segmentLen){
+        fftLen *= 2;
+    }
+    //The FFT function requires at least 1 butterfly
+    return fftLen < 2 ? 2 : fftLen;
+}
+
+double BlockFIRHelpers::getDirectCost(int taps, int blockLen, bool complex) {
+    //A multiply and add per tap per output.  A complex multiply accumulate is 4 multiplies and 4 adds
+    return 2.0*taps*blockLen*(complex ? 4 : 1);
+}
+
+double BlockFIRHelpers::getFFTCost(int taps, int blockLen) {
+    double fftLen = getFFTLength(taps, blockLen);
+    double transformCost = 5.0*fftLen*std::log2(fftLen);
+    double spectrumCost = 6.0*fftLen;
+    return 2*transformCost + spectrumCost;
+}
+
+BlockFIRHelpers::BlockFIRImplementation BlockFIRHelpers::selectImplementation(int taps, int blockLen, bool complex, bool fftAllowed) {
+    if(fftAllowed && taps >= VITIS_BLOCK_FIR_FFT_MIN_TAPS && getFFTCost(taps, blockLen) < getDirectCost(taps, blockLen, complex)){
+        return BlockFIRImplementation::FFT_OVERLAP_SAVE;
+    }
+
+    if(blockLen >= VITIS_BLOCK_FIR_TILE_OUTPUTS){
+        return BlockFIRImplementation::TILED;
+    }
+
+    return BlockFIRImplementation::DIRECT;
+}
+
+std::complex<double> BlockFIRHelpers::toComplexDouble(const NumericValue &val) {
+    if(val.isFractional()){
+        return val.isComplex() ? val.getComplexDouble() : std::complex<double>(val.getComplexDouble().real(), 0);
+    }
+
+    return std::complex<double>(val.getRealInt(), val.isComplex() ? val.getImagInt() : 0);
+}
+
+void BlockFIRHelpers::fft(std::vector<std::complex<double>> &vals, bool inverse) {
+    int n = vals.size();
+    std::vector<std::complex<double>> twiddles = getTwiddleFactors(n);
+
+    //Bit reversal permutation
+    for(int i = 1, j = 0; i<n; i++){
+        int bit = n>>1;
+        for(; j & bit; bit >>= 1){
+            j ^= bit;
+        }
+        j ^= bit;
+        if(i < j){
+            std::swap(vals[i], vals[j]);
+        }
+    }
+
+    //Butterflies
+    for(int len = 2; len <= n; len <<= 1){
+        int half = len>>1;
+        int twStride = n/len;
+        for(int i = 0; i<n; i+=len){
+            for(int k = 0; k<half; k++){
+                std::complex<double> w = inverse ? std::conj(twiddles[k*twStride]) : twiddles[k*twStride];
+                std::complex<double> t = vals[i+k+half]*w;
+                vals[i+k+half] = vals[i+k]-t;
+                vals[i+k] += t;
+            }
+        }
+    }
+}
+
+std::vector<std::complex<double>> BlockFIRHelpers::getTwiddleFactors(int fftLen) {
+    std::vector<std::complex<double>> twiddles;
+    for(int k = 0; k<fftLen/2; k++){
+        double angle = -2.0*M_PI*k/fftLen;
+        twiddles.emplace_back(std::cos(angle), std::sin(angle));
+    }
+    return twiddles;
+}
+
+std::vector<std::complex<double>> BlockFIRHelpers::getCoefSpectrum(std::vector<std::complex<double>> coefs, int fftLen) {
+    if(coefs.size() > fftLen){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("The FFT length must be at least the number of FIR coefficients"));
+    }
+
+    //The coefficients are oldest first.  The impulse response is newest first
+    std::vector<std::complex<double>> impulseResponse(fftLen, std::complex<double>(0, 0));
+    for(unsigned long i = 0; i<coefs.size(); i++){
+        impulseResponse[i] = coefs[coefs.size()-1-i];
+    }
+
+    fft(impulseResponse, false);
+
+    //Fold the 1/N scaling of the inverse transform into the spectrum
+    for(int i = 0; i<fftLen; i++){
+        impulseResponse[i] /= (double) fftLen;
+    }
+
+    return impulseResponse;
+}
+
+std::string BlockFIRHelpers::getFFTFunctionName(DataType elementType) {
+    DataType element = elementType;
+    element.setDimensions({1});
+    element.setComplex(false);
+    return "vitis_block_fir_fft_" + element.toString(DataType::StringStyle::C, false, false);
+}
+
+std::string BlockFIRHelpers::emitFFTFunction(DataType elementType) {
+    DataType element = elementType;
+    element.setDimensions({1});
+    element.setComplex(false);
+    std::string typeStr = element.toString(DataType::StringStyle::C, false, false);
+    std::string fnName = getFFTFunctionName(element);
+    std::string guard = GeneralHelper::toUpper(fnName) + "_DEFINED";
+
+    std::string fn = "#ifndef " + guard + "\n"
+                     "#define " + guard + "\n"
+                     "//In-place radix-2 FFT of length n (a power of 2).  twRe/twIm contain exp(-2*pi*i*k/n) for k<n/2\n"
+                     "//If inverse is non-zero, the inverse transform is computed (without the 1/n scaling)\n"
+                     "static void " + fnName + "(" + typeStr + "* restrict re, " + typeStr + "* restrict im, const " +
+                     typeStr + "* restrict twRe, const " + typeStr + "* restrict twIm, int n, int inverse){\n"
+                     "    //Bit reversal permutation\n"
+                     "    for(int i = 1, j = 0; i<n; i++){\n"
+                     "        int bit = n>>1;\n"
+                     "        for(; j & bit; bit >>= 1){\n"
+                     "            j ^= bit;\n"
+                     "        }\n"
+                     "        j ^= bit;\n"
+                     "        if(i < j){\n"
+                     "            " + typeStr + " tmpRe = re[i];\n"
+                     "            re[i] = re[j];\n"
+                     "            re[j] = tmpRe;\n"
+                     "            " + typeStr + " tmpIm = im[i];\n"
+                     "            im[i] = im[j];\n"
+                     "            im[j] = tmpIm;\n"
+                     "        }\n"
+                     "    }\n"
+                     "\n"
+                     "    //Butterflies\n"
+                     "    for(int len = 2; len <= n; len <<= 1){\n"
+                     "        int half = len>>1;\n"
+                     "        int twStride = n/len;\n"
+                     "        for(int i = 0; i<n; i+=len){\n"
+                     "            for(int k = 0; k<half; k++){\n"
+                     "                " + typeStr + " wRe = twRe[k*twStride];\n"
+                     "                " + typeStr + " wIm = inverse ? -twIm[k*twStride] : twIm[k*twStride];\n"
+                     "                int a = i+k;\n"
+                     "                int b = a+half;\n"
+                     "                " + typeStr + " tRe = re[b]*wRe - im[b]*wIm;\n"
+                     "                " + typeStr + " tIm = re[b]*wIm + im[b]*wRe;\n"
+                     "                re[b] = re[a]-tRe;\n"
+                     "                im[b] = im[a]-tIm;\n"
+                     "                re[a] += tRe;\n"
+                     "                im[a] += tIm;\n"
+                     "            }\n"
+                     "        }\n"
+                     "    }\n"
+                     "}\n"
+                     "#endif";
+
+    return fn;
+}
+
+std::string BlockFIRHelpers::emitComplexTable(Variable tableVar, const std::vector<std::complex<double>> &vals) {
+    DataType valType = tableVar.getDataType();
+    DataType storageType = valType.getCPUStorageType();
+    storageType.setDimensions({1});
+
+    std::vector<NumericValue> numericVals;
+    for(const std::complex<double> &val : vals){
+        numericVals.emplace_back(0, 0, val, true, true);
+    }
+
+    std::vector<int> dims = {(int) vals.size()};
+
+    return "static const " + tableVar.getCVarDecl(false, true, false, true) + " = " + EmitterHelpers::arrayLiteral(dims, numericVals, false, valType, storageType) + ";\n" +
+           "static const " + tableVar.getCVarDecl(true, true, false, true) + " = " + EmitterHelpers::arrayLiteral(dims, numericVals, true, valType, storageType) + ";";
+}
@@ -0,0 +1,146 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_BLOCKFIRHELPERS_H
+#define VITIS_BLOCKFIRHELPERS_H
+
+#include <string>
+#include <vector>
+#include <complex>
+#include "GraphCore/DataType.h"
+#include "GraphCore/NumericValue.h"
+#include "GraphCore/Variable.h"
+
+//The number of outputs accumulated in registers by the tiled block FIR
+#define VITIS_BLOCK_FIR_TILE_OUTPUTS (4)
+//The minimum number of taps before the FFT overlap-save implementation is considered by the cost model
+#define VITIS_BLOCK_FIR_FFT_MIN_TAPS (64)
+
+/**
+ * \addtogroup General General Helper Classes
+ *
+ * @brief A set of general helper classes.
+ * @{
+*/
+
+/**
+ * @brief Contains helper methods for selecting and emitting block implementations of FIR filters
+ *
+ * When a FIR filter (a TappedDelay feeding an InnerProduct) is sub-blocked, the TappedDelay presents the history and
+ * the new samples of the sub-block as a single contiguous segment (see CExpr::ExprType::ARRAY_HANKEL_COMPRESSED).
+ * The outputs of the sub-block can be computed from this segment with:
+ *   - A direct block convolution which accumulates a tile of outputs in registers so that each coefficient is loaded
+ *     once per tile
+ *   - An FFT overlap-save kernel.  The segment is zero padded to a power of 2 and is transformed, multiplied by the
+ *     precomputed spectrum of the coefficients, and inverse transformed.  The first taps-1 outputs of the circular
+ *     convolution wrap around and are discarded.
+ *
+ * The FFT is a radix-2 decimation in time transform which is emitted as a static C function (once per type in each
+ * file).
+ */
+namespace BlockFIRHelpers {
+    /**
+     * @brief The implementation of a sub-blocked FIR filter
+     */
+    enum class BlockFIRImplementation{
+        AUTO, ///<Selected by the cost model (see selectImplementation)
+        DIRECT, ///<The taps are the outer loop and the sub-block is the inner loop with the accumulators in memory
+        TILED, ///<Direct block convolution with VITIS_BLOCK_FIR_TILE_OUTPUTS outputs accumulated in registers
+        FFT_OVERLAP_SAVE ///<FFT overlap-save with a precomputed coefficient spectrum
+    };
+
+    BlockFIRImplementation parseBlockFIRImplementationStr(std::string str);
+
+    std::string blockFIRImplementationToString(BlockFIRImplementation implementation);
+
+    /**
+     * @brief Get the length of the FFT used to compute a sub-block of outputs
+     * @param taps the number of taps in the FIR filter
+     * @param blockLen the number of outputs computed at once (the sub-blocking length)
+     * @return the smallest power of 2 which is >= taps-1+blockLen
+     */
+    int getFFTLength(int taps, int blockLen);
+
+    /**
+     * @brief Estimate the number of real arithmetic operations to compute a sub-block of outputs with the direct form
+     */
+    double getDirectCost(int taps, int blockLen, bool complex);
+
+    /**
+     * @brief Estimate the number of real arithmetic operations to compute a sub-block of outputs with FFT overlap-save
+     *
+     * This includes the forward and inverse FFT (~5*N*log2(N) each) and the multiplication by the coefficient spectrum.
+     * Real signals are transformed with a complex FFT so the cost does not depend on the complexity of the signal.
+     */
+    double getFFTCost(int taps, int blockLen);
+
+    /**
+     * @brief Select the implementation of a sub-blocked FIR filter
+     * @param taps the number of taps in the FIR filter
+     * @param blockLen the number of outputs computed at once (the sub-blocking length)
+     * @param complex true if either the signal or the coefficients are complex
+     * @param fftAllowed true if FFT overlap-save can be used (floating point with constant coefficients)
+     * @return the selected implementation (never AUTO)
+     */
+    BlockFIRImplementation selectImplementation(int taps, int blockLen, bool complex, bool fftAllowed);
+
+    /**
+     * @brief Convert a NumericValue to a complex double
+     */
+    std::complex<double> toComplexDouble(const NumericValue &val);
+
+    /**
+     * @brief Computes an in-place radix-2 FFT
+     *
+     * This is the same algorithm as the function emitted by emitFFTFunction
+     *
+     * @param vals the values to transform.  The length must be a power of 2
+     * @param inverse if true, the inverse transform is computed (without the 1/N scaling)
+     */
+    void fft(std::vector<std::complex<double>> &vals, bool inverse);
+
+    /**
+     * @brief Get the twiddle factors exp(-2*pi*i*k/fftLen) for k<fftLen/2
+     */
+    std::vector<std::complex<double>> getTwiddleFactors(int fftLen);
+
+    /**
+     * @brief Get the spectrum of the coefficients used by FFT overlap-save
+     *
+     * The coefficients are in the order used by the InnerProduct of a FIR (oldest sample first).  They are reversed
+     * into the impulse response and zero padded before being transformed.  The 1/fftLen scaling of the inverse
+     * transform is folded into the spectrum.
+     *
+     * @param coefs the coefficients in oldest first order
+     * @param fftLen the length of the FFT (a power of 2 >= the number of coefficients)
+     * @return the scaled spectrum
+     */
+    std::vector<std::complex<double>> getCoefSpectrum(std::vector<std::complex<double>> coefs, int fftLen);
+
+    /**
+     * @brief Get the name of the emitted FFT function for the given element type
+     */
+    std::string getFFTFunctionName(DataType elementType);
+
+    /**
+     * @brief Emits the definition of the FFT function for the given element type
+     *
+     * The function has the prototype
+     *     static void fn(type* re, type* im, const type* twRe, const type* twIm, int n, int inverse);
+     *
+     * The definition is wrapped in an include guard so it may be emitted by more than one node in the same file.
+     */
+    std::string emitFFTFunction(DataType elementType);
+
+    /**
+     * @brief Emits the declaration of a constant table of complex values as separate real and imaginary arrays
+     * @param tableVar the variable for the table.  Its type should be a complex vector with the length of vals
+     * @param vals the values of the table
+     */
+    std::string emitComplexTable(Variable tableVar, const std::vector<std::complex<double>> &vals);
+};
+
+/*! @} */
+
+#endif //VITIS_BLOCKFIRHELPERS_H
@@ -82,7 +82,48 @@ std::vector<std::shared_ptr<BlackBox>> EmitterHelpers::findBlackBoxes(std::vecto
 void EmitterHelpers::emitOpsStateUpdateContext(std::ofstream &cFile, SchedParams::SchedType schedType,
                                                std::vector<std::shared_ptr<Node>> orderedNodes,
                                                std::shared_ptr<MasterOutput> outputMaster,
-                                               bool checkForPartitionChange) {
+                                               bool checkForPartitionChange,
+                                               const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode,
+                                               const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode) {
+    //Find where the statements to insert before/after nodes should be emitted.  They can only be placed where no
+    //context is open (between top level contexts).  The key is the position in orderedNodes where the statements are
+    //emitted (before the node at that position is emitted).  Statements emitted after the last node use
+    //orderedNodes.size() as the key
+    std::map<unsigned long, std::vector<std::string>> insertAfterSegment;
+    std::map<unsigned long, std::vector<std::string>> insertBeforeSegment;
+    if(!statementsBeforeNode.empty() || !statementsAfterNode.empty()) {
+        //A top level boundary exists between two nodes if they do not share an outer context family
+        std::vector<bool> boundaryBefore(orderedNodes.size()+1, true);
+        for (unsigned long i = 1; i < orderedNodes.size(); i++) {
+            std::vector<Context> prevContext = orderedNodes[i-1]->getContext();
+            std::vector<Context> nodeContext = orderedNodes[i]->getContext();
+            boundaryBefore[i] = prevContext.empty() || nodeContext.empty() ||
+                                prevContext[0].getContextRoot() != nodeContext[0].getContextRoot();
+        }
+
+        std::vector<unsigned long> segmentStart(orderedNodes.size());
+        for (unsigned long i = 0; i < orderedNodes.size(); i++) {
+            segmentStart[i] = boundaryBefore[i] ? i : segmentStart[i-1];
+        }
+        std::vector<unsigned long> segmentEnd(orderedNodes.size());
+        for (unsigned long i = orderedNodes.size(); i > 0; i--) {
+            segmentEnd[i-1] = boundaryBefore[i] ? i : segmentEnd[i];
+        }
+
+        for (unsigned long i = 0; i < orderedNodes.size(); i++) {
+            auto before = statementsBeforeNode.find(orderedNodes[i]);
+            if (before != statementsBeforeNode.end()) {
+                std::vector<std::string> &insertStatements = insertBeforeSegment[segmentStart[i]];
+                insertStatements.insert(insertStatements.end(), before->second.begin(), before->second.end());
+            }
+            auto after = statementsAfterNode.find(orderedNodes[i]);
+            if (after != statementsAfterNode.end()) {
+                std::vector<std::string> &insertStatements = insertAfterSegment[segmentEnd[i]];
+                insertStatements.insert(insertStatements.end(), after->second.begin(), after->second.end());
+            }
+        }
+    }
+
     //Keep a context stack of the last emitted statement.  This is used to check for context changes.  Also used to check if the 'first' entry should be used.  If first entry is used (ie. previous context at this level in the stack was not in the same famuly, and the subContext emit count is not 0, then contexts are not contiguous -> ie. switch cannot be used)
     std::vector<Context> lastEmittedContext;
 
@@ -121,6 +162,27 @@ void EmitterHelpers::emitOpsStateUpdateContext(std::ofstream &cFile, SchedParams
 
         std::vector<std::string> contextStatements;
 
+        unsigned long nodePos = it - orderedNodes.begin();
+        if(insertAfterSegment.find(nodePos) != insertAfterSegment.end() || insertBeforeSegment.find(nodePos) != insertBeforeSegment.end()){
+            //Close any open contexts before emitting the inserted statements
+            std::vector<Context> noContext;
+            emitCloseOpenContext(schedType, contextFirst, alreadyEmittedSubContexts, subContextEmittedCount, partition,
+                                 noContext, lastEmittedContext, contextStatements);
+            lastEmittedContext = noContext;
+
+            for (unsigned long i = 0; i < contextStatements.size(); i++) {
+                cFile << contextStatements[i];
+            }
+            contextStatements.clear();
+
+            for (const std::string &statement : insertAfterSegment[nodePos]) {
+                cFile << statement << std::endl;
+            }
+            for (const std::string &statement : insertBeforeSegment[nodePos]) {
+                cFile << statement << std::endl;
+            }
+        }
+
         emitCloseOpenContext(schedType, contextFirst, alreadyEmittedSubContexts, subContextEmittedCount, partition,
                              nodeContext, lastEmittedContext, contextStatements);
 
@@ -193,6 +255,10 @@ void EmitterHelpers::emitOpsStateUpdateContext(std::ofstream &cFile, SchedParams
     for (unsigned long i = 0; i < contextStatements.size(); i++) {
         cFile << contextStatements[i];
     }
+
+    for (const std::string &statement : insertAfterSegment[orderedNodes.size()]) {
+        cFile << statement << std::endl;
+    }
 }
 
 void EmitterHelpers::emitCloseOpenContext(const SchedParams::SchedType &schedType, std::vector<bool> &contextFirst,
@@ -1013,6 +1079,36 @@ std::string EmitterHelpers::telemetryLevelToString(EmitterHelpers::TelemetryLeve
     }
 }
 
+EmitterHelpers::ComplexLayout EmitterHelpers::parseComplexLayoutStr(std::string str){
+    if(str == "SPLIT_PACKED" || str == "split_packed" || str == "splitPacked"){
+        return EmitterHelpers::ComplexLayout::SPLIT_PACKED;
+    }else if(str == "PLANAR_ALIGNED" || str == "planar_aligned" || str == "planarAligned"){
+        return EmitterHelpers::ComplexLayout::PLANAR_ALIGNED;
+    }else{
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown ComplexLayout: " + str));
+    }
+}
+
+std::string EmitterHelpers::complexLayoutToString(EmitterHelpers::ComplexLayout layout){
+    switch(layout){
+        case EmitterHelpers::ComplexLayout::SPLIT_PACKED:
+            return "SPLIT_PACKED";
+        case EmitterHelpers::ComplexLayout::PLANAR_ALIGNED:
+            return "PLANAR_ALIGNED";
+        default:
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown ComplexLayout"));
+    }
+}
+
+std::string EmitterHelpers::getPlaneAlignmentAttribute(EmitterHelpers::ComplexLayout layout, DataType dataType){
+    //Aligning scalars would only add padding, they are not streamed
+    if(layout == EmitterHelpers::ComplexLayout::PLANAR_ALIGNED && !dataType.isScalar()){
+        return " __attribute__ ((aligned (VITIS_MEM_ALIGNMENT)))";
+    }
+
+    return "";
+}
+
 std::map<std::tuple<std::shared_ptr<OutputPort>, int, int, std::shared_ptr<BlockingDomain>, std::shared_ptr<ClockDomain>>, std::vector<std::shared_ptr<Arc>>> EmitterHelpers::getGroupableArcs(std::set<std::shared_ptr<Arc>> arcs, bool checkForToFromNoPartitionToNoBaseBlockSize, bool discardArcsWithinSinglePartition){
     //Note: Only the BlockingDomain or ClockDomain will be non-null.  It is possible for both to be non-null if the dst is at the top level
     std::map<std::tuple<std::shared_ptr<OutputPort>, int, int, std::shared_ptr<BlockingDomain>, std::shared_ptr<ClockDomain>>, std::vector<std::shared_ptr<Arc>>> groups;
@@ -56,8 +56,15 @@ namespace EmitterHelpers {
      * @param orderedNodes the nodes to emit, given in the order they should be emitted
      * @param outputMaster a pointer to the output master of the design being emitted
      * @param checkForPartitionChange if true, checks if the partition changes while emitting and throws an error if it does
+     * @param statementsBeforeNode statements to emit before the given nodes.  Statements are only inserted between top
+     * level contexts, so the statements are emitted before the outermost context containing the node is opened.
+     * Statements for nodes not in orderedNodes are ignored
+     * @param statementsAfterNode statements to emit after the given nodes.  The statements are emitted after the
+     * outermost context containing the node is closed.  Statements for nodes not in orderedNodes are ignored
      */
-    void emitOpsStateUpdateContext(std::ofstream &cFile, SchedParams::SchedType schedType, std::vector<std::shared_ptr<Node>> orderedNodes, std::shared_ptr<MasterOutput> outputMaster, bool checkForPartitionChange = true);
+    void emitOpsStateUpdateContext(std::ofstream &cFile, SchedParams::SchedType schedType, std::vector<std::shared_ptr<Node>> orderedNodes, std::shared_ptr<MasterOutput> outputMaster, bool checkForPartitionChange = true,
+                                   const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsBeforeNode = std::map<std::shared_ptr<Node>, std::vector<std::string>>(),
+                                   const std::map<std::shared_ptr<Node>, std::vector<std::string>> &statementsAfterNode = std::map<std::shared_ptr<Node>, std::vector<std::string>>());
 
     /**
      * @brief A helper function for emitting a single node
@@ -363,6 +370,29 @@ namespace EmitterHelpers {
     bool ioShouldCollectTelemetry(TelemetryLevel level);
     bool ioTelemetryBreakdown(TelemetryLevel level);
 
+    /**
+     * @brief The memory layout of the real and imaginary components of complex values in structures emitted by the generator
+     *
+     * Complex values are always stored as separate real and imaginary arrays (planes).  The layout determines where these
+     * planes are placed within the FIFO block structures and the partition state structures (which contain the delay
+     * buffers).  The I/O bundle structures are the external file/socket format and are not changed by the layout.
+     */
+    enum class ComplexLayout{
+        SPLIT_PACKED, ///<The real and imaginary planes are placed back to back with the natural alignment of their element type
+        PLANAR_ALIGNED ///<Each real and imaginary plane of an array starts on an aligned (VITIS_MEM_ALIGNMENT) boundary so it can be streamed with aligned vector loads
+    };
+
+    ComplexLayout parseComplexLayoutStr(std::string str);
+    std::string complexLayoutToString(ComplexLayout layout);
+
+    /**
+     * @brief Get the alignment attribute which should be appended to the declaration of an array plane in a structure
+     * @param layout the complex layout
+     * @param dataType the type of the plane.  Scalars are not aligned
+     * @return the attribute (including a leading space) or an empty string if the plane should have its natural alignment
+     */
+    std::string getPlaneAlignmentAttribute(ComplexLayout layout, DataType dataType);
+
     /**
      * @brief Gets groupable arcs from the given set.
      *
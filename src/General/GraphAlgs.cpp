@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <random>
+#include <algorithm>
 
 std::set<std::shared_ptr<Node>>
 GraphAlgs::scopedTraceBackAndMark(std::shared_ptr<InputPort> traceFrom, std::map<std::shared_ptr<Arc>, bool> &marks, bool stopAtPartitionBoundary, bool checkForContextBarriers, bool stopAtDifferentBaseSubBlockingLength) {
@@ -1008,7 +1009,8 @@ std::shared_ptr<Node> GraphAlgs::tarjanStronglyConnectedComponentNonRecursiveWor
 
     //Are we done processing this node (ie. have all children been processed)
     std::shared_ptr<Node> nodeToReturn = nullptr;
-    if(currentNode.childrenToSearch.empty() && !traversingChild){ //Do not do this if a new node is being traversed.  Need to handle the backtrack from that child first
+    //traversingChild is checked first because pushing the child onto the dfs stack may have reallocated it, invalidating currentNode
+    if(!traversingChild && currentNode.childrenToSearch.empty()){ //Do not do this if a new node is being traversed.  Need to handle the backtrack from that child first
         //Check if this is the root of a strongly connected component and pop off Tarjan stack
         if(num[currentNode.node] == lowLink[currentNode.node]){
             //node is the root of a strongly connected component (root of the subtree in the DFS tree defining the strongly connected component)
@@ -1075,6 +1077,91 @@ std::set<std::set<std::shared_ptr<Node>>> GraphAlgs::findStronglyConnectedCompon
     return connectedComponents;
 }
 
+std::vector<int> GraphAlgs::findStronglyConnectedComponentsIndexed(const std::vector<int> &childStart, const std::vector<int> &children, const std::vector<bool> &searchNodes, int &numComponents){
+    int numNodes = searchNodes.size();
+    if(childStart.size() != numNodes+1){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("The childStart vector must have an entry for each node plus an additional entry at the end"));
+    }
+
+    std::vector<int> component(numNodes, -1);
+    //The DFS number of each node (-1 if the node has not been visited)
+    std::vector<int> num(numNodes, -1);
+    std::vector<int> lowLink(numNodes, 0);
+    std::vector<bool> inStack(numNodes, false);
+    //The position in children of the next child of each node to be traversed.  This replaces the set of children to
+    //search which is kept for each entry of the DFS stack in the map based implementation
+    std::vector<int> nextChild(numNodes, 0);
+
+    std::vector<int> stack; //The Tarjan stack
+    std::vector<int> dfsStack;
+    int idx = 0;
+    numComponents = 0;
+
+    for(int root = 0; root<numNodes; root++){
+        if(!searchNodes[root] || num[root] != -1){
+            continue;
+        }
+
+        num[root] = idx;
+        lowLink[root] = idx;
+        idx++;
+        stack.push_back(root);
+        inStack[root] = true;
+        nextChild[root] = childStart[root];
+        dfsStack.push_back(root);
+
+        while(!dfsStack.empty()){
+            int node = dfsStack.back();
+
+            if(nextChild[node] < childStart[node+1]){
+                //Still have children to process
+                int child = children[nextChild[node]];
+                nextChild[node]++;
+
+                if(!searchNodes[child]){
+                    continue;
+                }
+
+                if(num[child] == -1){
+                    //Traverse the child (recursive call of Tarjan).  Processing of this node continues when DFS backtracks
+                    num[child] = idx;
+                    lowLink[child] = idx;
+                    idx++;
+                    stack.push_back(child);
+                    inStack[child] = true;
+                    nextChild[child] = childStart[child];
+                    dfsStack.push_back(child);
+                }else if(inStack[child]){
+                    lowLink[node] = std::min(lowLink[node], num[child]);
+                }
+            }else{
+                //All children have been processed.  Check if this is the root of a strongly connected component and
+                //pop it off the Tarjan stack
+                dfsStack.pop_back();
+
+                if(lowLink[node] == num[node]){
+                    int member;
+                    do{
+                        member = stack.back();
+                        stack.pop_back();
+                        inStack[member] = false;
+                        component[member] = numComponents;
+                    }while(member != node);
+                    numComponents++;
+                }
+
+                //Backtrack to the parent
+                if(!dfsStack.empty()){
+                    int parent = dfsStack.back();
+                    lowLink[parent] = std::min(lowLink[parent], lowLink[node]);
+                }
+            }
+        }
+    }
+
+    return component;
+}
+
 int GraphAlgs::findPartitionInSubSystem(std::shared_ptr<SubSystem> subsystem){
     std::set<std::shared_ptr<Node>> children = subsystem->getChildren();
     for(const std::shared_ptr<Node> &child : children){
@@ -8,6 +8,7 @@
 #include <memory>
 #include <set>
 #include <map>
+#include <vector>
 #include <string>
 #include "GraphCore/InputPort.h"
 #include "GraphCore/Node.h"
@@ -197,6 +198,25 @@ namespace GraphAlgs {
      */
     std::set<std::set<std::shared_ptr<Node>>> findStronglyConnectedComponents(std::vector<std::shared_ptr<Node>> nodesToSearch, std::set<std::shared_ptr<Node>> &excludeNodes);
 
+    /**
+     * @brief Finds the strongly connected components of a graph whose nodes are described by integer indexes
+     *
+     * This is the same non-recursive description of Tarjan's algorithm used by findStronglyConnectedComponents.  The
+     * DFS index, lowlink, and Tarjan stack state are kept in flat vectors rather than in maps keyed by node.  Used when
+     * operating on an index based view of a design (see DesignGraphView) or on clusters of nodes.
+     *
+     * The graph is given in compressed sparse row form: the children of node n are children[childStart[n]] to
+     * children[childStart[n+1]-1].  Children which are not searched are ignored (ex. to exclude the master nodes).
+     *
+     * @param childStart index into children where the children of each node start.  Has an additional entry at the end
+     * @param children the children of each node
+     * @param searchNodes a vector, indexed by node, which is true for each node to include in the search
+     * @param numComponents set to the number of strongly connected components found
+     * @return the component number of each node (-1 if the node was not searched).  Components are numbered in reverse
+     * topological order (a component is numbered before any component with an arc into it)
+     */
+    std::vector<int> findStronglyConnectedComponentsIndexed(const std::vector<int> &childStart, const std::vector<int> &children, const std::vector<bool> &searchNodes, int &numComponents);
+
     /**
      * @brief Recursive description of the Strongly Connected Components Algorithm by Tarjan as Described in
      * "Guide to Graph Algorithms: Sequential, Parallel, and Distributed" by K. Erciyes
@@ -0,0 +1,190 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "SIMDHelpers.h"
+#include "ErrorHelpers.h"
+#include "GeneralHelper.h"
+#include <stdexcept>
+
+SIMDHelpers::SIMDTarget SIMDHelpers::parseSIMDTargetStr(std::string str) {
+    if(str == "NONE" || str == "none"){
+        return SIMDTarget::NONE;
+    }else if(str == "SSE" || str == "sse"){
+        return SIMDTarget::SSE;
+    }else if(str == "AVX2" || str == "avx2"){
+        return SIMDTarget::AVX2;
+    }else if(str == "AVX512" || str == "avx512"){
+        return SIMDTarget::AVX512;
+    }else if(str == "NEON" || str == "neon"){
+        return SIMDTarget::NEON;
+    }
+
+    throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown SIMD target: " + str));
+}
+
+std::string SIMDHelpers::simdTargetToString(SIMDHelpers::SIMDTarget target) {
+    switch(target){
+        case SIMDTarget::NONE:
+            return "NONE";
+        case SIMDTarget::SSE:
+            return "SSE";
+        case SIMDTarget::AVX2:
+            return "AVX2";
+        case SIMDTarget::AVX512:
+            return "AVX512";
+        case SIMDTarget::NEON:
+            return "NEON";
+        default:
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown SIMD target"));
+    }
+}
+
+int SIMDHelpers::getVectorBytes(SIMDHelpers::SIMDTarget target) {
+    switch(target){
+        case SIMDTarget::NONE:
+            return 0;
+        case SIMDTarget::SSE:
+        case SIMDTarget::NEON:
+            return 16;
+        case SIMDTarget::AVX2:
+            return 32;
+        case SIMDTarget::AVX512:
+            return 64;
+        default:
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown SIMD target"));
+    }
+}
+
+DataType SIMDHelpers::getElementType(DataType dataType) {
+    DataType elementType = dataType;
+    elementType.setDimensions({1});
+    elementType.setComplex(false);
+    return elementType;
+}
+
+bool SIMDHelpers::sameElementType(DataType a, DataType b) {
+    return getElementType(a) == getElementType(b);
+}
+
+int SIMDHelpers::getLanes(SIMDHelpers::SIMDTarget target, DataType elementType) {
+    DataType element = getElementType(elementType);
+
+    //Only standard integer and floating point types are vectorized.  Fixed point types require shifts/masking which
+    //are handled by the scalar emit
+    if(target == SIMDTarget::NONE || !element.isCPUType() || element.isBool() || element.getFractionalBits() != 0){
+        return 1;
+    }
+
+    int elementBytes = element.getTotalBits()/8;
+    int lanes = getVectorBytes(target)/elementBytes;
+    return lanes > 1 ? lanes : 1;
+}
+
+std::string SIMDHelpers::getVectorTypeName(DataType elementType, int lanes) {
+    return "vitis_simd_" + getElementType(elementType).toString(DataType::StringStyle::C, false, false) + "_x" + GeneralHelper::to_string(lanes);
+}
+
+std::string SIMDHelpers::getVectorTypeDef(DataType elementType, int lanes) {
+    DataType element = getElementType(elementType);
+    int elementBytes = element.getTotalBits()/8;
+
+    //Element alignment and may_alias allow the vector to be loaded from any element of an array (same as the unaligned
+    //vector types used in the x86 intrinsic headers)
+    return "typedef " + element.toString(DataType::StringStyle::C, false, false) + " " + getVectorTypeName(element, lanes) +
+           " __attribute__((vector_size(" + GeneralHelper::to_string(elementBytes*lanes) + "), aligned(" +
+           GeneralHelper::to_string(elementBytes) + "), may_alias));";
+}
+
+SIMDHelpers::AccessType SIMDHelpers::getAccessType(const CExpr &expr, unsigned long numIndexExprs, long vecIndexPos) {
+    CExpr::ExprType exprType = expr.getExprType();
+
+    if(exprType == CExpr::ExprType::SCALAR_EXPR || exprType == CExpr::ExprType::SCALAR_VAR ||
+       exprType == CExpr::ExprType::SCALAR_EXPR_REPEAT || exprType == CExpr::ExprType::SCALAR_VAR_REPEAT){
+        return AccessType::BROADCAST;
+    }
+
+    if(numIndexExprs == 0 || vecIndexPos < 0){
+        return AccessType::BROADCAST;
+    }
+
+    bool innermost = vecIndexPos == numIndexExprs-1;
+
+    switch(exprType){
+        case CExpr::ExprType::ARRAY:
+            //Arrays are stored in row major order, only the innermost dimension is contiguous
+            return innermost ? AccessType::CONTIGUOUS : AccessType::UNSUPPORTED;
+        case CExpr::ExprType::ARRAY_HANKEL_COMPRESSED:
+            //The outer index is an offset into the same buffer as the inner index.  Both are contiguous (for up to 2 indexes)
+            return numIndexExprs <= 2 && (vecIndexPos == 0 || innermost) ? AccessType::CONTIGUOUS : AccessType::UNSUPPORTED;
+        case CExpr::ExprType::ARRAY_REPEAT:
+            //When the repeat stride is the vector length, the outer index is ignored and the operand is the same for each outer index
+            if(expr.getRepeatStride() != expr.getVecLen()){
+                return AccessType::UNSUPPORTED;
+            }
+            if(vecIndexPos == 0){
+                return AccessType::BROADCAST;
+            }
+            return innermost ? AccessType::CONTIGUOUS : AccessType::UNSUPPORTED;
+        default:
+            //Circular buffers can wrap around within a vector
+            return AccessType::UNSUPPORTED;
+    }
+}
+
+std::string SIMDHelpers::emitLoad(CExpr expr, SIMDHelpers::AccessType accessType, std::vector<std::string> indexExprs, DataType elementType, int lanes) {
+    if(expr.getExprType() == CExpr::ExprType::SCALAR_EXPR || expr.getExprType() == CExpr::ExprType::SCALAR_VAR){
+        //Scalar expressions are not indexed
+        indexExprs.clear();
+    }
+
+    std::string vecTypeName = getVectorTypeName(elementType, lanes);
+    std::string element = expr.getExprIndexed(indexExprs, true);
+
+    if(accessType == AccessType::BROADCAST){
+        return "(((" + vecTypeName + "){0}) + ((" + getElementType(elementType).toString(DataType::StringStyle::C, false, false) + ") (" + element + ")))";
+    }else if(accessType == AccessType::CONTIGUOUS){
+        return "(*((" + vecTypeName + "*) &(" + element + ")))";
+    }
+
+    throw std::runtime_error(ErrorHelpers::genErrorStr("Cannot emit a vector load for an operand which cannot be vectorized"));
+}
+
+std::string SIMDHelpers::emitElement(CExpr expr, std::vector<std::string> indexExprs) {
+    if(expr.getExprType() == CExpr::ExprType::SCALAR_EXPR || expr.getExprType() == CExpr::ExprType::SCALAR_VAR){
+        //Scalar expressions are not indexed
+        indexExprs.clear();
+    }
+
+    return "(" + expr.getExprIndexed(indexExprs, true) + ")";
+}
+
+std::string SIMDHelpers::emitStore(std::string dstElementExpr, std::string valueExpr, DataType elementType, int lanes) {
+    return "*((" + getVectorTypeName(elementType, lanes) + "*) &(" + dstElementExpr + ")) = " + valueExpr + ";";
+}
+
+std::string SIMDHelpers::emitHorizontalSum(std::string vecExpr, int lanes) {
+    std::string str = "(";
+    for(int i = 0; i<lanes; i++){
+        if(i > 0){
+            str += "+";
+        }
+        str += vecExpr + "[" + GeneralHelper::to_string(i) + "]";
+    }
+    str += ")";
+    return str;
+}
+
+int SIMDHelpers::getRemainderStart(int len, int lanes) {
+    return len - len%lanes;
+}
+
+std::string SIMDHelpers::emitVectorLoopOpen(std::string indVar, int len, int lanes) {
+    return "for(unsigned long " + indVar + " = 0; " + indVar + "<" + GeneralHelper::to_string(getRemainderStart(len, lanes)) +
+           "; " + indVar + "+=" + GeneralHelper::to_string(lanes) + "){";
+}
+
+std::string SIMDHelpers::emitRemainderLoopOpen(std::string indVar, int len, int lanes) {
+    return "for(unsigned long " + indVar + " = " + GeneralHelper::to_string(getRemainderStart(len, lanes)) + "; " +
+           indVar + "<" + GeneralHelper::to_string(len) + "; " + indVar + "++){";
+}
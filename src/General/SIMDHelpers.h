@@ -0,0 +1,160 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_SIMDHELPERS_H
+#define VITIS_SIMDHELPERS_H
+
+#include <string>
+#include <vector>
+#include "GraphCore/DataType.h"
+#include "GraphCore/CExpr.h"
+
+/**
+ * \addtogroup General General Helper Classes
+ *
+ * @brief A set of general helper classes.
+ * @{
+*/
+
+/**
+ * @brief Contains helper methods for emitting explicitly vectorized C code
+ *
+ * Vector code is emitted using GCC vector extensions (also supported by clang) sized for the selected target.  The
+ * compiler lowers these to the vector instructions of the target ISA (ex. AVX2, AVX-512, NEON).  Unlike the
+ * auto-vectorizer, this does not rely on the compiler proving that the loop can be vectorized.
+ *
+ * Vectors are loaded and stored through a vector type with element alignment which may alias its element type.  Delay
+ * lines and FIFO buffers are allocated aligned but the offset into them (ex. the head of a tapped delay) is not
+ * guaranteed to be a multiple of the vector length.  These loads are lowered to unaligned vector loads which do not
+ * incur a penalty when the address happens to be aligned.
+ */
+namespace SIMDHelpers {
+    /**
+     * @brief The SIMD target to emit vector code for
+     */
+    enum class SIMDTarget{
+        NONE, ///<Do not emit explicit vector code (rely on the compiler's auto-vectorizer)
+        SSE, ///<128 bit vectors (x86 SSE)
+        AVX2, ///<256 bit vectors (x86 AVX/AVX2)
+        AVX512, ///<512 bit vectors (x86 AVX-512)
+        NEON ///<128 bit vectors (ARM NEON/ASIMD)
+    };
+
+    /**
+     * @brief How an operand is accessed across the lanes of a vector
+     */
+    enum class AccessType{
+        BROADCAST, ///<The operand is the same for each lane and is broadcast to the vector
+        CONTIGUOUS, ///<The lanes of the operand are contiguous in memory and can be loaded as a vector
+        UNSUPPORTED ///<The lanes of the operand cannot be loaded as a vector (ex. a circular buffer which may wrap around)
+    };
+
+    SIMDTarget parseSIMDTargetStr(std::string str);
+
+    std::string simdTargetToString(SIMDTarget target);
+
+    /**
+     * @brief Get the width of a vector register of the given target in bytes
+     * @param target the SIMD target
+     * @return the width of a vector in bytes, 0 if target is NONE
+     */
+    int getVectorBytes(SIMDTarget target);
+
+    /**
+     * @brief Get the scalar element type of a DataType (the type with dimensions removed and without complexity)
+     */
+    DataType getElementType(DataType dataType);
+
+    /**
+     * @brief Checks if two types have the same element type (ignoring dimensions and complexity)
+     */
+    bool sameElementType(DataType a, DataType b);
+
+    /**
+     * @brief Get the number of lanes in a vector of the given element type
+     * @param target the SIMD target
+     * @param elementType the element type.  Only the element type is considered (dimensions and complexity are ignored)
+     * @return the number of lanes, 1 if the type cannot be vectorized for the target (ex. fixed point, bool, or
+     * target is NONE)
+     */
+    int getLanes(SIMDTarget target, DataType elementType);
+
+    /**
+     * @brief Get the name of the vector type with the given element type and number of lanes
+     */
+    std::string getVectorTypeName(DataType elementType, int lanes);
+
+    /**
+     * @brief Get the typedef of the vector type with the given element type and number of lanes
+     *
+     * The typedef may be repeated in the same scope (redefinition of a typedef to the same type is allowed in C11)
+     */
+    std::string getVectorTypeDef(DataType elementType, int lanes);
+
+    /**
+     * @brief Determine how an operand is accessed when the given index is vectorized
+     * @param expr the operand
+     * @param numIndexExprs the number of index expressions which will be used to index into the operand.  0 if the
+     * operand is used without indexing (ex. a scalar)
+     * @param vecIndexPos the position of the vectorized index in the index expressions.  -1 if the vectorized index is
+     * not used to index into the operand
+     * @return the access type
+     */
+    AccessType getAccessType(const CExpr &expr, unsigned long numIndexExprs, long vecIndexPos);
+
+    /**
+     * @brief Get an expression which loads the given operand as a vector
+     * @param expr the operand
+     * @param accessType the access type of the operand (see @ref getAccessType).  Must not be UNSUPPORTED
+     * @param indexExprs the index expressions into the operand with the vectorized index set to the first lane
+     * @param elementType the element type of the vector
+     * @param lanes the number of lanes in the vector
+     * @return the load expression
+     */
+    std::string emitLoad(CExpr expr, AccessType accessType, std::vector<std::string> indexExprs, DataType elementType, int lanes);
+
+    /**
+     * @brief Get the (dereferenced) element of an operand.  Used for the scalar remainder of a vectorized loop
+     * @param expr the operand
+     * @param indexExprs the index expressions into the operand (ignored for scalar expressions and variables)
+     * @return the element expression
+     */
+    std::string emitElement(CExpr expr, std::vector<std::string> indexExprs);
+
+    /**
+     * @brief Get a statement which stores a vector to memory
+     * @param dstElementExpr the (dereferenced) element in memory corresponding to the first lane
+     * @param valueExpr the vector expression to store
+     * @param elementType the element type of the vector
+     * @param lanes the number of lanes in the vector
+     * @return the store statement (including the trailing ;)
+     */
+    std::string emitStore(std::string dstElementExpr, std::string valueExpr, DataType elementType, int lanes);
+
+    /**
+     * @brief Get an expression which sums the lanes of a vector
+     */
+    std::string emitHorizontalSum(std::string vecExpr, int lanes);
+
+    /**
+     * @brief Get the start of the scalar remainder of a loop of the given length which is vectorized with the given number of lanes
+     */
+    int getRemainderStart(int len, int lanes);
+
+    /**
+     * @brief Emit the opening of a loop over the vectorized portion of a dimension
+     * @return the for loop opening (including the {)
+     */
+    std::string emitVectorLoopOpen(std::string indVar, int len, int lanes);
+
+    /**
+     * @brief Emit the opening of a loop over the scalar remainder of a dimension
+     * @return the for loop opening (including the {)
+     */
+    std::string emitRemainderLoopOpen(std::string indVar, int len, int lanes);
+};
+
+/*! @} */
+
+#endif //VITIS_SIMDHELPERS_H
@@ -42,6 +42,8 @@ TopologicalSortParameters::Heuristic TopologicalSortParameters::parseHeuristicSt
         return Heuristic::DFS_BLOCKED;
     }else if(str == "RANDOM" || str == "random" || str == "RAND" || str == "rand") {
         return Heuristic::RANDOM;
+    }else if(str == "MIN_LIVE_BYTES" || str == "min_live_bytes") {
+        return Heuristic::MIN_LIVE_BYTES;
     }else{
         throw std::runtime_error("Unable to parse Heuristic: " + str);
     }
@@ -56,6 +58,8 @@ std::string TopologicalSortParameters::heuristicToString(TopologicalSortParamete
         return "DFS_BLOCKED";
     }else if(schedType == Heuristic::RANDOM){
         return "RANDOM";
+    }else if(schedType == Heuristic::MIN_LIVE_BYTES){
+        return "MIN_LIVE_BYTES";
     }else{
         throw std::runtime_error("Unknown heuristic");
     }
@@ -23,7 +23,8 @@ public:
         BFS, ///< Breadth First Search Style
         DFS, ///< Depth First Search Style
         DFS_BLOCKED,
-        RANDOM ///< Randomly Select Node to Schedule From List of Ready Nodes
+        RANDOM, ///< Randomly Select Node to Schedule From List of Ready Nodes
+        MIN_LIVE_BYTES ///< Select the ready node which results in the fewest bytes of live temporaries (based on arc DataTypes).  Only supported by the indexed scheduler (see ScheduleGraph)
     };
 
     /**
@@ -18,12 +18,12 @@
 
 #include "General/ErrorHelpers.h"
 
-Arc::Arc() : id(-1), sampleTime(-1), delay(0), slack(0){
+Arc::Arc() : id(-1), sampleTime(-1), delay(0), slack(0), fifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){
     srcPort = std::shared_ptr<OutputPort>(nullptr);
     dstPort = std::shared_ptr<InputPort>(nullptr);
 }
 
-Arc::Arc(std::shared_ptr<OutputPort> srcPort, std::shared_ptr<InputPort> dstPort, DataType dataType, double sampleTime) : id(-1), srcPort(srcPort), dstPort(dstPort), dataType(dataType), sampleTime(sampleTime), delay(0), slack(0){
+Arc::Arc(std::shared_ptr<OutputPort> srcPort, std::shared_ptr<InputPort> dstPort, DataType dataType, double sampleTime) : id(-1), srcPort(srcPort), dstPort(dstPort), dataType(dataType), sampleTime(sampleTime), delay(0), slack(0), fifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){
 
 }
 
@@ -269,6 +269,14 @@ void Arc::setId(int id) {
     Arc::id = id;
 }
 
+ThreadCrossingFIFOParameters::FIFOPlacement Arc::getFifoPlacement() const {
+    return fifoPlacement;
+}
+
+void Arc::setFifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement) {
+    Arc::fifoPlacement = fifoPlacement;
+}
+
 xercesc::DOMElement *Arc::emitGraphML(xercesc::DOMDocument *doc, xercesc::DOMElement *graphNode) {
     //Used CreateDOMDocument.cpp example from Xerces as a guide
 
@@ -303,6 +311,9 @@ xercesc::DOMElement *Arc::emitGraphML(xercesc::DOMDocument *doc, xercesc::DOMEle
     GraphMLHelper::addDataNode(doc, arcElement, "arc_dimension", GeneralHelper::vectorToString(dataType.getDimensions()));
     GraphMLHelper::addDataNode(doc, arcElement, "arc_disp_label", labelStr());
     GraphMLHelper::addDataNode(doc, arcElement, "arc_id", GeneralHelper::to_string(getId()));
+    if(fifoPlacement != ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){
+        GraphMLHelper::addDataNode(doc, arcElement, "arc_fifo_placement", ThreadCrossingFIFOParameters::fifoPlacementToString(fifoPlacement));
+    }
 
     //---Add to graph node---
     graphNode->appendChild(arcElement);
@@ -335,6 +346,7 @@ void Arc::shallowCopyPrameters(Arc *orig) {
     sampleTime = orig->sampleTime;
     delay = orig->delay;
     slack = orig->slack;
+    fifoPlacement = orig->fifoPlacement;
 
     //do not copy weakSelf as this is set when connecting the nodes
 }
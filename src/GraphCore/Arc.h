@@ -9,6 +9,7 @@
 //#include "Port.h"
 //#include "Node.h"
 #include "DataType.h"
+#include "MultiThread/ThreadCrossingFIFOParameters.h"
 
 #include <xercesc/dom/DOM.hpp>
 #include <xercesc/util/PlatformUtils.hpp>
@@ -50,6 +51,7 @@ protected:
     double sampleTime; ///< The sample time of the data passed via this arc (in s)
     int delay; ///< The delay along this arc (in cycles)
     int slack; ///< The slack along this arc (in cycles)
+    ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement; ///< If this arc crosses partitions, the placement of the FIFO inserted into it (DEFAULT if not annotated)
 
     //For use in destructor, a weak pointer to itself is kept
     std::weak_ptr<Arc> weakSelf;
@@ -317,6 +319,8 @@ public:
     void setSlack(int slack);
     int getId() const;
     void setId(int id);
+    ThreadCrossingFIFOParameters::FIFOPlacement getFifoPlacement() const;
+    void setFifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement);
 };
 
 /*! @} */
@@ -239,6 +239,7 @@ std::set<GraphMLParameter> Design::graphMLParameters() {
     parameters.insert(GraphMLParameter("arc_complex", "string", false));
     parameters.insert(GraphMLParameter("arc_width", "string", false));
     parameters.insert(GraphMLParameter("arc_id", "int", true));
+    parameters.insert(GraphMLParameter("arc_fifo_placement", "string", false));
 
     //Add the static entries for partition crossing arcs in communication graph
     parameters.insert(GraphMLParameter("partition_crossing_init_state_count_blocks", "int", false));
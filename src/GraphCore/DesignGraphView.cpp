@@ -0,0 +1,337 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "DesignGraphView.h"
+
+#include <limits>
+
+#include "SubSystem.h"
+#include "ContextFamilyContainer.h"
+#include "StateUpdate.h"
+#include "InputPort.h"
+#include "OutputPort.h"
+#include "OrderConstraintInputPort.h"
+#include "OrderConstraintOutputPort.h"
+#include "EnablePort.h"
+#include "SelectPort.h"
+#include "MasterNodes/MasterNode.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+#include "MasterNodes/MasterUnconnected.h"
+#include "MultiThread/ThreadCrossingFIFO.h"
+#include "General/GeneralHelper.h"
+#include "General/ErrorHelpers.h"
+#include "General/GraphAlgs.h"
+
+const DesignGraphView::Index DesignGraphView::NO_INDEX = std::numeric_limits<DesignGraphView::Index>::max();
+
+DesignGraphView::DesignGraphView(Design &design) {
+    std::vector<std::shared_ptr<Node>> designNodes = design.getNodes();
+    std::vector<std::shared_ptr<Arc>> designArcs = design.getArcs();
+
+    //Index must be able to hold every node and arc as well as NO_INDEX
+    if(designNodes.size() + 5 >= NO_INDEX || designArcs.size() >= NO_INDEX){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Design is too large for DesignGraphView"));
+    }
+
+    //==== Nodes ====
+    unsigned long numNodes = designNodes.size() + 5;
+    nodes.reserve(numNodes);
+    nodeIndexes.reserve(numNodes);
+    nodeIds.reserve(numNodes);
+    nodePartitions.reserve(numNodes);
+    nodeKinds.reserve(numNodes);
+    nodeProperties.reserve(numNodes);
+
+    addNode(design.getInputMaster());
+    addNode(design.getOutputMaster());
+    addNode(design.getVisMaster());
+    addNode(design.getUnconnectedMaster());
+    addNode(design.getTerminatorMaster());
+    for(unsigned long i = 0; i<designNodes.size(); i++){
+        addNode(designNodes[i]);
+    }
+
+    //Parents are set after all nodes are indexed since a parent may be after its children in the design's node list
+    nodeParents.resize(nodes.size(), NO_INDEX);
+    for(Index i = 0; i<nodes.size(); i++){
+        std::shared_ptr<SubSystem> parent = nodes[i]->getParent();
+        if(parent != nullptr){
+            nodeParents[i] = getNodeIndex(parent);
+        }
+    }
+
+    //==== Arcs ====
+    arcs.reserve(designArcs.size());
+    arcSrcs.reserve(designArcs.size());
+    arcDsts.reserve(designArcs.size());
+    arcSrcPortNums.reserve(designArcs.size());
+    arcDstPortNums.reserve(designArcs.size());
+    arcKinds.reserve(designArcs.size());
+
+    for(unsigned long i = 0; i<designArcs.size(); i++){
+        std::shared_ptr<OutputPort> srcPort = designArcs[i]->getSrcPort();
+        std::shared_ptr<InputPort> dstPort = designArcs[i]->getDstPort();
+        if(srcPort == nullptr || dstPort == nullptr){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Arc in design is not connected when building DesignGraphView"));
+        }
+
+        ArcKind kind = ArcKind::STANDARD;
+        if(GeneralHelper::isType<OutputPort, OrderConstraintOutputPort>(srcPort) != nullptr ||
+           GeneralHelper::isType<InputPort, OrderConstraintInputPort>(dstPort) != nullptr){
+            kind = ArcKind::ORDER_CONSTRAINT;
+        }else if(GeneralHelper::isType<InputPort, EnablePort>(dstPort) != nullptr){
+            kind = ArcKind::ENABLE;
+        }else if(GeneralHelper::isType<InputPort, SelectPort>(dstPort) != nullptr){
+            kind = ArcKind::SELECT;
+        }
+
+        arcs.push_back(designArcs[i]);
+        arcSrcs.push_back(getNodeIndex(srcPort->getParent()));
+        arcDsts.push_back(getNodeIndex(dstPort->getParent()));
+        arcSrcPortNums.push_back(srcPort->getPortNum());
+        arcDstPortNums.push_back(dstPort->getPortNum());
+        arcKinds.push_back(kind);
+    }
+
+    buildCSR(arcSrcs, outArcStart, outArcs);
+    buildCSR(arcDsts, inArcStart, inArcs);
+}
+
+void DesignGraphView::addNode(std::shared_ptr<Node> node) {
+    if(node == nullptr){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Null node when building DesignGraphView"));
+    }
+    if(nodeIndexes.find(node.get()) != nodeIndexes.end()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Node appears more than once when building DesignGraphView", node));
+    }
+
+    NodeKind kind = NodeKind::NODE;
+    if(GeneralHelper::isType<Node, MasterNode>(node) != nullptr){
+        kind = NodeKind::MASTER;
+    }else if(GeneralHelper::isType<Node, ContextFamilyContainer>(node) != nullptr){
+        kind = NodeKind::CONTEXT_FAMILY_CONTAINER;
+    }else if(GeneralHelper::isType<Node, SubSystem>(node) != nullptr){
+        kind = NodeKind::SUBSYSTEM;
+    }else if(GeneralHelper::isType<Node, StateUpdate>(node) != nullptr){
+        kind = NodeKind::STATE_UPDATE;
+    }else if(GeneralHelper::isType<Node, ThreadCrossingFIFO>(node) != nullptr){
+        kind = NodeKind::THREAD_CROSSING_FIFO;
+    }
+
+    uint8_t properties = 0;
+    if(node->hasState()){
+        properties |= HAS_STATE;
+    }
+    if(node->hasCombinationalPath()){
+        properties |= HAS_COMBINATIONAL_PATH;
+    }
+    if(node->passesThroughInputs()){
+        properties |= PASSES_THROUGH_INPUTS;
+    }
+
+    nodeIndexes[node.get()] = nodes.size();
+    nodes.push_back(node);
+    nodeIds.push_back(node->getId());
+    nodePartitions.push_back(node->getPartitionNum());
+    nodeKinds.push_back(kind);
+    nodeProperties.push_back(properties);
+}
+
+void DesignGraphView::buildCSR(const std::vector<Index> &endpoints, std::vector<Index> &start, std::vector<Index> &arcList) {
+    //Count the arcs of each node
+    start.assign(nodes.size()+1, 0);
+    for(Index arc = 0; arc<endpoints.size(); arc++){
+        start[endpoints[arc]+1]++;
+    }
+
+    //Prefix sum to get the start of each node's arcs
+    for(Index node = 0; node<nodes.size(); node++){
+        start[node+1] += start[node];
+    }
+
+    //Place the arcs.  Arcs are placed in arc index order
+    std::vector<Index> nextPos(start.begin(), start.end()-1);
+    arcList.resize(endpoints.size());
+    for(Index arc = 0; arc<endpoints.size(); arc++){
+        arcList[nextPos[endpoints[arc]]++] = arc;
+    }
+}
+
+DesignGraphView::Index DesignGraphView::getNumNodes() const {
+    return nodes.size();
+}
+
+DesignGraphView::Index DesignGraphView::getNumArcs() const {
+    return arcs.size();
+}
+
+DesignGraphView::Index DesignGraphView::getNodeIndex(const std::shared_ptr<Node> &node) const {
+    auto it = nodeIndexes.find(node.get());
+    if(it == nodeIndexes.end()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Node is not in the DesignGraphView", node));
+    }
+    return it->second;
+}
+
+bool DesignGraphView::containsNode(const std::shared_ptr<Node> &node) const {
+    return nodeIndexes.find(node.get()) != nodeIndexes.end();
+}
+
+std::shared_ptr<Node> DesignGraphView::getNode(Index node) const {
+    return nodes[node];
+}
+
+int DesignGraphView::getNodeId(Index node) const {
+    return nodeIds[node];
+}
+
+DesignGraphView::Index DesignGraphView::getNodeParent(Index node) const {
+    return nodeParents[node];
+}
+
+int DesignGraphView::getNodePartition(Index node) const {
+    return nodePartitions[node];
+}
+
+DesignGraphView::NodeKind DesignGraphView::getNodeKind(Index node) const {
+    return nodeKinds[node];
+}
+
+bool DesignGraphView::nodeHasProperty(Index node, NodeProperty property) const {
+    return (nodeProperties[node] & property) != 0;
+}
+
+std::shared_ptr<Arc> DesignGraphView::getArc(Index arc) const {
+    return arcs[arc];
+}
+
+DesignGraphView::Index DesignGraphView::getArcSrc(Index arc) const {
+    return arcSrcs[arc];
+}
+
+DesignGraphView::Index DesignGraphView::getArcDst(Index arc) const {
+    return arcDsts[arc];
+}
+
+int DesignGraphView::getArcSrcPortNum(Index arc) const {
+    return arcSrcPortNums[arc];
+}
+
+int DesignGraphView::getArcDstPortNum(Index arc) const {
+    return arcDstPortNums[arc];
+}
+
+DesignGraphView::ArcKind DesignGraphView::getArcKind(Index arc) const {
+    return arcKinds[arc];
+}
+
+const DesignGraphView::Index* DesignGraphView::outArcsBegin(Index node) const {
+    return outArcs.data() + outArcStart[node];
+}
+
+const DesignGraphView::Index* DesignGraphView::outArcsEnd(Index node) const {
+    return outArcs.data() + outArcStart[node+1];
+}
+
+const DesignGraphView::Index* DesignGraphView::inArcsBegin(Index node) const {
+    return inArcs.data() + inArcStart[node];
+}
+
+const DesignGraphView::Index* DesignGraphView::inArcsEnd(Index node) const {
+    return inArcs.data() + inArcStart[node+1];
+}
+
+DesignGraphView::Index DesignGraphView::getOutDegree(Index node) const {
+    return outArcStart[node+1] - outArcStart[node];
+}
+
+DesignGraphView::Index DesignGraphView::getInDegree(Index node) const {
+    return inArcStart[node+1] - inArcStart[node];
+}
+
+std::vector<bool> DesignGraphView::findReachable(const std::vector<Index> &roots, bool forward, bool followOrderConstraints) const {
+    std::vector<bool> reached(nodes.size(), false);
+    std::vector<Index> toVisit;
+    toVisit.reserve(nodes.size());
+
+    for(Index root : roots){
+        if(!reached[root]){
+            reached[root] = true;
+            toVisit.push_back(root);
+        }
+    }
+
+    const std::vector<Index> &start = forward ? outArcStart : inArcStart;
+    const std::vector<Index> &arcList = forward ? outArcs : inArcs;
+    const std::vector<Index> &otherEnd = forward ? arcDsts : arcSrcs;
+
+    while(!toVisit.empty()){
+        Index node = toVisit.back();
+        toVisit.pop_back();
+
+        for(Index i = start[node]; i<start[node+1]; i++){
+            Index arc = arcList[i];
+            if(!followOrderConstraints && arcKinds[arc] == ArcKind::ORDER_CONSTRAINT){
+                continue;
+            }
+
+            Index next = otherEnd[arc];
+            if(!reached[next]){
+                reached[next] = true;
+                toVisit.push_back(next);
+            }
+        }
+    }
+
+    return reached;
+}
+
+DesignGraphView::StronglyConnectedComponents DesignGraphView::findStronglyConnectedComponents(const std::vector<bool> &searchNodes, bool followOrderConstraints) const {
+    if(searchNodes.size() != nodes.size()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("The searchNodes vector must have an entry for each node in the DesignGraphView"));
+    }
+
+    //The out arcs are converted to the children of each node (in CSR form) for GraphAlgs.  Order constraint arcs are
+    //dropped here if they are not followed
+    std::vector<int> childStart(nodes.size()+1, 0);
+    std::vector<int> children;
+    children.reserve(outArcs.size());
+    for(Index node = 0; node<nodes.size(); node++){
+        for(Index i = outArcStart[node]; i<outArcStart[node+1]; i++){
+            Index arc = outArcs[i];
+            if(followOrderConstraints || arcKinds[arc] != ArcKind::ORDER_CONSTRAINT){
+                children.push_back(arcDsts[arc]);
+            }
+        }
+        childStart[node+1] = children.size();
+    }
+
+    int numComponents;
+    std::vector<int> components = GraphAlgs::findStronglyConnectedComponentsIndexed(childStart, children, searchNodes, numComponents);
+
+    //Group the nodes of each component with a counting sort
+    StronglyConnectedComponents sccs;
+    sccs.componentStart.assign(numComponents+1, 0);
+    sccs.nodeComponents.assign(nodes.size(), NO_INDEX);
+    for(Index node = 0; node<nodes.size(); node++){
+        if(components[node] != -1){
+            sccs.nodeComponents[node] = components[node];
+            sccs.componentStart[components[node]+1]++;
+        }
+    }
+    for(Index component = 0; component<numComponents; component++){
+        sccs.componentStart[component+1] += sccs.componentStart[component];
+    }
+
+    sccs.componentNodes.resize(sccs.componentStart[numComponents]);
+    std::vector<Index> componentPos(sccs.componentStart.begin(), sccs.componentStart.end()-1);
+    for(Index node = 0; node<nodes.size(); node++){
+        if(components[node] != -1){
+            sccs.componentNodes[componentPos[components[node]]++] = node;
+        }
+    }
+
+    return sccs;
+}
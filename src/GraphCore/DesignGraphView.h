@@ -0,0 +1,228 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_DESIGNGRAPHVIEW_H
+#define VITIS_DESIGNGRAPHVIEW_H
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+
+#include "Design.h"
+#include "Node.h"
+#include "Arc.h"
+
+/**
+* \addtogroup GraphCore Graph Core
+* @{
+*/
+
+/**
+ * @brief A frozen, compact, integer indexed view of the nodes and arcs of a Design for read-only analyses.
+ *
+ * The Node/Port/Arc objects of a Design are connected through shared_ptrs and sets of weak_ptrs.  Traversing them
+ * (ex. with Node::getConnectedOutputNodes) creates new sets and shared_ptrs at each step.  This view is built once
+ * from the design and stores the graph in a small number of contiguous arrays, each of which is allocated once:
+ *   - Each node (including the master nodes) is assigned an index.  The node's ID, parent, partition, kind, and a few
+ *     commonly checked properties are stored in arrays indexed by the node index
+ *   - Each arc is assigned an index.  The src/dst node index, src/dst port numbers, and arc kind are stored in arrays
+ *     indexed by the arc index
+ *   - The out arcs and in arcs of each node are stored in CSR (compressed sparse row) form.  The out arcs of node n are
+ *     outArcs[outArcStart[n]] to outArcs[outArcStart[n+1]-1] (likewise for in arcs).  The arcs of each node are in the
+ *     order they appear in the design's arc list
+ *
+ * Traversals over the view only touch these arrays and do not allocate (other than the caller's own bookkeeping).  The
+ * nodes and arcs can be mapped back to the design with getNode and getArc.
+ *
+ * @warning The view is not updated when the design is modified.  It should be rebuilt after any pass which adds or
+ * removes nodes or arcs.
+ */
+class DesignGraphView {
+public:
+    typedef uint32_t Index;
+
+    /**
+     * @brief Returned for nodes without a parent (ie. at the top level of the design)
+     */
+    static const Index NO_INDEX;
+
+    /**
+     * @brief The kind of node (used as a type tag so that common type checks do not require a dynamic_cast)
+     */
+    enum class NodeKind : uint8_t{
+        NODE, ///<A node which does not fall into one of the other categories
+        MASTER, ///<One of the master nodes of the design
+        SUBSYSTEM, ///<A SubSystem (other than a ContextFamilyContainer)
+        CONTEXT_FAMILY_CONTAINER, ///<A ContextFamilyContainer
+        STATE_UPDATE, ///<A StateUpdate node
+        THREAD_CROSSING_FIFO ///<A ThreadCrossingFIFO
+    };
+
+    /**
+     * @brief Properties of a node which are recorded in the view (bit flags)
+     */
+    enum NodeProperty : uint8_t{
+        HAS_STATE = 1, ///<Node::hasState
+        HAS_COMBINATIONAL_PATH = 2, ///<Node::hasCombinationalPath
+        PASSES_THROUGH_INPUTS = 4 ///<Node::passesThroughInputs
+    };
+
+    /**
+     * @brief The kind of arc, based on the ports it connects
+     */
+    enum class ArcKind : uint8_t{
+        STANDARD, ///<An arc between standard input and output ports
+        ORDER_CONSTRAINT, ///<An arc from or to an order constraint port
+        ENABLE, ///<An arc to the enable port of an EnableNode
+        SELECT ///<An arc to the select port of a Mux
+    };
+
+    /**
+     * @brief The strongly connected components found by findStronglyConnectedComponents
+     *
+     * The nodes of each component are stored contiguously.  The nodes of component c are
+     * componentNodes[componentStart[c]] to componentNodes[componentStart[c+1]-1].
+     */
+    struct StronglyConnectedComponents{
+        std::vector<Index> componentNodes; ///<The nodes of each component
+        std::vector<Index> componentStart; ///<Index into componentNodes where each component starts.  Has an additional entry at the end
+        std::vector<Index> nodeComponents; ///<The component of each node in the view (NO_INDEX if the node was not searched)
+
+        Index getNumComponents() const {
+            return componentStart.size()-1;
+        }
+
+        const Index* componentBegin(Index component) const {
+            return componentNodes.data() + componentStart[component];
+        }
+
+        const Index* componentEnd(Index component) const {
+            return componentNodes.data() + componentStart[component+1];
+        }
+    };
+
+private:
+    std::vector<std::shared_ptr<Node>> nodes; ///<The nodes in the view.  The position in this vector is the node's index
+    std::unordered_map<Node*, Index> nodeIndexes; ///<Map from node to index in the view
+    std::vector<int> nodeIds; ///<The ID of each node
+    std::vector<Index> nodeParents; ///<The index of the parent of each node (NO_INDEX if at the top level)
+    std::vector<int> nodePartitions; ///<The partition of each node
+    std::vector<NodeKind> nodeKinds; ///<The kind of each node
+    std::vector<uint8_t> nodeProperties; ///<The NodeProperty flags of each node
+
+    std::vector<std::shared_ptr<Arc>> arcs; ///<The arcs in the view.  The position in this vector is the arc's index
+    std::vector<Index> arcSrcs; ///<The index of the src node of each arc
+    std::vector<Index> arcDsts; ///<The index of the dst node of each arc
+    std::vector<int> arcSrcPortNums; ///<The port number of the src port of each arc
+    std::vector<int> arcDstPortNums; ///<The port number of the dst port of each arc
+    std::vector<ArcKind> arcKinds; ///<The kind of each arc
+
+    std::vector<Index> outArcStart; ///<Index into outArcs where the out arcs of each node start.  Has an additional entry at the end
+    std::vector<Index> outArcs; ///<The out arcs of each node
+    std::vector<Index> inArcStart; ///<Index into inArcs where the in arcs of each node start.  Has an additional entry at the end
+    std::vector<Index> inArcs; ///<The in arcs of each node
+
+    /**
+     * @brief Add a node to the view
+     */
+    void addNode(std::shared_ptr<Node> node);
+
+    /**
+     * @brief Build the CSR arrays (ex. outArcStart and outArcs) for one endpoint of the arcs using a counting sort
+     * @param endpoints the node index of the endpoint of each arc (ex. arcSrcs)
+     * @param start set to the start of each node's arcs in arcList
+     * @param arcList set to the arcs of each node
+     */
+    void buildCSR(const std::vector<Index> &endpoints, std::vector<Index> &start, std::vector<Index> &arcList);
+
+public:
+    /**
+     * @brief Build a view of the design
+     * @param design the design to build the view of.  It is not modified
+     */
+    explicit DesignGraphView(Design &design);
+
+    Index getNumNodes() const;
+    Index getNumArcs() const;
+
+    /**
+     * @brief Get the index of a node in the view.  Throws an error if the node is not in the view
+     */
+    Index getNodeIndex(const std::shared_ptr<Node> &node) const;
+
+    /**
+     * @brief Returns true if the node is in the view
+     */
+    bool containsNode(const std::shared_ptr<Node> &node) const;
+
+    std::shared_ptr<Node> getNode(Index node) const;
+    int getNodeId(Index node) const;
+    Index getNodeParent(Index node) const;
+    int getNodePartition(Index node) const;
+    NodeKind getNodeKind(Index node) const;
+
+    /**
+     * @brief Returns true if the node has the given property
+     */
+    bool nodeHasProperty(Index node, NodeProperty property) const;
+
+    std::shared_ptr<Arc> getArc(Index arc) const;
+    Index getArcSrc(Index arc) const;
+    Index getArcDst(Index arc) const;
+    int getArcSrcPortNum(Index arc) const;
+    int getArcDstPortNum(Index arc) const;
+    ArcKind getArcKind(Index arc) const;
+
+    /**
+     * @brief Get a pointer to the first out arc of a node.  The out arcs are contiguous and end at outArcsEnd
+     */
+    const Index* outArcsBegin(Index node) const;
+
+    /**
+     * @brief Get a pointer past the last out arc of a node
+     */
+    const Index* outArcsEnd(Index node) const;
+
+    /**
+     * @brief Get a pointer to the first in arc of a node.  The in arcs are contiguous and end at inArcsEnd
+     */
+    const Index* inArcsBegin(Index node) const;
+
+    /**
+     * @brief Get a pointer past the last in arc of a node
+     */
+    const Index* inArcsEnd(Index node) const;
+
+    Index getOutDegree(Index node) const;
+    Index getInDegree(Index node) const;
+
+    /**
+     * @brief Finds the nodes reachable from a set of root nodes by following arcs
+     *
+     * @param roots the nodes to start from.  These are marked as reachable
+     * @param forward if true, arcs are followed from src to dst.  If false, arcs are followed from dst to src
+     * @param followOrderConstraints if false, order constraint arcs are not followed
+     * @return a vector, indexed by node index, which is true for each reachable node
+     */
+    std::vector<bool> findReachable(const std::vector<Index> &roots, bool forward, bool followOrderConstraints = true) const;
+
+    /**
+     * @brief Finds the strongly connected components of the nodes being searched using Tarjan's algorithm
+     *
+     * Uses GraphAlgs::findStronglyConnectedComponentsIndexed on the node indexes of the view.
+     *
+     * Arcs to or from nodes which are not searched are ignored (ex. to exclude the master nodes).
+     *
+     * @param searchNodes a vector, indexed by node index, which is true for each node to include in the search
+     * @param followOrderConstraints if false, order constraint arcs are not followed
+     * @return the strongly connected components.  Components are in reverse topological order (a component is found
+     * before any component with an arc into it)
+     */
+    StronglyConnectedComponents findStronglyConnectedComponents(const std::vector<bool> &searchNodes, bool followOrderConstraints = true) const;
+};
+
+/*! @} */
+
+#endif //VITIS_DESIGNGRAPHVIEW_H
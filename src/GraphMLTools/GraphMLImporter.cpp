@@ -4,6 +4,7 @@
 
 #include "GraphMLImporter.h"
 #include "GraphMLHelper.h"
+#include "GraphMLSAXHandler.h"
 
 #include "GraphCore/NodeFactory.h"
 #include "GraphCore/EnableInput.h"
@@ -61,6 +62,7 @@
 #include "BusNodes/VectorFanOut.h"
 #include "PrimitiveNodes/Concatenate.h"
 #include "MultiThread/LocklessThreadCrossingFIFO.h"
+#include "MultiThread/LocklessBatchedCommitThreadCrossingFIFO.h"
 #include "MultiRate/RateChange.h"
 #include "MultiRate/Downsample.h"
 #include "MultiRate/Upsample.h"
@@ -77,6 +79,8 @@
 #include <xercesc/util/PlatformUtils.hpp>
 #include <xercesc/dom/DOM.hpp>
 #include <xercesc/parsers/XercesDOMParser.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
 
 #include "General/ErrorHelpers.h"
 
@@ -225,32 +229,7 @@ std::unique_ptr<Design> GraphMLImporter::importGraphML(std::string filename, Gra
         std::cout << "Arcs Imported: " << numArcsImported << std::endl;
         #endif
 
-        //Propagate in nodes
-        std::vector<std::shared_ptr<Node>> nodes = design->getNodes();
-        for(auto node = nodes.begin(); node != nodes.end(); node++){
-            (*node)->propagateProperties();
-        }
-
-        //Discover Clock domain parameters/hierarchy and associate RateChange nodes with ClockDomains
-        // - This needs to be done before validation
-        for(auto node = nodes.begin(); node != nodes.end(); node++){
-            if(GeneralHelper::isType<Node, ClockDomain>(*node)){
-                std::shared_ptr<ClockDomain> clkDomain = std::static_pointer_cast<ClockDomain>(*node);
-                clkDomain->discoverClockDomainParameters();
-            }
-        }
-
-        //Should not be necessary to set original locations in this way.  They should be set during node creation
-//        //Get original names
-//        for(auto node = nodes.begin(); node != nodes.end(); node++){
-//            (*node)->setOrigLocation();
-//        }
-
-        //Validate nodes (get the node vector again in case nodes were added)
-        nodes = design->getNodes();
-        for(auto node = nodes.begin(); node != nodes.end(); node++){
-            (*node)->validate();
-        }
+        GraphMLImporter::finalizeImport(*design);
     }
 
 
@@ -263,6 +242,122 @@ std::unique_ptr<Design> GraphMLImporter::importGraphML(std::string filename, Gra
     return design;
 }
 
+std::unique_ptr<Design> GraphMLImporter::importGraphMLStreaming(std::string filename, GraphMLDialect dialect)
+{
+    //Check if input exists
+    std::ifstream inputFile;
+    inputFile.open(filename);
+    if(!inputFile.good()){
+        inputFile.close();
+
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Error: Input file does not exist: " + filename));
+    }
+    inputFile.close();
+
+    //Unlike importGraphML, the nodes are created while the file is being parsed (see GraphMLSAXHandler).  Edges are
+    //recorded during the parse and are converted to arcs after the parse completes since they may reference nodes
+    //declared later in the file.
+
+    try
+    {
+        XMLPlatformUtils::Initialize();
+    }
+    catch (const XMLException& toCatch)
+    {
+        char* error_msg = XMLString::transcode(toCatch.getMessage());
+        std::cerr << "Error during initialization! :\n" << error_msg << std::endl;
+        XMLString::release(&error_msg);
+        throw std::runtime_error(ErrorHelpers::genErrorStr("XML Parser Env could not initialize.  Could not import GraphML File."));
+    }
+
+    //Create Design Object
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+
+    //Scoping is used to ensure the Xerces objects are destroyed before the Terminate function is called
+    {
+        //From SAX2Count.cpp
+        SAX2XMLReader* parser = XMLReaderFactory::createXMLReader();
+        parser->setFeature(XMLUni::fgSAX2CoreNameSpaces, true);
+        parser->setFeature(XMLUni::fgSAX2CoreValidation, false);
+
+        std::map<std::string, std::shared_ptr<Node>> nodeMap;
+        GraphMLSAXHandler handler(*design, nodeMap, dialect);
+        parser->setContentHandler(&handler);
+        parser->setErrorHandler(&handler);
+
+        //Try Parsing File
+        try {
+            parser->parse(filename.c_str());
+        }
+        //Catch the various exceptions
+        catch (const XMLException& toCatch) {
+            char* message = XMLString::transcode(toCatch.getMessage());
+            std::cerr << "Exception message is:" << std::endl << message << std::endl;
+            XMLString::release(&message);
+            delete parser;
+            throw std::runtime_error(ErrorHelpers::genErrorStr("XML Parsing Failed Due to XML Exception"));
+        }
+        catch (const std::exception& toCatch) {
+            //Errors in the GraphML structure are reported by the handler
+            delete parser;
+            throw;
+        }
+        catch (...) {
+            std::cerr << "Unexpected Exception" << std::endl;
+            delete parser;
+            throw std::runtime_error(ErrorHelpers::genErrorStr("XML Parsing Failed Due to an Unknown Exception"));
+        }
+
+        delete parser;
+
+        #ifdef DEBUG
+        std::cout << "Nodes Imported: " << handler.getNodesImported() << std::endl;
+        #endif
+
+        int numArcsImported = handler.importDeferredEdges();
+        (void) numArcsImported; //Only reported in debug builds
+
+        #ifdef DEBUG
+        std::cout << "Arcs Imported: " << numArcsImported << std::endl;
+        #endif
+
+        GraphMLImporter::finalizeImport(*design);
+    }
+
+    XMLPlatformUtils::Terminate();
+
+    return design;
+}
+
+void GraphMLImporter::finalizeImport(Design &design){
+    //Propagate in nodes
+    std::vector<std::shared_ptr<Node>> nodes = design.getNodes();
+    for(auto node = nodes.begin(); node != nodes.end(); node++){
+        (*node)->propagateProperties();
+    }
+
+    //Discover Clock domain parameters/hierarchy and associate RateChange nodes with ClockDomains
+    // - This needs to be done before validation
+    for(auto node = nodes.begin(); node != nodes.end(); node++){
+        if(GeneralHelper::isType<Node, ClockDomain>(*node)){
+            std::shared_ptr<ClockDomain> clkDomain = std::static_pointer_cast<ClockDomain>(*node);
+            clkDomain->discoverClockDomainParameters();
+        }
+    }
+
+    //Should not be necessary to set original locations in this way.  They should be set during node creation
+//        //Get original names
+//        for(auto node = nodes.begin(); node != nodes.end(); node++){
+//            (*node)->setOrigLocation();
+//        }
+
+    //Validate nodes (get the node vector again in case nodes were added)
+    nodes = design.getNodes();
+    for(auto node = nodes.begin(); node != nodes.end(); node++){
+        (*node)->validate();
+    }
+}
+
 std::string GraphMLImporter::getTextValueOfNode(xercesc::DOMNode *node)
 {
     if(node->hasChildNodes()){
@@ -483,6 +578,21 @@ int GraphMLImporter::importNode(DOMNode *node, Design &design, std::map<std::str
     std::map<std::string, std::string> dataKeyValueMap;
     DOMNode *subgraph = GraphMLImporter::graphMLDataMap(node, dataKeyValueMap);
 
+    //Create the node
+    std::shared_ptr<SubSystem> container = GraphMLImporter::importNodeFromDataMap(fullNodeID, dataKeyValueMap, design, nodeMap, parent, dialect);
+
+    //Traverse the children in the subgraph (only nodes which can contain other nodes have their subgraph imported)
+    if (subgraph != nullptr && container != nullptr) {
+        nodesImported += GraphMLImporter::importNodes(subgraph, design, nodeMap, edgeNodes, container, dialect);
+    }
+
+    return nodesImported;
+
+}
+
+std::shared_ptr<SubSystem> GraphMLImporter::importNodeFromDataMap(std::string fullNodeID, std::map<std::string, std::string> &dataKeyValueMap, Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap, std::shared_ptr<SubSystem> parent, GraphMLDialect dialect) {
+    std::shared_ptr<SubSystem> container = nullptr; //Set if the new node can contain other nodes
+
     //Get the human readable instance name if one exists
     std::string name = "";
     bool hasName = false;
@@ -540,10 +650,8 @@ int GraphMLImporter::importNode(DOMNode *node, Design &design, std::map<std::str
         //Add to map
         nodeMap[fullNodeID] = newSubsystem;
 
-        //Traverse the children in the subgraph
-        if (subgraph != nullptr) {
-            nodesImported += GraphMLImporter::importNodes(subgraph, design, nodeMap, edgeNodes, newSubsystem, dialect);
-        }
+        //The children in the subgraph are imported under this node
+        container = newSubsystem;
 
     } else if (blockType == "Enabled Subsystem") {
         std::shared_ptr<EnabledSubSystem> newEnabledSubsystem = NodeFactory::createNode<EnabledSubSystem>(parent);
@@ -560,11 +668,8 @@ int GraphMLImporter::importNode(DOMNode *node, Design &design, std::map<std::str
         //Add to map
         nodeMap[fullNodeID] = newEnabledSubsystem;
 
-        //Traverse the children in the subgraph
-        if (subgraph != nullptr) {
-            nodesImported += GraphMLImporter::importNodes(subgraph, design, nodeMap, edgeNodes, newEnabledSubsystem,
-                                                          dialect);
-        }
+        //The children in the subgraph are imported under this node
+        container = newEnabledSubsystem;
 
     } else if (blockType == "Special Input Port") {
         std::shared_ptr<EnableInput> newNode = NodeFactory::createNode<EnableInput>(parent);
@@ -689,11 +794,8 @@ int GraphMLImporter::importNode(DOMNode *node, Design &design, std::map<std::str
         //Add to map
         nodeMap[fullNodeID] = expandedNode;
 
-        //Iterate through the children
-        //Traverse the children in the subgraph
-        if (subgraph != nullptr) {
-            nodesImported += GraphMLImporter::importNodes(subgraph, design, nodeMap, edgeNodes, expandedNode, dialect);
-        }
+        //The children in the subgraph are imported under this node
+        container = expandedNode;
     } else if (blockType == "Standard") {
         std::shared_ptr<Node> newNode = GraphMLImporter::importStandardNode(fullNodeID, dataKeyValueMap, parent,
                                                                             dialect);
@@ -752,7 +854,7 @@ int GraphMLImporter::importNode(DOMNode *node, Design &design, std::map<std::str
         throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown Block Type"));
     }
 
-    return nodesImported;
+    return container;
 
 }
 
@@ -1262,6 +1364,8 @@ std::shared_ptr<Node> GraphMLImporter::importThreadCrossingFIFONode(std::string
 
     if(blockFunction == "LocklessThreadCrossingFIFO") {
         newNode = LocklessThreadCrossingFIFO::createFromGraphML(id, name, dataKeyValueMap, parent, dialect);
+    }else if(blockFunction == "LocklessBatchedCommitThreadCrossingFIFO") {
+        newNode = LocklessBatchedCommitThreadCrossingFIFO::createFromGraphML(id, name, dataKeyValueMap, parent, dialect);
     }else{
         throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown ThreadCrossingFIFO type: " + blockFunction, parent->getFullyQualifiedName() + "/" + name));
     }
@@ -1350,139 +1454,154 @@ int GraphMLImporter::importEdges(std::vector<xercesc::DOMNode *> &edgeNodes, Des
 
         GraphMLImporter::graphMLDataAttributeMap(edgeNodes[i], attributeValueMap, dataKeyValueMap);
 
-        //==== Extract Information from "Edge" Entry ====
-        int id = Arc::getIDFromGraphMLFullPath(attributeValueMap.at("id"));
-
-        std::string srcFullPath = attributeValueMap.at("source");
-        std::string dstFullPath = attributeValueMap.at("target");
-
-        int srcPortNum = std::stoi(dataKeyValueMap.at("arc_src_port"));
-        int dstPortNum = 1; //So that decrement puts it to 0 if dst is enable port (for error check below)
-        //Handle case when dst port number may not be given if enabled.
-        std::string dstPortType = dataKeyValueMap.at("arc_dst_port_type");
-        bool standardDst = dstPortType == "Standard";
-        bool isEnableDst = dstPortType == "Enable";
-        bool isSelectDst = dstPortType == "Select";
-        if(standardDst){
-            dstPortNum = std::stoi(dataKeyValueMap.at("arc_dst_port"));
-        }
+        GraphMLImporter::importEdge(attributeValueMap, dataKeyValueMap, design, nodeMap, dialect);
+    }
 
-        std::string complexStr = dataKeyValueMap.at("arc_complex");
-        bool complex = !(complexStr == "0" || complexStr == "false");
+    return (int) numEdges; //We import all edges/arcs in the list
+}
 
+void GraphMLImporter::importEdge(std::map<std::string, std::string> &attributeValueMap, std::map<std::string, std::string> &dataKeyValueMap,
+                                 Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap, GraphMLDialect dialect) {
+    //==== Extract Information from "Edge" Entry ====
+    int id = Arc::getIDFromGraphMLFullPath(attributeValueMap.at("id"));
+
+    std::string srcFullPath = attributeValueMap.at("source");
+    std::string dstFullPath = attributeValueMap.at("target");
+
+    int srcPortNum = std::stoi(dataKeyValueMap.at("arc_src_port"));
+    int dstPortNum = 1; //So that decrement puts it to 0 if dst is enable port (for error check below)
+    //Handle case when dst port number may not be given if enabled.
+    std::string dstPortType = dataKeyValueMap.at("arc_dst_port_type");
+    bool standardDst = dstPortType == "Standard";
+    bool isEnableDst = dstPortType == "Enable";
+    bool isSelectDst = dstPortType == "Select";
+    if(standardDst){
+        dstPortNum = std::stoi(dataKeyValueMap.at("arc_dst_port"));
+    }
 
-        std::vector<int> dimensions;
-        if(dialect == GraphMLDialect::SIMULINK_EXPORT) {
-            //Reformat the dimensions array from Simulink to exclude the number of dimensions
-            std::string simulinkDimStr = dataKeyValueMap.at("arc_dimension");
-            std::vector<int> simulinkDim = GeneralHelper::parseIntVecStr(simulinkDimStr);
+    std::string complexStr = dataKeyValueMap.at("arc_complex");
+    bool complex = !(complexStr == "0" || complexStr == "false");
 
-            if(simulinkDim.size() <= 0){
-                throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions not specified: Edge ID: " + GeneralHelper::to_string(id)));
-            }
 
-            if(simulinkDim.size() < 2){
-                throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions for arc illegal, expect [#dim, dim1, dim2, ...]: Edge ID: " + GeneralHelper::to_string(id)));
-            }
+    std::vector<int> dimensions;
+    if(dialect == GraphMLDialect::SIMULINK_EXPORT) {
+        //Reformat the dimensions array from Simulink to exclude the number of dimensions
+        std::string simulinkDimStr = dataKeyValueMap.at("arc_dimension");
+        std::vector<int> simulinkDim = GeneralHelper::parseIntVecStr(simulinkDimStr);
 
-            if(simulinkDim[0] != simulinkDim.size()-1){
-                throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions for arc disagreed with the length of the dimension vector: Edge ID: " + GeneralHelper::to_string(id)));
-            }
+        if(simulinkDim.size() <= 0){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions not specified: Edge ID: " + GeneralHelper::to_string(id)));
+        }
 
-            //Get the dimensions of the wire.  Detect if all dimensions are 1
-            bool allOnes = true;
-            for(int dim = 1; dim<simulinkDim.size(); dim++){
-                dimensions.push_back(simulinkDim[dim]);
-                if(simulinkDim[dim] != 1){
-                    allOnes = false;
-                }
-            }
+        if(simulinkDim.size() < 2){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions for arc illegal, expect [#dim, dim1, dim2, ...]: Edge ID: " + GeneralHelper::to_string(id)));
+        }
+
+        if(simulinkDim[0] != simulinkDim.size()-1){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions for arc disagreed with the length of the dimension vector: Edge ID: " + GeneralHelper::to_string(id)));
+        }
 
-            //Check if the #dimensions>1 but lengths indicate a scalar
-            if(allOnes && dimensions.size()>1){
-                //Emit a warning if this happens
-                std::cerr << ErrorHelpers::genWarningStr("Converting wire of Simulink dimension " + simulinkDimStr + " (number of dimensions is first element in array) to scalar: Edge ID: " + GeneralHelper::to_string(id)) << std::endl;
-                dimensions = std::vector<int>({1});
+        //Get the dimensions of the wire.  Detect if all dimensions are 1
+        bool allOnes = true;
+        for(int dim = 1; dim<simulinkDim.size(); dim++){
+            dimensions.push_back(simulinkDim[dim]);
+            if(simulinkDim[dim] != 1){
+                allOnes = false;
             }
+        }
 
-            //Check that the number of elements equals the dimensions
-            int width = std::stoi(dataKeyValueMap.at("arc_width"));
+        //Check if the #dimensions>1 but lengths indicate a scalar
+        if(allOnes && dimensions.size()>1){
+            //Emit a warning if this happens
+            std::cerr << ErrorHelpers::genWarningStr("Converting wire of Simulink dimension " + simulinkDimStr + " (number of dimensions is first element in array) to scalar: Edge ID: " + GeneralHelper::to_string(id)) << std::endl;
+            dimensions = std::vector<int>({1});
+        }
 
-            int elements = 0;
-            for(unsigned long dim = 0; dim < dimensions.size(); dim++){
-                if(dim == 0){
-                    elements = dimensions[dim];
-                }else{
-                    elements *= dimensions[dim];
-                }
-            }
+        //Check that the number of elements equals the dimensions
+        int width = std::stoi(dataKeyValueMap.at("arc_width"));
 
-            if(elements != width){
-                throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions for arc don't match width: Edge ID: " + GeneralHelper::to_string(id)));
+        int elements = 0;
+        for(unsigned long dim = 0; dim < dimensions.size(); dim++){
+            if(dim == 0){
+                elements = dimensions[dim];
+            }else{
+                elements *= dimensions[dim];
             }
+        }
 
-        }else{
-            //Just grab the dimension array
-            std::string dimensionsStr = dataKeyValueMap.at("arc_dimension");
-            dimensions = GeneralHelper::parseIntVecStr(dimensionsStr);
+        if(elements != width){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Simulink dimensions for arc don't match width: Edge ID: " + GeneralHelper::to_string(id)));
         }
 
-        std::string dataTypeStr = dataKeyValueMap.at("arc_datatype");
+    }else{
+        //Just grab the dimension array
+        std::string dimensionsStr = dataKeyValueMap.at("arc_dimension");
+        dimensions = GeneralHelper::parseIntVecStr(dimensionsStr);
+    }
 
-        //==== Create DataType object ====
-        DataType dataType(dataTypeStr, complex, dimensions);
+    std::string dataTypeStr = dataKeyValueMap.at("arc_datatype");
 
-        //==== Lookup Nodes ====
-        std::shared_ptr<Node> srcNode = nodeMap.at(srcFullPath);
-        std::shared_ptr<Node> dstNode = nodeMap.at(dstFullPath);
+    //==== Create DataType object ====
+    DataType dataType(dataTypeStr, complex, dimensions);
 
-        if(srcNode == nullptr){
-            throw std::runtime_error(ErrorHelpers::genErrorStr("Null Src Node Ptr"));
-        }
+    //==== Lookup Nodes ====
+    std::shared_ptr<Node> srcNode = nodeMap.at(srcFullPath);
+    std::shared_ptr<Node> dstNode = nodeMap.at(dstFullPath);
 
-        if(dstNode == nullptr){
-            throw std::runtime_error(ErrorHelpers::genErrorStr("Null Dst Node Ptr"));
-        }
+    if(srcNode == nullptr){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Null Src Node Ptr"));
+    }
 
-        if(dialect == GraphMLDialect::SIMULINK_EXPORT) {
-            //==== Adjust Port Numbers to be 0 based rather than 1 based (only when importing from Simulink)====
-            srcPortNum--;
-            dstPortNum--;
-        }
+    if(dstNode == nullptr){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Null Dst Node Ptr"));
+    }
 
-        if(srcPortNum < 0){
-            throw std::runtime_error(ErrorHelpers::genErrorStr("Src Port Num < 0"));
-        }
+    if(dialect == GraphMLDialect::SIMULINK_EXPORT) {
+        //==== Adjust Port Numbers to be 0 based rather than 1 based (only when importing from Simulink)====
+        srcPortNum--;
+        dstPortNum--;
+    }
 
-        if(dstPortNum < 0){
-            throw std::runtime_error(ErrorHelpers::genErrorStr("Dst Port Num < 0"));
-        }
+    if(srcPortNum < 0){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Src Port Num < 0"));
+    }
 
-        //==== Create the Arc ====
-        std::shared_ptr<Arc> newArc;
+    if(dstPortNum < 0){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Dst Port Num < 0"));
+    }
 
-        //For now, set sample time to -1
-        //TODO: set sample time
+    //==== Create the Arc ====
+    std::shared_ptr<Arc> newArc;
 
-        if(standardDst) {
-            newArc = Arc::connectNodes(srcNode, srcPortNum, dstNode, dstPortNum, dataType);
-        }else if(isEnableDst) {
-            std::shared_ptr<EnableNode> dstNodeEnabled = std::dynamic_pointer_cast<EnableNode>(dstNode);
-            newArc = Arc::connectNodes(srcNode, srcPortNum, dstNodeEnabled, dataType);
-        }else if(isSelectDst){
-            std::shared_ptr<Mux> dstNodeSelect = std::dynamic_pointer_cast<Mux>(dstNode);
-            newArc = Arc::connectNodes(srcNode, srcPortNum, dstNodeSelect, dataType);
-        }else{
-            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown Port Type: " + dstPortType));
-        }
+    //For now, set sample time to -1
+    //TODO: set sample time
+
+    if(standardDst) {
+        newArc = Arc::connectNodes(srcNode, srcPortNum, dstNode, dstPortNum, dataType);
+    }else if(isEnableDst) {
+        std::shared_ptr<EnableNode> dstNodeEnabled = std::dynamic_pointer_cast<EnableNode>(dstNode);
+        newArc = Arc::connectNodes(srcNode, srcPortNum, dstNodeEnabled, dataType);
+    }else if(isSelectDst){
+        std::shared_ptr<Mux> dstNodeSelect = std::dynamic_pointer_cast<Mux>(dstNode);
+        newArc = Arc::connectNodes(srcNode, srcPortNum, dstNodeSelect, dataType);
+    }else{
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown Port Type: " + dstPortType));
+    }
 
-        newArc->setId(id);
+    newArc->setId(id);
 
-        //==== Add Arc to Design ====
-        design.addArc(newArc);
+    //Optional placement of the FIFO inserted if this arc crosses partitions
+    auto fifoPlacementIter = dataKeyValueMap.find("arc_fifo_placement");
+    if(fifoPlacementIter != dataKeyValueMap.end()){
+        try{
+            newArc->setFifoPlacement(ThreadCrossingFIFOParameters::parseFIFOPlacement(fifoPlacementIter->second));
+        }catch(std::runtime_error &e){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown FIFO placement (" + fifoPlacementIter->second + "): Edge ID: " + GeneralHelper::to_string(id)));
+        }
     }
 
-    return (int) numEdges; //We import all edges/arcs in the list
+    //==== Add Arc to Design ====
+    design.addArc(newArc);
 }
 
 void
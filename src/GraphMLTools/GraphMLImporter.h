@@ -18,6 +18,7 @@
 //#include "GraphCore/EnableOutput.h"
 class EnableOutput;
 class RateChange;
+class GraphMLSAXHandler;
 
 /**
  * \addtogroup GraphMLTools GraphML Import/Export Tools
@@ -36,6 +37,8 @@ class RateChange;
  * However, since GraphML files are XML files, XML parsers are leveraged
  */
 class GraphMLImporter {
+    friend class GraphMLSAXHandler;
+
 public:
     /**
      * @brief Imports a GraphML file which contains an exported Simulink design.
@@ -51,6 +54,23 @@ public:
      */
     static std::unique_ptr<Design> importGraphML(std::string filename, GraphMLDialect dialect = GraphMLDialect::VITIS);
 
+    /**
+     * @brief Imports a GraphML file using a streaming (SAX2) parser rather than building a DOM tree.
+     *
+     * Produces the same design as @ref GraphMLImporter::importGraphML but the XML document is never held in memory.
+     * Nodes are created as soon as their data entries have been read (at the start of their subgraph or at the end of
+     * the node element).  Edges may reference nodes which are declared later in the file so their data is recorded and
+     * the arcs are created once the whole file has been read.  The peak memory usage is therefore proportional to the
+     * size of the design rather than the size of the XML document.
+     *
+     * @note The same factories (createFromGraphML) are used as in the DOM based import
+     *
+     * @param filename The filename of the GraphML file to import
+     * @param dialect The dialect of the GraphML file to import
+     * @return A pointer to a new Design object which contains an internal representation of the design
+     */
+    static std::unique_ptr<Design> importGraphMLStreaming(std::string filename, GraphMLDialect dialect = GraphMLDialect::VITIS);
+
     /**
      * @brief Prints the various DOM nodes of a grsaphml file;
      * @param filename The filename of the GraphML file to import
@@ -94,6 +114,23 @@ private:
      */
     static int importNode(xercesc::DOMNode *node, Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap, std::vector<xercesc::DOMNode*> &edgeNodes, std::shared_ptr<SubSystem> parent, GraphMLDialect dialect);
 
+    /**
+     * @brief Creates a node from the map of its GraphML data entries and adds it to the design and to the name/node map
+     *
+     * Used by both the DOM based and streaming import.  The subgraph of the node (if one exists) is imported by the
+     * caller.
+     *
+     * @param fullNodeID The full GraphML ID of the node
+     * @param dataKeyValueMap The map of key/value pairs for node parameters
+     * @param design The design object which is modified to include the imported node
+     * @param nodeMap A map of nodes names to node object pointers which is populated during the import
+     * @param parent The parent Node object for the current position in the graph hierarchy
+     * @param dialect Dialect of GraphML file being imported
+     * @return The node which the children in this node's subgraph should be imported under.  nullptr if the node cannot
+     *         contain other nodes
+     */
+    static std::shared_ptr<SubSystem> importNodeFromDataMap(std::string fullNodeID, std::map<std::string, std::string> &dataKeyValueMap, Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap, std::shared_ptr<SubSystem> parent, GraphMLDialect dialect);
+
     /**
      * @brief Imports a Standard GraphML block
      *
@@ -205,6 +242,26 @@ private:
      */
     static int importEdges(std::vector<xercesc::DOMNode*> &edgeNodes, Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap, GraphMLDialect dialect);
 
+    /**
+     * @brief Import a single DSP Arc into the design from the attributes and data entries of its GraphML edge
+     *
+     * Used by both the DOM based and streaming import.
+     *
+     * @param attributeValueMap A key/value map for attributes of the GraphML edge
+     * @param dataKeyValueMap A key/value map for data entries under the GraphML edge
+     * @param design The Design to add the arc to
+     * @param nodeMap A map of node names to Node object pointers
+     * @param dialect The dialect of the GraphML file being imported
+     */
+    static void importEdge(std::map<std::string, std::string> &attributeValueMap, std::map<std::string, std::string> &dataKeyValueMap, Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap, GraphMLDialect dialect);
+
+    /**
+     * @brief Completes the import of a design once all nodes and arcs have been created.  Properties are propagated,
+     * ClockDomain parameters are discovered, and the nodes are validated
+     * @param design The design which was imported
+     */
+    static void finalizeImport(Design &design);
+
     /**
      * @brief Get the text value for a given node (in the text element under this node)
      * @param node The node to get the text value of
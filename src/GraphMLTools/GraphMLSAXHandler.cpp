@@ -0,0 +1,244 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "GraphMLSAXHandler.h"
+#include "GraphMLImporter.h"
+#include "GraphMLHelper.h"
+#include "XMLTranscoder.h"
+
+#include <iostream>
+#include <cctype>
+
+#include <xercesc/sax/SAXParseException.hpp>
+
+#include "General/GeneralHelper.h"
+#include "General/ErrorHelpers.h"
+
+using namespace xercesc;
+
+GraphMLSAXHandler::GraphMLSAXHandler(Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap,
+                                     GraphMLDialect dialect) : design(design), nodeMap(nodeMap), dialect(dialect),
+                                     skipDepth(0), dataIsText(true), nodesImported(0) {
+    parentStack.push_back(nullptr); //Top level nodes have no parent
+}
+
+bool GraphMLSAXHandler::insideElement(ElementType type) {
+    return !openElements.empty() && openElements.back().type == type;
+}
+
+std::shared_ptr<SubSystem> GraphMLSAXHandler::createOpenNode() {
+    OpenNode &openNode = openNodes.back();
+
+    std::shared_ptr<SubSystem> container = nullptr;
+    if(!openNode.created) {
+        container = GraphMLImporter::importNodeFromDataMap(openNode.fullNodeID, openNode.dataKeyValueMap, design,
+                                                           nodeMap, openNode.parent, dialect);
+        openNode.created = true;
+        nodesImported++;
+
+        //The data entries are no longer needed
+        openNode.dataKeyValueMap.clear();
+    }
+
+    return container;
+}
+
+void GraphMLSAXHandler::startElement(const XMLCh *const uri, const XMLCh *const localname, const XMLCh *const qname,
+                                     const Attributes &attrs) {
+    if(skipDepth > 0){
+        //Inside of an element which is being ignored
+        skipDepth++;
+        return;
+    }
+
+    if(insideElement(ElementType::DATA)){
+        //An element inside of a data entry.  The DOM import only accepts data entries which contain a single text node
+        dataIsText = false;
+        skipDepth = 1;
+        return;
+    }
+
+    bool inNodeOrEdge = insideElement(ElementType::NODE) || insideElement(ElementType::EDGE);
+    std::string elementName = GraphMLHelper::getTranscodedString(localname);
+
+    if(elementName == "graphml") {
+        openElements.emplace_back(ElementType::GRAPHML);
+
+    } else if(elementName == "key") {
+        //For now, we do not parse these keys
+        skipDepth = 1;
+
+    } else if(elementName == "graph") {
+        if(insideElement(ElementType::NODE)){
+            //This is the subgraph of a node.  All data entries of the node have been read so the node can be created
+            if(openNodes.back().hasSubgraph){
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Node with multiple graph children encountered"));
+            }
+            openNodes.back().hasSubgraph = true;
+
+            std::shared_ptr<SubSystem> container = createOpenNode();
+            if(container == nullptr){
+                //Only nodes which can contain other nodes have their subgraph imported
+                skipDepth = 1;
+            }else{
+                parentStack.push_back(container);
+                openElements.emplace_back(ElementType::GRAPH, true);
+            }
+        }else if(insideElement(ElementType::EDGE)){
+            //Ignore graphs under edges (the DOM import ignores them)
+            skipDepth = 1;
+        }else{
+            openElements.emplace_back(ElementType::GRAPH);
+        }
+
+    } else if(elementName == "node" || elementName == "edge") {
+        if(inNodeOrEdge){
+            //Not a data entry or subgraph of the enclosing node/edge.  The DOM import ignores these
+            skipDepth = 1;
+            return;
+        }
+
+        if(elementName == "node") {
+            const XMLCh *idXMLCh = attrs.getValue(TranscodeToXMLCh("id"));
+            if (idXMLCh == nullptr) {
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Node with no ID encountered"));
+            }
+
+            openNodes.emplace_back(GraphMLHelper::getTranscodedString(idXMLCh), parentStack.back());
+            openElements.emplace_back(ElementType::NODE);
+        }else{
+            currentEdge = DeferredEdge();
+            XMLSize_t numAttributes = attrs.getLength();
+            for(XMLSize_t i = 0; i < numAttributes; i++){
+                std::string attrName = GraphMLHelper::getTranscodedString(attrs.getQName(i));
+                const XMLCh *attrVal = attrs.getValue(i);
+                currentEdge.attributeValueMap[attrName] = attrVal == nullptr ? "" : GraphMLHelper::getTranscodedString(attrVal);
+            }
+            openElements.emplace_back(ElementType::EDGE);
+        }
+
+    } else if(elementName == "data") {
+        if(!inNodeOrEdge){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Encountered a GraphML data node in an unexpected location"));
+        }
+
+        if(insideElement(ElementType::NODE) && openNodes.back().created){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Data entry after the subgraph of node " +
+                                     openNodes.back().fullNodeID + " is not supported by the streaming GraphML importer"));
+        }
+
+        //The key is an attribute
+        dataKey = "";
+        if(attrs.getLength() > 0){
+            const XMLCh *keyXMLCh = attrs.getValue(TranscodeToXMLCh("key"));
+            if (keyXMLCh == nullptr) {
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Data node with no key encountered"));
+            }
+            dataKey = GraphMLHelper::getTranscodedString(keyXMLCh);
+        }
+
+        dataText.clear();
+        dataIsText = true;
+        openElements.emplace_back(ElementType::DATA);
+
+    } else if(inNodeOrEdge) {
+        //Other children of nodes and edges are ignored (as in the DOM import)
+        skipDepth = 1;
+    } else {
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Encountered an unknown GraphML tag: " + elementName));
+    }
+}
+
+void GraphMLSAXHandler::endElement(const XMLCh *const uri, const XMLCh *const localname, const XMLCh *const qname) {
+    if(skipDepth > 0){
+        skipDepth--;
+        return;
+    }
+
+    if(openElements.empty()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unexpected end of GraphML element"));
+    }
+
+    OpenElement element = openElements.back();
+    openElements.pop_back();
+
+    switch(element.type){
+        case ElementType::DATA: {
+            std::string dataValue = dataIsText ? GraphMLHelper::getTranscodedString(dataText.c_str()) : "";
+
+            if(insideElement(ElementType::NODE)){
+                openNodes.back().dataKeyValueMap[dataKey] = dataValue;
+            }else{
+                currentEdge.dataKeyValueMap[dataKey] = dataValue;
+            }
+            dataText.clear();
+            break;
+        }
+        case ElementType::GRAPH:
+            if(element.pushedParent){
+                parentStack.pop_back();
+            }
+            break;
+        case ElementType::NODE:
+            //Nodes without a subgraph are created once all of their data entries are read
+            createOpenNode();
+            openNodes.pop_back();
+            break;
+        case ElementType::EDGE:
+            deferredEdges.push_back(currentEdge);
+            currentEdge = DeferredEdge();
+            break;
+        case ElementType::GRAPHML:
+            break;
+    }
+}
+
+void GraphMLSAXHandler::characters(const XMLCh *const chars, const XMLSize_t length) {
+    if(skipDepth > 0){
+        return;
+    }
+
+    if(insideElement(ElementType::DATA)){
+        //The text of a data entry may be delivered in several pieces
+        dataText.append(chars, length);
+    }else if(!insideElement(ElementType::NODE) && !insideElement(ElementType::EDGE)){
+        //Text outside of data entries should be whitespace
+        std::basic_string<XMLCh> textXMLCh(chars, length);
+        std::string text = GraphMLHelper::getTranscodedString(textXMLCh.c_str());
+
+        for(unsigned long i = 0; i<text.size(); i++){
+            if(!std::isspace(text[i])){
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Encountered a text node that is not whitespace"));
+            }
+        }
+    }
+}
+
+void GraphMLSAXHandler::error(const SAXParseException &exc) {
+    fatalError(exc);
+}
+
+void GraphMLSAXHandler::fatalError(const SAXParseException &exc) {
+    std::cerr << "Exception message is:" << std::endl << GraphMLHelper::getTranscodedString(exc.getMessage()) << std::endl;
+    throw std::runtime_error(ErrorHelpers::genErrorStr("XML Parsing Failed Due to XML Exception at Line " +
+                             GeneralHelper::to_string(exc.getLineNumber()) + ", Column " +
+                             GeneralHelper::to_string(exc.getColumnNumber())));
+}
+
+int GraphMLSAXHandler::importDeferredEdges() {
+    int numEdges = deferredEdges.size();
+
+    for(unsigned long i = 0; i<deferredEdges.size(); i++){
+        GraphMLImporter::importEdge(deferredEdges[i].attributeValueMap, deferredEdges[i].dataKeyValueMap, design,
+                                    nodeMap, dialect);
+    }
+
+    deferredEdges.clear();
+
+    return numEdges;
+}
+
+int GraphMLSAXHandler::getNodesImported() const {
+    return nodesImported;
+}
@@ -0,0 +1,152 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_GRAPHMLSAXHANDLER_H
+#define VITIS_GRAPHMLSAXHANDLER_H
+
+#include <memory>
+#include <string>
+#include <map>
+#include <vector>
+
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/Attributes.hpp>
+
+#include "GraphCore/Design.h"
+#include "GraphCore/SubSystem.h"
+#include "GraphMLDialect.h"
+
+/**
+ * \addtogroup GraphMLTools GraphML Import/Export Tools
+ * @{
+*/
+
+/**
+ * @brief A SAX2 content handler which imports a GraphML design as the file is streamed through the parser.
+ *
+ * Used by @ref GraphMLImporter::importGraphMLStreaming.  Unlike the DOM based import, the XML document is never held
+ * in memory.  Only the data entries of the nodes which are currently open (the path from the root of the hierarchy
+ * to the current position in the file) and the data entries of edges are retained.
+ *
+ * A node is created (using the same logic as the DOM import) once all of its data entries have been read.  This occurs
+ * either when the node's subgraph starts or when the node element ends.  Nodes in the subgraph are then created under
+ * the new node.  Data entries are expected to come before the subgraph of a node (as emitted by Vitis and the Simulink
+ * exporter).  An exception is thrown if a data entry follows the subgraph.
+ *
+ * GraphML does not require edges to be declared after the nodes they reference.  Edges are therefore recorded and
+ * only converted to arcs by @ref importDeferredEdges once the file has been fully read.
+ */
+class GraphMLSAXHandler : public xercesc::DefaultHandler {
+private:
+    /**
+     * @brief The types of GraphML elements which are tracked while streaming
+     */
+    enum class ElementType{
+        GRAPHML, ///<The root graphml element
+        GRAPH, ///<A graph or subgraph
+        NODE, ///<A node
+        EDGE, ///<An edge
+        DATA ///<A data entry of a node or edge
+    };
+
+    /**
+     * @brief An open element
+     */
+    struct OpenElement{
+        ElementType type;
+        bool pushedParent; ///<True if this is a subgraph which pushed a new parent onto the parent stack
+
+        OpenElement(ElementType type, bool pushedParent = false) : type(type), pushedParent(pushedParent) {}
+    };
+
+    /**
+     * @brief A GraphML node which has been opened but may not have been created yet
+     */
+    struct OpenNode{
+        std::string fullNodeID; ///<The full GraphML ID of the node
+        std::map<std::string, std::string> dataKeyValueMap; ///<The data entries read so far
+        std::shared_ptr<SubSystem> parent; ///<The parent the node will be created under
+        bool created; ///<True if the node has been created
+        bool hasSubgraph; ///<True if the subgraph of this node has been encountered
+
+        OpenNode(std::string fullNodeID, std::shared_ptr<SubSystem> parent) : fullNodeID(fullNodeID), parent(parent),
+                                                                               created(false), hasSubgraph(false) {}
+    };
+
+    /**
+     * @brief The attributes and data entries of an edge which will be converted to an arc once all nodes are imported
+     */
+    struct DeferredEdge{
+        std::map<std::string, std::string> attributeValueMap;
+        std::map<std::string, std::string> dataKeyValueMap;
+    };
+
+    Design &design; ///<The design nodes and arcs are imported into
+    std::map<std::string, std::shared_ptr<Node>> &nodeMap; ///<A map of node names to Node object pointers populated during the import
+    GraphMLDialect dialect; ///<The dialect of the GraphML file being imported
+
+    std::vector<OpenElement> openElements; ///<The stack of tracked elements which are currently open
+    std::vector<OpenNode> openNodes; ///<The stack of nodes which are currently open
+    std::vector<std::shared_ptr<SubSystem>> parentStack; ///<The stack of parents for the current position in the hierarchy (nullptr at the top level)
+    int skipDepth; ///<The depth of the element subtree currently being ignored (0 if no subtree is being ignored)
+
+    std::string dataKey; ///<The key of the data entry currently being read
+    std::basic_string<XMLCh> dataText; ///<The text of the data entry currently being read
+    bool dataIsText; ///<False if the current data entry contained an element, in which case its value is empty (as in the DOM import)
+
+    DeferredEdge currentEdge; ///<The edge currently being read
+    std::vector<DeferredEdge> deferredEdges; ///<Edges which have been read but not yet imported
+
+    int nodesImported;
+
+    /**
+     * @brief Creates the innermost open node if it has not already been created
+     * @return The node which the children in the subgraph of the open node should be imported under.  nullptr if the
+     *         node cannot contain other nodes
+     */
+    std::shared_ptr<SubSystem> createOpenNode();
+
+    /**
+     * @brief Checks if the innermost tracked element is of the given type
+     */
+    bool insideElement(ElementType type);
+
+public:
+    /**
+     * @brief Constructs a handler which imports into the given design
+     * @param design The design to import into
+     * @param nodeMap A map of node names to Node object pointers which is populated during the import
+     * @param dialect The dialect of the GraphML file being imported
+     */
+    GraphMLSAXHandler(Design &design, std::map<std::string, std::shared_ptr<Node>> &nodeMap, GraphMLDialect dialect);
+
+    void startElement(const XMLCh* const uri, const XMLCh* const localname, const XMLCh* const qname,
+                      const xercesc::Attributes& attrs) override;
+
+    void endElement(const XMLCh* const uri, const XMLCh* const localname, const XMLCh* const qname) override;
+
+    void characters(const XMLCh* const chars, const XMLSize_t length) override;
+
+    void error(const xercesc::SAXParseException& exc) override;
+
+    void fatalError(const xercesc::SAXParseException& exc) override;
+
+    /**
+     * @brief Converts the edges read from the file into arcs in the design
+     *
+     * @note Should be called after the file has been fully parsed so that all nodes referenced by the edges exist
+     *
+     * @return number of edges imported
+     */
+    int importDeferredEdges();
+
+    /**
+     * @brief Get the number of nodes imported so far
+     */
+    int getNodesImported() const;
+};
+
+/*! @} */
+
+#endif //VITIS_GRAPHMLSAXHANDLER_H
@@ -13,11 +13,11 @@
 
 #include <iostream>
 
-DiscreteFIR::DiscreteFIR() {
+DiscreteFIR::DiscreteFIR() : blockImplementation(BlockFIRHelpers::BlockFIRImplementation::AUTO) {
 
 }
 
-DiscreteFIR::DiscreteFIR(std::shared_ptr<SubSystem> parent) : HighLevelNode(parent), coefSource(CoefSource::FIXED) {
+DiscreteFIR::DiscreteFIR(std::shared_ptr<SubSystem> parent) : HighLevelNode(parent), coefSource(CoefSource::FIXED), blockImplementation(BlockFIRHelpers::BlockFIRImplementation::AUTO) {
 
 }
 
@@ -41,6 +41,29 @@ std::string DiscreteFIR::coefSourceToString(DiscreteFIR::CoefSource coefSource)
     }
 }
 
+InnerProduct::CoefSymmetry DiscreteFIR::findCoefSymmetry(const std::vector<NumericValue> &coefs) {
+    if(coefs.size() < 2){
+        return InnerProduct::CoefSymmetry::NONE;
+    }
+
+    bool symmetric = true;
+    bool antisymmetric = true;
+    for(unsigned long i = 0; i<coefs.size(); i++){
+        std::complex<double> coef = BlockFIRHelpers::toComplexDouble(coefs[i]);
+        std::complex<double> mirror = BlockFIRHelpers::toComplexDouble(coefs[coefs.size()-1-i]);
+        symmetric &= coef == mirror;
+        antisymmetric &= coef == -mirror; //Requires the middle coefficient of an odd length filter to be 0
+    }
+
+    if(symmetric){
+        return InnerProduct::CoefSymmetry::SYMMETRIC;
+    }else if(antisymmetric){
+        return InnerProduct::CoefSymmetry::ANTISYMMETRIC;
+    }
+
+    return InnerProduct::CoefSymmetry::NONE;
+}
+
 DiscreteFIR::CoefSource DiscreteFIR::getCoefSource() const {
     return coefSource;
 }
@@ -65,6 +88,14 @@ void DiscreteFIR::setInitVals(const std::vector<NumericValue> &initVals) {
     DiscreteFIR::initVals = initVals;
 }
 
+BlockFIRHelpers::BlockFIRImplementation DiscreteFIR::getBlockImplementation() const {
+    return blockImplementation;
+}
+
+void DiscreteFIR::setBlockImplementation(BlockFIRHelpers::BlockFIRImplementation blockImplementation) {
+    DiscreteFIR::blockImplementation = blockImplementation;
+}
+
 std::shared_ptr<DiscreteFIR>
 DiscreteFIR::createFromGraphML(int id, std::string name, std::map<std::string, std::string> dataKeyValueMap,
                                      std::shared_ptr<SubSystem> parent, GraphMLDialect dialect) {
@@ -124,6 +155,11 @@ DiscreteFIR::createFromGraphML(int id, std::string name, std::map<std::string, s
 
     newNode->setInitVals(initVals);
 
+    //Get the block implementation (optional, only in the VITIS dialect)
+    if(dialect == GraphMLDialect::VITIS && dataKeyValueMap.find("BlockImplementation") != dataKeyValueMap.end()){
+        newNode->setBlockImplementation(BlockFIRHelpers::parseBlockFIRImplementationStr(dataKeyValueMap.at("BlockImplementation")));
+    }
+
     return newNode;
 }
 
@@ -242,6 +278,10 @@ DiscreteFIR::expand(std::vector<std::shared_ptr<Node>> &new_nodes, std::vector<s
         innerProductNode->setName("InnerProduct");
         innerProductNode->setComplexConjBehavior(
                 InnerProduct::ComplexConjBehavior::NONE); //Do not complex conjugate for FIR
+        innerProductNode->setBlockFIRImplementation(blockImplementation); //Only used if the FIR is sub-blocked
+        //Symmetric and antisymmetric coefficients are folded so that mirrored taps share a multiply
+        InnerProduct::CoefSymmetry coefSymmetry = coefSource == CoefSource::FIXED ? findCoefSymmetry(coefs) : InnerProduct::CoefSymmetry::NONE;
+        innerProductNode->setCoefSymmetry(coefSymmetry);
         new_nodes.push_back(innerProductNode);
 
         //Connect TappedDelay to InnerProduct
@@ -267,6 +307,15 @@ DiscreteFIR::expand(std::vector<std::shared_ptr<Node>> &new_nodes, std::vector<s
             //Reverse the order of coefs when the Inner Product is in oldest first mode.  This helps with Laminar unrolling because samples can be directly copied from input buffers without being reversed
             std::vector<NumericValue> coefsReversed = coefs;
             std::reverse(coefsReversed.begin(), coefsReversed.end());
+            //When folded, only the first half of the coefficients are needed.  The middle coefficient of an odd length
+            //filter is kept if it is symmetric (it is 0 if it is antisymmetric)
+            int numCoefsFolded = numCoefs;
+            if(coefSymmetry == InnerProduct::CoefSymmetry::SYMMETRIC){
+                numCoefsFolded = (numCoefs+1)/2;
+            }else if(coefSymmetry == InnerProduct::CoefSymmetry::ANTISYMMETRIC){
+                numCoefsFolded = numCoefs/2;
+            }
+            coefsReversed.resize(numCoefsFolded);
             coefNode->setValue(coefsReversed);
             new_nodes.push_back(coefNode);
 
@@ -293,7 +342,7 @@ DiscreteFIR::expand(std::vector<std::shared_ptr<Node>> &new_nodes, std::vector<s
                 //TODO: Change if fixed point implemented
                 coefDataType = outputDT;
                 coefDataType.setComplex(isComplex); //Output can be complex but input can be real
-                coefDataType.setDimensions({numCoefs});
+                coefDataType.setDimensions({numCoefsFolded});
             } else {
                 //All are integers, adopt an int type
                 bool isSigned = false;
@@ -315,7 +364,7 @@ DiscreteFIR::expand(std::vector<std::shared_ptr<Node>> &new_nodes, std::vector<s
                 }
 
                 //TODO: Change if fixed point implemented
-                coefDataType = DataType(false, isSigned, isComplex, maxBits, 0, {numCoefs});
+                coefDataType = DataType(false, isSigned, isComplex, maxBits, 0, {numCoefsFolded});
             }
 
             //Connect constant to inner product
@@ -356,6 +405,7 @@ std::set<GraphMLParameter> DiscreteFIR::graphMLParameters() {
     parameters.insert(GraphMLParameter("CoefSource", "string", true));
     parameters.insert(GraphMLParameter("Coefficients", "string", true));
     parameters.insert(GraphMLParameter("InitialStates", "string", true));
+    parameters.insert(GraphMLParameter("BlockImplementation", "string", true));
 
     return parameters;
 }
@@ -375,6 +425,7 @@ DiscreteFIR::emitGraphML(xercesc::DOMDocument *doc, xercesc::DOMElement *graphNo
     GraphMLHelper::addDataNode(doc, thisNode, "CoefSource", coefSourceToString(coefSource));
     GraphMLHelper::addDataNode(doc, thisNode, "Coefficients", NumericValue::toString(coefs));
     GraphMLHelper::addDataNode(doc, thisNode, "InitialStates", NumericValue::toString(initVals));
+    GraphMLHelper::addDataNode(doc, thisNode, "BlockImplementation", BlockFIRHelpers::blockFIRImplementationToString(blockImplementation));
 
     return thisNode;
 }
@@ -393,6 +444,7 @@ std::string DiscreteFIR::labelStr() {
     }
 
     label += "\nInitialStates: " + NumericValue::toString(initVals);
+    label += "\nBlockImplementation: " + BlockFIRHelpers::blockFIRImplementationToString(blockImplementation);
 
     return label;
 }
@@ -476,7 +528,7 @@ void DiscreteFIR::validate() {
     }
 }
 
-DiscreteFIR::DiscreteFIR(std::shared_ptr<SubSystem> parent, DiscreteFIR* orig) : HighLevelNode(parent, orig), coefSource(orig->coefSource), coefs(orig->coefs), initVals(orig->initVals) {
+DiscreteFIR::DiscreteFIR(std::shared_ptr<SubSystem> parent, DiscreteFIR* orig) : HighLevelNode(parent, orig), coefSource(orig->coefSource), coefs(orig->coefs), initVals(orig->initVals), blockImplementation(orig->blockImplementation) {
 
 }
 
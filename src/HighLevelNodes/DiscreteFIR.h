@@ -8,6 +8,8 @@
 #include "HighLevelNode.h"
 #include "GraphMLTools/GraphMLDialect.h"
 #include "GraphCore/NodeFactory.h"
+#include "General/BlockFIRHelpers.h"
+#include "PrimitiveNodes/InnerProduct.h"
 
 /**
  * \addtogroup HighLevelNodes High Level Nodes
@@ -33,10 +35,20 @@ public:
     static CoefSource parseCoefSourceStr(std::string str);
     static std::string coefSourceToString(CoefSource coefSource);
 
+    /**
+     * @brief Finds if the given coefficients are symmetric or antisymmetric (linear phase)
+     *
+     * @param coefs the coefficients of the FIR filter
+     * @return SYMMETRIC if c[k] == c[N-1-k], ANTISYMMETRIC if c[k] == -c[N-1-k], NONE otherwise or if there are fewer
+     * than 2 coefficients
+     */
+    static InnerProduct::CoefSymmetry findCoefSymmetry(const std::vector<NumericValue> &coefs);
+
 private:
     CoefSource coefSource; ///<The source of the coefficients for this FIR filter
     std::vector<NumericValue> coefs; ///<The coefficients of the FIR filter (only used if coefficient source is FIXED)
     std::vector<NumericValue> initVals; ///<The initial values of the state elements in the FIR filter
+    BlockFIRHelpers::BlockFIRImplementation blockImplementation; ///<The implementation of the InnerProduct when the FIR filter is sub-blocked (see BlockFIRHelpers)
 
     /**
      * @brief Constructs a DiscreteFIR filter with no coefficients or initVals.
@@ -76,6 +88,8 @@ public:
     void setCoefs(const std::vector<NumericValue> &coefs);
     std::vector<NumericValue> getInitVals() const;
     void setInitVals(const std::vector<NumericValue> &initVals);
+    BlockFIRHelpers::BlockFIRImplementation getBlockImplementation() const;
+    void setBlockImplementation(BlockFIRHelpers::BlockFIRImplementation blockImplementation);
 
     //==== Factories ====
     /**
@@ -102,6 +116,12 @@ public:
      *
      * Expands into direct form FIR
      *
+     * If the coefficients are fixed and symmetric or antisymmetric, only the first half of the coefficients are passed
+     * to the InnerProduct which pre-adds (or subtracts) the mirrored taps before multiplying (see
+     * InnerProduct::CoefSymmetry)
+     *
+     * The block implementation is passed to the InnerProduct and is used if the FIR filter is sub-blocked
+     *
      */
     std::shared_ptr<ExpandedNode> expand(std::vector<std::shared_ptr<Node>> &new_nodes, std::vector<std::shared_ptr<Node>> &deleted_nodes,
                                              std::vector<std::shared_ptr<Arc>> &new_arcs, std::vector<std::shared_ptr<Arc>> &deleted_arcs,
@@ -17,7 +17,8 @@ void ConstIOThread::emitConstIOThreadC(std::vector<std::shared_ptr<ThreadCrossin
                                        std::string path, std::string fileNamePrefix,
                                        std::string designName, unsigned long blockSize,
                                        std::string fifoHeaderFile, std::string fifoSupportFile, bool threadDebugPrint,
-                                       PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior){
+                                       PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                                       PartitionParams::FIFOWaitPolicy fifoWaitPolicy){
     //Emit a thread for handeling the I/O
 
     //Note, a single input FIFO may correspond to multiple MasterOutput ports
@@ -153,6 +154,11 @@ void ConstIOThread::emitConstIOThreadC(std::vector<std::shared_ptr<ThreadCrossin
         ioThread << cachedVarDeclsOutputFIFOs[i] << std::endl;
     }
 
+    std::vector<std::string> waitStateDecl = MultiThreadEmit::createFIFOWaitState(fifoWaitPolicy, "ioThreadWait");
+    for(unsigned long i = 0; i<waitStateDecl.size(); i++){
+        ioThread << waitStateDecl[i] << std::endl;
+    }
+
     ioThread << "while(1){" << std::endl;
     //NOTE: Because access to FIFOs is non-blocking and buffering is handled differently in I/O, we will force
     //TODO: Inspect if this becomes the bottleneck
@@ -183,6 +189,32 @@ void ConstIOThread::emitConstIOThreadC(std::vector<std::shared_ptr<ThreadCrossin
     }
     ioThread << "}" << std::endl; //Close if
 
+    //Publish any deferred FIFO reads/writes each iteration since the I/O thread does not block on FIFOs
+    std::vector<std::string> flushExprs = MultiThreadEmit::flushFIFOsPendingCommits(inputFIFOs, outputFIFOs);
+    for(int i = 0; i<flushExprs.size(); i++){
+        ioThread << flushExprs[i] << std::endl;
+    }
+
+    //Wait according to the wait policy if no FIFOs were ready in this iteration
+    std::vector<std::string> waitExprs = MultiThreadEmit::waitOnFIFOs(fifoWaitPolicy, "ioThreadWait");
+    if(!waitExprs.empty()){
+        std::vector<std::string> wakeExprs = MultiThreadEmit::wakeFIFOWaiters(fifoWaitPolicy);
+        for(int i = 0; i<wakeExprs.size(); i++){
+            ioThread << wakeExprs[i] << std::endl;
+        }
+
+        std::vector<std::string> doneExprs = MultiThreadEmit::doneWaitingOnFIFOs(fifoWaitPolicy, "ioThreadWait");
+        ioThread << "if(outputFIFOsReady || inputFIFOsReady){" << std::endl;
+        for(int i = 0; i<doneExprs.size(); i++){
+            ioThread << doneExprs[i] << std::endl;
+        }
+        ioThread << "}else{" << std::endl;
+        for(int i = 0; i<waitExprs.size(); i++){
+            ioThread << waitExprs[i] << std::endl;
+        }
+        ioThread << "}" << std::endl;
+    }
+
     ioThread << "}" << std::endl; //Close for
 
     //Done reading
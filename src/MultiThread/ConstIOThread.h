@@ -26,12 +26,15 @@ namespace ConstIOThread {
      * @param blockSize
      * @param fifoHeaderFile
      * @param threadDebugPrint
+     * @param fifoIndexCachingBehavior
+     * @param fifoWaitPolicy selects what the thread does in iterations where no FIFOs were ready
      */
     void emitConstIOThreadC(std::vector<std::shared_ptr<ThreadCrossingFIFO>> inputFIFOs,
                             std::vector<std::shared_ptr<ThreadCrossingFIFO>> outputFIFOs, std::string path,
                             std::string fileNamePrefix, std::string designName, unsigned long blockSize,
                             std::string fifoHeaderFile, std::string fifoSupportFile, bool threadDebugPrint,
-                            PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior);
+                            PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                            PartitionParams::FIFOWaitPolicy fifoWaitPolicy);
 
 };
 
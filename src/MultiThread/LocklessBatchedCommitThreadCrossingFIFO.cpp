@@ -0,0 +1,263 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "LocklessBatchedCommitThreadCrossingFIFO.h"
+#include "General/GeneralHelper.h"
+#include "General/ErrorHelpers.h"
+
+LocklessBatchedCommitThreadCrossingFIFO::LocklessBatchedCommitThreadCrossingFIFO() : LocklessThreadCrossingFIFO(),
+commitBatch(1), cWriteUncommittedInitialized(false), cReadUncommittedInitialized(false) {
+
+}
+
+LocklessBatchedCommitThreadCrossingFIFO::LocklessBatchedCommitThreadCrossingFIFO(std::shared_ptr<SubSystem> parent) :
+LocklessThreadCrossingFIFO(parent), commitBatch(1), cWriteUncommittedInitialized(false), cReadUncommittedInitialized(false) {
+
+}
+
+LocklessBatchedCommitThreadCrossingFIFO::LocklessBatchedCommitThreadCrossingFIFO(std::shared_ptr<SubSystem> parent,
+                                                                                 LocklessBatchedCommitThreadCrossingFIFO *orig)
+        : LocklessThreadCrossingFIFO(parent, orig), commitBatch(orig->commitBatch),
+        cWriteUncommitted(orig->cWriteUncommitted), cReadUncommitted(orig->cReadUncommitted),
+        cWriteUncommittedInitialized(orig->cWriteUncommittedInitialized), cReadUncommittedInitialized(orig->cReadUncommittedInitialized){
+
+}
+
+int LocklessBatchedCommitThreadCrossingFIFO::getCommitBatch() const {
+    return commitBatch;
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::setCommitBatch(int commitBatch) {
+    LocklessBatchedCommitThreadCrossingFIFO::commitBatch = commitBatch;
+}
+
+Variable LocklessBatchedCommitThreadCrossingFIFO::getCWriteUncommitted() {
+    bool initialized = cWriteUncommittedInitialized;
+    LocklessThreadCrossingFIFO::initializeVarIfNotAlready(getSharedPointer(), cWriteUncommitted, cWriteUncommittedInitialized, "writeUncommitted");
+
+    if(!initialized) {
+        //Count is in blocks
+        DataType newDT = DataType(false, true, false, 32, 0, {1});
+        cWriteUncommitted.setDataType(newDT);
+        cWriteUncommitted.setAtomicVar(false);
+    }
+
+    return cWriteUncommitted;
+}
+
+Variable LocklessBatchedCommitThreadCrossingFIFO::getCReadUncommitted() {
+    bool initialized = cReadUncommittedInitialized;
+    LocklessThreadCrossingFIFO::initializeVarIfNotAlready(getSharedPointer(), cReadUncommitted, cReadUncommittedInitialized, "readUncommitted");
+
+    if(!initialized) {
+        //Count is in blocks
+        DataType newDT = DataType(false, true, false, 32, 0, {1});
+        cReadUncommitted.setDataType(newDT);
+        cReadUncommitted.setAtomicVar(false);
+    }
+
+    return cReadUncommitted;
+}
+
+std::shared_ptr<LocklessBatchedCommitThreadCrossingFIFO>
+LocklessBatchedCommitThreadCrossingFIFO::createFromGraphML(int id, std::string name,
+                                                           std::map<std::string, std::string> dataKeyValueMap,
+                                                           std::shared_ptr<SubSystem> parent,
+                                                           GraphMLDialect dialect) {
+    std::shared_ptr<LocklessBatchedCommitThreadCrossingFIFO> newNode = NodeFactory::createNode<LocklessBatchedCommitThreadCrossingFIFO>(parent);
+    newNode->setId(id);
+    newNode->setName(name);
+
+    if (dialect != GraphMLDialect::VITIS) {
+        throw std::runtime_error(ErrorHelpers::genErrorStr("LocklessBatchedCommitThreadCrossingFIFO is only supported in the vitis GraphML dialect", newNode));
+    }
+
+    //Populate properties from ThreadCrossingFIFO superclass
+    newNode->populatePropertiesFromGraphML(dataKeyValueMap, parent, dialect);
+
+    //==== Import important properties for this class ====
+    std::string commitBatchStr = dataKeyValueMap.at("CommitBatch");
+    newNode->setCommitBatch(std::stoi(commitBatchStr));
+
+    return newNode;
+}
+
+std::set<GraphMLParameter> LocklessBatchedCommitThreadCrossingFIFO::graphMLParameters() {
+    std::set<GraphMLParameter> parameters = LocklessThreadCrossingFIFO::graphMLParameters();
+
+    parameters.insert(GraphMLParameter("CommitBatch", "int", true));
+
+    return parameters;
+}
+
+xercesc::DOMElement *
+LocklessBatchedCommitThreadCrossingFIFO::emitGraphML(xercesc::DOMDocument *doc, xercesc::DOMElement *graphNode,
+                                                     bool include_block_node_type) {
+    xercesc::DOMElement* thisNode = emitGraphMLBasics(doc, graphNode);
+    if(include_block_node_type) {
+        GraphMLHelper::addDataNode(doc, thisNode, "block_node_type", "ThreadCrossingFIFO");
+    }
+
+    GraphMLHelper::addDataNode(doc, thisNode, "block_function", "LocklessBatchedCommitThreadCrossingFIFO");
+
+    //Emit properties from the superclass
+    emitPropertiesToGraphML(doc, graphNode);
+
+    GraphMLHelper::addDataNode(doc, thisNode, "CommitBatch", GeneralHelper::to_string(commitBatch));
+
+    return thisNode;
+}
+
+std::shared_ptr<Node> LocklessBatchedCommitThreadCrossingFIFO::shallowClone(std::shared_ptr<SubSystem> parent) {
+    return NodeFactory::shallowCloneNode<LocklessBatchedCommitThreadCrossingFIFO>(parent, this);
+}
+
+std::string LocklessBatchedCommitThreadCrossingFIFO::typeNameStr(){
+    return "LocklessBatchedCommitThreadCrossingFIFO";
+}
+
+std::string LocklessBatchedCommitThreadCrossingFIFO::labelStr() {
+    std::string label = LocklessThreadCrossingFIFO::labelStr();
+
+    label += "\nCommitBatch: " + GeneralHelper::to_string(commitBatch);
+
+    return label;
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::validate() {
+    LocklessThreadCrossingFIFO::validate();
+
+    if(commitBatch < 1){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - LocklessBatchedCommitThreadCrossingFIFO - Commit batch must be >= 1", getSharedPointer()));
+    }
+}
+
+std::string LocklessBatchedCommitThreadCrossingFIFO::emitCIsNotEmpty(std::vector<std::string> &cStatementQueue, Role role) {
+    if(role == Role::NONE){
+        //Would reload this thread's own offset from the published value which may be behind
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Role NONE is not supported for checks on a LocklessBatchedCommitThreadCrossingFIFO", getSharedPointer()));
+    }
+
+    return LocklessThreadCrossingFIFO::emitCIsNotEmpty(cStatementQueue, role);
+}
+
+std::string LocklessBatchedCommitThreadCrossingFIFO::emitCIsNotFull(std::vector<std::string> &cStatementQueue, Role role) {
+    if(role == Role::NONE){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Role NONE is not supported for checks on a LocklessBatchedCommitThreadCrossingFIFO", getSharedPointer()));
+    }
+
+    return LocklessThreadCrossingFIFO::emitCIsNotFull(cStatementQueue, role);
+}
+
+std::string LocklessBatchedCommitThreadCrossingFIFO::emitCNumBlocksAvailToRead(std::vector<std::string> &cStatementQueue, Role role) {
+    if(role == Role::NONE){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Role NONE is not supported for checks on a LocklessBatchedCommitThreadCrossingFIFO", getSharedPointer()));
+    }
+
+    return LocklessThreadCrossingFIFO::emitCNumBlocksAvailToRead(cStatementQueue, role);
+}
+
+std::string LocklessBatchedCommitThreadCrossingFIFO::emitCNumBlocksAvailToWrite(std::vector<std::string> &cStatementQueue, Role role) {
+    if(role == Role::NONE){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Role NONE is not supported for checks on a LocklessBatchedCommitThreadCrossingFIFO", getSharedPointer()));
+    }
+
+    return LocklessThreadCrossingFIFO::emitCNumBlocksAvailToWrite(cStatementQueue, role);
+}
+
+std::string
+LocklessBatchedCommitThreadCrossingFIFO::emitCWriteToFIFO(std::vector<std::string> &cStatementQueue, std::string src, int numBlocks, Role role, bool pushStateAfter, bool forceNotInPlace) {
+    //The cached write offset is always the authoritative position of the producer (the published offset may be behind).
+    //Do not reload it from the shared offset, even if the role is NONE
+    Role writeRole = role == Role::NONE ? Role::PRODUCER : role;
+
+    //The superclass updates the cached offset but does not publish it
+    LocklessThreadCrossingFIFO::emitCWriteToFIFO(cStatementQueue, src, numBlocks, writeRole, false, forceNotInPlace);
+
+    cStatementQueue.push_back(getCWriteUncommitted().getCVarName(false) + " += " + GeneralHelper::to_string(numBlocks) + ";");
+    if(pushStateAfter){
+        emitCCommitIfBatchReady(cStatementQueue, getCWriteOffsetPtr(), getCWriteOffsetCached(), getCWriteUncommitted());
+    }
+
+    return "";
+}
+
+std::string
+LocklessBatchedCommitThreadCrossingFIFO::emitCReadFromFIFO(std::vector<std::string> &cStatementQueue, std::string dst, int numBlocks, Role role, bool pushStateAfter, bool forceNotInPlace) {
+    //The cached read offset is always the authoritative position of the consumer (the published offset may be behind).
+    //Do not reload it from the shared offset, even if the role is NONE
+    Role readRole = role == Role::NONE ? Role::CONSUMER : role;
+
+    //The superclass updates the cached offset but does not publish it
+    LocklessThreadCrossingFIFO::emitCReadFromFIFO(cStatementQueue, dst, numBlocks, readRole, false, forceNotInPlace);
+
+    cStatementQueue.push_back(getCReadUncommitted().getCVarName(false) + " += " + GeneralHelper::to_string(numBlocks) + ";");
+    if(pushStateAfter){
+        emitCCommitIfBatchReady(cStatementQueue, getCReadOffsetPtr(), getCReadOffsetCached(), getCReadUncommitted());
+    }
+
+    return "";
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::createLocalVars(std::vector<std::string> &cStatementQueue){
+    LocklessThreadCrossingFIFO::createLocalVars(cStatementQueue);
+    cStatementQueue.push_back(getCWriteUncommitted().getCVarDecl(false) + ";");
+    cStatementQueue.push_back(getCReadUncommitted().getCVarDecl(false) + ";");
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::initLocalVars(std::vector<std::string> &cStatementQueue, Role role){
+    //Nothing is pending at the start.  This is the only point where the cached offsets are pulled with the role NONE
+    LocklessThreadCrossingFIFO::initLocalVars(cStatementQueue, role);
+    cStatementQueue.push_back(getCWriteUncommitted().getCVarName(false) + " = 0;");
+    cStatementQueue.push_back(getCReadUncommitted().getCVarName(false) + " = 0;");
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::pushLocalVars(std::vector<std::string> &cStatementQueue, Role role){
+    if(role == Role::CONSUMER || role == Role::NONE){
+        emitCCommitIfBatchReady(cStatementQueue, getCReadOffsetPtr(), getCReadOffsetCached(), getCReadUncommitted());
+    }
+
+    if(role == Role::PRODUCER || role == Role::NONE){
+        emitCCommitIfBatchReady(cStatementQueue, getCWriteOffsetPtr(), getCWriteOffsetCached(), getCWriteUncommitted());
+    }
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::emitCFlushPendingCommits(std::vector<std::string> &cStatementQueue, Role role){
+    if(role == Role::CONSUMER || role == Role::CONSUMER_FULLCACHE || role == Role::NONE){
+        emitCCommitIfPending(cStatementQueue, getCReadOffsetPtr(), getCReadOffsetCached(), getCReadUncommitted());
+    }
+
+    if(role == Role::PRODUCER || role == Role::PRODUCER_FULLCACHE || role == Role::NONE){
+        emitCCommitIfPending(cStatementQueue, getCWriteOffsetPtr(), getCWriteOffsetCached(), getCWriteUncommitted());
+    }
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::emitCCommitIfBatchReady(std::vector<std::string> &cStatementQueue, Variable sharedOffset, Variable cachedOffset, Variable uncommitted){
+    if(commitBatch <= 1){
+        //Publish on every access (equivalent to LocklessThreadCrossingFIFO)
+        cStatementQueue.push_back("atomic_store_explicit(" + sharedOffset.getCVarName(false) + ", " + cachedOffset.getCVarName(false) + ", memory_order_release);");
+        cStatementQueue.push_back(uncommitted.getCVarName(false) + " = 0;");
+    }else{
+        cStatementQueue.push_back("if(" + uncommitted.getCVarName(false) + " >= " + GeneralHelper::to_string(commitBatch) + "){");
+        cStatementQueue.push_back("//Publish the batch");
+        cStatementQueue.push_back("atomic_store_explicit(" + sharedOffset.getCVarName(false) + ", " + cachedOffset.getCVarName(false) + ", memory_order_release);");
+        cStatementQueue.push_back(uncommitted.getCVarName(false) + " = 0;");
+        cStatementQueue.push_back("}");
+    }
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::emitCCommitIfPending(std::vector<std::string> &cStatementQueue, Variable sharedOffset, Variable cachedOffset, Variable uncommitted){
+    //Avoid storing to the shared offset if nothing is pending since the store would invalidate the line in the other core's cache
+    cStatementQueue.push_back("if(" + uncommitted.getCVarName(false) + " > 0){");
+    cStatementQueue.push_back("atomic_store_explicit(" + sharedOffset.getCVarName(false) + ", " + cachedOffset.getCVarName(false) + ", memory_order_release);");
+    cStatementQueue.push_back(uncommitted.getCVarName(false) + " = 0;");
+    cStatementQueue.push_back("}");
+}
+
+void LocklessBatchedCommitThreadCrossingFIFO::initializeCVars() {
+    LocklessThreadCrossingFIFO::initializeCVars();
+
+    getCWriteUncommitted();
+    getCReadUncommitted();
+}
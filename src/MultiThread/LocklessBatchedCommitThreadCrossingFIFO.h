@@ -0,0 +1,182 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_LOCKLESSBATCHEDCOMMITTHREADCROSSINGFIFO_H
+#define VITIS_LOCKLESSBATCHEDCOMMITTHREADCROSSINGFIFO_H
+
+#include "LocklessThreadCrossingFIFO.h"
+
+/**
+ * \addtogroup MultiThread Multi-Thread Support
+ * @{
+ */
+
+/**
+ * @brief A modification of the Lockless Thread Crossing FIFO where the read and write offsets are only published to
+ * the other thread after a batch of blocks has been read or written.
+ *
+ * In LocklessThreadCrossingFIFO, the write offset is stored (with release semantics) after every block is written and
+ * the read offset is stored after every block is read.  Each store invalidates the cache line containing the offset in
+ * the other core's cache, which then needs to be transferred back when the other thread next checks the FIFO.  When
+ * blocks are small, this traffic can dominate the cost of the transfer.
+ *
+ * In this FIFO, the producer and consumer continue to track their position in the cached offsets (which are local to
+ * each thread and were already the authoritative copy of each thread's own position).  A count of the blocks which
+ * have been written (or read) but not yet published is kept in an additional local variable.  The shared offset is only
+ * stored once commitBatch blocks are pending.  The logic for determining if the FIFO is empty/full is unchanged.  Since
+ * the other thread only sees the published offset, it may see the FIFO as more full (or more empty) than it actually
+ * is, which is always safe.
+ *
+ * Deferring publication could stall the other thread indefinitely (ex. at the end of a stream or when threads wait on
+ * each other through a feedback path).  To prevent this, any pending blocks are published (see
+ * emitCFlushPendingCommits) whenever a thread is about to spin waiting on a FIFO, at the end of each I/O thread loop
+ * iteration, and when the input stream ends.  Because the flush occurs as soon as the thread would otherwise idle, the
+ * added latency is bounded by the time taken to process a batch of blocks.
+ *
+ * A commitBatch of 1 produces the same behavior as LocklessThreadCrossingFIFO.
+ *
+ * @note Accessing this FIFO with Role::NONE is not supported for FIFO checks since this reloads the thread's own offset
+ * from the (potentially stale) published value.
+ */
+class LocklessBatchedCommitThreadCrossingFIFO : public LocklessThreadCrossingFIFO {
+    friend NodeFactory;
+
+protected:
+    int commitBatch; ///<The number of blocks read or written before the offset is published to the other thread
+
+    Variable cWriteUncommitted; ///<The C variable corresponding to the number of blocks written but not yet published
+    Variable cReadUncommitted; ///<The C variable corresponding to the number of blocks read but not yet published
+
+    bool cWriteUncommittedInitialized;
+    bool cReadUncommittedInitialized;
+
+    //==== Constructors ====
+    /**
+     * @brief Constructs an empty Lockless Batched Commit ThreadCrossing FIFO node
+     *
+     * @note To construct from outside of hierarchy, use factories in @ref NodeFactory
+     */
+    LocklessBatchedCommitThreadCrossingFIFO();
+
+    /**
+     * @brief Constructs an empty Lockless Batched Commit ThreadCrossing FIFO node with a given parent.  This node is not added to the children list of the parent.
+     *
+     * @note To construct from outside of hierarchy, use factories in @ref NodeFactory
+     *
+     * @param parent parent node
+     */
+    explicit LocklessBatchedCommitThreadCrossingFIFO(std::shared_ptr<SubSystem> parent);
+
+    /**
+     * @brief Constructs a new node with a shallow copy of parameters from the original node.  Ports are not copied and neither is the parent reference.  This node is not added to the children list of the parent.
+     *
+     * @note To construct from outside of hierarchy, use factories in @ref NodeFactory
+     *
+     * @note If copying a graph, the parent should be one of the copies and not from the original graph.
+     *
+     * @warning Because pointer (this) is passed to ports, nodes must be allocated on the heap and not moved.  All interaction should be via pointers.
+     *
+     * @param parent parent node
+     * @param orig The origional node from which a shallow copy is being made
+     */
+    LocklessBatchedCommitThreadCrossingFIFO(std::shared_ptr<SubSystem> parent, LocklessBatchedCommitThreadCrossingFIFO *orig);
+
+    /**
+     * @brief Emits the statements which publish an offset once a batch of blocks is pending
+     *
+     * @param cStatementQueue The C statements will be written to this queue
+     * @param sharedOffset the shared (atomic) offset
+     * @param cachedOffset the local offset
+     * @param uncommitted the count of blocks which have not yet been published
+     */
+    void emitCCommitIfBatchReady(std::vector<std::string> &cStatementQueue, Variable sharedOffset, Variable cachedOffset, Variable uncommitted);
+
+    /**
+     * @brief Emits the statements which publish an offset if any blocks are pending
+     *
+     * @param cStatementQueue The C statements will be written to this queue
+     * @param sharedOffset the shared (atomic) offset
+     * @param cachedOffset the local offset
+     * @param uncommitted the count of blocks which have not yet been published
+     */
+    void emitCCommitIfPending(std::vector<std::string> &cStatementQueue, Variable sharedOffset, Variable cachedOffset, Variable uncommitted);
+
+    //====Getters/Setters====
+public:
+    int getCommitBatch() const;
+    void setCommitBatch(int commitBatch);
+
+    /**
+     * @brief Gets the cWriteUncommitted for this FIFO.  If it has not yet been initialized, it will be initialized at this point
+     *
+     * @note This function is used internally whenever accessing the object to ensure it is initialized
+     *
+     * @return the initialized cWriteUncommitted for this FIFO
+     */
+    Variable getCWriteUncommitted();
+
+    /**
+     * @brief Gets the cReadUncommitted for this FIFO.  If it has not yet been initialized, it will be initialized at this point
+     *
+     * @note This function is used internally whenever accessing the object to ensure it is initialized
+     *
+     * @return the initialized cReadUncommitted for this FIFO
+     */
+    Variable getCReadUncommitted();
+
+    //====Factory====
+    static std::shared_ptr<LocklessBatchedCommitThreadCrossingFIFO> createFromGraphML(int id, std::string name,
+                                                    std::map<std::string, std::string> dataKeyValueMap,
+                                                    std::shared_ptr<SubSystem> parent, GraphMLDialect dialect);
+
+    //====Emit Functions====
+    std::set<GraphMLParameter> graphMLParameters() override;
+
+    xercesc::DOMElement* emitGraphML(xercesc::DOMDocument* doc, xercesc::DOMElement* graphNode, bool include_block_node_type) override ;
+
+    std::shared_ptr<Node> shallowClone(std::shared_ptr<SubSystem> parent) override;
+
+    std::string typeNameStr() override;
+
+    std::string labelStr() override;
+
+    void validate() override;
+
+    //==== FIFO Implementation Functions ====
+
+    std::string emitCIsNotEmpty(std::vector<std::string> &cStatementQueue, Role roll) override;
+
+    std::string emitCIsNotFull(std::vector<std::string> &cStatementQueue, Role roll) override;
+
+    std::string emitCNumBlocksAvailToRead(std::vector<std::string> &cStatementQueue, Role roll) override;
+
+    std::string emitCNumBlocksAvailToWrite(std::vector<std::string> &cStatementQueue, Role roll) override;
+
+    /**
+     * @brief Writes to the FIFO.  The write offset is only published if pushStateAfter is true and a batch of blocks is pending
+     */
+    std::string emitCWriteToFIFO(std::vector<std::string> &cStatementQueue, std::string src, int numBlocks, Role roll, bool pushStateAfter, bool forceNotInPlace) override;
+
+    /**
+     * @brief Reads from the FIFO.  The read offset is only published if pushStateAfter is true and a batch of blocks is pending
+     */
+    std::string emitCReadFromFIFO(std::vector<std::string> &cStatementQueue, std::string dst, int numBlocks, Role roll, bool pushStateAfter, bool forceNotInPlace) override;
+
+    void createLocalVars(std::vector<std::string> &cStatementQueue) override;
+
+    void initLocalVars(std::vector<std::string> &cStatementQueue, Role role) override;
+
+    /**
+     * @brief Publishes the local offsets based on the role if a batch of blocks is pending
+     */
+    void pushLocalVars(std::vector<std::string> &cStatementQueue, Role role) override;
+
+    void emitCFlushPendingCommits(std::vector<std::string> &cStatementQueue, Role role) override;
+
+    void initializeCVars() override;
+};
+
+/*! @} */
+
+#endif //VITIS_LOCKLESSBATCHEDCOMMITTHREADCROSSINGFIFO_H
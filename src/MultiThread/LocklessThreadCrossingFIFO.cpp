@@ -27,7 +27,6 @@ LocklessThreadCrossingFIFO::LocklessThreadCrossingFIFO(std::shared_ptr<SubSystem
 Variable LocklessThreadCrossingFIFO::getCWriteOffsetPtr() {
     bool initialized = cWriteOffsetPtrInitialized;
     LocklessThreadCrossingFIFO::initializeVarIfNotAlready(getSharedPointer(), cWriteOffsetPtr, cWriteOffsetPtrInitialized, "writeOffsetPtr");
-    cWriteOffsetPtr.setAtomicVar(true);
 
     if(!initialized) {
         //Offset is in blocks
@@ -43,7 +42,6 @@ Variable LocklessThreadCrossingFIFO::getCWriteOffsetPtr() {
 Variable LocklessThreadCrossingFIFO::getCReadOffsetPtr() {
     bool initialized = cReadOffsetPtrInitialized;
     LocklessThreadCrossingFIFO::initializeVarIfNotAlready(getSharedPointer(), cReadOffsetPtr, cReadOffsetPtrInitialized, "readOffsetPtr");
-    cReadOffsetPtr.setAtomicVar(true);
 
     if(!initialized){
         //Offset is in blocks
@@ -58,7 +56,6 @@ Variable LocklessThreadCrossingFIFO::getCReadOffsetPtr() {
 Variable LocklessThreadCrossingFIFO::getCArrayPtr() {
     bool initialized = cArrayPtrInitialized;
     LocklessThreadCrossingFIFO::initializeVarIfNotAlready(getSharedPointer(), cArrayPtr, cArrayPtrInitialized, "arrayPtr");
-    cArrayPtr.setAtomicVar(false); //Memory ordering around the read and write pointer access is used to act as a barrier for array access.  This allows the array to not be declared as atomic
 
     if (!initialized){
         if (getOutputPorts().size() >= 1 && getOutputPort(0)->getArcs().size() >= 1) {
@@ -75,7 +72,6 @@ Variable LocklessThreadCrossingFIFO::getCArrayPtr() {
 Variable LocklessThreadCrossingFIFO::getCWriteOffsetCached() {
     bool initialized = cWriteOffsetCachedInitialized;
     LocklessThreadCrossingFIFO::initializeVarIfNotAlready(getSharedPointer(), cWriteOffsetCached, cWriteOffsetCachedInitialized, "writeOffsetCached");
-    cWriteOffsetCached.setAtomicVar(false);
 
     if(!initialized) {
         //Offset is in blocks
@@ -91,7 +87,6 @@ Variable LocklessThreadCrossingFIFO::getCWriteOffsetCached() {
 Variable LocklessThreadCrossingFIFO::getCReadOffsetCached() {
     bool initialized = cReadOffsetCachedInitialized;
     LocklessThreadCrossingFIFO::initializeVarIfNotAlready(getSharedPointer(), cReadOffsetCached, cReadOffsetCachedInitialized, "readOffsetCached");
-    cReadOffsetCached.setAtomicVar(false);
 
     if(!initialized) {
         //Offset is in blocks
@@ -537,11 +532,34 @@ std::vector<std::pair<Variable, std::string>> LocklessThreadCrossingFIFO::getFIF
     return vars;
 }
 
-void LocklessThreadCrossingFIFO::createSharedVariables(std::vector<std::string> &cStatementQueue, int core) {
+void LocklessThreadCrossingFIFO::createSharedVariables(std::vector<std::string> &cStatementQueue, int producerCore, int consumerCore) {
     //Will declare the shared vars.  References to these should be passed (using & for the pointers and directly for the )
 
+    //Select the core each shared variable is allocated on
+    int readOffsetCore = producerCore;
+    int writeOffsetCore = producerCore;
+    int arrayCore = producerCore;
+    switch(fifoPlacement){
+        case ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT:
+        case ThreadCrossingFIFOParameters::FIFOPlacement::PRODUCER:
+        case ThreadCrossingFIFOParameters::FIFOPlacement::INTERLEAVED: //Only the array is interleaved
+            break;
+        case ThreadCrossingFIFOParameters::FIFOPlacement::CONSUMER:
+            readOffsetCore = consumerCore;
+            writeOffsetCore = consumerCore;
+            arrayCore = consumerCore;
+            break;
+        case ThreadCrossingFIFOParameters::FIFOPlacement::SPLIT:
+            //Each offset is written by only one side and is kept local to it
+            readOffsetCore = consumerCore;
+            arrayCore = consumerCore;
+            break;
+        default:
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown FIFO placement", getSharedPointer()));
+    }
+
     std::string cReadOffsetDT = (getCReadOffsetPtr().isAtomicVar() ? "_Atomic " : "") + getCReadOffsetPtr().getDataType().getCPUStorageType().toString(DataType::StringStyle::C, false, false);
-    if(core < 0) {
+    if(readOffsetCore < 0) {
         cStatementQueue.push_back(
                 cReadOffsetDT + "* " + getCReadOffsetPtr().getCVarName(false) + " = (" + cReadOffsetDT +
                 "*) vitis_aligned_alloc(VITIS_MEM_ALIGNMENT, sizeof(" + cReadOffsetDT + "));");
@@ -549,12 +567,12 @@ void LocklessThreadCrossingFIFO::createSharedVariables(std::vector<std::string>
         cStatementQueue.push_back(
                 cReadOffsetDT + "* " + getCReadOffsetPtr().getCVarName(false) + " = (" + cReadOffsetDT +
                 "*) vitis_aligned_alloc_core(VITIS_MEM_ALIGNMENT, sizeof(" + cReadOffsetDT + "), " +
-                GeneralHelper::to_string(core) + ");");
+                GeneralHelper::to_string(readOffsetCore) + ");");
     }
 
     std::string cWriteOffsetDT = (getCWriteOffsetPtr().isAtomicVar() ? "_Atomic " : "") + getCWriteOffsetPtr().getDataType().getCPUStorageType().toString(DataType::StringStyle::C, false, false);
 
-    if(core < 0) {
+    if(writeOffsetCore < 0) {
         cStatementQueue.push_back(
                 cWriteOffsetDT + "* " + getCWriteOffsetPtr().getCVarName(false) + " = (" + cWriteOffsetDT +
                 "*) vitis_aligned_alloc(VITIS_MEM_ALIGNMENT, sizeof(" + cWriteOffsetDT + "));");
@@ -562,28 +580,32 @@ void LocklessThreadCrossingFIFO::createSharedVariables(std::vector<std::string>
         cStatementQueue.push_back(
                 cWriteOffsetDT + "* " + getCWriteOffsetPtr().getCVarName(false) + " = (" + cWriteOffsetDT +
                 "*) vitis_aligned_alloc_core(VITIS_MEM_ALIGNMENT, sizeof(" + cWriteOffsetDT + "), " +
-                GeneralHelper::to_string(core) + ");");
+                GeneralHelper::to_string(writeOffsetCore) + ");");
     }
 
     std::string cArrayDT = getFIFOStructTypeName();
 
-    if(core < 0) {
+    //The array is allocated with the large allocator which, depending on the NUMA alloc policy, may back it with huge
+    //pages, bind it to the NUMA node of the given core, and pre-fault it
+    if(fifoPlacement == ThreadCrossingFIFOParameters::FIFOPlacement::INTERLEAVED) {
         cStatementQueue.push_back(cArrayDT + "* " + getCArrayPtr().getCVarName(false) + " = (" + cArrayDT +
-                                  "*) vitis_aligned_alloc(VITIS_MEM_ALIGNMENT, sizeof(" + cArrayDT + ")*" +
+                                  "*) vitis_large_alloc_interleaved(VITIS_MEM_ALIGNMENT, sizeof(" + cArrayDT + ")*" +
                                   GeneralHelper::to_string(fifoLength + 1) +
-                                  ");"); //The Array length is 1 larger than the FIFO length.
+                                  ", " + GeneralHelper::to_string(producerCore) + ", " +
+                                  GeneralHelper::to_string(consumerCore) + ");"); //The Array length is 1 larger than the FIFO length.
     }else{
         cStatementQueue.push_back(cArrayDT + "* " + getCArrayPtr().getCVarName(false) + " = (" + cArrayDT +
-                                  "*) vitis_aligned_alloc_core(VITIS_MEM_ALIGNMENT, sizeof(" + cArrayDT + ")*" +
+                                  "*) vitis_large_alloc_core(VITIS_MEM_ALIGNMENT, sizeof(" + cArrayDT + ")*" +
                                   GeneralHelper::to_string(fifoLength + 1) +
-                                  ", " + GeneralHelper::to_string(core) + ");"); //The Array length is 1 larger than the FIFO length.
+                                  ", " + GeneralHelper::to_string(arrayCore) + ");"); //The Array length is 1 larger than the FIFO length.
     }
 }
 
 void LocklessThreadCrossingFIFO::cleanupSharedVariables(std::vector<std::string> &cStatementQueue) {
     cStatementQueue.push_back("free(" + getCReadOffsetPtr().getCVarName(false) + ");");
     cStatementQueue.push_back("free(" + getCWriteOffsetPtr().getCVarName(false) + ");");
-    cStatementQueue.push_back("free(" + getCArrayPtr().getCVarName(false) + ");");
+    cStatementQueue.push_back("vitis_large_free(" + getCArrayPtr().getCVarName(false) + ", sizeof(" + getFIFOStructTypeName() + ")*" +
+                              GeneralHelper::to_string(fifoLength + 1) + ");");
 }
 
 void LocklessThreadCrossingFIFO::initializeSharedVariables(std::vector<std::string> &cStatementQueue) {
@@ -708,3 +730,13 @@ std::set<std::string> LocklessThreadCrossingFIFO::getExternalIncludes() {
 bool LocklessThreadCrossingFIFO::isInPlace() {
     return false;
 }
+
+void LocklessThreadCrossingFIFO::initializeCVars() {
+    ThreadCrossingFIFO::initializeCVars();
+
+    getCWriteOffsetPtr();
+    getCReadOffsetPtr();
+    getCArrayPtr();
+    getCWriteOffsetCached();
+    getCReadOffsetCached();
+}
@@ -264,7 +264,7 @@ public:
 
     std::vector<std::pair<Variable, std::string>> getFIFOSharedVariables() override;
 
-    void createSharedVariables(std::vector<std::string> &cStatementQueue, int core) override;
+    void createSharedVariables(std::vector<std::string> &cStatementQueue, int producerCore, int consumerCore) override;
 
     void cleanupSharedVariables(std::vector<std::string> &cStatementQueue) override ;
 
@@ -294,6 +294,8 @@ public:
 
     //Need to include stdatomic
     std::set<std::string> getExternalIncludes() override;
+
+    void initializeCVars() override;
 };
 
 /*! @} */
@@ -8,6 +8,8 @@
 PartitionParams::PartitionType PartitionParams::parsePartitionTypeStr(std::string str) {
     if(str == "MANUAL" || str == "manual"){
         return PartitionType::MANUAL;
+    }else if(str == "AUTO" || str == "auto"){
+        return PartitionType::AUTO;
     }else{
         throw std::runtime_error("Unable to parse partitioner: " + str);
     }
@@ -16,6 +18,8 @@ PartitionParams::PartitionType PartitionParams::parsePartitionTypeStr(std::strin
 std::string PartitionParams::partitionTypeToString(PartitionParams::PartitionType partitionType) {
     if(partitionType == PartitionType::MANUAL) {
         return "MANUAL";
+    }else if(partitionType == PartitionType::AUTO) {
+        return "AUTO";
     }else{
         throw std::runtime_error("Unknown partitioner");
     }
@@ -49,3 +53,59 @@ PartitionParams::fifoIndexCachingBehaviorToString(PartitionParams::FIFOIndexCach
         throw std::runtime_error("Unknown FIFO Index Caching Behavior");
     }
 }
+
+PartitionParams::FIFOWaitPolicy PartitionParams::parseFIFOWaitPolicy(std::string str) {
+    if(str == "SPIN" || str == "spin") {
+        return FIFOWaitPolicy::SPIN;
+    }else if(str == "SPIN_PAUSE" || str == "spin_pause"){
+        return FIFOWaitPolicy::SPIN_PAUSE;
+    }else if(str == "BACKOFF" || str == "backoff"){
+        return FIFOWaitPolicy::BACKOFF;
+    }else if(str == "FUTEX" || str == "futex"){
+        return FIFOWaitPolicy::FUTEX;
+    }else{
+        throw std::runtime_error("Unknown FIFO Wait Policy");
+    }
+}
+
+std::string PartitionParams::fifoWaitPolicyToString(PartitionParams::FIFOWaitPolicy fifoWaitPolicy) {
+    if(fifoWaitPolicy == FIFOWaitPolicy::SPIN){
+        return "SPIN";
+    }else if(fifoWaitPolicy == FIFOWaitPolicy::SPIN_PAUSE){
+        return "SPIN_PAUSE";
+    }else if(fifoWaitPolicy == FIFOWaitPolicy::BACKOFF){
+        return "BACKOFF";
+    }else if(fifoWaitPolicy == FIFOWaitPolicy::FUTEX){
+        return "FUTEX";
+    }else{
+        throw std::runtime_error("Unknown FIFO Wait Policy");
+    }
+}
+
+PartitionParams::NUMAAllocPolicy PartitionParams::parseNUMAAllocPolicy(std::string str) {
+    if(str == "FIRST_TOUCH" || str == "first_touch") {
+        return NUMAAllocPolicy::FIRST_TOUCH;
+    }else if(str == "BIND" || str == "bind"){
+        return NUMAAllocPolicy::BIND;
+    }else if(str == "BIND_THP" || str == "bind_thp"){
+        return NUMAAllocPolicy::BIND_THP;
+    }else if(str == "BIND_HUGETLB" || str == "bind_hugetlb"){
+        return NUMAAllocPolicy::BIND_HUGETLB;
+    }else{
+        throw std::runtime_error("Unknown NUMA Alloc Policy");
+    }
+}
+
+std::string PartitionParams::numaAllocPolicyToString(PartitionParams::NUMAAllocPolicy numaAllocPolicy) {
+    if(numaAllocPolicy == NUMAAllocPolicy::FIRST_TOUCH){
+        return "FIRST_TOUCH";
+    }else if(numaAllocPolicy == NUMAAllocPolicy::BIND){
+        return "BIND";
+    }else if(numaAllocPolicy == NUMAAllocPolicy::BIND_THP){
+        return "BIND_THP";
+    }else if(numaAllocPolicy == NUMAAllocPolicy::BIND_HUGETLB){
+        return "BIND_HUGETLB";
+    }else{
+        throw std::runtime_error("Unknown NUMA Alloc Policy");
+    }
+}
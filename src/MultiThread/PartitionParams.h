@@ -21,7 +21,8 @@ public:
      * @brief Represents the types of partitioning schemes supported
      */
     enum class PartitionType{
-        MANUAL ///<Paritioning is manually accomplished by using VITIS_PARTITION directives
+        MANUAL, ///<Paritioning is manually accomplished by using VITIS_PARTITION directives
+        AUTO ///<Partitioning is automatically accomplished by balancing estimated compute across a given number of partitions while limiting inter-partition communication
     };
 
     /**
@@ -47,6 +48,32 @@ public:
 
     static FIFOIndexCachingBehavior parseFIFOIndexCachingBehavior(std::string str);
     static std::string fifoIndexCachingBehaviorToString(FIFOIndexCachingBehavior fifoIndexCachingBehavior);
+
+    /**
+     * @brief Represents what a thread does while it waits for FIFOs to become available
+     */
+    enum class FIFOWaitPolicy{
+        SPIN, ///<The FIFO check is repeated immediately.  Lowest latency but fully occupies the core
+        SPIN_PAUSE, ///<A pause instruction (_mm_pause) is executed between FIFO checks.  Reduces power and yields pipeline resources to a hyperthread sibling
+        BACKOFF, ///<An exponentially increasing number of pause instructions (up to a limit) is executed between FIFO checks
+        FUTEX ///<Pauses between FIFO checks for a set number of attempts, then parks the thread on a futex until another thread publishes a FIFO update (or a timeout elapses)
+    };
+
+    static FIFOWaitPolicy parseFIFOWaitPolicy(std::string str);
+    static std::string fifoWaitPolicyToString(FIFOWaitPolicy fifoWaitPolicy);
+
+    /**
+     * @brief Represents how large shared buffers (FIFO arrays) are allocated and placed on NUMA nodes
+     */
+    enum class NUMAAllocPolicy{
+        FIRST_TOUCH, ///<Allocated with aligned_alloc from a thread pinned to the producer's core.  Placement relies on the first touch of each page
+        BIND, ///<Mapped with mmap, bound to the NUMA node of the consumer's core with mbind, and pre-faulted at startup
+        BIND_THP, ///<Like BIND but transparent huge pages are requested with madvise for buffers of at least one huge page
+        BIND_HUGETLB ///<Like BIND but buffers of at least one huge page are mapped from the huge page pool (MAP_HUGETLB).  Falls back to transparent huge pages if the pool is exhausted
+    };
+
+    static NUMAAllocPolicy parseNUMAAllocPolicy(std::string str);
+    static std::string numaAllocPolicyToString(NUMAAllocPolicy numaAllocPolicy);
 };
 
 /*! @} */
@@ -26,6 +26,9 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
                                          int telemReportFreqBlockFreq, double telemReportPeriodSeconds,
                                          std::string telemDumpFilePrefix, bool telemAvg,
                                          PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                                         PartitionParams::FIFOWaitPolicy fifoWaitPolicy,
+                                         int socketBatchBlocks, int socketBufferSize, bool socketZeroCopy,
+                                         bool sharedMemFutex, bool sharedMemHugePages,
                                          std::string streamNameSuffix) {
 
     bool collectTelem = EmitterHelpers::ioShouldCollectTelemetry(telemLevel);
@@ -33,6 +36,16 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
 
     unsigned long blockSizeBase = blockSize;
 
+    //The io_uring driver and the batched socket driver move multiple blocks per system call through receive/transmit
+    //ring buffers rather than through single block temporaries
+    bool socketBatched = streamType == StreamType::SOCKET && socketBatchBlocks > 0;
+    bool socketZeroCopyEnabled = socketBatched && socketZeroCopy;
+    bool ringBuffered = streamType == StreamType::IO_URING || socketBatched;
+    std::string ringPrefix = streamType == StreamType::IO_URING ? "ioUring" : "socket";
+    std::string ringBlocks = streamType == StreamType::IO_URING ? "VITIS_IO_URING_BLOCKS" : "VITIS_SOCKET_BATCH_BLOCKS";
+    //Both shared memory FIFO helper libraries have the same interface
+    bool sharedMem = streamType == StreamType::POSIX_SHARED_MEM || streamType == StreamType::POSIX_SHARED_MEM_LOCKLESS;
+
     //Emit a thread for handeling the I/O
 
     //Note, a single input FIFO may correspond to multiple MasterOutput ports
@@ -50,14 +63,26 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         case StreamType::POSIX_SHARED_MEM:
             filenamePostfix = "io_posix_shared_mem";
             break;
+        case StreamType::POSIX_SHARED_MEM_LOCKLESS:
+            filenamePostfix = "io_posix_shared_mem_lockless";
+            break;
+        case StreamType::IO_URING:
+            filenamePostfix = "io_linux_uring";
+            break;
         default:
             throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown stream type during stream I/O emit"));
     }
 
+    if(streamType == StreamType::IO_URING && ioFifoSize < 1){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("The io_uring stream I/O buffers must be at least 1 block"));
+    }
+
     std::string sharedFIFOHelperHeaderName;
     if(streamType == StreamType::POSIX_SHARED_MEM){
         //Emit the helper files
         sharedFIFOHelperHeaderName = emitSharedMemoryFIFOHelperFiles(path);
+    }else if(streamType == StreamType::POSIX_SHARED_MEM_LOCKLESS){
+        sharedFIFOHelperHeaderName = emitLocklessSharedMemoryFIFOHelperFiles(path, sharedMemFutex, sharedMemHugePages);
     }
 
     std::string fileName = fileNamePrefix + "_" + filenamePostfix;
@@ -84,8 +109,14 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
     if(streamType == StreamType::SOCKET){
         includesHFile.insert("#define VITIS_SOCKET_LISTEN_PORT " + GeneralHelper::to_string(DEFAULT_VITIS_SOCKET_LISTEN_PORT));
         includesHFile.insert("#define VITIS_SOCKET_LISTEN_ADDR " + GeneralHelper::to_string(DEFAULT_VITIS_SOCKET_LISTEN_ADDR));
-    }else if(streamType == StreamType::POSIX_SHARED_MEM){
+        includesHFile.insert("#define VITIS_SOCKET_BUFFER_SIZE " + GeneralHelper::to_string(socketBufferSize));
+        if(socketBatched){
+            includesHFile.insert("#define VITIS_SOCKET_BATCH_BLOCKS " + GeneralHelper::to_string(socketBatchBlocks));
+        }
+    }else if(sharedMem){
         includesHFile.insert("#include \"" + sharedFIFOHelperHeaderName + "\"");
+    }else if(streamType == StreamType::IO_URING){
+        includesHFile.insert("#define VITIS_IO_URING_BLOCKS " + GeneralHelper::to_string(ioFifoSize));
     }
     includesHFile.insert("#include \"" + GeneralHelper::to_string(VITIS_TYPE_NAME) + ".h\"");
     includesHFile.insert("#include \"" + fifoHeaderFile + "\"");
@@ -209,6 +240,19 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         includesCFile.insert("#include <netinet/in.h>");
         includesCFile.insert("#include <arpa/inet.h>");
         includesCFile.insert("#include <sys/select.h>");
+        if(socketBatched){
+            includesCFile.insert("#include <errno.h>");
+            includesCFile.insert("#include <sys/uio.h>");
+        }
+        if(socketZeroCopyEnabled){
+            includesCFile.insert("#include <poll.h>");
+            includesCFile.insert("#include <linux/errqueue.h>");
+        }
+    }else if(streamType == StreamType::IO_URING) {
+        includesCFile.insert("#include <fcntl.h>");
+        includesCFile.insert("#include <errno.h>");
+        includesCFile.insert("#include <sys/uio.h>");
+        includesCFile.insert("#include <liburing.h>");
     }
 
     includesCFile.insert("#include <time.h>");
@@ -405,6 +449,21 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
             ioThread << "}" << std::endl;
             ioThread << std::endl;
 
+            //Set the socket buffer sizes.  These are inherited by the connected socket and need to be set before
+            //listen so that the TCP window scaling reflects the larger receive buffer
+            ioThread << "if(VITIS_SOCKET_BUFFER_SIZE > 0){" << std::endl;
+            ioThread << "int bufferSize = VITIS_SOCKET_BUFFER_SIZE;" << std::endl;
+            ioThread << "if(setsockopt(" << listenSocketName << ", SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize)) != 0){" << std::endl;
+            ioThread << "fprintf(stderr, \"Could not set SO_RCVBUF for listen socket ... continuing anyway\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << "if(setsockopt(" << listenSocketName << ", SOL_SOCKET, SO_SNDBUF, &bufferSize, sizeof(bufferSize)) != 0){" << std::endl;
+            ioThread << "fprintf(stderr, \"Could not set SO_SNDBUF for listen socket ... continuing anyway\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << std::endl;
+
             //Set the socket to listen for incoming connections (limit to a queue of length 1)
             std::string listenStatusName = "listenStatus_bundle_" + GeneralHelper::to_string(*it);
             ioThread << "int " + listenStatusName + " = listen(" << listenSocketName << ", 1);" << std::endl;
@@ -495,7 +554,11 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
             ioThread << "}" << std::endl; //End connection if
         }
         ioThread << "}" << std::endl; //Close connect while
-    }else if(streamType == StreamType::POSIX_SHARED_MEM) {
+
+        if(socketBatched){
+            emitSocketBatchBufferSetup(ioThread, designName, masterInputBundles, masterOutputBundles, socketZeroCopyEnabled);
+        }
+    }else if(sharedMem) {
         ioThread << "//Setup FIFOs" << std::endl;
         //Create a pipe for each bundle
         //Producers should be initialized first - therefore, we start with outputs
@@ -522,6 +585,121 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
             ioThread << "size_t " << inputFIFOSizeName << " = sizeof(" << inputStructTypeName << ")*" << ioFifoSize << ";" << std::endl;
             ioThread << "consumerOpenFIFOBlock(\"" << inputSharedName << "\", " << inputFIFOSizeName << ", &" << inputFifoHandleName << ");" << std::endl;
         }
+    }else if(streamType == StreamType::IO_URING) {
+        ioThread << "//Setup Pipes" << std::endl;
+        ioThread << "int status;" << std::endl;
+        //The same named pipes as the PIPE driver are used so that the same clients can be used
+        for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++){
+            std::string inputPipeFileName = "input_bundle_"+GeneralHelper::to_string(it->first)+streamNameSuffix+".pipe";
+            ioThread << "status = mkfifo(\"" + inputPipeFileName + "\", S_IRUSR | S_IWUSR);" << std::endl;
+            ioThread << "if(status != 0){" << std::endl;
+            ioThread << "printf(\"Unable to create input pipe ... exiting\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "exit(1);" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << std::endl;
+        }
+
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            std::string outputPipeFileName = "output_bundle_" + GeneralHelper::to_string(it->first) + streamNameSuffix + ".pipe";
+            ioThread << "status = mkfifo(\"" + outputPipeFileName + "\", S_IRUSR | S_IWUSR);" << std::endl;
+            ioThread << "if(status != 0){" << std::endl;
+            ioThread << "printf(\"Unable to create output pipe ... exiting\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "exit(1);" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << std::endl;
+        }
+
+        //Open Linux pipes (opened in the same order as the PIPE driver)
+        for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
+            std::string inputPipeFileName = "input_bundle_"+GeneralHelper::to_string(it->first)+streamNameSuffix+".pipe";
+            std::string inputFDName = "inputFD_bundle_"+GeneralHelper::to_string(it->first);
+            ioThread << "int " + inputFDName + " = open(\"" + inputPipeFileName + "\", O_RDONLY);" << std::endl;
+            ioThread << "if(" + inputFDName + " == -1){" << std::endl;
+            ioThread << "printf(\"Unable to open input pipe ... exiting\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "exit(1);" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << std::endl;
+        }
+
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            std::string outputPipeFileName = "output_bundle_"+GeneralHelper::to_string(it->first)+streamNameSuffix+".pipe";
+            std::string outputFDName = "outputFD_bundle_"+GeneralHelper::to_string(it->first);
+            ioThread << "int " + outputFDName + " = open(\"" + outputPipeFileName + "\", O_WRONLY);" << std::endl;
+            ioThread << "if(" + outputFDName + " == -1){" << std::endl;
+            ioThread << "printf(\"Unable to open output pipe ... exiting\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "exit(1);" << std::endl;
+            ioThread << "}" << std::endl;
+        }
+
+        //At most one request is in flight for each bundle in each direction
+        unsigned long ringEntries = masterInputBundles.size() + masterOutputBundles.size();
+        ioThread << std::endl;
+        ioThread << "//Setup io_uring" << std::endl;
+        ioThread << "struct io_uring ioRing;" << std::endl;
+        ioThread << "status = io_uring_queue_init(" << (ringEntries < 1 ? 1 : ringEntries) << ", &ioRing, 0);" << std::endl;
+        ioThread << "if(status < 0){" << std::endl;
+        ioThread << "printf(\"Unable to setup io_uring ... exiting\\n\");" << std::endl;
+        ioThread << "errno = -status;" << std::endl;
+        ioThread << "perror(NULL);" << std::endl;
+        ioThread << "exit(1);" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "bool ioUringSubmitPending = false;" << std::endl;
+        ioThread << std::endl;
+
+        //Allocate the receive and transmit buffers.  These are registered with io_uring as fixed buffers so that they
+        //are not mapped into the kernel for each request
+        ioThread << "//Allocate receive/transmit buffers" << std::endl;
+        ioThread << "struct iovec ioUringBufferVecs[" << (ringEntries < 1 ? 1 : ringEntries) << "];" << std::endl;
+        int bufIdx = 0;
+        for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
+            std::string bundleStr = GeneralHelper::to_string(it->first);
+            std::string inputStructTypeName = designName+"_inputs_bundle_"+bundleStr+"_t";
+            std::string bufName = "ioUringInputBuf_bundle_"+bundleStr;
+            ioThread << inputStructTypeName << " *" << bufName << ";" << std::endl;
+            ioThread << "status = posix_memalign((void**) &" << bufName << ", 4096, sizeof(" << inputStructTypeName << ")*VITIS_IO_URING_BLOCKS);" << std::endl;
+            ioThread << "if(status != 0){" << std::endl;
+            ioThread << "printf(\"Unable to allocate io_uring receive buffer ... exiting\\n\");" << std::endl;
+            ioThread << "exit(1);" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << "const int ioUringInputBufIdx_bundle_" << bundleStr << " = " << bufIdx << ";" << std::endl;
+            ioThread << "ioUringBufferVecs[" << bufIdx << "].iov_base = " << bufName << ";" << std::endl;
+            ioThread << "ioUringBufferVecs[" << bufIdx << "].iov_len = sizeof(" << inputStructTypeName << ")*VITIS_IO_URING_BLOCKS;" << std::endl;
+            ioThread << "uint64_t ioUringInputBytes_bundle_" << bundleStr << " = 0; //The total number of bytes received" << std::endl;
+            ioThread << "uint64_t ioUringInputRd_bundle_" << bundleStr << " = 0; //The total number of blocks passed to compute" << std::endl;
+            ioThread << "bool ioUringInputInFlight_bundle_" << bundleStr << " = false;" << std::endl;
+            ioThread << "bool ioUringInputEOF_bundle_" << bundleStr << " = false;" << std::endl;
+            bufIdx++;
+        }
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            std::string bundleStr = GeneralHelper::to_string(it->first);
+            std::string outputStructTypeName = designName+"_outputs_bundle_"+bundleStr+"_t";
+            std::string bufName = "ioUringOutputBuf_bundle_"+bundleStr;
+            ioThread << outputStructTypeName << " *" << bufName << ";" << std::endl;
+            ioThread << "status = posix_memalign((void**) &" << bufName << ", 4096, sizeof(" << outputStructTypeName << ")*VITIS_IO_URING_BLOCKS);" << std::endl;
+            ioThread << "if(status != 0){" << std::endl;
+            ioThread << "printf(\"Unable to allocate io_uring transmit buffer ... exiting\\n\");" << std::endl;
+            ioThread << "exit(1);" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << "const int ioUringOutputBufIdx_bundle_" << bundleStr << " = " << bufIdx << ";" << std::endl;
+            ioThread << "ioUringBufferVecs[" << bufIdx << "].iov_base = " << bufName << ";" << std::endl;
+            ioThread << "ioUringBufferVecs[" << bufIdx << "].iov_len = sizeof(" << outputStructTypeName << ")*VITIS_IO_URING_BLOCKS;" << std::endl;
+            ioThread << "uint64_t ioUringOutputWr_bundle_" << bundleStr << " = 0; //The total number of blocks placed in the transmit buffer" << std::endl;
+            ioThread << "uint64_t ioUringOutputBytes_bundle_" << bundleStr << " = 0; //The total number of bytes sent" << std::endl;
+            ioThread << "bool ioUringOutputInFlight_bundle_" << bundleStr << " = false;" << std::endl;
+            bufIdx++;
+        }
+
+        //Registration can fail if the buffers exceed RLIMIT_MEMLOCK.  Fall back to unregistered buffers in that case
+        ioThread << "bool ioUringFixedBuffers = true;" << std::endl;
+        ioThread << "status = io_uring_register_buffers(&ioRing, ioUringBufferVecs, " << bufIdx << ");" << std::endl;
+        ioThread << "if(status < 0){" << std::endl;
+        ioThread << "printf(\"Unable to register io_uring buffers (%s) ... continuing with unregistered buffers\\n\", strerror(-status));" << std::endl;
+        ioThread << "ioUringFixedBuffers = false;" << std::endl;
+        ioThread << "}" << std::endl;
     }else{
         throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown stream type during stream I/O emit"));
     }
@@ -561,7 +739,10 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         std::string extInputBufferFilledName = "extInputBufferFilled_"+GeneralHelper::to_string(it->first);
         std::string toComputeFIFOFilledName = "toComputeFIFOFilled_"+GeneralHelper::to_string(it->first);
 
-        ioThread << inputStructTypeName << " " << linuxInputTmpName << ";" << std::endl;
+        if(!ringBuffered) {
+            //Ring buffered drivers pass blocks to compute directly from their receive buffers
+            ioThread << inputStructTypeName << " " << linuxInputTmpName << ";" << std::endl;
+        }
         ioThread << "bool " << extInputBufferFilledName << " = false;" << std::endl;
         ioThread << "bool " <<  toComputeFIFOFilledName << " = false;" << std::endl;
 
@@ -574,7 +755,10 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         std::string fromComputeFIFOFilledName = "fromComputeFIFOFilled_"+GeneralHelper::to_string(it->first);
         std::string extOutputBufferFilledName = "extOutputBufferFilled_"+GeneralHelper::to_string(it->first);
 
-        ioThread << outputStructTypeName << " " << linuxOutputTmpName << ";" << std::endl;
+        if(!ringBuffered) {
+            //Ring buffered drivers copy blocks from compute directly into their transmit buffers
+            ioThread << outputStructTypeName << " " << linuxOutputTmpName << ";" << std::endl;
+        }
 
         ioThread << "bool " << fromComputeFIFOFilledName << " = false;" << std::endl;
         ioThread << "bool " << extOutputBufferFilledName << " = false;" << std::endl;
@@ -596,8 +780,19 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
 
     ioThread << std::endl;
 
+    //The I/O thread does not block on FIFOs.  Instead, it waits according to the wait policy in iterations where no
+    //progress was made
+    std::vector<std::string> waitStateDecl = MultiThreadEmit::createFIFOWaitState(fifoWaitPolicy, "ioThreadWait");
+    bool trackProgress = !waitStateDecl.empty();
+    for(unsigned long i = 0; i<waitStateDecl.size(); i++){
+        ioThread << waitStateDecl[i] << std::endl;
+    }
+
     ioThread << "//Thread loop" << std::endl;
     ioThread << "while(true){" << std::endl;
+    if(trackProgress){
+        ioThread << "bool ioThreadProgress = false;" << std::endl;
+    }
     //Allocate temp Memory for linux pipe read
     //++++ External Input to Compute ++++
 
@@ -611,6 +806,13 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
     std::map<int, std::vector<std::pair<std::shared_ptr<ThreadCrossingFIFO>, int>>> inputPortFifoMap = getInputPortFIFOMapping(outputFIFOs); //Note, outputFIFOs are the outputs of the I/O thread.  They carry the inputs to the system to the compute threads
 
     ioThread << std::endl;
+    if(streamType == StreamType::IO_URING){
+        emitIOUringProcessCompletions(ioThread, masterInputBundles, masterOutputBundles, false, trackProgress);
+    }else if(socketZeroCopyEnabled){
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            emitSocketZeroCopyCompletions(ioThread, it->first, trackProgress);
+        }
+    }
     for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
         //This process needs to be repeated for each input bundle
         //TODO: This currently forces reading in a specific order, consider changing this?
@@ -624,11 +826,36 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         ioThread << "//Copy Between Input Buffers" << std::endl;
         ioThread << "if(" << extInputBufferFilledName << " && !" << toComputeFIFOFilledName << "){" << std::endl;
 
-        copyIOInputsToFIFO(ioThread, it->second.first, inputPortFifoMap, linuxInputTmpName);
-        ioThread << extInputBufferFilledName << " = false;" << std::endl;
+        if(ringBuffered){
+            emitRingBufferCopyInput(ioThread, designName, it->first, it->second.first, inputPortFifoMap,
+                                    collectTelem && it == masterInputBundles.begin() ? blockSizeBase : 0,
+                                    ringPrefix, ringBlocks);
+        }else {
+            copyIOInputsToFIFO(ioThread, it->second.first, inputPortFifoMap, linuxInputTmpName);
+            ioThread << extInputBufferFilledName << " = false;" << std::endl;
+        }
         ioThread << toComputeFIFOFilledName << " = true;" << std::endl;
         ioThread << "}" << std::endl;
 
+        if(ringBuffered){
+            std::string bundleStr = GeneralHelper::to_string(it->first);
+            ioThread << std::endl;
+            if(streamType == StreamType::IO_URING) {
+                //Reads are asynchronous.  Rather than checking if data is available, a read is kept in flight
+                emitIOUringQueueRead(ioThread, designName, it->first);
+            }else{
+                //Receive whatever is available (without blocking) into the receive buffer
+                emitSocketBatchRecv(ioThread, designName, it->first, trackProgress);
+            }
+            ioThread << extInputBufferFilledName << " = " << ringPrefix << "InputBytes_bundle_" << bundleStr << "/sizeof("
+                     << inputStructTypeName << ") > " << ringPrefix << "InputRd_bundle_" << bundleStr << ";" << std::endl;
+            ioThread << "if(" << ringPrefix << "InputEOF_bundle_" << bundleStr << " && !" << extInputBufferFilledName << "){" << std::endl;
+            ioThread << "//Done with input (input stream closed and all received blocks passed to compute)" << std::endl;
+            ioThread << "break;" << std::endl;
+            ioThread << "}" << std::endl;
+            continue;
+        }
+
         ioThread << std::endl;
         ioThread << "//Check if space available for input" << std::endl;
         //Read data from the input pipe if data is availible and the buffer is free
@@ -640,7 +867,7 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         } else if (streamType == StreamType::SOCKET) {
             std::string connectedSocketName = "connectedSocket_bundle_" + GeneralHelper::to_string(it->first);
             ioThread << "bool extDataAvail = isReadyForReadingFD(" << connectedSocketName << ");" << std::endl;
-        } else if (streamType == StreamType::POSIX_SHARED_MEM){
+        } else if (sharedMem){
             std::string inputFifoHandleName = "inputFIFO_bundle_"+GeneralHelper::to_string(it->first);
             ioThread << "bool extDataAvail = isReadyForReading(&" << inputFifoHandleName << ");" << std::endl;
         } else {
@@ -685,7 +912,7 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
             ioThread << "printf(\"An unknown error was encountered while reading the Socket\\n\");" << std::endl;
             ioThread << "exit(1);" << std::endl;
             ioThread << "}" << std::endl;
-        } else if (streamType == StreamType::POSIX_SHARED_MEM){
+        } else if (sharedMem){
             std::string inputFifoHandleName = "inputFIFO_bundle_"+GeneralHelper::to_string(it->first);
             ioThread << "int elementsRead = readFifo(&" << linuxInputTmpName << ", sizeof(" << inputStructTypeName
                      << "), 1, &" << inputFifoHandleName << ");" << std::endl;
@@ -699,6 +926,9 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
 
         //This read is blocking so can set the receive status unconditionally
         ioThread << extInputBufferFilledName << " = true;" << std::endl;
+        if(trackProgress){
+            ioThread << "ioThreadProgress = true;" << std::endl;
+        }
 
         //Only counts the data received for the one of the bundles
         if(collectTelem && it == masterInputBundles.begin()) {
@@ -846,8 +1076,14 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         //Copy ext input into the compute buffer if possible
         ioThread << "//Copy Between Input Buffers" << std::endl;
         ioThread << "if(" << extInputBufferFilledName << " && !" << toComputeFIFOFilledName << "){" << std::endl;
-        copyIOInputsToFIFO(ioThread, it->second.first, inputPortFifoMap, linuxInputTmpName);
-        ioThread << extInputBufferFilledName << " = false;" << std::endl;
+        if(ringBuffered){
+            emitRingBufferCopyInput(ioThread, designName, it->first, it->second.first, inputPortFifoMap,
+                                    collectTelem && it == masterInputBundles.begin() ? blockSizeBase : 0,
+                                    ringPrefix, ringBlocks);
+        }else {
+            copyIOInputsToFIFO(ioThread, it->second.first, inputPortFifoMap, linuxInputTmpName);
+            ioThread << extInputBufferFilledName << " = false;" << std::endl;
+        }
         ioThread << toComputeFIFOFilledName << " = true;" << std::endl;
         ioThread << "}" << std::endl;
     }
@@ -916,6 +1152,9 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
     }
 
     ioThread << "if(outputFIFOsReady){" << std::endl;
+    if(trackProgress){
+        ioThread << "ioThreadProgress = true;" << std::endl;
+    }
 
     if (collectBreakdownTelem) {
         ioThread << "timespec_t writingFIFOsToComputeStart;" << std::endl;
@@ -1014,6 +1253,9 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
     }
 
     ioThread << "if(inputFIFOsReady){" << std::endl;
+    if(trackProgress){
+        ioThread << "ioThreadProgress = true;" << std::endl;
+    }
     //Data availible on FIFOs and room in buffers, read
 
     //Read input FIFOs
@@ -1071,9 +1313,14 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         //Copy ext input into the compute buffer if the external input buffer has data but the computeFIFO buffer does not
         //This allows a read from the external stream to occur if availible
         ioThread << "if(" << fromComputeFIFOFilledName << " && !" << extOutputBufferFilledName << "){" << std::endl;
-        copyFIFOToIOOutputs(ioThread, it->second.first, outputPortFifoMap, outputMaster, linuxOutputTmpName);
+        if(ringBuffered){
+            emitRingBufferCopyOutput(ioThread, designName, it->first, it->second.first, outputPortFifoMap, outputMaster,
+                                     ringPrefix, ringBlocks);
+        }else {
+            copyFIFOToIOOutputs(ioThread, it->second.first, outputPortFifoMap, outputMaster, linuxOutputTmpName);
+            ioThread << extOutputBufferFilledName << " = true;" << std::endl;
+        }
         ioThread << fromComputeFIFOFilledName << " = false;" << std::endl;
-        ioThread << extOutputBufferFilledName << " = true;" << std::endl;
         ioThread << "}" << std::endl;
     }
 
@@ -1101,6 +1348,21 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         std::string outputStructTypeName = designName+"_outputs_bundle_"+GeneralHelper::to_string(it->first)+"_t";
         std::string extOutputBufferFilledName = "extOutputBufferFilled_"+GeneralHelper::to_string(it->first);
 
+        if(ringBuffered){
+            std::string bundleStr = GeneralHelper::to_string(it->first);
+            if(streamType == StreamType::IO_URING) {
+                //Writes are asynchronous.  Any blocks in the transmit buffer are written once the previous write completes
+                emitIOUringQueueWrite(ioThread, designName, it->first);
+            }else{
+                //Send as much of the transmit buffer as the socket will accept (without blocking)
+                emitSocketBatchSend(ioThread, designName, it->first, trackProgress, false, socketZeroCopyEnabled);
+            }
+            ioThread << extOutputBufferFilledName << " = " << ringPrefix << "OutputWr_bundle_" << bundleStr
+                     << " - " << ringPrefix << "OutputBytes_bundle_" << bundleStr << "/sizeof(" << outputStructTypeName
+                     << ") >= " << ringBlocks << ";" << std::endl;
+            continue;
+        }
+
         //Only check external outputs ready if there is data to be sent
         ioThread << "//Check if data to write to external stream" << std::endl;
         ioThread << "if("<< extOutputBufferFilledName << "){" << std::endl;
@@ -1114,7 +1376,7 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         } else if (streamType == StreamType::SOCKET) {
             std::string connectedSocketName = "connectedSocket_bundle_" + GeneralHelper::to_string(it->first);
             ioThread << "bool extWriteReady = isReadyForWritingFD(" << connectedSocketName << ");" << std::endl;
-        } else if (streamType == StreamType::POSIX_SHARED_MEM){
+        } else if (sharedMem){
             std::string outputFifoHandleName = "outputFIFO_bundle_"+GeneralHelper::to_string(it->first);
             ioThread << "bool extWriteReady = isReadyForWriting(&" << outputFifoHandleName << ");" << std::endl;
         } else {
@@ -1122,6 +1384,9 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         }
 
         ioThread << "if(extWriteReady){" << std::endl;
+        if(trackProgress){
+            ioThread << "ioThreadProgress = true;" << std::endl;
+        }
         //External stream is ready, perform a blocking write
         ioThread << "//Write to external stream" << std::endl;
         if (streamType == StreamType::PIPE) {
@@ -1152,7 +1417,7 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
             ioThread << "printf(\"An unknown error was encountered while writing to socket\\n\");" << std::endl;
             ioThread << "exit(1);" << std::endl;
             ioThread << "}" << std::endl;
-        } else if (streamType == StreamType::POSIX_SHARED_MEM) {
+        } else if (sharedMem) {
             std::string outputFifoHandleName = "outputFIFO_bundle_"+GeneralHelper::to_string(it->first);
             ioThread << "int elementsWritten = writeFifo(&" << linuxOutputTmpName << ", sizeof(" << outputStructTypeName
                      << "), 1, &" << outputFifoHandleName << ");" << std::endl;
@@ -1183,9 +1448,14 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         //Copy ext input into the compute buffer if the external input buffer has data but the computeFIFO buffer does not
         //This allows a read from the external stream to occur if availible
         ioThread << "if(" << fromComputeFIFOFilledName << " && !" << extOutputBufferFilledName << "){" << std::endl;
-        copyFIFOToIOOutputs(ioThread, it->second.first, outputPortFifoMap, outputMaster, linuxOutputTmpName);
+        if(ringBuffered){
+            emitRingBufferCopyOutput(ioThread, designName, it->first, it->second.first, outputPortFifoMap, outputMaster,
+                                     ringPrefix, ringBlocks);
+        }else {
+            copyFIFOToIOOutputs(ioThread, it->second.first, outputPortFifoMap, outputMaster, linuxOutputTmpName);
+            ioThread << extOutputBufferFilledName << " = true;" << std::endl;
+        }
         ioThread << fromComputeFIFOFilledName << " = false;" << std::endl;
-        ioThread << extOutputBufferFilledName << " = true;" << std::endl;
         ioThread << "}" << std::endl;
     }
 
@@ -1223,12 +1493,109 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
         ioThread << "}" << std::endl;
     }
 
+    if(streamType == StreamType::IO_URING){
+        //Submit all of the reads and writes queued during this iteration with a single system call
+        ioThread << "if(ioUringSubmitPending){" << std::endl;
+        emitIOUringSubmit(ioThread);
+        ioThread << "}" << std::endl;
+    }
+
+    //Publish any deferred FIFO reads/writes each iteration since the I/O thread does not block on FIFOs
+    std::vector<std::string> flushExprs = MultiThreadEmit::flushFIFOsPendingCommits(inputFIFOs, outputFIFOs);
+    for(int i = 0; i<flushExprs.size(); i++){
+        ioThread << flushExprs[i] << std::endl;
+    }
+
+    std::vector<std::string> wakeExprs = MultiThreadEmit::wakeFIFOWaiters(fifoWaitPolicy);
+    for(int i = 0; i<wakeExprs.size(); i++){
+        ioThread << wakeExprs[i] << std::endl;
+    }
+
+    if(trackProgress){
+        std::vector<std::string> doneExprs = MultiThreadEmit::doneWaitingOnFIFOs(fifoWaitPolicy, "ioThreadWait");
+        std::vector<std::string> waitExprs = MultiThreadEmit::waitOnFIFOs(fifoWaitPolicy, "ioThreadWait");
+        ioThread << "if(ioThreadProgress){" << std::endl;
+        for(int i = 0; i<doneExprs.size(); i++){
+            ioThread << doneExprs[i] << std::endl;
+        }
+        ioThread << "}else{" << std::endl;
+        for(int i = 0; i<waitExprs.size(); i++){
+            ioThread << waitExprs[i] << std::endl;
+        }
+        ioThread << "}" << std::endl;
+    }
+
     ioThread << "}" << std::endl; //Close while
 
+    //The input stream has ended, publish anything written since the last iteration
+    for(int i = 0; i<flushExprs.size(); i++){
+        ioThread << flushExprs[i] << std::endl;
+    }
+    for(int i = 0; i<wakeExprs.size(); i++){
+        ioThread << wakeExprs[i] << std::endl;
+    }
+
     if(threadDebugPrint) {
         ioThread << "printf(\"Input Pipe Closed ... Exiting\\n\");" << std::endl;
     }
 
+    if(streamType == StreamType::IO_URING){
+        //Finish writing the blocks in the transmit buffers and wait for any outstanding reads before closing the pipes
+        ioThread << "//Drain io_uring requests" << std::endl;
+        ioThread << "while(1){" << std::endl;
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            emitIOUringQueueWrite(ioThread, designName, it->first);
+        }
+        ioThread << "if(ioUringSubmitPending){" << std::endl;
+        emitIOUringSubmit(ioThread);
+        ioThread << "}" << std::endl;
+        ioThread << "bool ioUringOutstanding = false;" << std::endl;
+        for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
+            ioThread << "ioUringOutstanding |= ioUringInputInFlight_bundle_" << it->first << ";" << std::endl;
+        }
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            std::string outputStructTypeName = designName+"_outputs_bundle_"+GeneralHelper::to_string(it->first)+"_t";
+            ioThread << "ioUringOutstanding |= ioUringOutputInFlight_bundle_" << it->first << " || ioUringOutputWr_bundle_"
+                     << it->first << "*sizeof(" << outputStructTypeName << ") != ioUringOutputBytes_bundle_" << it->first << ";" << std::endl;
+        }
+        ioThread << "if(!ioUringOutstanding){" << std::endl;
+        ioThread << "break;" << std::endl;
+        ioThread << "}" << std::endl;
+        emitIOUringProcessCompletions(ioThread, masterInputBundles, masterOutputBundles, true, false);
+        ioThread << "}" << std::endl;
+    }
+
+    if(socketBatched){
+        //Finish sending the blocks in the transmit buffers.  If zero copy is used, the buffers cannot be freed until the
+        //kernel has indicated that it is done with them
+        ioThread << "//Drain transmit buffers" << std::endl;
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            std::string bundleStr = GeneralHelper::to_string(it->first);
+            std::string outputStructTypeName = designName+"_outputs_bundle_"+bundleStr+"_t";
+            ioThread << "while(socketOutputWr_bundle_" << bundleStr << "*sizeof(" << outputStructTypeName
+                     << ") != socketOutputBytes_bundle_" << bundleStr << "){" << std::endl;
+            if(socketZeroCopyEnabled){
+                emitSocketZeroCopyCompletions(ioThread, it->first, false);
+            }
+            emitSocketBatchSend(ioThread, designName, it->first, false, true, socketZeroCopyEnabled);
+            if(socketZeroCopyEnabled){
+                //Wait for zero copy completions (reported as an error queue event) if all blocks have been handed to
+                //the kernel or if no more sends can be tracked
+                ioThread << "if(socketOutputSent_bundle_" << bundleStr << " != socketOutputBytes_bundle_" << bundleStr
+                         << " && (socketOutputWr_bundle_" << bundleStr << "*sizeof(" << outputStructTypeName
+                         << ") == socketOutputSent_bundle_" << bundleStr << " || socketZCIssued_bundle_" << bundleStr
+                         << " - socketZCCompleted_bundle_" << bundleStr << " >= VITIS_SOCKET_BATCH_BLOCKS)){" << std::endl;
+                ioThread << "struct pollfd errQueuePoll;" << std::endl;
+                ioThread << "errQueuePoll.fd = connectedSocket_bundle_" << bundleStr << ";" << std::endl;
+                ioThread << "errQueuePoll.events = 0; //POLLERR is always reported" << std::endl;
+                ioThread << "errQueuePoll.revents = 0;" << std::endl;
+                ioThread << "poll(&errQueuePoll, 1, -1);" << std::endl;
+                ioThread << "}" << std::endl;
+            }
+            ioThread << "}" << std::endl;
+        }
+    }
+
     //clean up streams
     if(streamType == StreamType::PIPE) {
         //The client should close the output FIFO first then the read FIFO
@@ -1284,7 +1651,15 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
             ioThread << "perror(NULL);" << std::endl;
             ioThread << "}" << std::endl;
         }
-    } else if (streamType == StreamType::POSIX_SHARED_MEM) {
+        if(socketBatched){
+            for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
+                ioThread << "free(socketInputBuf_bundle_" << it->first << ");" << std::endl;
+            }
+            for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+                ioThread << "free(socketOutputBuf_bundle_" << it->first << ");" << std::endl;
+            }
+        }
+    } else if (sharedMem) {
         for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
             std::string outputFifoHandleName = "outputFIFO_bundle_"+GeneralHelper::to_string(it->first);
             ioThread << "cleanupProducer(&" << outputFifoHandleName << ");" << std::endl;
@@ -1295,6 +1670,49 @@ void StreamIOThread::emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaste
             ioThread << "cleanupConsumer(&" << inputFifoHandleName << ");" << std::endl;
         }
 
+    }else if(streamType == StreamType::IO_URING){
+        ioThread << "if(ioUringFixedBuffers){" << std::endl;
+        ioThread << "io_uring_unregister_buffers(&ioRing);" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "io_uring_queue_exit(&ioRing);" << std::endl;
+
+        ioThread << "int closeStatus;" << std::endl;
+        for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
+            std::string inputFDName = "inputFD_bundle_"+GeneralHelper::to_string(it->first);
+            ioThread << "closeStatus = close(" << inputFDName << ");" << std::endl;
+            ioThread << "if(closeStatus != 0){" << std::endl;
+            ioThread << "printf(\"Unable to close Linux Input Pipe\\n\");" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << "free(ioUringInputBuf_bundle_" << it->first << ");" << std::endl;
+        }
+
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            std::string outputFDName = "outputFD_bundle_"+GeneralHelper::to_string(it->first);
+            ioThread << "closeStatus = close(" << outputFDName << ");" << std::endl;
+            ioThread << "if(closeStatus != 0){" << std::endl;
+            ioThread << "printf(\"Unable to close Linux Output Pipe\\n\");" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << "free(ioUringOutputBuf_bundle_" << it->first << ");" << std::endl;
+        }
+
+        //Delete the pipes
+        for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
+            std::string inputPipeFileName = "input_bundle_"+GeneralHelper::to_string(it->first)+streamNameSuffix+".pipe";
+            ioThread << "closeStatus = unlink(\"" << inputPipeFileName << "\");" << std::endl;
+            ioThread << "if (closeStatus != 0){" << std::endl;
+            ioThread << "printf(\"Could not delete the Linux Input Pipe\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "}" << std::endl;
+        }
+
+        for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+            std::string outputPipeFileName = "output_bundle_" + GeneralHelper::to_string(it->first) + streamNameSuffix + ".pipe";
+            ioThread << "closeStatus = unlink(\"" << outputPipeFileName << "\");" << std::endl;
+            ioThread << "if (closeStatus != 0){" << std::endl;
+            ioThread << "printf(\"Could not delete the Linux Output Pipe\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "}" << std::endl;
+        }
     }else{
         throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown stream type during stream I/O emit"));
     }
@@ -1469,7 +1887,7 @@ void StreamIOThread::copyFIFOToIOOutputs(std::ofstream &ioThread, std::vector<Va
     }
 }
 
-void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaster, std::shared_ptr<MasterOutput> outputMaster, std::string path, std::string fileNamePrefix, std::string fifoHeaderFile, std::string designName) {
+void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaster, std::shared_ptr<MasterOutput> outputMaster, std::string path, std::string fileNamePrefix, std::string fifoHeaderFile, std::string designName, int socketBufferSize) {
     std::string serverFilenamePostfix = "io_network_socket";
     std::string serverFileName = fileNamePrefix + "_" + serverFilenamePostfix;
 
@@ -1489,6 +1907,7 @@ void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaste
     headerFile << "#include <math.h>" << std::endl;
     headerFile << "#include <pthread.h>" << std::endl;
     headerFile << "#define VITIS_SOCKET_LISTEN_PORT " << DEFAULT_VITIS_SOCKET_LISTEN_PORT << std::endl;
+    headerFile << "#define VITIS_SOCKET_CLIENT_BUFFER_SIZE " << socketBufferSize << std::endl;
     headerFile << "#include \"" << VITIS_TYPE_NAME << ".h\"" << std::endl;
     headerFile << "#include \"" << serverFileName << ".h\"" << std::endl;
     headerFile << "#include \"" << fifoHeaderFile << "\"" << std::endl;
@@ -1530,6 +1949,10 @@ void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaste
         std::string sendFctnDcl = "void " + designName + "_" + filenamePostfix + "_bundle_" + GeneralHelper::to_string(it->first) + "_send(int socket, " + inputStructTypeName + " *toSend)";
         headerFile << sendFctnDcl << ";" << std::endl;
         headerFile << std::endl;
+        headerFile << "//For sending multiple blocks to the remote system with a single system call" << std::endl;
+        std::string sendBatchFctnDcl = "void " + designName + "_" + filenamePostfix + "_bundle_" + GeneralHelper::to_string(it->first) + "_sendBatch(int socket, " + inputStructTypeName + " *toSend, int numBlocks)";
+        headerFile << sendBatchFctnDcl << ";" << std::endl;
+        headerFile << std::endl;
     }
 
     for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
@@ -1540,6 +1963,12 @@ void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaste
         std::string recvFctnDcl = "bool " + designName + "_" + filenamePostfix + "_bundle_" + GeneralHelper::to_string(it->first) + "_recv(int socket, " + outputStructTypeName + " *toRecv)";
         headerFile << recvFctnDcl << ";" << std::endl;
         headerFile << std::endl;
+        headerFile << "//For receiving multiple blocks from the remote system with a single system call" << std::endl;
+        headerFile << "//Blocks until at least one block is received.  Returns the number of blocks received (up to maxBlocks)" << std::endl;
+        headerFile << "//or 0 if the socket has been closed" << std::endl;
+        std::string recvBatchFctnDcl = "int " + designName + "_" + filenamePostfix + "_bundle_" + GeneralHelper::to_string(it->first) + "_recvBatch(int socket, " + outputStructTypeName + " *toRecv, int maxBlocks)";
+        headerFile << recvBatchFctnDcl << ";" << std::endl;
+        headerFile << std::endl;
     }
     headerFile << "#endif" << std::endl;
     headerFile.close();
@@ -1582,6 +2011,18 @@ void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaste
     ioThread << "connectAddr.sin_family=AF_INET;" << std::endl;
     ioThread << "connectAddr.sin_port=htons(VITIS_SOCKET_LISTEN_PORT+bundleNum);" << std::endl;
     ioThread << "connectAddr.sin_addr.s_addr=inet_addr(ipAddrStr);" << std::endl;
+    ioThread << std::endl;
+
+    //The buffer sizes need to be set before connecting so that the TCP window scaling reflects the larger receive buffer
+    ioThread << "if(VITIS_SOCKET_CLIENT_BUFFER_SIZE > 0){" << std::endl;
+    ioThread << "int bufferSize = VITIS_SOCKET_CLIENT_BUFFER_SIZE;" << std::endl;
+    ioThread << "if(setsockopt(" << connectSocketName << ", SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize)) != 0){" << std::endl;
+    ioThread << "VITIS_CLIENT_PRINTF(\"Could not set SO_RCVBUF ... continuing anyway\\n\");" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "if(setsockopt(" << connectSocketName << ", SOL_SOCKET, SO_SNDBUF, &bufferSize, sizeof(bufferSize)) != 0){" << std::endl;
+    ioThread << "VITIS_CLIENT_PRINTF(\"Could not set SO_SNDBUF ... continuing anyway\\n\");" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
     ioThread << "VITIS_CLIENT_PRINTF(\"Connecting to addr: %s:%d\\n\", ipAddrStr, VITIS_SOCKET_LISTEN_PORT);" << std::endl;
     ioThread << std::endl;
 
@@ -1623,6 +2064,23 @@ void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaste
         ioThread << "}" << std::endl;
         ioThread << "}" << std::endl;
         ioThread << std::endl;
+
+        std::string sendBatchFctnDcl = "void " + designName + "_" + filenamePostfix + "_bundle_" + GeneralHelper::to_string(it->first) + "_sendBatch(int socket, " + inputStructTypeName + " *toSend, int numBlocks)";
+        ioThread << sendBatchFctnDcl << "{" << std::endl;
+        ioThread << "size_t bytesToSend = sizeof(" << inputStructTypeName << ")*numBlocks;" << std::endl;
+        ioThread << "size_t bytesSentTotal = 0;" << std::endl;
+        //A blocking send on a stream socket can still return early if interrupted
+        ioThread << "while(bytesSentTotal < bytesToSend){" << std::endl;
+        ioThread << "ssize_t bytesSent = send(socket, ((char*) toSend)+bytesSentTotal, bytesToSend-bytesSentTotal, 0);" << std::endl;
+        ioThread << "if (bytesSent == -1){" << std::endl;
+        ioThread << "VITIS_CLIENT_PRINTF(\"An error was encountered while writing the socket\\n\");" << std::endl;
+        ioThread << "perror(NULL);" << std::endl;
+        ioThread << "exit(1);" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "bytesSentTotal += bytesSent;" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << std::endl;
     }
 
     for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
@@ -1647,6 +2105,33 @@ void StreamIOThread::emitSocketClientLib(std::shared_ptr<MasterInput> inputMaste
         ioThread << "return true;" << std::endl;
         ioThread << "}" << std::endl;
         ioThread << std::endl;
+
+        //Receive whatever is available (up to maxBlocks) then complete any partially received block
+        std::string recvBatchFctnDcl = "int " + designName + "_" + filenamePostfix + "_bundle_" + GeneralHelper::to_string(it->first) + "_recvBatch(int socket, " + outputStructTypeName + " *toRecv, int maxBlocks)";
+        ioThread << recvBatchFctnDcl << "{" << std::endl;
+        ioThread << "ssize_t bytesRead = recv(socket, toRecv, sizeof(" << outputStructTypeName << ")*maxBlocks, 0);" << std::endl;
+        ioThread << "if(bytesRead == 0){" << std::endl;
+        ioThread << "//Done with input (socket closed)" << std::endl;
+        ioThread << "return 0;" << std::endl;
+        ioThread << "} else if (bytesRead == -1){" << std::endl;
+        ioThread << "VITIS_CLIENT_PRINTF(\"An error was encountered while reading the socket\\n\");" << std::endl;
+        ioThread << "perror(NULL);" << std::endl;
+        ioThread << "exit(1);" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "size_t partialBytes = bytesRead % sizeof(" << outputStructTypeName << ");" << std::endl;
+        ioThread << "if(partialBytes != 0){" << std::endl;
+        ioThread << "size_t remainingBytes = sizeof(" << outputStructTypeName << ") - partialBytes;" << std::endl;
+        ioThread << "ssize_t remainingRead = recv(socket, ((char*) toRecv)+bytesRead, remainingBytes, MSG_WAITALL);" << std::endl;
+        ioThread << "if(remainingRead != (ssize_t) remainingBytes){" << std::endl;
+        ioThread << "VITIS_CLIENT_PRINTF(\"An error was encountered while reading the socket (partial block received)\\n\");" << std::endl;
+        ioThread << "perror(NULL);" << std::endl;
+        ioThread << "exit(1);" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "bytesRead += remainingRead;" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "return bytesRead/sizeof(" << outputStructTypeName << ");" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << std::endl;
     }
     ioThread.close();
 }
@@ -2225,62 +2710,623 @@ std::string StreamIOThread::emitSharedMemoryFIFOHelperFiles(std::string path) {
     return fileName+".h";
 }
 
-std::string StreamIOThread::emitFileStreamHelpers(std::string path, std::string fileNamePrefix){
-    std::string fileName = fileNamePrefix + "_filestream_helpers";
+std::string StreamIOThread::emitLocklessSharedMemoryFIFOHelperFiles(std::string path, bool useFutex, bool hugePages) {
+    std::string fileName = "LocklessSharedMemoryFIFO";
     std::cout << "Emitting C File: " << path << "/" << fileName << ".h" << std::endl;
     //#### Emit .h file ####
     std::ofstream headerFile;
-    headerFile.open(path + "/" + fileName + ".h", std::ofstream::out | std::ofstream::trunc);
+    headerFile.open(path+"/"+fileName+".h", std::ofstream::out | std::ofstream::trunc);
 
     std::string fileNameUpper =  GeneralHelper::toUpper(fileName);
-    headerFile << "#ifndef " << fileNameUpper << "_H" << std::endl;
-    headerFile << "#define " << fileNameUpper << "_H" << std::endl;
-    headerFile << std::endl;
-
-    headerFile << "#include <stdbool.h>" << std::endl;
-    headerFile << "#include <stdio.h>" << std::endl;
-    headerFile << std::endl;
-
-    headerFile << "bool isReadyForReading(FILE* file);" << std::endl;
-    headerFile << "bool isReadyForReadingFD(int fileFD);" << std::endl;
-    headerFile << "bool isReadyForWriting(FILE* file);" << std::endl;
-    headerFile << "bool isReadyForWritingFD(int fileFD);" << std::endl;
-    headerFile << std::endl;
 
-    headerFile << "#endif" << std::endl;
-    headerFile.close();
+    headerFile << "//\n"
+                  "// A lockless single producer, single consumer FIFO between processes using POSIX shared memory.\n"
+                  "// Provides the same interface as BerkeleySharedMemoryFIFO but does not use semaphores.\n"
+                  "//" << std::endl;
 
-    std::cout << "Emitting C File: " << path << "/" << fileName << ".c" << std::endl;
-    //#### Emit .c file ####
-    std::ofstream cFile;
-    cFile.open(path + "/" + fileName + ".c", std::ofstream::out | std::ofstream::trunc);
-    cFile << "#include \"" << fileName << ".h" << "\"" << std::endl;
-    cFile << std::endl;
+    headerFile << "#ifndef " << fileNameUpper << "_H" << std::endl;
+    headerFile << "#define " << fileNameUpper << "_H" << std::endl;
 
-    cFile << "#include <stdio.h>" << std::endl;
-    cFile << "#include <sys/select.h>" << std::endl;
-    cFile << "#include <sys/time.h>" << std::endl;
-    cFile << "#include <stdlib.h>" << std::endl;
-    cFile << std::endl;
-    cFile << "bool isReadyForReading(FILE* file) {" << std::endl;
-    cFile << "int fileFD = fileno(file);" << std::endl;
-    cFile << "return isReadyForReadingFD(fileFD);" << std::endl;
-    cFile << "}" << std::endl;
-    cFile << std::endl;
-    cFile << "bool isReadyForReadingFD(int fileFD){" << std::endl;
-    cFile << "fd_set fdSet;" << std::endl;
-    cFile << "FD_ZERO(&fdSet);" << std::endl;
-    cFile << "FD_SET(fileFD, &fdSet);" << std::endl;
-    cFile << "int maxFD = fileFD;" << std::endl;
-    cFile << std::endl;
-    cFile << "//Timeout quickly" << std::endl;
-    cFile << "struct timespec timeout;" << std::endl;
-    cFile << "timeout.tv_sec = 0;" << std::endl;
-    cFile << "timeout.tv_nsec = 0;" << std::endl;
-    cFile << std::endl;
-    cFile << "int selectStatus = pselect(maxFD+1, &fdSet, NULL, NULL, &timeout, NULL);" << std::endl;
-    cFile << "if(selectStatus == -1){" << std::endl;
-    cFile << "fprintf(stderr, \"Error while checking if a file is ready for reading\\n\");" << std::endl;
+    headerFile << "#ifndef _DEFAULT_SOURCE\n"
+                  "#define _DEFAULT_SOURCE\n"
+                  "#endif\n"
+                  "\n"
+                  "#include <stdatomic.h>\n"
+                  "#include <stdint.h>\n"
+                  "#include <stdbool.h>\n"
+                  "#include <stddef.h>\n"
+                  "\n"
+                  "//If 1, a thread which cannot make progress in readFifo/writeFifo sleeps on a futex after LOCKLESS_SHM_FIFO_SPIN_LIMIT\n"
+                  "//failed checks.  The peer only issues a futex wake if the thread has indicated that it is parked\n"
+                  "#ifndef LOCKLESS_SHM_FIFO_USE_FUTEX\n"
+                  "#define LOCKLESS_SHM_FIFO_USE_FUTEX " << (useFutex ? "1" : "0") << "\n"
+                  "#endif\n"
+                  "\n"
+                  "//If 1, the shared region is created on hugetlbfs (LOCKLESS_SHM_FIFO_HUGETLBFS_PATH).  If that fails, the region is\n"
+                  "//created with shm_open and transparent huge pages are requested with madvise\n"
+                  "#ifndef LOCKLESS_SHM_FIFO_HUGE_PAGES\n"
+                  "#define LOCKLESS_SHM_FIFO_HUGE_PAGES " << (hugePages ? "1" : "0") << "\n"
+                  "#endif\n"
+                  "\n"
+                  "#ifndef LOCKLESS_SHM_FIFO_HUGETLBFS_PATH\n"
+                  "#define LOCKLESS_SHM_FIFO_HUGETLBFS_PATH \"/dev/hugepages\"\n"
+                  "#endif\n"
+                  "\n"
+                  "#ifndef LOCKLESS_SHM_FIFO_HUGE_PAGE_SIZE\n"
+                  "#define LOCKLESS_SHM_FIFO_HUGE_PAGE_SIZE (2*1024*1024)\n"
+                  "#endif\n"
+                  "\n"
+                  "#ifndef LOCKLESS_SHM_FIFO_SPIN_LIMIT\n"
+                  "#define LOCKLESS_SHM_FIFO_SPIN_LIMIT 1000\n"
+                  "#endif\n"
+                  "\n"
+                  "//The maximum time (in ns) a thread sleeps on the futex before re-checking the FIFO\n"
+                  "#ifndef LOCKLESS_SHM_FIFO_PARK_TIMEOUT_NS\n"
+                  "#define LOCKLESS_SHM_FIFO_PARK_TIMEOUT_NS 1000000\n"
+                  "#endif\n"
+                  "\n"
+                  "#define LOCKLESS_SHM_FIFO_CACHE_LINE_SIZE 64\n"
+                  "#define LOCKLESS_SHM_FIFO_READY_MAGIC 0x4C534846\n"
+                  "\n"
+                  "//The control block at the start of the shared region.  The producer and consumer indexes reside in separate cache lines\n"
+                  "//so that updating one does not invalidate the other.  The indexes are free running byte counts (modulo 2^32).\n"
+                  "//Each parked flag resides in the cache line of the index the parked thread is waiting on so that the thread publishing\n"
+                  "//that index checks it without an additional cache line transfer.\n"
+                  "typedef struct{\n"
+                  "    //---- Written during setup ----\n"
+                  "    _Alignas(LOCKLESS_SHM_FIFO_CACHE_LINE_SIZE) _Atomic uint32_t ready;\n"
+                  "    _Atomic uint32_t consumerJoined;\n"
+                  "    uint32_t fifoSizeBytes;\n"
+                  "\n"
+                  "    //---- Written by the producer ----\n"
+                  "    _Alignas(LOCKLESS_SHM_FIFO_CACHE_LINE_SIZE) _Atomic uint32_t writeIndex;\n"
+                  "    _Atomic uint32_t producerClosed;\n"
+                  "    _Atomic uint32_t consumerParked; //Set by the consumer while sleeping on writeIndex\n"
+                  "\n"
+                  "    //---- Written by the consumer ----\n"
+                  "    _Alignas(LOCKLESS_SHM_FIFO_CACHE_LINE_SIZE) _Atomic uint32_t readIndex;\n"
+                  "    _Atomic uint32_t producerParked; //Set by the producer while sleeping on readIndex\n"
+                  "} sharedMemoryFIFOControl_t;\n"
+                  "\n"
+                  "typedef struct{\n"
+                  "    char *sharedName;\n"
+                  "    char *hugePagePath; //Path of the region on hugetlbfs (NULL if created with shm_open)\n"
+                  "    int sharedFD;\n"
+                  "    sharedMemoryFIFOControl_t* control;\n"
+                  "    void* fifoBlock;\n"
+                  "    void* fifoBuffer;\n"
+                  "    size_t fifoSizeBytes;\n"
+                  "    size_t fifoSharedBlockSizeBytes;\n"
+                  "    size_t currentOffset;\n"
+                  "    uint32_t localIndex; //This side's index.  Authoritative copy, only published after a read/write completes\n"
+                  "    uint32_t peerIndexCached; //The last observed index of the other side.  Only re-loaded when the FIFO appears full/empty\n"
+                  "    bool rxReady;\n"
+                  "} sharedMemoryFIFO_t;\n"
+                  "\n"
+                  "void initSharedMemoryFIFO(sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "int producerOpenInitFIFO(char *sharedName, size_t fifoSizeBytes, sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "int consumerOpenFIFOBlock(char *sharedName, size_t fifoSizeBytes, sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "//NOTE: this function blocks until numElements can be written into the FIFO\n"
+                  "int writeFifo(void* src, size_t elementSize, int numElements, sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "//NOTE: this function blocks until numElements can be read from the FIFO.  Returns 0 if the producer closed the FIFO\n"
+                  "//before numElements were available\n"
+                  "int readFifo(void* dst, size_t elementSize, int numElements, sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "//Marks the FIFO as closed (so that the consumer can detect the end of the stream) and unlinks the shared region\n"
+                  "void cleanupProducer(sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "void cleanupConsumer(sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "//Returns true if data is available or the producer closed the FIFO\n"
+                  "bool isReadyForReading(sharedMemoryFIFO_t *fifo);\n"
+                  "\n"
+                  "bool isReadyForWriting(sharedMemoryFIFO_t *fifo);" << std::endl;
+    headerFile << "#endif" << std::endl;
+    headerFile.close();
+
+    std::cout << "Emitting C File: " << path << "/" << fileName << ".c" << std::endl;
+    //#### Emit .c file ####
+    std::ofstream cFile;
+    cFile.open(path+"/"+fileName+".c", std::ofstream::out | std::ofstream::trunc);
+
+    cFile << "#include \"" + fileName + ".h\"" << std::endl;
+    cFile << "#include <stdio.h>\n"
+             "#include <stdlib.h>\n"
+             "#include <string.h>\n"
+             "#include <errno.h>\n"
+             "#include <fcntl.h>\n"
+             "#include <time.h>\n"
+             "#include <unistd.h>\n"
+             "#include <sys/types.h>\n"
+             "#include <sys/stat.h>\n"
+             "#include <sys/mman.h>\n"
+             "#include <sys/syscall.h>\n"
+             "#include <linux/futex.h>\n"
+             "\n"
+             "static void waitShort(){\n"
+             "    struct timespec sleepTime = {0, 1000000};\n"
+             "    nanosleep(&sleepTime, NULL);\n"
+             "}\n"
+             "\n"
+             "#if LOCKLESS_SHM_FIFO_USE_FUTEX\n"
+             "static void parkOnIndex(_Atomic uint32_t *index, uint32_t observed){\n"
+             "    //Returns immediately if the index no longer matches the observed value.  Not FUTEX_PRIVATE since the word is shared\n"
+             "    //between processes.  The timeout bounds the wait if the peer exits while this thread is parked\n"
+             "    struct timespec timeout = {0, LOCKLESS_SHM_FIFO_PARK_TIMEOUT_NS};\n"
+             "    syscall(SYS_futex, (uint32_t*) index, FUTEX_WAIT, observed, &timeout, NULL, 0);\n"
+             "}\n"
+             "#endif\n"
+             "\n"
+             "static void publishIndex(_Atomic uint32_t *index, uint32_t val, _Atomic uint32_t *peerParked){\n"
+             "    atomic_store_explicit(index, val, memory_order_release);\n"
+             "#if LOCKLESS_SHM_FIFO_USE_FUTEX\n"
+             "    //Orders the index store before the parked flag load (paired with the fence in the parking thread)\n"
+             "    atomic_thread_fence(memory_order_seq_cst);\n"
+             "    if(atomic_load_explicit(peerParked, memory_order_relaxed)){\n"
+             "        syscall(SYS_futex, (uint32_t*) index, FUTEX_WAKE, 1, NULL, NULL, 0);\n"
+             "    }\n"
+             "#else\n"
+             "    (void) peerParked;\n"
+             "#endif\n"
+             "}\n"
+             "\n"
+             "static size_t sharedBlockSizeFor(size_t fifoSizeBytes){\n"
+             "    size_t sharedBlockSize = sizeof(sharedMemoryFIFOControl_t) + fifoSizeBytes;\n"
+             "#if LOCKLESS_SHM_FIFO_HUGE_PAGES\n"
+             "    //Huge page backed regions must be a multiple of the huge page size\n"
+             "    sharedBlockSize = ((sharedBlockSize + LOCKLESS_SHM_FIFO_HUGE_PAGE_SIZE - 1)/LOCKLESS_SHM_FIFO_HUGE_PAGE_SIZE)*LOCKLESS_SHM_FIFO_HUGE_PAGE_SIZE;\n"
+             "#endif\n"
+             "    return sharedBlockSize;\n"
+             "}\n"
+             "\n"
+             "#if LOCKLESS_SHM_FIFO_HUGE_PAGES\n"
+             "static char* hugePagePathFor(char *sharedName){\n"
+             "    const char* dir = LOCKLESS_SHM_FIFO_HUGETLBFS_PATH;\n"
+             "    char* path = malloc(strlen(dir) + strlen(sharedName) + 2);\n"
+             "    strcpy(path, dir);\n"
+             "    strcat(path, \"/\");\n"
+             "    strcat(path, sharedName);\n"
+             "    return path;\n"
+             "}\n"
+             "#endif\n"
+             "\n"
+             "//Opens (or creates) the shared region.  Huge page backed regions on hugetlbfs are tried first\n"
+             "static int openSharedRegion(sharedMemoryFIFO_t *fifo, bool create){\n"
+             "#if LOCKLESS_SHM_FIFO_HUGE_PAGES\n"
+             "    char *hugePath = hugePagePathFor(fifo->sharedName);\n"
+             "    if(create){\n"
+             "        unlink(hugePath); //Remove any stale region from a previous run\n"
+             "    }\n"
+             "    int hugeFD = open(hugePath, create ? O_CREAT | O_EXCL | O_RDWR : O_RDWR, S_IRUSR | S_IWUSR);\n"
+             "    if(hugeFD != -1){\n"
+             "        fifo->hugePagePath = hugePath;\n"
+             "        return hugeFD;\n"
+             "    }\n"
+             "    if(create){\n"
+             "        printf(\"Unable to create huge page backed FIFO %s, falling back to shm_open with transparent huge pages\\n\", hugePath);\n"
+             "    }\n"
+             "    free(hugePath);\n"
+             "#endif\n"
+             "    if(create){\n"
+             "        shm_unlink(fifo->sharedName); //Remove any stale region from a previous run\n"
+             "        return shm_open(fifo->sharedName, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);\n"
+             "    }\n"
+             "    return shm_open(fifo->sharedName, O_RDWR, S_IRUSR | S_IWUSR);\n"
+             "}\n"
+             "\n"
+             "static void mapSharedRegion(sharedMemoryFIFO_t *fifo){\n"
+             "    fifo->fifoBlock = mmap(NULL, fifo->fifoSharedBlockSizeBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fifo->sharedFD, 0);\n"
+             "    if(fifo->fifoBlock == MAP_FAILED){\n"
+             "        fifo->fifoBlock = NULL;\n"
+             "        printf(\"FIFO mmap failed\\n\");\n"
+             "        perror(NULL);\n"
+             "        exit(1);\n"
+             "    }\n"
+             "#if LOCKLESS_SHM_FIFO_HUGE_PAGES && defined(MADV_HUGEPAGE)\n"
+             "    if(fifo->hugePagePath == NULL){\n"
+             "        //Only has an effect if /sys/kernel/mm/transparent_hugepage/shmem_enabled allows it\n"
+             "        madvise(fifo->fifoBlock, fifo->fifoSharedBlockSizeBytes, MADV_HUGEPAGE);\n"
+             "    }\n"
+             "#endif\n"
+             "\n"
+             "    fifo->control = (sharedMemoryFIFOControl_t*) fifo->fifoBlock;\n"
+             "    //The control block is a multiple of the cache line size so the buffer starts on a new cache line\n"
+             "    fifo->fifoBuffer = (void*) (((char*) fifo->fifoBlock) + sizeof(sharedMemoryFIFOControl_t));\n"
+             "}\n"
+             "\n"
+             "void initSharedMemoryFIFO(sharedMemoryFIFO_t *fifo){\n"
+             "    fifo->sharedName = NULL;\n"
+             "    fifo->hugePagePath = NULL;\n"
+             "    fifo->sharedFD = -1;\n"
+             "    fifo->control = NULL;\n"
+             "    fifo->fifoBlock = NULL;\n"
+             "    fifo->fifoBuffer = NULL;\n"
+             "    fifo->fifoSizeBytes = 0;\n"
+             "    fifo->fifoSharedBlockSizeBytes = 0;\n"
+             "    fifo->currentOffset = 0;\n"
+             "    fifo->localIndex = 0;\n"
+             "    fifo->peerIndexCached = 0;\n"
+             "    fifo->rxReady = false;\n"
+             "}\n"
+             "\n"
+             "int producerOpenInitFIFO(char *sharedName, size_t fifoSizeBytes, sharedMemoryFIFO_t *fifo){\n"
+             "    if(fifoSizeBytes == 0 || fifoSizeBytes > INT32_MAX){\n"
+             "        printf(\"Shared memory FIFO size must be between 1 and 2^31-1 bytes\\n\");\n"
+             "        exit(1);\n"
+             "    }\n"
+             "\n"
+             "    fifo->sharedName = sharedName;\n"
+             "    fifo->fifoSizeBytes = fifoSizeBytes;\n"
+             "    fifo->fifoSharedBlockSizeBytes = sharedBlockSizeFor(fifoSizeBytes);\n"
+             "\n"
+             "    fifo->sharedFD = openSharedRegion(fifo, true);\n"
+             "    if(fifo->sharedFD == -1){\n"
+             "        printf(\"Unable to create tx shm\\n\");\n"
+             "        perror(NULL);\n"
+             "        exit(1);\n"
+             "    }\n"
+             "\n"
+             "    //The new region is zero filled so ready is not set until initialization completes\n"
+             "    int status = ftruncate(fifo->sharedFD, fifo->fifoSharedBlockSizeBytes);\n"
+             "    if(status == -1){\n"
+             "        printf(\"Unable to resize tx fifo\\n\");\n"
+             "        perror(NULL);\n"
+             "        exit(1);\n"
+             "    }\n"
+             "\n"
+             "    mapSharedRegion(fifo);\n"
+             "\n"
+             "    sharedMemoryFIFOControl_t *control = fifo->control;\n"
+             "    control->fifoSizeBytes = fifoSizeBytes;\n"
+             "    atomic_store_explicit(&control->consumerJoined, 0, memory_order_relaxed);\n"
+             "    atomic_store_explicit(&control->writeIndex, 0, memory_order_relaxed);\n"
+             "    atomic_store_explicit(&control->producerClosed, 0, memory_order_relaxed);\n"
+             "    atomic_store_explicit(&control->consumerParked, 0, memory_order_relaxed);\n"
+             "    atomic_store_explicit(&control->readIndex, 0, memory_order_relaxed);\n"
+             "    atomic_store_explicit(&control->producerParked, 0, memory_order_relaxed);\n"
+             "\n"
+             "    //FIFO init done, release the initialized control block to the consumer\n"
+             "    atomic_store_explicit(&control->ready, LOCKLESS_SHM_FIFO_READY_MAGIC, memory_order_release);\n"
+             "\n"
+             "    return fifo->fifoSharedBlockSizeBytes;\n"
+             "}\n"
+             "\n"
+             "int consumerOpenFIFOBlock(char *sharedName, size_t fifoSizeBytes, sharedMemoryFIFO_t *fifo){\n"
+             "    fifo->sharedName = sharedName;\n"
+             "    fifo->fifoSizeBytes = fifoSizeBytes;\n"
+             "    fifo->fifoSharedBlockSizeBytes = sharedBlockSizeFor(fifoSizeBytes);\n"
+             "\n"
+             "    //---- Wait for the producer to create the shared region ----\n"
+             "    while((fifo->sharedFD = openSharedRegion(fifo, false)) == -1){\n"
+             "        if(errno != ENOENT){\n"
+             "            printf(\"Unable to open rx shm\\n\");\n"
+             "            perror(NULL);\n"
+             "            exit(1);\n"
+             "        }\n"
+             "        waitShort();\n"
+             "    }\n"
+             "\n"
+             "    //---- Wait for the producer to size the region (mapping beyond the end of the object would fault) ----\n"
+             "    struct stat sharedStat;\n"
+             "    while(true){\n"
+             "        if(fstat(fifo->sharedFD, &sharedStat) == -1){\n"
+             "            printf(\"Unable to stat rx shm\\n\");\n"
+             "            perror(NULL);\n"
+             "            exit(1);\n"
+             "        }\n"
+             "        if(sharedStat.st_size >= (off_t) fifo->fifoSharedBlockSizeBytes){\n"
+             "            break;\n"
+             "        }\n"
+             "        waitShort();\n"
+             "    }\n"
+             "\n"
+             "    mapSharedRegion(fifo);\n"
+             "\n"
+             "    //---- Wait for the producer to finish initializing the control block ----\n"
+             "    while(atomic_load_explicit(&fifo->control->ready, memory_order_acquire) != LOCKLESS_SHM_FIFO_READY_MAGIC){\n"
+             "        waitShort();\n"
+             "    }\n"
+             "\n"
+             "    if(fifo->control->fifoSizeBytes != fifoSizeBytes){\n"
+             "        printf(\"Shared memory FIFO size mismatch between producer and consumer\\n\");\n"
+             "        exit(1);\n"
+             "    }\n"
+             "\n"
+             "    //Inform producer that consumer is ready\n"
+             "    atomic_store_explicit(&fifo->control->consumerJoined, 1, memory_order_release);\n"
+             "\n"
+             "    return fifo->fifoSharedBlockSizeBytes;\n"
+             "}\n"
+             "\n"
+             "static bool waitForConsumer(sharedMemoryFIFO_t *fifo){\n"
+             "    if(!fifo->rxReady){\n"
+             "        fifo->rxReady = atomic_load_explicit(&fifo->control->consumerJoined, memory_order_acquire) != 0;\n"
+             "    }\n"
+             "    return fifo->rxReady;\n"
+             "}\n"
+             "\n"
+             "//currentOffset is in bytes\n"
+             "//fifosize is in bytes\n"
+             "//localIndex and peerIndexCached are free running byte counts\n"
+             "\n"
+             "//returns number of elements written\n"
+             "int writeFifo(void* src_uncast, size_t elementSize, int numElements, sharedMemoryFIFO_t *fifo){\n"
+             "    char* dst = (char*) fifo->fifoBuffer;\n"
+             "    char* src = (char*) src_uncast;\n"
+             "    sharedMemoryFIFOControl_t *control = fifo->control;\n"
+             "\n"
+             "    size_t bytesToWrite = elementSize*numElements;\n"
+             "    if(bytesToWrite > fifo->fifoSizeBytes){\n"
+             "        printf(\"Write is larger than the shared memory FIFO\\n\");\n"
+             "        exit(1);\n"
+             "    }\n"
+             "\n"
+             "    //---- Wait for consumer to join ---\n"
+             "    while(!waitForConsumer(fifo)){\n"
+             "        waitShort();\n"
+             "    }\n"
+             "\n"
+             "    //Only re-load the consumer's index if the cached copy indicates there is not enough room\n"
+             "#if LOCKLESS_SHM_FIFO_USE_FUTEX\n"
+             "    int spins = 0;\n"
+             "#endif\n"
+             "    while(fifo->fifoSizeBytes - (uint32_t) (fifo->localIndex - fifo->peerIndexCached) < bytesToWrite){\n"
+             "        fifo->peerIndexCached = atomic_load_explicit(&control->readIndex, memory_order_acquire);\n"
+             "#if LOCKLESS_SHM_FIFO_USE_FUTEX\n"
+             "        if(fifo->fifoSizeBytes - (uint32_t) (fifo->localIndex - fifo->peerIndexCached) >= bytesToWrite){\n"
+             "            break;\n"
+             "        }\n"
+             "        if(spins < LOCKLESS_SHM_FIFO_SPIN_LIMIT){\n"
+             "            spins++;\n"
+             "        }else{\n"
+             "            atomic_store_explicit(&control->producerParked, 1, memory_order_relaxed);\n"
+             "            atomic_thread_fence(memory_order_seq_cst);\n"
+             "            uint32_t observed = atomic_load_explicit(&control->readIndex, memory_order_relaxed);\n"
+             "            if(observed == fifo->peerIndexCached){\n"
+             "                parkOnIndex(&control->readIndex, observed);\n"
+             "            }\n"
+             "            atomic_store_explicit(&control->producerParked, 0, memory_order_relaxed);\n"
+             "            spins = 0;\n"
+             "        }\n"
+             "#endif\n"
+             "    }\n"
+             "\n"
+             "    //There is room in the FIFO, write into it\n"
+             "    //Write up to the end of the buffer, wrap around if nessisary\n"
+             "    size_t currentOffsetLocal = fifo->currentOffset;\n"
+             "    size_t bytesToEnd = fifo->fifoSizeBytes - currentOffsetLocal;\n"
+             "    size_t bytesToTransferFirst = bytesToEnd < bytesToWrite ? bytesToEnd : bytesToWrite;\n"
+             "    memcpy(dst+currentOffsetLocal, src, bytesToTransferFirst);\n"
+             "    currentOffsetLocal += bytesToTransferFirst;\n"
+             "    if(currentOffsetLocal >= fifo->fifoSizeBytes){\n"
+             "        //Wrap around\n"
+             "        currentOffsetLocal = 0;\n"
+             "\n"
+             "        //Write remaining (if any)\n"
+             "        size_t remainingBytesToTransfer = bytesToWrite - bytesToTransferFirst;\n"
+             "        if(remainingBytesToTransfer>0){\n"
+             "            memcpy(dst, src+bytesToTransferFirst, remainingBytesToTransfer);\n"
+             "            currentOffsetLocal+=remainingBytesToTransfer;\n"
+             "        }\n"
+             "    }\n"
+             "\n"
+             "    //Update the current offset\n"
+             "    fifo->currentOffset = currentOffsetLocal;\n"
+             "\n"
+             "    //Publish the write index (release orders the data before it)\n"
+             "    fifo->localIndex += bytesToWrite;\n"
+             "    publishIndex(&control->writeIndex, fifo->localIndex, &control->consumerParked);\n"
+             "\n"
+             "    return numElements;\n"
+             "}\n"
+             "\n"
+             "int readFifo(void* dst_uncast, size_t elementSize, int numElements, sharedMemoryFIFO_t *fifo){\n"
+             "    char* dst = (char*) dst_uncast;\n"
+             "    char* src = (char*) fifo->fifoBuffer;\n"
+             "    sharedMemoryFIFOControl_t *control = fifo->control;\n"
+             "\n"
+             "    size_t bytesToRead = elementSize*numElements;\n"
+             "\n"
+             "    //Only re-load the producer's index if the cached copy indicates there is not enough data\n"
+             "#if LOCKLESS_SHM_FIFO_USE_FUTEX\n"
+             "    int spins = 0;\n"
+             "#endif\n"
+             "    while((uint32_t) (fifo->peerIndexCached - fifo->localIndex) < bytesToRead){\n"
+             "        //Check closed before re-loading the index.  Since the producer closes after publishing its final index, a\n"
+             "        //closed FIFO without enough data after the re-load will never have enough data\n"
+             "        bool closed = atomic_load_explicit(&control->producerClosed, memory_order_acquire) != 0;\n"
+             "        fifo->peerIndexCached = atomic_load_explicit(&control->writeIndex, memory_order_acquire);\n"
+             "        if((uint32_t) (fifo->peerIndexCached - fifo->localIndex) >= bytesToRead){\n"
+             "            break;\n"
+             "        }\n"
+             "        if(closed){\n"
+             "            return 0;\n"
+             "        }\n"
+             "#if LOCKLESS_SHM_FIFO_USE_FUTEX\n"
+             "        if(spins < LOCKLESS_SHM_FIFO_SPIN_LIMIT){\n"
+             "            spins++;\n"
+             "        }else{\n"
+             "            atomic_store_explicit(&control->consumerParked, 1, memory_order_relaxed);\n"
+             "            atomic_thread_fence(memory_order_seq_cst);\n"
+             "            uint32_t observed = atomic_load_explicit(&control->writeIndex, memory_order_relaxed);\n"
+             "            if(observed == fifo->peerIndexCached){\n"
+             "                parkOnIndex(&control->writeIndex, observed);\n"
+             "            }\n"
+             "            atomic_store_explicit(&control->consumerParked, 0, memory_order_relaxed);\n"
+             "            spins = 0;\n"
+             "        }\n"
+             "#endif\n"
+             "    }\n"
+             "\n"
+             "    //There is enough data in the fifo to complete a read operation\n"
+             "    //Read up to the end of the buffer and wrap if nessisary\n"
+             "    size_t currentOffsetLocal = fifo->currentOffset;\n"
+             "    size_t bytesToEnd = fifo->fifoSizeBytes - currentOffsetLocal;\n"
+             "    size_t bytesToTransferFirst = bytesToEnd < bytesToRead ? bytesToEnd : bytesToRead;\n"
+             "    memcpy(dst, src+currentOffsetLocal, bytesToTransferFirst);\n"
+             "    currentOffsetLocal += bytesToTransferFirst;\n"
+             "    if(currentOffsetLocal >= fifo->fifoSizeBytes){\n"
+             "        //Wrap around\n"
+             "        currentOffsetLocal = 0;\n"
+             "\n"
+             "        //Read remaining (if any)\n"
+             "        size_t remainingBytesToTransfer = bytesToRead - bytesToTransferFirst;\n"
+             "        if(remainingBytesToTransfer>0){\n"
+             "            memcpy(dst+bytesToTransferFirst, src, remainingBytesToTransfer);\n"
+             "            currentOffsetLocal+=remainingBytesToTransfer;\n"
+             "        }\n"
+             "    }\n"
+             "\n"
+             "    //Update the current offset\n"
+             "    fifo->currentOffset = currentOffsetLocal;\n"
+             "\n"
+             "    //Publish the read index (release orders the reads of the data before the space is returned to the producer)\n"
+             "    fifo->localIndex += bytesToRead;\n"
+             "    publishIndex(&control->readIndex, fifo->localIndex, &control->producerParked);\n"
+             "\n"
+             "    return numElements;\n"
+             "}\n"
+             "\n"
+             "static void cleanupHelper(sharedMemoryFIFO_t *fifo){\n"
+             "    if(fifo->fifoBlock != NULL) {\n"
+             "        int status = munmap(fifo->fifoBlock, fifo->fifoSharedBlockSizeBytes);\n"
+             "        if (status == -1) {\n"
+             "            printf(\"Error in fifo munmap\\n\");\n"
+             "            perror(NULL);\n"
+             "        }\n"
+             "        fifo->fifoBlock = NULL;\n"
+             "        fifo->control = NULL;\n"
+             "        fifo->fifoBuffer = NULL;\n"
+             "    }\n"
+             "\n"
+             "    if(fifo->sharedFD != -1) {\n"
+             "        close(fifo->sharedFD);\n"
+             "        fifo->sharedFD = -1;\n"
+             "    }\n"
+             "}\n"
+             "\n"
+             "void cleanupProducer(sharedMemoryFIFO_t *fifo){\n"
+             "    bool unlinkSharedBlock = fifo->fifoBlock != NULL;\n"
+             "\n"
+             "    if(fifo->control != NULL){\n"
+             "        //Signal the end of the stream.  The consumer may be parked waiting for data which will never arrive\n"
+             "        atomic_store_explicit(&fifo->control->producerClosed, 1, memory_order_release);\n"
+             "        publishIndex(&fifo->control->writeIndex, fifo->localIndex, &fifo->control->consumerParked);\n"
+             "    }\n"
+             "\n"
+             "    cleanupHelper(fifo);\n"
+             "\n"
+             "    //The consumer retains its mapping after the region is unlinked\n"
+             "    if(unlinkSharedBlock) {\n"
+             "        int status = fifo->hugePagePath != NULL ? unlink(fifo->hugePagePath) : shm_unlink(fifo->sharedName);\n"
+             "        if (status == -1) {\n"
+             "            printf(\"Error in tx fifo unlink\\n\");\n"
+             "            perror(NULL);\n"
+             "        }\n"
+             "    }\n"
+             "\n"
+             "    if(fifo->hugePagePath != NULL){\n"
+             "        free(fifo->hugePagePath);\n"
+             "        fifo->hugePagePath = NULL;\n"
+             "    }\n"
+             "}\n"
+             "\n"
+             "void cleanupConsumer(sharedMemoryFIFO_t *fifo) {\n"
+             "    cleanupHelper(fifo);\n"
+             "\n"
+             "    if(fifo->hugePagePath != NULL){\n"
+             "        free(fifo->hugePagePath);\n"
+             "        fifo->hugePagePath = NULL;\n"
+             "    }\n"
+             "}\n"
+             "\n"
+             "bool isReadyForReading(sharedMemoryFIFO_t *fifo){\n"
+             "    if(fifo->peerIndexCached != fifo->localIndex){\n"
+             "        return true;\n"
+             "    }\n"
+             "    fifo->peerIndexCached = atomic_load_explicit(&fifo->control->writeIndex, memory_order_acquire);\n"
+             "    return fifo->peerIndexCached != fifo->localIndex ||\n"
+             "           atomic_load_explicit(&fifo->control->producerClosed, memory_order_acquire) != 0;\n"
+             "}\n"
+             "\n"
+             "bool isReadyForWriting(sharedMemoryFIFO_t *fifo){\n"
+             "    if(!waitForConsumer(fifo)) {\n"
+             "        //Consumer has not joined yet\n"
+             "        return false;\n"
+             "    }\n"
+             "\n"
+             "    if((uint32_t) (fifo->localIndex - fifo->peerIndexCached) < fifo->fifoSizeBytes){\n"
+             "        return true;\n"
+             "    }\n"
+             "    fifo->peerIndexCached = atomic_load_explicit(&fifo->control->readIndex, memory_order_acquire);\n"
+             "    return (uint32_t) (fifo->localIndex - fifo->peerIndexCached) < fifo->fifoSizeBytes;\n"
+             "}" << std::endl;
+
+    cFile.close();
+
+    return fileName+".h";
+}
+
+std::string StreamIOThread::emitFileStreamHelpers(std::string path, std::string fileNamePrefix){
+    std::string fileName = fileNamePrefix + "_filestream_helpers";
+    std::cout << "Emitting C File: " << path << "/" << fileName << ".h" << std::endl;
+    //#### Emit .h file ####
+    std::ofstream headerFile;
+    headerFile.open(path + "/" + fileName + ".h", std::ofstream::out | std::ofstream::trunc);
+
+    std::string fileNameUpper =  GeneralHelper::toUpper(fileName);
+    headerFile << "#ifndef " << fileNameUpper << "_H" << std::endl;
+    headerFile << "#define " << fileNameUpper << "_H" << std::endl;
+    headerFile << std::endl;
+
+    headerFile << "#include <stdbool.h>" << std::endl;
+    headerFile << "#include <stdio.h>" << std::endl;
+    headerFile << std::endl;
+
+    headerFile << "bool isReadyForReading(FILE* file);" << std::endl;
+    headerFile << "bool isReadyForReadingFD(int fileFD);" << std::endl;
+    headerFile << "bool isReadyForWriting(FILE* file);" << std::endl;
+    headerFile << "bool isReadyForWritingFD(int fileFD);" << std::endl;
+    headerFile << std::endl;
+
+    headerFile << "#endif" << std::endl;
+    headerFile.close();
+
+    std::cout << "Emitting C File: " << path << "/" << fileName << ".c" << std::endl;
+    //#### Emit .c file ####
+    std::ofstream cFile;
+    cFile.open(path + "/" + fileName + ".c", std::ofstream::out | std::ofstream::trunc);
+    cFile << "#include \"" << fileName << ".h" << "\"" << std::endl;
+    cFile << std::endl;
+
+    cFile << "#include <stdio.h>" << std::endl;
+    cFile << "#include <sys/select.h>" << std::endl;
+    cFile << "#include <sys/time.h>" << std::endl;
+    cFile << "#include <stdlib.h>" << std::endl;
+    cFile << std::endl;
+    cFile << "bool isReadyForReading(FILE* file) {" << std::endl;
+    cFile << "int fileFD = fileno(file);" << std::endl;
+    cFile << "return isReadyForReadingFD(fileFD);" << std::endl;
+    cFile << "}" << std::endl;
+    cFile << std::endl;
+    cFile << "bool isReadyForReadingFD(int fileFD){" << std::endl;
+    cFile << "fd_set fdSet;" << std::endl;
+    cFile << "FD_ZERO(&fdSet);" << std::endl;
+    cFile << "FD_SET(fileFD, &fdSet);" << std::endl;
+    cFile << "int maxFD = fileFD;" << std::endl;
+    cFile << std::endl;
+    cFile << "//Timeout quickly" << std::endl;
+    cFile << "struct timespec timeout;" << std::endl;
+    cFile << "timeout.tv_sec = 0;" << std::endl;
+    cFile << "timeout.tv_nsec = 0;" << std::endl;
+    cFile << std::endl;
+    cFile << "int selectStatus = pselect(maxFD+1, &fdSet, NULL, NULL, &timeout, NULL);" << std::endl;
+    cFile << "if(selectStatus == -1){" << std::endl;
+    cFile << "fprintf(stderr, \"Error while checking if a file is ready for reading\\n\");" << std::endl;
     cFile << "perror(NULL);" << std::endl;
     cFile << "exit(1);" << std::endl;
     cFile << "}" << std::endl;
@@ -2314,4 +3360,393 @@ std::string StreamIOThread::emitFileStreamHelpers(std::string path, std::string
     cFile.close();
 
     return fileName+".h";
-}
\ No newline at end of file
+}
+
+void StreamIOThread::emitIOUringQueueRead(std::ofstream &ioThread, std::string designName, int bundle){
+    std::string bundleStr = GeneralHelper::to_string(bundle);
+    std::string inputStructTypeName = designName+"_inputs_bundle_"+bundleStr+"_t";
+    std::string bufName = "ioUringInputBuf_bundle_"+bundleStr;
+    std::string bytesName = "ioUringInputBytes_bundle_"+bundleStr;
+    std::string rdName = "ioUringInputRd_bundle_"+bundleStr;
+    std::string inFlightName = "ioUringInputInFlight_bundle_"+bundleStr;
+    std::string eofName = "ioUringInputEOF_bundle_"+bundleStr;
+    std::string bufIdxName = "ioUringInputBufIdx_bundle_"+bundleStr;
+    std::string fdName = "inputFD_bundle_"+bundleStr;
+
+    ioThread << "//Queue a read into the free space of the receive buffer" << std::endl;
+    ioThread << "if(!" << inFlightName << " && !" << eofName << "){" << std::endl;
+    ioThread << "uint64_t capacityBytes = sizeof(" << inputStructTypeName << ")*VITIS_IO_URING_BLOCKS;" << std::endl;
+    ioThread << "uint64_t freeBytes = capacityBytes - (" << bytesName << " - " << rdName << "*sizeof(" << inputStructTypeName << "));" << std::endl;
+    ioThread << "if(freeBytes > 0){" << std::endl;
+    ioThread << "uint64_t writePos = " << bytesName << " % capacityBytes;" << std::endl;
+    ioThread << "uint64_t readLen = capacityBytes - writePos < freeBytes ? capacityBytes - writePos : freeBytes;" << std::endl;
+    ioThread << "struct io_uring_sqe *sqe = io_uring_get_sqe(&ioRing); //The ring has an entry for each bundle so this does not fail" << std::endl;
+    ioThread << "if(ioUringFixedBuffers){" << std::endl;
+    ioThread << "io_uring_prep_read_fixed(sqe, " << fdName << ", ((char*) " << bufName << ")+writePos, readLen, 0, " << bufIdxName << ");" << std::endl;
+    ioThread << "}else{" << std::endl;
+    ioThread << "io_uring_prep_read(sqe, " << fdName << ", ((char*) " << bufName << ")+writePos, readLen, 0);" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "io_uring_sqe_set_data(sqe, (void*) (uintptr_t) " << 2*bundle << ");" << std::endl;
+    ioThread << inFlightName << " = true;" << std::endl;
+    ioThread << "ioUringSubmitPending = true;" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+}
+
+void StreamIOThread::emitIOUringQueueWrite(std::ofstream &ioThread, std::string designName, int bundle){
+    std::string bundleStr = GeneralHelper::to_string(bundle);
+    std::string outputStructTypeName = designName+"_outputs_bundle_"+bundleStr+"_t";
+    std::string bufName = "ioUringOutputBuf_bundle_"+bundleStr;
+    std::string bytesName = "ioUringOutputBytes_bundle_"+bundleStr;
+    std::string wrName = "ioUringOutputWr_bundle_"+bundleStr;
+    std::string inFlightName = "ioUringOutputInFlight_bundle_"+bundleStr;
+    std::string bufIdxName = "ioUringOutputBufIdx_bundle_"+bundleStr;
+    std::string fdName = "outputFD_bundle_"+bundleStr;
+
+    ioThread << "//Queue a write of the pending blocks in the transmit buffer" << std::endl;
+    ioThread << "if(!" << inFlightName << "){" << std::endl;
+    ioThread << "uint64_t pendingBytes = " << wrName << "*sizeof(" << outputStructTypeName << ") - " << bytesName << ";" << std::endl;
+    ioThread << "if(pendingBytes > 0){" << std::endl;
+    ioThread << "uint64_t capacityBytes = sizeof(" << outputStructTypeName << ")*VITIS_IO_URING_BLOCKS;" << std::endl;
+    ioThread << "uint64_t readPos = " << bytesName << " % capacityBytes;" << std::endl;
+    ioThread << "uint64_t writeLen = capacityBytes - readPos < pendingBytes ? capacityBytes - readPos : pendingBytes;" << std::endl;
+    ioThread << "struct io_uring_sqe *sqe = io_uring_get_sqe(&ioRing); //The ring has an entry for each bundle so this does not fail" << std::endl;
+    ioThread << "if(ioUringFixedBuffers){" << std::endl;
+    ioThread << "io_uring_prep_write_fixed(sqe, " << fdName << ", ((char*) " << bufName << ")+readPos, writeLen, 0, " << bufIdxName << ");" << std::endl;
+    ioThread << "}else{" << std::endl;
+    ioThread << "io_uring_prep_write(sqe, " << fdName << ", ((char*) " << bufName << ")+readPos, writeLen, 0);" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "io_uring_sqe_set_data(sqe, (void*) (uintptr_t) " << 2*bundle+1 << ");" << std::endl;
+    ioThread << inFlightName << " = true;" << std::endl;
+    ioThread << "ioUringSubmitPending = true;" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+}
+
+void StreamIOThread::emitIOUringProcessCompletions(std::ofstream &ioThread,
+                                                   const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterInputBundles,
+                                                   const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterOutputBundles,
+                                                   bool wait, bool trackProgress){
+    ioThread << "//Process io_uring completions" << std::endl;
+    ioThread << "{" << std::endl;
+    ioThread << "struct io_uring_cqe *cqe;" << std::endl;
+    if(wait){
+        ioThread << "int cqeStatus = io_uring_wait_cqe(&ioRing, &cqe);" << std::endl;
+    }else{
+        ioThread << "int cqeStatus = io_uring_peek_cqe(&ioRing, &cqe);" << std::endl;
+    }
+    ioThread << "while(cqeStatus == 0){" << std::endl;
+    ioThread << "uint64_t tag = (uint64_t) (uintptr_t) io_uring_cqe_get_data(cqe);" << std::endl;
+    ioThread << "int res = cqe->res;" << std::endl;
+    ioThread << "io_uring_cqe_seen(&ioRing, cqe);" << std::endl;
+    ioThread << "if(res < 0 && res != -EAGAIN && res != -EINTR){" << std::endl;
+    ioThread << "printf(\"An error was encountered while accessing a Linux Pipe using io_uring: %s\\n\", strerror(-res));" << std::endl;
+    ioThread << "exit(1);" << std::endl;
+    ioThread << "}" << std::endl;
+    if(trackProgress){
+        ioThread << "ioThreadProgress = true;" << std::endl;
+    }
+
+    //Requests interrupted with EAGAIN or EINTR are re-queued since the in flight flag is cleared without changing the buffer state
+    bool first = true;
+    for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++){
+        std::string bundleStr = GeneralHelper::to_string(it->first);
+        ioThread << (first ? "" : "}else ") << "if(tag == " << 2*it->first << "){" << std::endl;
+        ioThread << "ioUringInputInFlight_bundle_" << bundleStr << " = false;" << std::endl;
+        ioThread << "if(res == 0){" << std::endl;
+        ioThread << "ioUringInputEOF_bundle_" << bundleStr << " = true;" << std::endl;
+        ioThread << "}else if(res > 0){" << std::endl;
+        ioThread << "ioUringInputBytes_bundle_" << bundleStr << " += res;" << std::endl;
+        ioThread << "}" << std::endl;
+        first = false;
+    }
+    for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++){
+        std::string bundleStr = GeneralHelper::to_string(it->first);
+        ioThread << (first ? "" : "}else ") << "if(tag == " << 2*it->first+1 << "){" << std::endl;
+        ioThread << "ioUringOutputInFlight_bundle_" << bundleStr << " = false;" << std::endl;
+        ioThread << "if(res > 0){" << std::endl;
+        ioThread << "ioUringOutputBytes_bundle_" << bundleStr << " += res;" << std::endl;
+        ioThread << "}" << std::endl;
+        first = false;
+    }
+    if(!first){
+        ioThread << "}" << std::endl;
+    }
+
+    ioThread << "cqeStatus = io_uring_peek_cqe(&ioRing, &cqe);" << std::endl;
+    ioThread << "}" << std::endl; //Close while
+    ioThread << "}" << std::endl; //Close scope
+}
+
+void StreamIOThread::emitIOUringSubmit(std::ofstream &ioThread){
+    ioThread << "int submitStatus = io_uring_submit(&ioRing);" << std::endl;
+    ioThread << "if(submitStatus < 0){" << std::endl;
+    ioThread << "printf(\"An error was encountered while submitting io_uring requests: %s\\n\", strerror(-submitStatus));" << std::endl;
+    ioThread << "exit(1);" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "ioUringSubmitPending = false;" << std::endl;
+}
+
+void StreamIOThread::emitRingBufferCopyInput(std::ofstream &ioThread, std::string designName, int bundle,
+                                            std::vector<Variable> masterInputVars,
+                                            std::map<int, std::vector<std::pair<std::shared_ptr<ThreadCrossingFIFO>, int>>> inputPortFifoMap,
+                                            unsigned long rxSamplesPerBlock, std::string ringPrefix, std::string ringBlocks){
+    std::string bundleStr = GeneralHelper::to_string(bundle);
+    std::string inputStructTypeName = designName+"_inputs_bundle_"+bundleStr+"_t";
+    std::string rdName = ringPrefix+"InputRd_bundle_"+bundleStr;
+    std::string blockName = ringPrefix+"InputBuf_bundle_"+bundleStr+"["+rdName+"%"+ringBlocks+"]";
+
+    //The block is copied directly from the receive buffer
+    copyIOInputsToFIFO(ioThread, masterInputVars, inputPortFifoMap, blockName);
+    ioThread << rdName << "++;" << std::endl;
+    ioThread << "extInputBufferFilled_" << bundleStr << " = " << ringPrefix << "InputBytes_bundle_" << bundleStr << "/sizeof("
+             << inputStructTypeName << ") > " << rdName << ";" << std::endl;
+    if(rxSamplesPerBlock > 0){
+        ioThread << "rxSamples += " << rxSamplesPerBlock << ";" << std::endl;
+    }
+}
+
+void StreamIOThread::emitRingBufferCopyOutput(std::ofstream &ioThread, std::string designName, int bundle,
+                                             std::vector<Variable> masterOutputVars,
+                                             std::map<int, std::pair<std::shared_ptr<ThreadCrossingFIFO>, int>> outputPortFifoMap,
+                                             std::shared_ptr<MasterOutput> outputMaster, std::string ringPrefix,
+                                             std::string ringBlocks){
+    std::string bundleStr = GeneralHelper::to_string(bundle);
+    std::string outputStructTypeName = designName+"_outputs_bundle_"+bundleStr+"_t";
+    std::string wrName = ringPrefix+"OutputWr_bundle_"+bundleStr;
+    std::string blockName = ringPrefix+"OutputBuf_bundle_"+bundleStr+"["+wrName+"%"+ringBlocks+"]";
+
+    //The block is copied directly into the transmit buffer
+    copyFIFOToIOOutputs(ioThread, masterOutputVars, outputPortFifoMap, outputMaster, blockName);
+    ioThread << wrName << "++;" << std::endl;
+    ioThread << "extOutputBufferFilled_" << bundleStr << " = " << wrName << " - " << ringPrefix << "OutputBytes_bundle_" << bundleStr
+             << "/sizeof(" << outputStructTypeName << ") >= " << ringBlocks << ";" << std::endl;
+}
+
+void StreamIOThread::emitSocketBatchBufferSetup(std::ofstream &ioThread, std::string designName,
+                                                const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterInputBundles,
+                                                const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterOutputBundles,
+                                                bool zeroCopy){
+    if(zeroCopy){
+        //These may not be defined by older libc headers
+        ioThread << "#ifndef SO_ZEROCOPY" << std::endl;
+        ioThread << "#define SO_ZEROCOPY 60" << std::endl;
+        ioThread << "#endif" << std::endl;
+        ioThread << "#ifndef MSG_ZEROCOPY" << std::endl;
+        ioThread << "#define MSG_ZEROCOPY 0x4000000" << std::endl;
+        ioThread << "#endif" << std::endl;
+        ioThread << "#ifndef SO_EE_ORIGIN_ZEROCOPY" << std::endl;
+        ioThread << "#define SO_EE_ORIGIN_ZEROCOPY 5" << std::endl;
+        ioThread << "#endif" << std::endl;
+    }
+
+    ioThread << std::endl;
+    ioThread << "//Allocate receive/transmit buffers" << std::endl;
+    for(auto it = masterInputBundles.begin(); it != masterInputBundles.end(); it++) {
+        std::string bundleStr = GeneralHelper::to_string(it->first);
+        std::string inputStructTypeName = designName+"_inputs_bundle_"+bundleStr+"_t";
+        std::string bufName = "socketInputBuf_bundle_"+bundleStr;
+        ioThread << inputStructTypeName << " *" << bufName << ";" << std::endl;
+        ioThread << "if(posix_memalign((void**) &" << bufName << ", 4096, sizeof(" << inputStructTypeName << ")*VITIS_SOCKET_BATCH_BLOCKS) != 0){" << std::endl;
+        ioThread << "fprintf(stderr, \"Unable to allocate socket receive buffer\\n\");" << std::endl;
+        ioThread << "exit(1);" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "uint64_t socketInputBytes_bundle_" << bundleStr << " = 0; //The total number of bytes received" << std::endl;
+        ioThread << "uint64_t socketInputRd_bundle_" << bundleStr << " = 0; //The total number of blocks passed to compute" << std::endl;
+        ioThread << "bool socketInputEOF_bundle_" << bundleStr << " = false;" << std::endl;
+    }
+
+    for(auto it = masterOutputBundles.begin(); it != masterOutputBundles.end(); it++) {
+        std::string bundleStr = GeneralHelper::to_string(it->first);
+        std::string outputStructTypeName = designName+"_outputs_bundle_"+bundleStr+"_t";
+        std::string bufName = "socketOutputBuf_bundle_"+bundleStr;
+        ioThread << outputStructTypeName << " *" << bufName << ";" << std::endl;
+        ioThread << "if(posix_memalign((void**) &" << bufName << ", 4096, sizeof(" << outputStructTypeName << ")*VITIS_SOCKET_BATCH_BLOCKS) != 0){" << std::endl;
+        ioThread << "fprintf(stderr, \"Unable to allocate socket transmit buffer\\n\");" << std::endl;
+        ioThread << "exit(1);" << std::endl;
+        ioThread << "}" << std::endl;
+        ioThread << "uint64_t socketOutputWr_bundle_" << bundleStr << " = 0; //The total number of blocks placed in the transmit buffer" << std::endl;
+        ioThread << "uint64_t socketOutputSent_bundle_" << bundleStr << " = 0; //The total number of bytes handed to the kernel" << std::endl;
+        ioThread << "uint64_t socketOutputBytes_bundle_" << bundleStr << " = 0; //The total number of bytes whose space in the transmit buffer can be reused" << std::endl;
+
+        if(zeroCopy){
+            //With MSG_ZEROCOPY, the kernel reads from the transmit buffer after sendmsg returns.  Each successful
+            //sendmsg is assigned a sequential ID which is reported through the socket error queue once the kernel is
+            //done with the buffer.  The end position of each outstanding send is tracked so that space can be reclaimed
+            std::string connectedSocketName = "connectedSocket_bundle_" + bundleStr;
+            ioThread << "bool socketZeroCopy_bundle_" << bundleStr << " = true;" << std::endl;
+            ioThread << "int zeroCopyEnable_bundle_" << bundleStr << " = 1;" << std::endl;
+            ioThread << "if(setsockopt(" << connectedSocketName << ", SOL_SOCKET, SO_ZEROCOPY, &zeroCopyEnable_bundle_"
+                     << bundleStr << ", sizeof(zeroCopyEnable_bundle_" << bundleStr << ")) != 0){" << std::endl;
+            ioThread << "fprintf(stderr, \"Could not set SO_ZEROCOPY for socket ... continuing without zero copy\\n\");" << std::endl;
+            ioThread << "perror(NULL);" << std::endl;
+            ioThread << "socketZeroCopy_bundle_" << bundleStr << " = false;" << std::endl;
+            ioThread << "}" << std::endl;
+            ioThread << "uint32_t socketZCIssued_bundle_" << bundleStr << " = 0;" << std::endl;
+            ioThread << "uint32_t socketZCCompleted_bundle_" << bundleStr << " = 0;" << std::endl;
+            ioThread << "int socketZCCompletedSlot_bundle_" << bundleStr << " = 0;" << std::endl;
+            ioThread << "uint64_t socketZCEnd_bundle_" << bundleStr << "[VITIS_SOCKET_BATCH_BLOCKS];" << std::endl;
+            ioThread << "bool socketZCDone_bundle_" << bundleStr << "[VITIS_SOCKET_BATCH_BLOCKS] = {false};" << std::endl;
+        }
+    }
+}
+
+void StreamIOThread::emitSocketBatchRecv(std::ofstream &ioThread, std::string designName, int bundle, bool trackProgress){
+    std::string bundleStr = GeneralHelper::to_string(bundle);
+    std::string inputStructTypeName = designName+"_inputs_bundle_"+bundleStr+"_t";
+    std::string bufName = "socketInputBuf_bundle_"+bundleStr;
+    std::string bytesName = "socketInputBytes_bundle_"+bundleStr;
+    std::string rdName = "socketInputRd_bundle_"+bundleStr;
+    std::string eofName = "socketInputEOF_bundle_"+bundleStr;
+    std::string connectedSocketName = "connectedSocket_bundle_" + bundleStr;
+
+    //Both regions of free space (before and after the wrap point) are filled by one call.  Partial blocks remain in
+    //the buffer until the remainder arrives
+    ioThread << "//Receive into the free space of the receive buffer" << std::endl;
+    ioThread << "if(!" << eofName << "){" << std::endl;
+    ioThread << "uint64_t capacityBytes = sizeof(" << inputStructTypeName << ")*VITIS_SOCKET_BATCH_BLOCKS;" << std::endl;
+    ioThread << "uint64_t freeBytes = capacityBytes - (" << bytesName << " - " << rdName << "*sizeof(" << inputStructTypeName << "));" << std::endl;
+    ioThread << "if(freeBytes > 0){" << std::endl;
+    ioThread << "uint64_t writePos = " << bytesName << " % capacityBytes;" << std::endl;
+    ioThread << "struct iovec recvVecs[2];" << std::endl;
+    ioThread << "recvVecs[0].iov_base = ((char*) " << bufName << ")+writePos;" << std::endl;
+    ioThread << "recvVecs[0].iov_len = capacityBytes - writePos < freeBytes ? capacityBytes - writePos : freeBytes;" << std::endl;
+    ioThread << "recvVecs[1].iov_base = " << bufName << ";" << std::endl;
+    ioThread << "recvVecs[1].iov_len = freeBytes - recvVecs[0].iov_len;" << std::endl;
+    ioThread << "struct msghdr recvMsg;" << std::endl;
+    ioThread << "memset(&recvMsg, 0, sizeof(recvMsg));" << std::endl;
+    ioThread << "recvMsg.msg_iov = recvVecs;" << std::endl;
+    ioThread << "recvMsg.msg_iovlen = recvVecs[1].iov_len > 0 ? 2 : 1;" << std::endl;
+    ioThread << "ssize_t bytesRead = recvmsg(" << connectedSocketName << ", &recvMsg, MSG_DONTWAIT);" << std::endl;
+    ioThread << "if(bytesRead == 0){" << std::endl;
+    ioThread << "//Socket closed" << std::endl;
+    ioThread << eofName << " = true;" << std::endl;
+    ioThread << "}else if(bytesRead > 0){" << std::endl;
+    ioThread << bytesName << " += bytesRead;" << std::endl;
+    if(trackProgress){
+        ioThread << "ioThreadProgress = true;" << std::endl;
+    }
+    ioThread << "}else if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR){" << std::endl;
+    ioThread << "printf(\"An error was encountered while reading the socket\\n\");" << std::endl;
+    ioThread << "perror(NULL);" << std::endl;
+    ioThread << "exit(1);" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+}
+
+void StreamIOThread::emitSocketBatchSend(std::ofstream &ioThread, std::string designName, int bundle,
+                                         bool trackProgress, bool blocking, bool zeroCopy){
+    std::string bundleStr = GeneralHelper::to_string(bundle);
+    std::string outputStructTypeName = designName+"_outputs_bundle_"+bundleStr+"_t";
+    std::string bufName = "socketOutputBuf_bundle_"+bundleStr;
+    std::string wrName = "socketOutputWr_bundle_"+bundleStr;
+    std::string sentName = "socketOutputSent_bundle_"+bundleStr;
+    std::string bytesName = "socketOutputBytes_bundle_"+bundleStr;
+    std::string connectedSocketName = "connectedSocket_bundle_" + bundleStr;
+    std::string zcName = "socketZeroCopy_bundle_"+bundleStr;
+    std::string zcIssuedName = "socketZCIssued_bundle_"+bundleStr;
+    std::string zcCompletedName = "socketZCCompleted_bundle_"+bundleStr;
+    std::string zcCompletedSlotName = "socketZCCompletedSlot_bundle_"+bundleStr;
+
+    ioThread << "//Send the pending blocks in the transmit buffer" << std::endl;
+    ioThread << "{" << std::endl;
+    ioThread << "uint64_t pendingBytes = " << wrName << "*sizeof(" << outputStructTypeName << ") - " << sentName << ";" << std::endl;
+    if(zeroCopy){
+        //Only VITIS_SOCKET_BATCH_BLOCKS zero copy sends can be tracked at once
+        ioThread << "if(pendingBytes > 0 && " << zcIssuedName << " - " << zcCompletedName << " < VITIS_SOCKET_BATCH_BLOCKS){" << std::endl;
+    }else{
+        ioThread << "if(pendingBytes > 0){" << std::endl;
+    }
+    ioThread << "uint64_t capacityBytes = sizeof(" << outputStructTypeName << ")*VITIS_SOCKET_BATCH_BLOCKS;" << std::endl;
+    ioThread << "uint64_t readPos = " << sentName << " % capacityBytes;" << std::endl;
+    ioThread << "struct iovec sendVecs[2];" << std::endl;
+    ioThread << "sendVecs[0].iov_base = ((char*) " << bufName << ")+readPos;" << std::endl;
+    ioThread << "sendVecs[0].iov_len = capacityBytes - readPos < pendingBytes ? capacityBytes - readPos : pendingBytes;" << std::endl;
+    ioThread << "sendVecs[1].iov_base = " << bufName << ";" << std::endl;
+    ioThread << "sendVecs[1].iov_len = pendingBytes - sendVecs[0].iov_len;" << std::endl;
+    ioThread << "struct msghdr sendMsg;" << std::endl;
+    ioThread << "memset(&sendMsg, 0, sizeof(sendMsg));" << std::endl;
+    ioThread << "sendMsg.msg_iov = sendVecs;" << std::endl;
+    ioThread << "sendMsg.msg_iovlen = sendVecs[1].iov_len > 0 ? 2 : 1;" << std::endl;
+    ioThread << "int sendFlags = " << (blocking ? "0" : "MSG_DONTWAIT") << ";" << std::endl;
+    if(zeroCopy){
+        ioThread << "if(" << zcName << "){" << std::endl;
+        ioThread << "sendFlags |= MSG_ZEROCOPY;" << std::endl;
+        ioThread << "}" << std::endl;
+    }
+    ioThread << "ssize_t bytesSent = sendmsg(" << connectedSocketName << ", &sendMsg, sendFlags);" << std::endl;
+    ioThread << "if(bytesSent > 0){" << std::endl;
+    ioThread << sentName << " += bytesSent;" << std::endl;
+    if(zeroCopy){
+        ioThread << "if(" << zcName << "){" << std::endl;
+        ioThread << "//The buffer space is reclaimed once the kernel reports the send is complete" << std::endl;
+        ioThread << "int zcSlot = (" << zcCompletedSlotName << " + (" << zcIssuedName << " - " << zcCompletedName << ")) % VITIS_SOCKET_BATCH_BLOCKS;" << std::endl;
+        ioThread << "socketZCEnd_bundle_" << bundleStr << "[zcSlot] = " << sentName << ";" << std::endl;
+        ioThread << zcIssuedName << "++;" << std::endl;
+        ioThread << "}else{" << std::endl;
+        ioThread << bytesName << " = " << sentName << ";" << std::endl;
+        ioThread << "}" << std::endl;
+    }else{
+        ioThread << bytesName << " = " << sentName << ";" << std::endl;
+    }
+    if(trackProgress){
+        ioThread << "ioThreadProgress = true;" << std::endl;
+    }
+    //ENOBUFS is returned if the zero copy notification could not be allocated.  The send is retried later
+    ioThread << "}else if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR" << (zeroCopy ? " && errno != ENOBUFS" : "") << "){" << std::endl;
+    ioThread << "printf(\"An error was encountered while writing the socket\\n\");" << std::endl;
+    ioThread << "perror(NULL);" << std::endl;
+    ioThread << "exit(1);" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+}
+
+void StreamIOThread::emitSocketZeroCopyCompletions(std::ofstream &ioThread, int bundle, bool trackProgress){
+    std::string bundleStr = GeneralHelper::to_string(bundle);
+    std::string connectedSocketName = "connectedSocket_bundle_" + bundleStr;
+    std::string zcIssuedName = "socketZCIssued_bundle_"+bundleStr;
+    std::string zcCompletedName = "socketZCCompleted_bundle_"+bundleStr;
+    std::string zcCompletedSlotName = "socketZCCompletedSlot_bundle_"+bundleStr;
+    std::string zcDoneName = "socketZCDone_bundle_"+bundleStr;
+
+    ioThread << "//Process zero copy completions" << std::endl;
+    ioThread << "if(" << zcIssuedName << " != " << zcCompletedName << "){" << std::endl;
+    ioThread << "struct msghdr zcMsg;" << std::endl;
+    ioThread << "char zcControl[128];" << std::endl;
+    ioThread << "while(1){" << std::endl;
+    ioThread << "memset(&zcMsg, 0, sizeof(zcMsg));" << std::endl;
+    ioThread << "zcMsg.msg_control = zcControl;" << std::endl;
+    ioThread << "zcMsg.msg_controllen = sizeof(zcControl);" << std::endl;
+    ioThread << "if(recvmsg(" << connectedSocketName << ", &zcMsg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1){" << std::endl;
+    ioThread << "break; //Error queue empty" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "for(struct cmsghdr *cm = CMSG_FIRSTHDR(&zcMsg); cm != NULL; cm = CMSG_NXTHDR(&zcMsg, cm)){" << std::endl;
+    ioThread << "if(cm->cmsg_level == IPPROTO_IP && cm->cmsg_type == IP_RECVERR){" << std::endl;
+    ioThread << "struct sock_extended_err *serr = (struct sock_extended_err *) CMSG_DATA(cm);" << std::endl;
+    ioThread << "if(serr->ee_errno == 0 && serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY){" << std::endl;
+    ioThread << "//The notification covers the (inclusive) range of send IDs [ee_info, ee_data]" << std::endl;
+    ioThread << "for(uint32_t zcID = serr->ee_info; zcID != serr->ee_data+1; zcID++){" << std::endl;
+    ioThread << "uint32_t zcOffset = zcID - " << zcCompletedName << ";" << std::endl;
+    ioThread << "if(zcOffset < " << zcIssuedName << " - " << zcCompletedName << "){" << std::endl;
+    ioThread << zcDoneName << "[(" << zcCompletedSlotName << " + zcOffset) % VITIS_SOCKET_BATCH_BLOCKS] = true;" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl; //Close for
+    ioThread << "}" << std::endl; //Close while
+
+    //Completions may be reported out of order.  Space is only reclaimed in order
+    ioThread << "while(" << zcCompletedName << " != " << zcIssuedName << " && " << zcDoneName << "[" << zcCompletedSlotName << "]){" << std::endl;
+    ioThread << zcDoneName << "[" << zcCompletedSlotName << "] = false;" << std::endl;
+    ioThread << "socketOutputBytes_bundle_" << bundleStr << " = socketZCEnd_bundle_" << bundleStr << "[" << zcCompletedSlotName << "];" << std::endl;
+    ioThread << zcCompletedSlotName << " = (" << zcCompletedSlotName << "+1) % VITIS_SOCKET_BATCH_BLOCKS;" << std::endl;
+    ioThread << zcCompletedName << "++;" << std::endl;
+    if(trackProgress){
+        ioThread << "ioThreadProgress = true;" << std::endl;
+    }
+    ioThread << "}" << std::endl;
+    ioThread << "}" << std::endl;
+}
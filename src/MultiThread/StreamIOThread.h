@@ -20,7 +20,9 @@ namespace StreamIOThread {
     enum class StreamType{
         PIPE, ///<A linux named pipe (FIFO)
         SOCKET, ///<A network socket
-        POSIX_SHARED_MEM ///< POSIX Shared Memory
+        POSIX_SHARED_MEM, ///< POSIX Shared Memory
+        POSIX_SHARED_MEM_LOCKLESS, ///< POSIX Shared Memory using lockless FIFOs (no semaphores) with optional futex wakeups and huge pages
+        IO_URING ///<A linux named pipe (FIFO) accessed with io_uring.  Reads and writes are asynchronous and move multiple blocks per request
     };
 
     /**
@@ -72,9 +74,18 @@ namespace StreamIOThread {
      * @param designName
      * @param blockSize
      * @param fifoHeaderFile
-     * @param ioFifoSize The size of the fifo in blocks (only pertains to POSIX shared memory)
+     * @param ioFifoSize The size of the fifo in blocks (only pertains to POSIX shared memory and the io_uring receive/transmit buffers)
      * @param threadDebugPrint
      * @param printTelem
+     * @param fifoWaitPolicy selects what the thread does in iterations where no progress was made
+     * @param socketBatchBlocks (SOCKET only) if >0, the size in blocks of the socket receive/transmit buffers.  Many
+     *                          blocks are moved per system call with non-blocking recvmsg/sendmsg.  If 0, each block
+     *                          is moved with a blocking recv/send
+     * @param socketBufferSize (SOCKET only) if >0, the SO_RCVBUF/SO_SNDBUF size in bytes requested for the sockets
+     * @param socketZeroCopy (SOCKET only) if true and socketBatchBlocks>0, sends use MSG_ZEROCOPY
+     * @param sharedMemFutex (POSIX_SHARED_MEM_LOCKLESS only) if true, blocking shared memory FIFO reads/writes sleep on a
+     *                       futex after spinning.  The peer only issues a wake if the thread is parked
+     * @param sharedMemHugePages (POSIX_SHARED_MEM_LOCKLESS only) if true, the shared memory FIFOs are backed by huge pages
      */
     void emitStreamIOThreadC(std::shared_ptr<MasterInput> inputMaster, std::shared_ptr<MasterOutput> outputMaster,
                              std::vector<std::shared_ptr<ThreadCrossingFIFO>> inputFIFOs,
@@ -85,9 +96,20 @@ namespace StreamIOThread {
                              bool printTelem, EmitterHelpers::TelemetryLevel telemLevel,
                              int telemReportFreqBlockFreq, double reportPeriodSeconds, std::string telemDumpFilePrefix,
                              bool telemAvg, PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior,
+                             PartitionParams::FIFOWaitPolicy fifoWaitPolicy,
+                             int socketBatchBlocks, int socketBufferSize, bool socketZeroCopy,
+                             bool sharedMemFutex, bool sharedMemHugePages,
                              std::string streamNameSuffix);
 
-    void emitSocketClientLib(std::shared_ptr<MasterInput> inputMaster, std::shared_ptr<MasterOutput> outputMaster, std::string path, std::string fileNamePrefix, std::string fifoHeaderFile, std::string designName);
+    /**
+     * @brief Emits a client library for connecting to the SOCKET I/O thread
+     *
+     * In addition to functions sending/receiving a single block, functions which send/receive multiple blocks per system
+     * call are emitted.
+     *
+     * @param socketBufferSize if >0, the SO_RCVBUF/SO_SNDBUF size in bytes requested when connecting
+     */
+    void emitSocketClientLib(std::shared_ptr<MasterInput> inputMaster, std::shared_ptr<MasterOutput> outputMaster, std::string path, std::string fileNamePrefix, std::string fifoHeaderFile, std::string designName, int socketBufferSize);
 
     void sortIntoBundles(std::vector<Variable> inputMasterVars, std::vector<Variable> outputMasterVars,
                          std::vector<int> inputBlockSizes, std::vector<int> outputBlockSizes,
@@ -101,7 +123,161 @@ namespace StreamIOThread {
      */
     std::string emitSharedMemoryFIFOHelperFiles(std::string path);
 
+    /**
+     * @brief Emits the helper files for lockless shared memory fifos which use the POSIX API
+     *
+     * These provide the same interface as the files emitted by emitSharedMemoryFIFOHelperFiles but do not use
+     * semaphores.  The producer and consumer exchange free running byte indexes which reside in separate cache lines
+     * at the start of the shared region.  Each side caches the other's index and only re-loads it when the FIFO
+     * appears full (or empty).  The consumer detects the end of the stream when the producer cleans up the FIFO.
+     *
+     * @param path the path to emit the file to
+     * @param useFutex if true, a thread blocked in readFifo/writeFifo sleeps on a futex after spinning.  The other side
+     *                 only issues a futex wake if the thread has marked itself as parked.  Can be overridden when
+     *                 compiling with LOCKLESS_SHM_FIFO_USE_FUTEX
+     * @param hugePages if true, the shared region is created on hugetlbfs, falling back to shm_open with
+     *                  transparent huge pages requested.  Can be overridden when compiling with
+     *                  LOCKLESS_SHM_FIFO_HUGE_PAGES
+     * @return the header filename
+     */
+    std::string emitLocklessSharedMemoryFIFOHelperFiles(std::string path, bool useFutex, bool hugePages);
+
     std::string emitFileStreamHelpers(std::string path, std::string fileNamePrefix);
+
+    /**
+     * @brief Emits C code which queues a read into the free space of an input bundle's io_uring receive buffer (if
+     * no read is already in flight for the bundle)
+     *
+     * Only one read is kept in flight per bundle since concurrent reads on a pipe may complete out of order or
+     * partially.  Instead, each read requests all of the contiguous free space in the receive buffer so that multiple
+     * blocks can be received per request.
+     *
+     * @param ioThread the stream to emit to
+     * @param designName the name of the design
+     * @param bundle the input bundle number
+     */
+    void emitIOUringQueueRead(std::ofstream &ioThread, std::string designName, int bundle);
+
+    /**
+     * @brief Emits C code which queues a write of the pending blocks in an output bundle's io_uring transmit buffer (if
+     * no write is already in flight for the bundle)
+     *
+     * Blocks placed in the transmit buffer while a write is in flight are written together in the next request.
+     *
+     * @param ioThread the stream to emit to
+     * @param designName the name of the design
+     * @param bundle the output bundle number
+     */
+    void emitIOUringQueueWrite(std::ofstream &ioThread, std::string designName, int bundle);
+
+    /**
+     * @brief Emits C code which processes the available io_uring completions and updates the state of the receive and
+     * transmit buffers
+     *
+     * @param ioThread the stream to emit to
+     * @param masterInputBundles the input bundles
+     * @param masterOutputBundles the output bundles
+     * @param wait if true, blocks until at least one completion is available
+     * @param trackProgress if true, sets ioThreadProgress when a completion is processed
+     */
+    void emitIOUringProcessCompletions(std::ofstream &ioThread,
+                                       const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterInputBundles,
+                                       const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterOutputBundles,
+                                       bool wait, bool trackProgress);
+
+    /**
+     * @brief Emits C code which submits the queued io_uring requests
+     *
+     * @param ioThread the stream to emit to
+     */
+    void emitIOUringSubmit(std::ofstream &ioThread);
+
+    /**
+     * @brief Emits C code which copies the next block in an input bundle's receive ring buffer into the FIFO write
+     * temporaries and updates the state of the receive buffer.  Used by the io_uring and batched socket drivers
+     *
+     * @param ioThread the stream to emit to
+     * @param designName the name of the design
+     * @param bundle the input bundle number
+     * @param masterInputVars the variables of the input bundle
+     * @param inputPortFifoMap the mapping of input ports to FIFOs
+     * @param rxSamplesPerBlock if >0, rxSamples is incremented by this value (for telemetry)
+     * @param ringPrefix the prefix of the ring buffer variable names
+     * @param ringBlocks the C expression for the size of the ring buffer in blocks
+     */
+    void emitRingBufferCopyInput(std::ofstream &ioThread, std::string designName, int bundle,
+                                 std::vector<Variable> masterInputVars,
+                                 std::map<int, std::vector<std::pair<std::shared_ptr<ThreadCrossingFIFO>, int>>> inputPortFifoMap,
+                                 unsigned long rxSamplesPerBlock, std::string ringPrefix, std::string ringBlocks);
+
+    /**
+     * @brief Emits C code which copies the FIFO read temporaries into the next free block of an output bundle's
+     * transmit ring buffer and updates the state of the transmit buffer.  Used by the io_uring and batched socket drivers
+     *
+     * @param ioThread the stream to emit to
+     * @param designName the name of the design
+     * @param bundle the output bundle number
+     * @param masterOutputVars the variables of the output bundle
+     * @param outputPortFifoMap the mapping of output ports to FIFOs
+     * @param outputMaster the output master node
+     * @param ringPrefix the prefix of the ring buffer variable names
+     * @param ringBlocks the C expression for the size of the ring buffer in blocks
+     */
+    void emitRingBufferCopyOutput(std::ofstream &ioThread, std::string designName, int bundle,
+                                  std::vector<Variable> masterOutputVars,
+                                  std::map<int, std::pair<std::shared_ptr<ThreadCrossingFIFO>, int>> outputPortFifoMap,
+                                  std::shared_ptr<MasterOutput> outputMaster, std::string ringPrefix,
+                                  std::string ringBlocks);
+
+    /**
+     * @brief Emits C code which allocates the receive/transmit buffers of the batched socket driver (and enables
+     * SO_ZEROCOPY on the connected sockets if requested)
+     *
+     * @param ioThread the stream to emit to
+     * @param designName the name of the design
+     * @param masterInputBundles the input bundles
+     * @param masterOutputBundles the output bundles
+     * @param zeroCopy if true, state for tracking MSG_ZEROCOPY sends is declared
+     */
+    void emitSocketBatchBufferSetup(std::ofstream &ioThread, std::string designName,
+                                    const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterInputBundles,
+                                    const std::map<int, std::pair<std::vector<Variable>, std::vector<int>>> &masterOutputBundles,
+                                    bool zeroCopy);
+
+    /**
+     * @brief Emits C code which receives the available bytes (without blocking) into the free space of an input
+     * bundle's socket receive buffer using a single recvmsg call
+     *
+     * @param ioThread the stream to emit to
+     * @param designName the name of the design
+     * @param bundle the input bundle number
+     * @param trackProgress if true, sets ioThreadProgress when data is received
+     */
+    void emitSocketBatchRecv(std::ofstream &ioThread, std::string designName, int bundle, bool trackProgress);
+
+    /**
+     * @brief Emits C code which sends the pending blocks in an output bundle's socket transmit buffer using a single
+     * sendmsg call
+     *
+     * @param ioThread the stream to emit to
+     * @param designName the name of the design
+     * @param bundle the output bundle number
+     * @param trackProgress if true, sets ioThreadProgress when data is sent
+     * @param blocking if true, the send blocks.  Otherwise, MSG_DONTWAIT is used
+     * @param zeroCopy if true, MSG_ZEROCOPY is used (if it was successfully enabled on the socket)
+     */
+    void emitSocketBatchSend(std::ofstream &ioThread, std::string designName, int bundle,
+                             bool trackProgress, bool blocking, bool zeroCopy);
+
+    /**
+     * @brief Emits C code which reads MSG_ZEROCOPY completion notifications from the socket error queue and reclaims
+     * the space in the transmit buffer of the completed sends
+     *
+     * @param ioThread the stream to emit to
+     * @param bundle the output bundle number
+     * @param trackProgress if true, sets ioThreadProgress when space is reclaimed
+     */
+    void emitSocketZeroCopyCompletions(std::ofstream &ioThread, int bundle, bool trackProgress);
 };
 
 
@@ -250,9 +250,11 @@ void ThreadCrossingFIFO::setBaseSubBlockSizeOut(int portNum, int subBlockSize){
     baseSubBlockSizesOut[portNum] = subBlockSize;
 }
 
-ThreadCrossingFIFO::ThreadCrossingFIFO() : fifoLength(8), copyMode(ThreadCrossingFIFOParameters::CopyMode::CLANG_MEMCPY_INLINED){}
+ThreadCrossingFIFO::ThreadCrossingFIFO() : fifoLength(8), copyMode(ThreadCrossingFIFOParameters::CopyMode::CLANG_MEMCPY_INLINED),
+                                           fifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){}
 
-ThreadCrossingFIFO::ThreadCrossingFIFO(std::shared_ptr<SubSystem> parent) : Node(parent), fifoLength(8), copyMode(ThreadCrossingFIFOParameters::CopyMode::CLANG_MEMCPY_INLINED){}
+ThreadCrossingFIFO::ThreadCrossingFIFO(std::shared_ptr<SubSystem> parent) : Node(parent), fifoLength(8), copyMode(ThreadCrossingFIFOParameters::CopyMode::CLANG_MEMCPY_INLINED),
+                                                                             fifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){}
 
 ThreadCrossingFIFO::ThreadCrossingFIFO(std::shared_ptr<SubSystem> parent, ThreadCrossingFIFO *orig) : Node(parent, orig),
                                        fifoLength(orig->fifoLength), initConditions(orig->initConditions),
@@ -263,7 +265,7 @@ ThreadCrossingFIFO::ThreadCrossingFIFO(std::shared_ptr<SubSystem> parent, Thread
                                        subBlockSizesOut(orig->subBlockSizesOut),
                                        cStateVarsInitialized(orig->cStateVarsInitialized),
                                        cStateInputVarsInitialized(orig->cStateInputVarsInitialized),
-                                       copyMode(orig->copyMode){}
+                                       copyMode(orig->copyMode), fifoPlacement(orig->fifoPlacement){}
 
 std::set<GraphMLParameter> ThreadCrossingFIFO::graphMLParameters() {
     std::set<GraphMLParameter> parameters;
@@ -401,6 +403,7 @@ std::string ThreadCrossingFIFO::labelStr() {
 
     label += "\nFunction: " + typeNameStr();
     label += "\nFIFO_Length: " + GeneralHelper::to_string(fifoLength);
+    label += "\nFIFO_Placement: " + ThreadCrossingFIFOParameters::fifoPlacementToString(fifoPlacement);
 
     //There is a separate initial condition entry for each port pair
     for(int i = 0; i<blockSizes.size(); i++){
@@ -861,7 +864,7 @@ std::string ThreadCrossingFIFO::getFIFOStructTypeName(){
     return name+"_n"+GeneralHelper::to_string(id) + "_t";
 }
 
-std::string ThreadCrossingFIFO::createFIFOStruct(){
+std::string ThreadCrossingFIFO::createFIFOStruct(EmitterHelpers::ComplexLayout complexLayout){
     std::string typeName = getFIFOStructTypeName();
 
     //TODO: Check 2D case
@@ -879,12 +882,13 @@ std::string ThreadCrossingFIFO::createFIFOStruct(){
         structStr += "//From: " + src->getParent()->getFullyQualifiedName() + " [Port " + GeneralHelper::to_string(src->getPortNum()) + "]\n";
 
         //There are possibly 2 entries per port
+        std::string planeAlignment = EmitterHelpers::getPlaneAlignmentAttribute(complexLayout, blockStateDT);
         structStr += stateDT.toString(DataType::StringStyle::C) + " port" + GeneralHelper::to_string(i) + "_real" +
-                     blockStateDT.dimensionsToString(true) + ";\n";
+                     blockStateDT.dimensionsToString(true) + planeAlignment + ";\n";
 
         if (stateDT.isComplex()) {
             structStr += stateDT.toString(DataType::StringStyle::C) + " port" + GeneralHelper::to_string(i) + "_imag" +
-                         blockStateDT.dimensionsToString(true) + ";\n";
+                         blockStateDT.dimensionsToString(true) + planeAlignment + ";\n";
         }
     }
     structStr += "} " + typeName + ";";
@@ -932,3 +936,30 @@ ThreadCrossingFIFOParameters::CopyMode ThreadCrossingFIFO::getCopyMode() const {
 void ThreadCrossingFIFO::setCopyMode(ThreadCrossingFIFOParameters::CopyMode copyMode) {
     ThreadCrossingFIFO::copyMode = copyMode;
 }
+
+ThreadCrossingFIFOParameters::FIFOPlacement ThreadCrossingFIFO::getFifoPlacement() const {
+    return fifoPlacement;
+}
+
+void ThreadCrossingFIFO::setFifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement) {
+    ThreadCrossingFIFO::fifoPlacement = fifoPlacement;
+}
+
+void ThreadCrossingFIFO::emitCFlushPendingCommits(std::vector<std::string> &cStatementQueue, Role role) {
+    //By default, the FIFO state is published on every access.  Nothing is pending
+}
+
+void ThreadCrossingFIFO::initializeCVars() {
+    for(int i = 0; i<inputPorts.size(); i++){
+        getCStateVar(i);
+        getCStateInputVar(i);
+        getInitConditionsCreateIfNot(i);
+        getBlockSizeCreateIfNot(i);
+        getSubBlockSizeInCreateIfNot(i);
+        getSubBlockSizeOutCreateIfNot(i);
+        getBaseSubBlockSizeInCreateIfNot(i);
+        getBaseSubBlockSizeOutCreateIfNot(i);
+        getCBlockIndexExprInputCreateIfNot(i);
+        getCBlockIndexExprOutputCreateIfNot(i);
+    }
+}
@@ -16,6 +16,7 @@
 #include "GraphCore/StateUpdate.h"
 #include "MultiRate/ClockDomain.h"
 #include "ThreadCrossingFIFOParameters.h"
+#include "General/EmitterHelpers.h"
 
 /**
  * \addtogroup MultiThread Multi-Thread Support
@@ -63,6 +64,8 @@ protected:
 
     ThreadCrossingFIFOParameters::CopyMode copyMode;
 
+    ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement; ///<Where the shared variables of this FIFO are placed in memory.  Set from a placement annotation on the partition crossing or the global placement
+
     //==== Constructors ====
     /**
      * @brief Constructs an empty ThreadCrossing FIFO node
@@ -127,6 +130,9 @@ public:
 
     void setCopyMode(ThreadCrossingFIFOParameters::CopyMode copyMode);
 
+    ThreadCrossingFIFOParameters::FIFOPlacement getFifoPlacement() const;
+    void setFifoPlacement(ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement);
+
     /**
      * @brief Returns true if threads operation on this FIFO use the data in the FIFO in place or copy to/from a local
      * buffer.  If used in place, checks need to be made to both input and output FIFOs before use.  State is only updated
@@ -421,8 +427,9 @@ public:
 
     /**
      * @brief Creates a structure which is the format for entries in the FIFO.  Each structure contains a block of samples
+     * @param complexLayout the placement of the real and imaginary planes of each port within the structure
      */
-    virtual std::string createFIFOStruct();
+    virtual std::string createFIFOStruct(EmitterHelpers::ComplexLayout complexLayout = EmitterHelpers::ComplexLayout::SPLIT_PACKED);
 
     /**
      * @brief Returns the type name of the FIFO structure.  Structures are used to store blocks in the FIFO
@@ -435,10 +442,13 @@ public:
      *
      * This function should be called by the function creating threads.  These variables should be passed to threads.
      *
+     * The core each variable is allocated on is selected by the FIFO's placement (see ThreadCrossingFIFOParameters::FIFOPlacement)
+     *
      * @param cStatementQueue The C statements will be written to this queue
-     * @param core The core on which the memory should be allocated.  If -1, it is the core the current thread is running on (aligned_alloc).  Otherwise, it uses the vitis helper function
+     * @param producerCore The core the producer runs on.  If -1, it is the core the current thread is running on (aligned_alloc).  Otherwise, it uses the vitis helper function
+     * @param consumerCore The core the consumer runs on.  If -1, it is the core the current thread is running on (aligned_alloc).  Otherwise, it uses the vitis helper function
      */
-    virtual void createSharedVariables(std::vector<std::string> &cStatementQueue, int core = -1) = 0;
+    virtual void createSharedVariables(std::vector<std::string> &cStatementQueue, int producerCore = -1, int consumerCore = -1) = 0;
 
     /**
      * @brief Emits C statements that initialize allocated variables
@@ -500,6 +510,30 @@ public:
      * @param role the role of the actor calling this function
      */
     virtual void pushLocalVars(std::vector<std::string> &cStatementQueue, Role role) = 0;
+
+    /**
+     * @brief Publishes any reads or writes which have been performed but not yet made visible to the other thread
+     *
+     * This is called when a thread is about to stall (ex. waiting on a FIFO check) and at the end of a stream.  FIFOs
+     * which publish their state on every access have nothing pending and emit no statements (the default).
+     *
+     * If the role is producer, pending writes are published
+     * If the role is consumer, pending reads are published
+     * If the role is none, both are published
+     *
+     * @param cStatementQueue The C statements will be written to this queue
+     * @param role the role of the actor calling this function
+     */
+    virtual void emitCFlushPendingCommits(std::vector<std::string> &cStatementQueue, Role role);
+
+    /**
+     * @brief Initializes the C variables and per-port properties of this FIFO which are otherwise created lazily when
+     * first accessed
+     *
+     * A FIFO is accessed when emitting both its src and dst partitions.  Calling this before partitions are emitted
+     * concurrently ensures that the partition emitters only read the FIFO's state.
+     */
+    virtual void initializeCVars();
 };
 
 
@@ -11,6 +11,8 @@ ThreadCrossingFIFOParameters::parseThreadCrossingFIFOType(std::string str) {
         return ThreadCrossingFIFOType::LOCKLESS_X86;
     }else if(str == "LOCKLESS_INPLACE_X86" || str == "lockeless_inplace_x86"){
         return ThreadCrossingFIFOType::LOCKLESS_INPLACE_X86;
+    }else if(str == "LOCKLESS_BATCHED_COMMIT_X86" || str == "lockeless_batched_commit_x86"){
+        return ThreadCrossingFIFOType::LOCKLESS_BATCHED_COMMIT_X86;
     }else{
         throw std::runtime_error(ErrorHelpers::genErrorStr("Unable to parse ThreadCrossingFIFOType " + str));
     }
@@ -24,7 +26,42 @@ ThreadCrossingFIFOParameters::threadCrossingFIFOTypeToString(ThreadCrossingFIFOP
             return "LOCKLESS_X86";
         case ThreadCrossingFIFOType::LOCKLESS_INPLACE_X86:
             return "LOCKLESS_INPLACE_X86";
+        case ThreadCrossingFIFOType::LOCKLESS_BATCHED_COMMIT_X86:
+            return "LOCKLESS_BATCHED_COMMIT_X86";
         default:
             throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown ThreadCrossingFIFOType"));
     }
 }
+
+ThreadCrossingFIFOParameters::FIFOPlacement ThreadCrossingFIFOParameters::parseFIFOPlacement(std::string str) {
+    if(str == "DEFAULT" || str == "default"){
+        return FIFOPlacement::DEFAULT;
+    }else if(str == "PRODUCER" || str == "producer"){
+        return FIFOPlacement::PRODUCER;
+    }else if(str == "CONSUMER" || str == "consumer"){
+        return FIFOPlacement::CONSUMER;
+    }else if(str == "INTERLEAVED" || str == "interleaved"){
+        return FIFOPlacement::INTERLEAVED;
+    }else if(str == "SPLIT" || str == "split"){
+        return FIFOPlacement::SPLIT;
+    }else{
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Unable to parse FIFOPlacement " + str));
+    }
+}
+
+std::string ThreadCrossingFIFOParameters::fifoPlacementToString(ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement) {
+    switch(fifoPlacement) {
+        case FIFOPlacement::DEFAULT:
+            return "DEFAULT";
+        case FIFOPlacement::PRODUCER:
+            return "PRODUCER";
+        case FIFOPlacement::CONSUMER:
+            return "CONSUMER";
+        case FIFOPlacement::INTERLEAVED:
+            return "INTERLEAVED";
+        case FIFOPlacement::SPLIT:
+            return "SPLIT";
+        default:
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown FIFOPlacement"));
+    }
+}
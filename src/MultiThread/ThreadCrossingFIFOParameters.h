@@ -22,13 +22,30 @@ public:
      */
     enum class ThreadCrossingFIFOType{
         LOCKLESS_X86, ///< A lockeless FIFO that relies on the memory semantics of x86 processors (atomic write and write order preservation from single core)
-        LOCKLESS_INPLACE_X86 ///< A lockeless FIFO that relies on the memory semantics of x86 processors (atomic write and write order preservation from single core).  Operations occure in place instead of copying to/from local buffers
+        LOCKLESS_INPLACE_X86, ///< A lockeless FIFO that relies on the memory semantics of x86 processors (atomic write and write order preservation from single core).  Operations occure in place instead of copying to/from local buffers,
+        LOCKLESS_BATCHED_COMMIT_X86 ///< A lockeless FIFO (like LOCKLESS_X86) where the read and write offsets are only published to the other thread after a configurable number of blocks (the commit batch) have been read or written.  Pending blocks are published when the thread stalls.  Reduces coherence traffic on the offsets when blocks are small
     };
 
     static ThreadCrossingFIFOType parseThreadCrossingFIFOType(std::string str);
 
     static std::string threadCrossingFIFOTypeToString(ThreadCrossingFIFOType threadCrossingFifoType);
 
+    /**
+     * @brief Where the shared variables (read/write offsets and array) of a FIFO are placed in memory.  Matters when
+     * the producer and consumer run on cores in different NUMA nodes
+     */
+    enum class FIFOPlacement{
+        DEFAULT, ///< No placement was specified for this FIFO.  Replaced by the global placement when the FIFO is emitted
+        PRODUCER, ///< The offsets and array are allocated on the producer's core
+        CONSUMER, ///< The offsets and array are allocated on the consumer's core
+        INTERLEAVED, ///< The offsets are allocated on the producer's core.  The pages of the array are interleaved across the NUMA nodes of the producer and consumer
+        SPLIT ///< Each offset is allocated on the core which writes it (the write offset on the producer, the read offset on the consumer).  The array is allocated on the consumer's core
+    };
+
+    static FIFOPlacement parseFIFOPlacement(std::string str);
+
+    static std::string fifoPlacementToString(FIFOPlacement fifoPlacement);
+
     enum class CopyMode{
         ASSIGN, ///< Uses a standard assign
         MEMCPY, ///< Uses the standard call to memcpy
@@ -358,130 +358,139 @@ void ContextPasses::rewireArcsToContexts(Design &design, std::vector<std::shared
     for(unsigned long i = 0; i<candidateArcs.size(); i++){
         std::shared_ptr<Arc> candidateArc = candidateArcs[i];
 
-        std::vector<Context> srcContext = candidateArc->getSrcPort()->getParent()->getContext();
-        std::vector<Context> dstContext = candidateArc->getDstPort()->getParent()->getContext();
-
-        //ContextRoots are not within their own contexts.  However, we need to make sure the inputs and output
-        //arcs to the ContextRoots are elevated to the ContextFamily container for that ContextRoot as if it were in its
-        //own subcontext.  We will therefore check for context roots and temporarily insert a dummy context entry
-        std::shared_ptr<ContextRoot> srcAsContextRoot = GeneralHelper::isType<Node, ContextRoot>(candidateArc->getSrcPort()->getParent());
-        std::shared_ptr<DummyReplica> srcAsDummyReplica = GeneralHelper::isType<Node, DummyReplica>(candidateArc->getSrcPort()->getParent());
-        if(srcAsContextRoot){
-            srcContext.push_back(Context(srcAsContextRoot, -1));
-        }else if(srcAsDummyReplica){
-            srcContext.push_back(Context(srcAsDummyReplica->getDummyOf(), -1));
+        std::shared_ptr<OutputPort> srcPort;
+        std::shared_ptr<InputPort> dstPort;
+        if(findContextRewiredPorts(candidateArc, srcPort, dstPort)){
+            std::shared_ptr<Arc> rewiredArc = Arc::connectNodes(srcPort, dstPort, candidateArc->getDataType(),
+                                                                candidateArc->getSampleTime());
+
+            //Add the orig and rewired arcs to the vectors to return
+            origArcs.push_back(candidateArc);
+            contextArcs.push_back({rewiredArc});
         }
-        std::shared_ptr<ContextRoot> dstAsContextRoot = GeneralHelper::isType<Node, ContextRoot>(candidateArc->getDstPort()->getParent());
-        std::shared_ptr<DummyReplica> dstAsDummyReplica = GeneralHelper::isType<Node, DummyReplica>(candidateArc->getDstPort()->getParent());
-        if(dstAsContextRoot){
-            dstContext.push_back(Context(dstAsContextRoot, -1));
-        }else if(dstAsDummyReplica){
-            dstContext.push_back(Context(dstAsDummyReplica->getDummyOf(), -1));
-        }
-
-        bool rewireSrc = false;
-        bool rewireDst = false;
-
-        //Basically, we need to re-wire the arc if the src and destination are not in the same context for the perpose of scheduling
-        //If the the destination is in a subcontext of where the src is, the source does not need to be rewired.
-        //However, the destination will need to be re-wired up to the ContextFamilyContainer that resides at the same
-        //Context level as the source
-
-        //If the src is in a subcontext compared to the destination, the source needs to be re-wired up to the ContextFamilyContainer
-        //that resides at the same level as the destination.  The destination does not need to be re-wired.
+    }
+}
 
-        //The case where both the source and destination need to be re-wired is when they are in seperate subcontexts
-        //and one is not nested inside the other.
+bool ContextPasses::findContextRewiredPorts(std::shared_ptr<Arc> candidateArc, std::shared_ptr<OutputPort> &srcPort, std::shared_ptr<InputPort> &dstPort) {
+    std::vector<Context> srcContext = candidateArc->getSrcPort()->getParent()->getContext();
+    std::vector<Context> dstContext = candidateArc->getDstPort()->getParent()->getContext();
+
+    //ContextRoots are not within their own contexts.  However, we need to make sure the inputs and output
+    //arcs to the ContextRoots are elevated to the ContextFamily container for that ContextRoot as if it were in its
+    //own subcontext.  We will therefore check for context roots and temporarily insert a dummy context entry
+    std::shared_ptr<ContextRoot> srcAsContextRoot = GeneralHelper::isType<Node, ContextRoot>(candidateArc->getSrcPort()->getParent());
+    std::shared_ptr<DummyReplica> srcAsDummyReplica = GeneralHelper::isType<Node, DummyReplica>(candidateArc->getSrcPort()->getParent());
+    if(srcAsContextRoot){
+        srcContext.push_back(Context(srcAsContextRoot, -1));
+    }else if(srcAsDummyReplica){
+        srcContext.push_back(Context(srcAsDummyReplica->getDummyOf(), -1));
+    }
+    std::shared_ptr<ContextRoot> dstAsContextRoot = GeneralHelper::isType<Node, ContextRoot>(candidateArc->getDstPort()->getParent());
+    std::shared_ptr<DummyReplica> dstAsDummyReplica = GeneralHelper::isType<Node, DummyReplica>(candidateArc->getDstPort()->getParent());
+    if(dstAsContextRoot){
+        dstContext.push_back(Context(dstAsContextRoot, -1));
+    }else if(dstAsDummyReplica){
+        dstContext.push_back(Context(dstAsDummyReplica->getDummyOf(), -1));
+    }
 
-        //We may also need to re-wire the the arc for nodes in the same context if they are in different partitions
+    bool rewireSrc = false;
+    bool rewireDst = false;
 
-        /* Since we are now checking for partitions, it is possible for the source and destination to
-         * actually be in the same context but in different partitions (different ContextFamilyContainers)
-         * We need to pick the appropriate ContextFamilyContainer partition
-         */
+    //Basically, we need to re-wire the arc if the src and destination are not in the same context for the perpose of scheduling
+    //If the the destination is in a subcontext of where the src is, the source does not need to be rewired.
+    //However, the destination will need to be re-wired up to the ContextFamilyContainer that resides at the same
+    //Context level as the source
 
-        //Check if the src should be rewired
-        //TODO: Refactor since we may not actually re-wire one of the sides if the partitions don't match
-        //We do not re-wire the src if the src in dst are in different partitions if the src is not in a context.  In this case, the src remains the same (the origional node in the general context)
-        //We do re-wire the src if it is in a different partition and is in a context.  We then need to elevate the arc to the ContextFamilyContainer of the particular partition
-        if((!Context::isEqOrSubContext(dstContext, srcContext)) || ((candidateArc->getSrcPort()->getParent()->getPartitionNum() != candidateArc->getDstPort()->getParent()->getPartitionNum()) && !srcContext.empty())){
-            rewireSrc = true;
-        }
+    //If the src is in a subcontext compared to the destination, the source needs to be re-wired up to the ContextFamilyContainer
+    //that resides at the same level as the destination.  The destination does not need to be re-wired.
 
-        //Check if the dst should be rewired
-        //Similarly to the src, the dest is not re-wired if is in a different partition but is not within a context
-        if((!Context::isEqOrSubContext(srcContext, dstContext)) || ((candidateArc->getSrcPort()->getParent()->getPartitionNum() != candidateArc->getDstPort()->getParent()->getPartitionNum()) && !dstContext.empty())){
-            rewireDst = true;
-        }
+    //The case where both the source and destination need to be re-wired is when they are in seperate subcontexts
+    //and one is not nested inside the other.
 
-        if(rewireSrc || rewireDst){
-            std::shared_ptr<OutputPort> srcPort;
-            std::shared_ptr<InputPort> dstPort;
+    //We may also need to re-wire the the arc for nodes in the same context if they are in different partitions
 
-            if(rewireSrc){
-                long commonContextInd = Context::findMostSpecificCommonContext(srcContext, dstContext);
-                std::shared_ptr<ContextRoot> newSrcAsContextRoot;
+    /* Since we are now checking for partitions, it is possible for the source and destination to
+     * actually be in the same context but in different partitions (different ContextFamilyContainers)
+     * We need to pick the appropriate ContextFamilyContainer partition
+     */
 
-                if(commonContextInd+1 > srcContext.size()){
-                    throw std::runtime_error(ErrorHelpers::genErrorStr("Unexpected common context found when re-wiring arcs to src", candidateArc->getSrcPort()->getParent()));
-                }else if(commonContextInd+1 == srcContext.size()){
-                    //The dst is at or below the src context but they are in different partitions
-                    //Need to re-wire the src to be the ContextFamilyContainer for its particular
-                    newSrcAsContextRoot = srcContext[commonContextInd].getContextRoot();
-                }else{
-                    //The dst is above the src in context, need to rewire
-                    newSrcAsContextRoot = srcContext[commonContextInd+1].getContextRoot();
-                }//The case of the src not having a context is handled when checking if src rewiring is needed
+    //Check if the src should be rewired
+    //TODO: Refactor since we may not actually re-wire one of the sides if the partitions don't match
+    //We do not re-wire the src if the src in dst are in different partitions if the src is not in a context.  In this case, the src remains the same (the origional node in the general context)
+    //We do re-wire the src if it is in a different partition and is in a context.  We then need to elevate the arc to the ContextFamilyContainer of the particular partition
+    if((!Context::isEqOrSubContext(dstContext, srcContext)) || ((candidateArc->getSrcPort()->getParent()->getPartitionNum() != candidateArc->getDstPort()->getParent()->getPartitionNum()) && !srcContext.empty())){
+        rewireSrc = true;
+    }
 
-                //TODO: fix diamond inheritcance
+    //Check if the dst should be rewired
+    //Similarly to the src, the dest is not re-wired if is in a different partition but is not within a context
+    if((!Context::isEqOrSubContext(srcContext, dstContext)) || ((candidateArc->getSrcPort()->getParent()->getPartitionNum() != candidateArc->getDstPort()->getParent()->getPartitionNum()) && !dstContext.empty())){
+        rewireDst = true;
+    }
 
-                srcPort = newSrcAsContextRoot->getContextFamilyContainers()[candidateArc->getSrcPort()->getParent()->getPartitionNum()]->getOrderConstraintOutputPort();
+    if(rewireSrc || rewireDst){
+        if(rewireSrc){
+            long commonContextInd = Context::findMostSpecificCommonContext(srcContext, dstContext);
+            std::shared_ptr<ContextRoot> newSrcAsContextRoot;
+
+            if(commonContextInd+1 > srcContext.size()){
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Unexpected common context found when re-wiring arcs to src", candidateArc->getSrcPort()->getParent()));
+            }else if(commonContextInd+1 == srcContext.size()){
+                //The dst is at or below the src context but they are in different partitions
+                //Need to re-wire the src to be the ContextFamilyContainer for its particular
+                newSrcAsContextRoot = srcContext[commonContextInd].getContextRoot();
             }else{
-                srcPort = candidateArc->getSrcPort();
-            }
+                //The dst is above the src in context, need to rewire
+                newSrcAsContextRoot = srcContext[commonContextInd+1].getContextRoot();
+            }//The case of the src not having a context is handled when checking if src rewiring is needed
 
-            if(rewireDst){
-                long commonContextInd = Context::findMostSpecificCommonContext(srcContext, dstContext);
+            //TODO: fix diamond inheritcance
 
-                std::shared_ptr<ContextRoot> newDstAsContextRoot;
-                if(commonContextInd+1 > dstContext.size()){
-                    throw std::runtime_error(ErrorHelpers::genErrorStr("Unexpected common context found when re-wiring arcs to dst", candidateArc->getDstPort()->getParent()));
-                }else if(commonContextInd+1 == dstContext.size()){
-                    //The src is at or below the dest context but they are in different partitions
-                    //Need to re-wire to the ContextFamilyContainer for the partition
-                    newDstAsContextRoot = dstContext[commonContextInd].getContextRoot();
-                }else{
-                    newDstAsContextRoot = dstContext[commonContextInd+1].getContextRoot();
-                }
+            srcPort = newSrcAsContextRoot->getContextFamilyContainers()[candidateArc->getSrcPort()->getParent()->getPartitionNum()]->getOrderConstraintOutputPort();
+        }else{
+            srcPort = candidateArc->getSrcPort();
+        }
 
-                //TODO: fix diamond inheritcance
+        if(rewireDst){
+            long commonContextInd = Context::findMostSpecificCommonContext(srcContext, dstContext);
 
-                dstPort = newDstAsContextRoot->getContextFamilyContainers()[candidateArc->getDstPort()->getParent()->getPartitionNum()]->getOrderConstraintInputPort();
+            std::shared_ptr<ContextRoot> newDstAsContextRoot;
+            if(commonContextInd+1 > dstContext.size()){
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Unexpected common context found when re-wiring arcs to dst", candidateArc->getDstPort()->getParent()));
+            }else if(commonContextInd+1 == dstContext.size()){
+                //The src is at or below the dest context but they are in different partitions
+                //Need to re-wire to the ContextFamilyContainer for the partition
+                newDstAsContextRoot = dstContext[commonContextInd].getContextRoot();
             }else{
-                dstPort = candidateArc->getDstPort();
+                newDstAsContextRoot = dstContext[commonContextInd+1].getContextRoot();
             }
 
-            //Handle the special case when going between subcontexts under the same ContextFamilyContainer.  This should
-            //only occur when the dst is the context root for the ContextFamilyContainer.  In this case, do not rewire
-            if(srcPort->getParent() == dstPort->getParent()){
-                std::shared_ptr<ContextRoot> origDstAsContextRoot = GeneralHelper::isType<Node, ContextRoot>(candidateArc->getDstPort()->getParent());
-                if(origDstAsContextRoot == nullptr){
-                    throw std::runtime_error("Attempted to Rewire a Context Arc into a Self Loop");
-                }
+            //TODO: fix diamond inheritcance
 
-                if(origDstAsContextRoot->getContextFamilyContainers()[candidateArc->getDstPort()->getParent()->getPartitionNum()] != dstPort->getParent()){
-                    throw std::runtime_error("Attempted to Rewire a Context Arc into a Self Loop");
-                }
-            }else {
-                std::shared_ptr<Arc> rewiredArc = Arc::connectNodes(srcPort, dstPort, candidateArc->getDataType(),
-                                                                    candidateArc->getSampleTime());
+            dstPort = newDstAsContextRoot->getContextFamilyContainers()[candidateArc->getDstPort()->getParent()->getPartitionNum()]->getOrderConstraintInputPort();
+        }else{
+            dstPort = candidateArc->getDstPort();
+        }
+
+        //Handle the special case when going between subcontexts under the same ContextFamilyContainer.  This should
+        //only occur when the dst is the context root for the ContextFamilyContainer.  In this case, do not rewire
+        if(srcPort->getParent() == dstPort->getParent()){
+            std::shared_ptr<ContextRoot> origDstAsContextRoot = GeneralHelper::isType<Node, ContextRoot>(candidateArc->getDstPort()->getParent());
+            if(origDstAsContextRoot == nullptr){
+                throw std::runtime_error("Attempted to Rewire a Context Arc into a Self Loop");
+            }
 
-                //Add the orig and rewired arcs to the vectors to return
-                origArcs.push_back(candidateArc);
-                contextArcs.push_back({rewiredArc});
+            if(origDstAsContextRoot->getContextFamilyContainers()[candidateArc->getDstPort()->getParent()->getPartitionNum()] != dstPort->getParent()){
+                throw std::runtime_error("Attempted to Rewire a Context Arc into a Self Loop");
             }
+
+            return false;
         }
+
+        return true;
     }
+
+    return false;
 }
 
 std::shared_ptr<ContextFamilyContainer> ContextPasses::getContextFamilyContainerCreateIfNotNoParent(
@@ -115,6 +115,20 @@ namespace ContextPasses {
      */
     void rewireArcsToContexts(Design &design, std::vector<std::shared_ptr<Arc>> &origArcs, std::vector<std::vector<std::shared_ptr<Arc>>> &contextArcs);
 
+    /**
+     * @brief Determines if a single (non context driver) arc should be rewired to ContextFamilyContainers and, if so,
+     * the ports the rewired arc should connect.
+     *
+     * This is the per-arc decision made by @ref rewireArcsToContexts.  It does not create any arcs or modify the design
+     * and can therefore be used to compute the rewired graph without altering it (ex. by the indexed scheduler).
+     *
+     * @param candidateArc the arc to check
+     * @param srcPort set to the src port of the rewired arc (only valid if true is returned)
+     * @param dstPort set to the dst port of the rewired arc (only valid if true is returned)
+     * @return true if the arc should be rewired, false if the arc should be kept as is
+     */
+    bool findContextRewiredPorts(std::shared_ptr<Arc> candidateArc, std::shared_ptr<OutputPort> &srcPort, std::shared_ptr<InputPort> &dstPort);
+
     /**
      * @brief Gets the ContextFamilyContainer for the provided context root if one exists (is in the ContextRoot's map of ContextFamilyContainers).
      *
@@ -14,6 +14,9 @@
 #include "GraphCore/ContextFamilyContainer.h"
 #include "GraphCore/StateUpdate.h"
 #include "General/GraphAlgs.h"
+#include "PrimitiveNodes/InnerProduct.h"
+#include "PrimitiveNodes/Sum.h"
+#include "PrimitiveNodes/Product.h"
 #include <iostream>
 
 void DesignPasses::createStateUpdateNodes(Design &design, bool includeContext) {
@@ -321,4 +324,18 @@ void DesignPasses::assignSubBlockingLengthToUnassignedSubsystems(Design &design,
             }
         }
     }
-}
\ No newline at end of file
+}
+
+void DesignPasses::setSIMDTarget(Design &design, SIMDHelpers::SIMDTarget simdTarget){
+    std::vector<std::shared_ptr<Node>> nodes = design.getNodes();
+
+    for(const std::shared_ptr<Node> &node : nodes){
+        if(std::shared_ptr<InnerProduct> asInnerProduct = GeneralHelper::isType<Node, InnerProduct>(node)){
+            asInnerProduct->setSimdTarget(simdTarget);
+        }else if(std::shared_ptr<Sum> asSum = GeneralHelper::isType<Node, Sum>(node)){
+            asSum->setSimdTarget(simdTarget);
+        }else if(std::shared_ptr<Product> asProduct = GeneralHelper::isType<Node, Product>(node)){
+            asProduct->setSimdTarget(simdTarget);
+        }
+    }
+}
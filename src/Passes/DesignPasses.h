@@ -8,6 +8,7 @@
 #include <string>
 
 #include "GraphCore/Design.h"
+#include "General/SIMDHelpers.h"
 
 /**
  * \addtogroup Passes Design Passes/Transforms
@@ -100,6 +101,15 @@ namespace DesignPasses {
      */
     void assignSubBlockingLengthToUnassignedSubsystems(Design &design, bool printWarning, bool errorIfUnableToSet);
 
+    /**
+     * @brief Sets the SIMD target of nodes which support emitting explicit vector code (InnerProduct, Sum, and Product)
+     *
+     * Gain nodes are expanded to Products and are covered by the Product
+     *
+     * @param simdTarget the SIMD target to emit vector code for.  If NONE, vector code is not emitted
+     */
+    void setSIMDTarget(Design &design, SIMDHelpers::SIMDTarget simdTarget);
+
 };
 
 /*! @} */
@@ -11,6 +11,7 @@
 #include "MasterNodes/MasterUnconnected.h"
 #include "MultiThread/ThreadCrossingFIFO.h"
 #include "General/GraphAlgs.h"
+#include "GraphCore/DesignGraphView.h"
 #include "General/ErrorHelpers.h"
 #include "Blocking/BlockingHelpers.h"
 #include "Blocking/BlockingDomain.h"
@@ -22,6 +23,10 @@
 #include "GraphCore/DummyReplica.h"
 #include "PrimitiveNodes/Constant.h"
 #include "Blocking/BlockingDomainBridge.h"
+#include "Blocking/BlockingBoundary.h"
+#include "PrimitiveNodes/InnerProduct.h"
+#include "MultiRate/DownsampleInput.h"
+#include "MultiRate/UpsampleOutput.h"
 
 #include <iostream>
 
@@ -470,6 +475,98 @@ void DomainPasses::setMasterBlockSizesBasedOnPortClockDomain(Design &design, int
     design.getVisMaster()->setPortBlockSizesBasedOnClockDomain(baseBlockingLength);
 }
 
+void DomainPasses::fusePolyphaseFIRs(Design &design){
+    std::vector<std::shared_ptr<Node>> nodes = design.getNodes();
+
+    for(const std::shared_ptr<Node> &node : nodes){
+        std::shared_ptr<InnerProduct> innerProduct = GeneralHelper::isType<Node, InnerProduct>(node);
+        if(innerProduct == nullptr || innerProduct->getSubBlockingLength() <= 1){
+            continue;
+        }
+        int subBlockingLength = innerProduct->getSubBlockingLength();
+
+        //Check for a sub-blocked TappedDelay presenting the samples oldest first ([subBlock][taps])
+        std::shared_ptr<OutputPort> sampleSrcPort = innerProduct->getInputPort(1)->getSrcOutputPort();
+        std::shared_ptr<TappedDelay> tappedDelay = sampleSrcPort == nullptr ? nullptr : GeneralHelper::isType<Node, TappedDelay>(sampleSrcPort->getParent());
+        if(tappedDelay == nullptr || tappedDelay->getTransactionBlockSize() != subBlockingLength || tappedDelay->isEarliestFirst()){
+            continue;
+        }
+        std::vector<int> sampleDims = innerProduct->getInputPort(1)->getDataType().getDimensions();
+        if(sampleDims.size() != 2 || innerProduct->getInputPort(0)->getDataType().getDimensions().size() != 2){
+            continue;
+        }
+        int numSamples = sampleDims[1];
+
+        //==== FIR->Downsample ====
+        //Find the consumers of the InnerProduct, traversing blocking boundaries
+        int decimation = 0;
+        bool decimationFound = true;
+        std::vector<std::shared_ptr<OutputPort>> portsToVisit = {innerProduct->getOutputPort(0)};
+        while(!portsToVisit.empty() && decimationFound){
+            std::shared_ptr<OutputPort> port = portsToVisit.back();
+            portsToVisit.pop_back();
+
+            std::set<std::shared_ptr<Arc>> outArcs = port->getArcs();
+            if(outArcs.empty()){
+                decimationFound = false;
+            }
+            for(const std::shared_ptr<Arc> &outArc : outArcs){
+                std::shared_ptr<Node> dst = outArc->getDstPort()->getParent();
+                std::shared_ptr<DownsampleInput> downsample = GeneralHelper::isType<Node, DownsampleInput>(dst);
+                if(GeneralHelper::isType<Node, BlockingBoundary>(dst) != nullptr){
+                    portsToVisit.push_back(dst->getOutputPort(0));
+                }else if(downsample != nullptr && downsample->isUsingVectorSamplingMode() &&
+                         (decimation == 0 || decimation == downsample->getDownsampleRatio())){
+                    decimation = downsample->getDownsampleRatio();
+                }else{
+                    decimationFound = false;
+                }
+            }
+        }
+
+        if(decimationFound && decimation > 1){
+            if(subBlockingLength % decimation == 0){
+                innerProduct->setPolyphaseDecimation(decimation);
+            }else{
+                std::cerr << ErrorHelpers::genWarningStr("FIR feeds a Downsample by " + GeneralHelper::to_string(decimation) + " but the sub-blocking length (" + GeneralHelper::to_string(subBlockingLength) + ") is not a multiple of the downsample ratio, the FIR will not be emitted as a polyphase filter", innerProduct) << std::endl;
+            }
+        }
+
+        //==== Upsample->FIR ====
+        //Find the source of the TappedDelay, traversing blocking boundaries
+        std::shared_ptr<OutputPort> delaySrcPort = tappedDelay->getInputPort(0)->getSrcOutputPort();
+        while(delaySrcPort != nullptr && GeneralHelper::isType<Node, BlockingBoundary>(delaySrcPort->getParent()) != nullptr){
+            delaySrcPort = delaySrcPort->getParent()->getInputPort(0)->getSrcOutputPort();
+        }
+        std::shared_ptr<UpsampleOutput> upsample = delaySrcPort == nullptr ? nullptr : GeneralHelper::isType<Node, UpsampleOutput>(delaySrcPort->getParent());
+        if(upsample == nullptr || !upsample->isUsingVectorSamplingMode() || upsample->getUpsampleRatio() <= 1){
+            continue;
+        }
+        int interpolation = upsample->getUpsampleRatio();
+
+        //The history before the first sample is only zero stuffed if the initial conditions are 0
+        bool zeroInit = true;
+        for(const NumericValue &initCond : tappedDelay->getInitCondition()){
+            if(BlockFIRHelpers::toComplexDouble(initCond) != std::complex<double>(0, 0)){
+                zeroInit = false;
+            }
+        }
+
+        if(!zeroInit){
+            std::cerr << ErrorHelpers::genWarningStr("FIR is fed by an Upsample but has non-zero initial conditions, the FIR will not be emitted as a polyphase filter", innerProduct) << std::endl;
+        }else if(subBlockingLength % interpolation != 0){
+            std::cerr << ErrorHelpers::genWarningStr("FIR is fed by an Upsample by " + GeneralHelper::to_string(interpolation) + " but the sub-blocking length (" + GeneralHelper::to_string(subBlockingLength) + ") is not a multiple of the upsample ratio, the FIR will not be emitted as a polyphase filter", innerProduct) << std::endl;
+        }else{
+            //The sample at tap k of output i in the sub-block is delayed by numSamples-1-k (+1 if the TappedDelay does
+            //not include the current sample).  The sub-block starts at phase 0 so the sample is non-zero when
+            //i-delay is a multiple of the upsample ratio
+            int newestTapDelay = tappedDelay->isAllocateExtraSpace() ? 0 : 1;
+            int phase = (numSamples-1+newestTapDelay) % interpolation;
+            innerProduct->setPolyphaseInterpolation(interpolation, phase);
+        }
+    }
+}
+
 void DomainPasses::setMasterBlockOrigDataTypes(Design &design){
     design.getInputMaster()->setPortOriginalDataTypesBasedOnCurrentTypes();
     design.getOutputMaster()->setPortOriginalDataTypesBasedOnCurrentTypes();
@@ -947,19 +1044,24 @@ void DomainPasses::blockAndSubBlockDesign(Design &design, int baseBlockingLength
             designClone.addRemoveNodesAndArcs(emptyNodeSet, emptyNodeSet, emptyArcSet, arcsToDisconnect);
         }
 
-        //Find the strongly connected components in the design
+        //Find the strongly connected components in the design (excluding the master nodes)
+        DesignGraphView cloneView(designClone);
+        std::vector<bool> searchNodes(cloneView.getNumNodes(), true);
         std::set<std::shared_ptr<Node>> cloneMasterNodes = designClone.getMasterNodes();
-        std::set<std::set<std::shared_ptr<Node>>> cloneStronglyConnectedComponents = GraphAlgs::findStronglyConnectedComponents(
-                designClone.getNodes(), cloneMasterNodes);
+        for (const std::shared_ptr<Node> &cloneMasterNode: cloneMasterNodes) {
+            searchNodes[cloneView.getNodeIndex(cloneMasterNode)] = false;
+        }
+        DesignGraphView::StronglyConnectedComponents cloneStronglyConnectedComponents = cloneView.findStronglyConnectedComponents(searchNodes);
 
         //Translate back to the original design:
         std::set<std::set<std::shared_ptr<Node>>> stronglyConnectedComponents;
 
-        for (const std::set<std::shared_ptr<Node>> &cloneStronglyConnectedComponent: cloneStronglyConnectedComponents) {
+        for (DesignGraphView::Index component = 0; component < cloneStronglyConnectedComponents.getNumComponents(); component++) {
             std::set<std::shared_ptr<Node>> stronglyConnectedComponent;
 
-            for (const std::shared_ptr<Node> &cloneNode: cloneStronglyConnectedComponent) {
-                stronglyConnectedComponent.insert(copyToOrigNode[cloneNode]);
+            for (const DesignGraphView::Index *cloneNode = cloneStronglyConnectedComponents.componentBegin(component);
+                 cloneNode != cloneStronglyConnectedComponents.componentEnd(component); cloneNode++) {
+                stronglyConnectedComponent.insert(copyToOrigNode[cloneView.getNode(*cloneNode)]);
             }
             stronglyConnectedComponents.insert(stronglyConnectedComponent);
         }
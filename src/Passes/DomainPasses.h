@@ -109,6 +109,29 @@ namespace DomainPasses {
      */
     void setMasterBlockSizesBasedOnPortClockDomain(Design &design, int baseBlockingLength);
 
+    /**
+     * @brief Fuses sub-blocked FIR filters (a TappedDelay feeding an InnerProduct) with adjacent rate changes of
+     *        vector mode clock domains into polyphase filters
+     *
+     * Two patterns are recognized:
+     *   - FIR→Downsample: The output of the InnerProduct is only consumed by DownsampleInputs with the same ratio M.
+     *     Only every M-th output is retained so only those outputs are computed.
+     *   - Upsample→FIR: The TappedDelay is fed by an UpsampleOutput with ratio L and has zero initial conditions.  Only
+     *     1 in L samples in the delay line is non-zero so only the taps aligned with those samples are accumulated.
+     *
+     * BlockingInput and BlockingOutput nodes between the FIR and the rate change are traversed.
+     *
+     * In vector sampling mode, every block processed outside of the clock domain starts at phase 0 of the rate change.
+     * When the sub-blocking length of the FIR is a multiple of the rate change, the retained outputs and non-zero
+     * samples are at fixed positions within each sub-block.  FIRs where this is not the case are left unchanged.
+     *
+     * @warning Should be called after blockAndSubBlockDesign (once the sub-blocking lengths and vector sampling modes
+     *          are known)
+     *
+     * @param design the design to transform
+     */
+    void fusePolyphaseFIRs(Design &design);
+
     /**
      * @brief Sets the original DataTypes (pre-blocking) for I/O Master Nodes
      *
@@ -865,6 +865,7 @@ void MultiThreadPasses::mergeFIFOs(
                     }
 
                     //Merge the other properties of this FIFO
+                    fifoToMergeInto->setFifoPlacement(MultiThreadPasses::mergeFIFOPlacements(fifoToMergeInto->getFifoPlacement(), fifoToMergeFrom->getFifoPlacement(), fifoToMergeInto));
 
                     //Transfer Order Constraint Input Arcs
                     std::set<std::shared_ptr<Arc>> orderConstraintInputArcs = fifoToMergeFrom->getOrderConstraintInputArcs();
@@ -937,4 +938,21 @@ void MultiThreadPasses::propagatePartitionsFromSubsystemsToChildren(Design &desi
     topLevelNodeSet.insert(topLevelNodes.begin(), topLevelNodes.end());
 
     propagatePartitionsFromSubsystemsToChildren(topLevelNodeSet, -1);
-}
\ No newline at end of file
+}
+
+ThreadCrossingFIFOParameters::FIFOPlacement MultiThreadPasses::mergeFIFOPlacements(ThreadCrossingFIFOParameters::FIFOPlacement a,
+                                                                                 ThreadCrossingFIFOParameters::FIFOPlacement b,
+                                                                                 std::shared_ptr<Node> fifo) {
+    if(a == ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT){
+        return b;
+    }
+
+    if(b != ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT && a != b){
+        std::cerr << ErrorHelpers::genWarningStr("Conflicting FIFO placements (" +
+                     ThreadCrossingFIFOParameters::fifoPlacementToString(a) + ", " +
+                     ThreadCrossingFIFOParameters::fifoPlacementToString(b) + ") for a single FIFO, using " +
+                     ThreadCrossingFIFOParameters::fifoPlacementToString(a), fifo) << std::endl;
+    }
+
+    return a;
+}
@@ -43,6 +43,18 @@ namespace MultiThreadPasses {
         PARTIAL_ABSORPTION_MERGE_INIT_COND
     };
 
+    /**
+     * @brief Combines the placements of FIFOs (or partition crossing arcs) which are being merged into a single FIFO
+     *
+     * A DEFAULT placement takes the other placement.  If both are specified and disagree, a warning is printed and the
+     * first placement is kept
+     *
+     * @param fifo the FIFO the placement is for (used in the warning)
+     */
+    ThreadCrossingFIFOParameters::FIFOPlacement mergeFIFOPlacements(ThreadCrossingFIFOParameters::FIFOPlacement a,
+                                                                    ThreadCrossingFIFOParameters::FIFOPlacement b,
+                                                                    std::shared_ptr<Node> fifo);
+
     /**
      * @brief Inserts partition (thread) crossing FIFOs into the design at the specified points.
      *
@@ -161,6 +173,16 @@ namespace MultiThreadPasses {
 
                 fifo->setBaseSubBlockSizeOut(0, baseSubBlockingLengthOutput);
 
+                //Apply any placement annotation on the crossing (or the arc into the BlockingDomainBridge it replaces)
+                std::vector<std::shared_ptr<Arc>> placementArcs = partitionPairGroups[groupInd];
+                if(srcAsBlockingDomainBridge){
+                    std::set<std::shared_ptr<Arc>> bridgeInputArcs = srcAsBlockingDomainBridge->getDirectInputArcs();
+                    placementArcs.insert(placementArcs.end(), bridgeInputArcs.begin(), bridgeInputArcs.end());
+                }
+                for(const std::shared_ptr<Arc> &placementArc : placementArcs){
+                    fifo->setFifoPlacement(MultiThreadPasses::mergeFIFOPlacements(fifo->getFifoPlacement(), placementArc->getFifoPlacement(), fifo));
+                }
+
                 crossingFIFOs.push_back(fifo);
 
                 if(srcAsBlockingDomainBridge){
@@ -0,0 +1,751 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "PartitioningPasses.h"
+
+#include "General/GeneralHelper.h"
+#include "General/ErrorHelpers.h"
+#include "General/GraphAlgs.h"
+#include "GraphCore/SubSystem.h"
+#include "GraphCore/EnableNode.h"
+#include "GraphCore/OrderConstraintOutputPort.h"
+#include "MultiRate/ClockDomain.h"
+#include "MultiRate/RateChange.h"
+#include "MultiRate/MultiRateHelpers.h"
+#include "Estimators/ComputationEstimator.h"
+#include "Estimators/CommunicationEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+PartitioningPasses::ClusterGraph PartitioningPasses::buildClusterGraph(Design &design, const ComputationCostTable &costTable){
+    ClusterGraph clusterGraph;
+
+    //==== Find the nodes to partition ====
+    //Subsystems are not partitioned directly (they are assigned later based on their children) and the master nodes
+    //reside in the I/O partition
+    std::set<std::shared_ptr<Node>> masterNodes = design.getMasterNodes();
+    std::vector<std::shared_ptr<Node>> &nodes = clusterGraph.nodes;
+    std::map<std::shared_ptr<Node>, int> nodeIndex;
+    std::vector<std::shared_ptr<ClockDomain>> clockDomains;
+    {
+        std::vector<std::shared_ptr<Node>> designNodes = design.getNodes();
+        for (const std::shared_ptr<Node> &node: designNodes) {
+            if (GeneralHelper::isType<Node, SubSystem>(node) != nullptr) {
+                std::shared_ptr<ClockDomain> asClockDomain = GeneralHelper::isType<Node, ClockDomain>(node);
+                if(asClockDomain != nullptr){
+                    clockDomains.push_back(asClockDomain);
+                }
+            } else if (masterNodes.find(node) == masterNodes.end()) {
+                nodeIndex[node] = nodes.size();
+                nodes.push_back(node);
+            }
+        }
+    }
+
+    if(nodes.empty()){
+        return clusterGraph;
+    }
+
+    //==== Group nodes which must reside in the same partition ====
+    //Nodes under the same (outermost) ClockDomain, including its RateChange nodes, are grouped.  A union-find is used
+    //to create these initial groups
+    std::vector<int> groupParent(nodes.size());
+    for(int i = 0; i<nodes.size(); i++){
+        groupParent[i] = i;
+    }
+
+    std::map<std::shared_ptr<ClockDomain>, int> clockDomainRepresentative;
+    std::vector<double> nodeRate(nodes.size(), 1.0);
+
+    for(int i = 0; i<nodes.size(); i++){
+        std::shared_ptr<ClockDomain> clockDomain = MultiRateHelpers::findClockDomain(nodes[i]);
+        if(clockDomain != nullptr){
+            std::pair<int, int> rate = clockDomain->getRateRelativeToBase();
+            nodeRate[i] = ((double) rate.first)/rate.second;
+
+            std::shared_ptr<ClockDomain> outerClockDomain = clockDomain;
+            for(std::shared_ptr<ClockDomain> cursor = MultiRateHelpers::findClockDomain(clockDomain); cursor != nullptr; cursor = MultiRateHelpers::findClockDomain(cursor)){
+                outerClockDomain = cursor;
+            }
+
+            if(clockDomainRepresentative.find(outerClockDomain) == clockDomainRepresentative.end()){
+                clockDomainRepresentative[outerClockDomain] = i;
+            }else{
+                groupParent[i] = clockDomainRepresentative[outerClockDomain];
+            }
+        }
+    }
+
+    //Also group RateChange nodes referenced by ClockDomains in case they do not reside under the ClockDomain in the hierarchy
+    for(const std::shared_ptr<ClockDomain> &clockDomain : clockDomains){
+        std::shared_ptr<ClockDomain> outerClockDomain = clockDomain;
+        for(std::shared_ptr<ClockDomain> cursor = MultiRateHelpers::findClockDomain(clockDomain); cursor != nullptr; cursor = MultiRateHelpers::findClockDomain(cursor)){
+            outerClockDomain = cursor;
+        }
+
+        std::set<std::shared_ptr<RateChange>> rateChangeNodes = clockDomain->getRateChangeIn();
+        std::set<std::shared_ptr<RateChange>> rateChangeOut = clockDomain->getRateChangeOut();
+        rateChangeNodes.insert(rateChangeOut.begin(), rateChangeOut.end());
+
+        for(const std::shared_ptr<RateChange> &rateChange : rateChangeNodes){
+            auto rateChangeIndex = nodeIndex.find(rateChange);
+            if(rateChangeIndex == nodeIndex.end()){
+                continue;
+            }
+
+            if(clockDomainRepresentative.find(outerClockDomain) == clockDomainRepresentative.end()){
+                clockDomainRepresentative[outerClockDomain] = rateChangeIndex->second;
+            }
+
+            //Find the roots of both groups and merge them
+            int a = rateChangeIndex->second;
+            while(groupParent[a] != a){
+                a = groupParent[a];
+            }
+            int b = clockDomainRepresentative[outerClockDomain];
+            while(groupParent[b] != b){
+                b = groupParent[b];
+            }
+            groupParent[a] = b;
+        }
+    }
+
+    std::vector<int> initialGroup(nodes.size());
+    std::map<int, int> rootToInitialGroup;
+    for(int i = 0; i<nodes.size(); i++){
+        int root = i;
+        while(groupParent[root] != root){
+            root = groupParent[root];
+        }
+
+        if(rootToInitialGroup.find(root) == rootToInitialGroup.end()){
+            int groupNum = rootToInitialGroup.size();
+            rootToInitialGroup[root] = groupNum;
+        }
+        initialGroup[i] = rootToInitialGroup[root];
+    }
+    int numInitialGroups = rootToInitialGroup.size();
+
+    //==== Find the communication between nodes ====
+    //Values from a single output port going to multiple nodes in another partition are sent in a single FIFO (see
+    //Design::getGroupableCrossings).  The communication is therefore tracked per output port.
+    std::vector<std::shared_ptr<Arc>> arcs = design.getArcs();
+    std::map<std::shared_ptr<OutputPort>, int> crossingIndex;
+    for(const std::shared_ptr<Arc> &arc : arcs){
+        auto srcIndex = nodeIndex.find(arc->getSrcPort()->getParent());
+        auto dstIndex = nodeIndex.find(arc->getDstPort()->getParent());
+        if(srcIndex != nodeIndex.end() && dstIndex != nodeIndex.end() && srcIndex->second != dstIndex->second){
+            auto crossingIt = crossingIndex.find(arc->getSrcPort());
+            if(crossingIt == crossingIndex.end()){
+                NodeCrossing crossing;
+                crossing.srcNode = srcIndex->second;
+                //Order constraint arcs do not carry data
+                if(GeneralHelper::isType<OutputPort, OrderConstraintOutputPort>(arc->getSrcPort()) == nullptr){
+                    crossing.bytesPerBaseRateSample = CommunicationEstimator::getCommunicationBitsForType(arc->getDataType()) / 8.0 * nodeRate[srcIndex->second];
+                }
+                crossingIndex[arc->getSrcPort()] = clusterGraph.crossings.size();
+                clusterGraph.crossings.push_back(crossing);
+                crossingIt = crossingIndex.find(arc->getSrcPort());
+            }
+            clusterGraph.crossings[crossingIt->second].dstNodes.insert(dstIndex->second);
+        }
+    }
+
+    //Strongly connected components of the group graph are merged so that no communication cycles are created between
+    //partitions.  Note that this includes cycles through delays.
+    std::vector<std::vector<int>> groupAdjacency(numInitialGroups);
+    for(const NodeCrossing &crossing : clusterGraph.crossings){
+        int srcGroup = initialGroup[crossing.srcNode];
+        for(int dstNode : crossing.dstNodes){
+            int dstGroup = initialGroup[dstNode];
+            if(srcGroup != dstGroup){
+                groupAdjacency[srcGroup].push_back(dstGroup);
+            }
+        }
+    }
+
+    std::vector<int> groupCluster = findStronglyConnectedComponentsIndexed(groupAdjacency);
+    int numClusters = 0;
+    for(int cluster : groupCluster){
+        numClusters = std::max(numClusters, cluster+1);
+    }
+    clusterGraph.numClusters = numClusters;
+
+    clusterGraph.clusterOfNode.resize(nodes.size());
+    clusterGraph.nodeCost.resize(nodes.size());
+    clusterGraph.clusterCost.resize(numClusters, 0);
+    clusterGraph.clusterFirstNode.resize(numClusters, -1);
+    for(int i = 0; i<nodes.size(); i++){
+        int cluster = groupCluster[initialGroup[i]];
+        clusterGraph.clusterOfNode[i] = cluster;
+        clusterGraph.nodeCost[i] = ComputationEstimator::estimateNodeCost(nodes[i], costTable)*nodeRate[i];
+        clusterGraph.clusterCost[cluster] += clusterGraph.nodeCost[i];
+        if(clusterGraph.clusterFirstNode[cluster] == -1){
+            clusterGraph.clusterFirstNode[cluster] = i;
+        }
+    }
+
+    clusterGraph.clusterAdjacency.resize(numClusters);
+    std::set<std::pair<int, int>> clusterEdges;
+    for(const NodeCrossing &crossing : clusterGraph.crossings){
+        int srcCluster = clusterGraph.clusterOfNode[crossing.srcNode];
+        for(int dstNode : crossing.dstNodes){
+            int dstCluster = clusterGraph.clusterOfNode[dstNode];
+            if(srcCluster != dstCluster && clusterEdges.find(std::pair<int, int>(srcCluster, dstCluster)) == clusterEdges.end()){
+                clusterEdges.insert(std::pair<int, int>(srcCluster, dstCluster));
+                clusterGraph.clusterAdjacency[srcCluster].push_back(dstCluster);
+            }
+        }
+    }
+
+    return clusterGraph;
+}
+
+int PartitioningPasses::autoPartition(Design &design, int numPartitions, double balanceTolerance, bool printReport,
+                                      const ComputationCostTable &costTable){
+    if(numPartitions < 1){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Automatic partitioning requires at least 1 partition.  Requested: " + GeneralHelper::to_string(numPartitions)));
+    }
+
+    //Subsystems are assigned partitions later based on their children
+    {
+        std::vector<std::shared_ptr<Node>> designNodes = design.getNodes();
+        for (const std::shared_ptr<Node> &node: designNodes) {
+            if (GeneralHelper::isType<Node, SubSystem>(node) != nullptr) {
+                node->setPartitionNum(-1);
+            }
+        }
+    }
+
+    ClusterGraph clusterGraph = buildClusterGraph(design, costTable);
+    std::vector<std::shared_ptr<Node>> &nodes = clusterGraph.nodes;
+    int numClusters = clusterGraph.numClusters;
+    if(nodes.empty()){
+        return 0;
+    }
+
+    const std::vector<int> &clusterOfNode = clusterGraph.clusterOfNode;
+    const std::vector<double> &clusterCost = clusterGraph.clusterCost;
+    const std::vector<int> &clusterFirstNode = clusterGraph.clusterFirstNode;
+    const std::vector<std::vector<int>> &clusterAdjacency = clusterGraph.clusterAdjacency;
+    std::vector<int> clusterInDegree(numClusters, 0);
+    for(int cluster = 0; cluster<numClusters; cluster++){
+        for(int dst : clusterAdjacency[cluster]){
+            clusterInDegree[dst]++;
+        }
+    }
+
+    //==== Order the clusters ====
+    //A depth first style topological sort is used to keep chains of dependent clusters adjacent in the order
+    std::vector<int> order;
+    std::vector<int> clusterPosition(numClusters, -1);
+    {
+        auto laterFirstNode = [&clusterFirstNode](int a, int b){return clusterFirstNode[a] > clusterFirstNode[b];};
+
+        std::vector<int> readyStack;
+        for (int cluster = 0; cluster < numClusters; cluster++) {
+            if (clusterInDegree[cluster] == 0) {
+                readyStack.push_back(cluster);
+            }
+        }
+        //Sort so that the cluster containing the earliest node is popped first
+        std::sort(readyStack.begin(), readyStack.end(), laterFirstNode);
+
+        while (!readyStack.empty()) {
+            int cluster = readyStack.back();
+            readyStack.pop_back();
+            clusterPosition[cluster] = order.size();
+            order.push_back(cluster);
+
+            std::vector<int> newlyReady;
+            for (int dst: clusterAdjacency[cluster]) {
+                clusterInDegree[dst]--;
+                if (clusterInDegree[dst] == 0) {
+                    newlyReady.push_back(dst);
+                }
+            }
+            std::sort(newlyReady.begin(), newlyReady.end(), laterFirstNode);
+            readyStack.insert(readyStack.end(), newlyReady.begin(), newlyReady.end());
+        }
+    }
+
+    if(order.size() != numClusters){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Automatic partitioning was unable to order clusters.  A cycle remains after merging strongly connected components"));
+    }
+
+    //==== Compute the workload and communication at each potential cut ====
+    //A cut at position p places clusters in positions [0, p) before the cut
+    std::vector<double> prefixCost(numClusters+1, 0);
+    for(int pos = 0; pos<numClusters; pos++){
+        prefixCost[pos+1] = prefixCost[pos] + clusterCost[order[pos]];
+    }
+
+    std::vector<double> cutBytes(numClusters+1, 0);
+    for(const NodeCrossing &crossing : clusterGraph.crossings){
+        int srcPos = clusterPosition[clusterOfNode[crossing.srcNode]];
+        int farthestDstPos = srcPos;
+        for(int dstNode : crossing.dstNodes){
+            farthestDstPos = std::max(farthestDstPos, clusterPosition[clusterOfNode[dstNode]]);
+        }
+        //Crosses any cut in (srcPos, farthestDstPos]
+        if(farthestDstPos > srcPos){
+            cutBytes[srcPos+1] += crossing.bytesPerBaseRateSample;
+            if(farthestDstPos+1 <= numClusters){
+                cutBytes[farthestDstPos+1] -= crossing.bytesPerBaseRateSample;
+            }
+        }
+    }
+    for(int pos = 1; pos<=numClusters; pos++){
+        cutBytes[pos] += cutBytes[pos-1];
+    }
+
+    //==== Select the cuts ====
+    int partitionsToCreate = numPartitions;
+    if(numClusters < numPartitions){
+        partitionsToCreate = numClusters;
+        std::cerr << ErrorHelpers::genWarningStr("Automatic partitioning was only able to find " + GeneralHelper::to_string(numClusters) + " independent clusters of nodes.  Creating " + GeneralHelper::to_string(partitionsToCreate) + " partitions rather than the requested " + GeneralHelper::to_string(numPartitions)) << std::endl;
+    }
+
+    std::vector<int> partitionStart = {0};
+    for(int part = 1; part<partitionsToCreate; part++){
+        int prevCut = partitionStart[part-1];
+        double target = (prefixCost[numClusters] - prefixCost[prevCut])/(partitionsToCreate-part+1);
+        double idealPrefixCost = prefixCost[prevCut] + target;
+        double allowedDeviation = balanceTolerance*target;
+
+        //Leave at least 1 cluster for each of the remaining partitions
+        int minPos = prevCut+1;
+        int maxPos = numClusters-(partitionsToCreate-part);
+
+        int bestPos = -1;
+        double bestDeviation = 0;
+        int closestPos = minPos;
+        double closestDeviation = std::fabs(prefixCost[minPos] - idealPrefixCost);
+        for(int pos = minPos; pos<=maxPos; pos++){
+            double deviation = std::fabs(prefixCost[pos] - idealPrefixCost);
+            if(deviation < closestDeviation){
+                closestDeviation = deviation;
+                closestPos = pos;
+            }
+
+            if(deviation <= allowedDeviation){
+                if(bestPos == -1 || cutBytes[pos] < cutBytes[bestPos] || (cutBytes[pos] == cutBytes[bestPos] && deviation < bestDeviation)){
+                    bestPos = pos;
+                    bestDeviation = deviation;
+                }
+            }
+
+            if(prefixCost[pos] > idealPrefixCost + allowedDeviation){
+                //The prefix cost is non-decreasing, no further positions can be within the tolerance
+                break;
+            }
+        }
+
+        partitionStart.push_back(bestPos == -1 ? closestPos : bestPos);
+    }
+    partitionStart.push_back(numClusters);
+
+    //==== Assign partitions ====
+    std::vector<int> partitionOfCluster(numClusters);
+    for(int part = 0; part<partitionsToCreate; part++){
+        for(int pos = partitionStart[part]; pos<partitionStart[part+1]; pos++){
+            partitionOfCluster[order[pos]] = part;
+        }
+    }
+
+    std::map<int, int> partitionNodeCount;
+    for(int i = 0; i<nodes.size(); i++){
+        if(GeneralHelper::isType<Node, EnableNode>(nodes[i]) != nullptr){
+            //EnableNodes are placed later based on the nodes they connect to within the EnabledSubsystem
+            nodes[i]->setPartitionNum(-1);
+        }else{
+            int part = partitionOfCluster[clusterOfNode[i]];
+            nodes[i]->setPartitionNum(part);
+            partitionNodeCount[part]++;
+        }
+    }
+
+    //==== Report ====
+    if(printReport){
+        std::map<std::pair<int, int>, double> partitionCrossingBytes;
+        for(const NodeCrossing &crossing : clusterGraph.crossings){
+            int srcPart = partitionOfCluster[clusterOfNode[crossing.srcNode]];
+            std::set<int> dstParts;
+            for(int dstNode : crossing.dstNodes){
+                int dstPart = partitionOfCluster[clusterOfNode[dstNode]];
+                if(dstPart != srcPart){
+                    dstParts.insert(dstPart);
+                }
+            }
+            for(int dstPart : dstParts){
+                partitionCrossingBytes[std::pair<int, int>(srcPart, dstPart)] += crossing.bytesPerBaseRateSample;
+            }
+        }
+
+        std::cout << std::endl;
+        std::cout << "========== Automatic Partitioning Report ==========" << std::endl;
+        std::cout << "Clusters: " << numClusters << ", Partitions: " << partitionsToCreate << std::endl;
+        for(int part = 0; part<partitionsToCreate; part++){
+            double partCost = prefixCost[partitionStart[part+1]] - prefixCost[partitionStart[part]];
+            printf("Partition %d: Nodes: %d, Estimated Workload: %.2f\n", part, partitionNodeCount[part], partCost);
+        }
+        for(auto it = partitionCrossingBytes.begin(); it != partitionCrossingBytes.end(); it++){
+            printf("Partition %d -> %d: Estimated Bytes Per Base Rate Sample: %.2f\n", it->first.first, it->first.second, it->second);
+        }
+        std::cout << std::endl;
+    }
+
+    return partitionsToCreate;
+}
+
+int PartitioningPasses::refinePartitions(Design &design, int maxPasses, bool printReport,
+                                         const ComputationCostTable &costTable){
+    ClusterGraph clusterGraph = buildClusterGraph(design, costTable);
+    std::vector<std::shared_ptr<Node>> &nodes = clusterGraph.nodes;
+    int numClusters = clusterGraph.numClusters;
+    const std::vector<int> &clusterOfNode = clusterGraph.clusterOfNode;
+
+    //==== Find the existing partitions ====
+    //Partitions are referred to by an index into partitionNums while refining
+    std::vector<int> partitionNums;
+    std::map<int, int> partitionIndex;
+    for(const std::shared_ptr<Node> &node : nodes){
+        if(node->getPartitionNum() >= 0 && partitionIndex.find(node->getPartitionNum()) == partitionIndex.end()){
+            partitionIndex[node->getPartitionNum()] = -1;
+        }
+    }
+    for(auto it = partitionIndex.begin(); it != partitionIndex.end(); it++){
+        it->second = partitionNums.size();
+        partitionNums.push_back(it->first);
+    }
+    int numPartitions = partitionNums.size();
+
+    std::vector<int> nodePart(nodes.size(), -1); //-1 if the node is not assigned a partition
+    std::vector<int> partNodeCount(numPartitions, 0);
+    std::vector<double> partLoad(numPartitions, 0);
+    for(int i = 0; i<nodes.size(); i++){
+        if(nodes[i]->getPartitionNum() >= 0){
+            nodePart[i] = partitionIndex[nodes[i]->getPartitionNum()];
+            partNodeCount[nodePart[i]]++;
+            partLoad[nodePart[i]] += clusterGraph.nodeCost[i];
+        }
+    }
+
+    //==== Find the clusters which can be moved ====
+    //Clusters already split across partitions are left where they are
+    std::vector<int> clusterPart(numClusters, -1);
+    std::vector<bool> clusterMovable(numClusters, true);
+    std::vector<int> clusterAssignedNodeCount(numClusters, 0);
+    std::vector<double> clusterAssignedCost(numClusters, 0);
+    for(int i = 0; i<nodes.size(); i++){
+        int cluster = clusterOfNode[i];
+        if(nodePart[i] != -1){
+            if(clusterPart[cluster] == -1){
+                clusterPart[cluster] = nodePart[i];
+            }else if(clusterPart[cluster] != nodePart[i]){
+                clusterMovable[cluster] = false;
+            }
+            clusterAssignedNodeCount[cluster]++;
+            clusterAssignedCost[cluster] += clusterGraph.nodeCost[i];
+        }
+    }
+    for(int cluster = 0; cluster<numClusters; cluster++){
+        if(clusterPart[cluster] == -1){
+            clusterMovable[cluster] = false;
+        }
+    }
+
+    std::vector<std::vector<int>> crossingsOfCluster(numClusters);
+    for(int crossingInd = 0; crossingInd<clusterGraph.crossings.size(); crossingInd++){
+        const NodeCrossing &crossing = clusterGraph.crossings[crossingInd];
+        std::set<int> clusters = {clusterOfNode[crossing.srcNode]};
+        for(int dstNode : crossing.dstNodes){
+            clusters.insert(clusterOfNode[dstNode]);
+        }
+        for(int cluster : clusters){
+            crossingsOfCluster[cluster].push_back(crossingInd);
+        }
+    }
+
+    //The partition of a node, taking into account a hypothetical move of a cluster
+    auto partitionOf = [&](int node, int movedCluster, int movedTo) -> int {
+        if(clusterOfNode[node] == movedCluster && nodePart[node] != -1){
+            return movedTo;
+        }
+        return nodePart[node];
+    };
+
+    //The partitions a crossing sends values to (excluding the source partition)
+    auto crossingDstPartitions = [&](const NodeCrossing &crossing, int movedCluster, int movedTo) -> std::set<int> {
+        std::set<int> dstParts;
+        int srcPart = partitionOf(crossing.srcNode, movedCluster, movedTo);
+        if(srcPart != -1){
+            for(int dstNode : crossing.dstNodes){
+                int dstPart = partitionOf(dstNode, movedCluster, movedTo);
+                if(dstPart != -1 && dstPart != srcPart){
+                    dstParts.insert(dstPart);
+                }
+            }
+        }
+        return dstParts;
+    };
+
+    //==== Compute the initial communication ====
+    //The number of crossings between each pair of partitions is tracked to check for the creation of communication cycles
+    double cutBytes = 0;
+    std::map<std::pair<int, int>, int> partitionEdgeCount;
+    for(const NodeCrossing &crossing : clusterGraph.crossings){
+        std::set<int> dstParts = crossingDstPartitions(crossing, -1, -1);
+        cutBytes += crossing.bytesPerBaseRateSample*dstParts.size();
+        for(int dstPart : dstParts){
+            partitionEdgeCount[std::pair<int, int>(nodePart[crossing.srcNode], dstPart)]++;
+        }
+    }
+
+    //The strongly connected component of each partition in the graph of communication between partitions
+    auto findPartitionComponents = [&]() -> std::vector<int> {
+        std::vector<std::vector<int>> partitionAdjacency(numPartitions);
+        for(auto it = partitionEdgeCount.begin(); it != partitionEdgeCount.end(); it++){
+            if(it->second > 0){
+                partitionAdjacency[it->first.first].push_back(it->first.second);
+            }
+        }
+        return findStronglyConnectedComponentsIndexed(partitionAdjacency);
+    };
+
+    //A move creates a new communication cycle if any 2 partitions which were in different SCCs before the move are in
+    //the same SCC after it.  Comparing the number of SCCs is not sufficient since a move can break one cycle and
+    //create another
+    auto mergesPartitionComponents = [](const std::vector<int> &componentsBefore, const std::vector<int> &componentsAfter) -> bool {
+        std::map<int, int> componentBeforeOfComponentAfter;
+        for(int part = 0; part<componentsAfter.size(); part++){
+            auto it = componentBeforeOfComponentAfter.find(componentsAfter[part]);
+            if(it == componentBeforeOfComponentAfter.end()){
+                componentBeforeOfComponentAfter[componentsAfter[part]] = componentsBefore[part];
+            }else if(it->second != componentsBefore[part]){
+                return true;
+            }
+        }
+        return false;
+    };
+
+    //The nodes of each cluster are collected to avoid scanning all nodes when applying a move
+    std::vector<std::vector<int>> nodesOfCluster(numClusters);
+    for(int i = 0; i<nodes.size(); i++){
+        nodesOfCluster[clusterOfNode[i]].push_back(i);
+    }
+
+    //Applies a move to the partitioning state
+    auto applyMove = [&](int cluster, int to) {
+        int from = clusterPart[cluster];
+        for(int crossingInd : crossingsOfCluster[cluster]){
+            const NodeCrossing &crossing = clusterGraph.crossings[crossingInd];
+            std::set<int> oldDstParts = crossingDstPartitions(crossing, -1, -1);
+            std::set<int> newDstParts = crossingDstPartitions(crossing, cluster, to);
+            int newSrcPart = partitionOf(crossing.srcNode, cluster, to);
+            cutBytes += crossing.bytesPerBaseRateSample*(((double) newDstParts.size()) - ((double) oldDstParts.size()));
+            for(int dstPart : oldDstParts){
+                partitionEdgeCount[std::pair<int, int>(nodePart[crossing.srcNode], dstPart)]--;
+            }
+            for(int dstPart : newDstParts){
+                partitionEdgeCount[std::pair<int, int>(newSrcPart, dstPart)]++;
+            }
+        }
+        //The nodes are updated after the crossings since partitionOf relies on the original partitions
+        for(int i : nodesOfCluster[cluster]){
+            if(nodePart[i] != -1){
+                nodePart[i] = to;
+            }
+        }
+        clusterPart[cluster] = to;
+        partLoad[from] -= clusterAssignedCost[cluster];
+        partLoad[to] += clusterAssignedCost[cluster];
+        partNodeCount[from] -= clusterAssignedNodeCount[cluster];
+        partNodeCount[to] += clusterAssignedNodeCount[cluster];
+    };
+
+    auto maxLoad = [&]() -> double {
+        double maxPartLoad = 0;
+        for(double load : partLoad){
+            maxPartLoad = std::max(maxPartLoad, load);
+        }
+        return maxPartLoad;
+    };
+
+    //Scores are compared by the maximum partition workload then by the communication
+    auto isBetter = [](std::pair<double, double> a, std::pair<double, double> b) -> bool {
+        double loadEpsilon = 1e-9*std::max(std::fabs(a.first), std::fabs(b.first));
+        if(a.first < b.first - loadEpsilon){
+            return true;
+        }else if(a.first > b.first + loadEpsilon){
+            return false;
+        }
+        double bytesEpsilon = 1e-9*std::max(std::fabs(a.second), std::fabs(b.second));
+        return a.second < b.second - bytesEpsilon;
+    };
+
+    std::vector<double> initialPartLoad = partLoad;
+    double initialCutBytes = cutBytes;
+
+    //==== Refine ====
+    //Passes are stopped early if this many moves are made without improving on the best partitioning in the pass
+    const int maxNonImprovingMoves = 50;
+
+    for(int pass = 0; pass<maxPasses && numPartitions > 1; pass++){
+        std::vector<bool> locked(numClusters, false);
+        std::vector<std::pair<int, int>> moves; //The cluster and the partition it was moved from
+        std::pair<double, double> bestScore(maxLoad(), cutBytes);
+        int bestMoveCount = 0;
+
+        while(moves.size() - bestMoveCount < maxNonImprovingMoves){
+            //Find the candidate moves (to partitions the cluster communicates with) and their resulting scores
+            std::vector<std::pair<std::pair<double, double>, std::pair<int, int>>> candidates;
+            for(int cluster = 0; cluster<numClusters; cluster++){
+                if(!clusterMovable[cluster] || locked[cluster]){
+                    continue;
+                }
+
+                int from = clusterPart[cluster];
+                if(partNodeCount[from] == clusterAssignedNodeCount[cluster]){
+                    //Moving the cluster would leave the partition empty
+                    continue;
+                }
+
+                std::set<int> targets;
+                for(int crossingInd : crossingsOfCluster[cluster]){
+                    const NodeCrossing &crossing = clusterGraph.crossings[crossingInd];
+                    if(nodePart[crossing.srcNode] != -1){
+                        targets.insert(nodePart[crossing.srcNode]);
+                    }
+                    for(int dstNode : crossing.dstNodes){
+                        if(nodePart[dstNode] != -1){
+                            targets.insert(nodePart[dstNode]);
+                        }
+                    }
+                }
+                targets.erase(from);
+
+                for(int to : targets){
+                    double newCutBytes = cutBytes;
+                    for(int crossingInd : crossingsOfCluster[cluster]){
+                        const NodeCrossing &crossing = clusterGraph.crossings[crossingInd];
+                        newCutBytes += crossing.bytesPerBaseRateSample*(((double) crossingDstPartitions(crossing, cluster, to).size()) - ((double) crossingDstPartitions(crossing, -1, -1).size()));
+                    }
+
+                    double newMaxLoad = 0;
+                    for(int part = 0; part<numPartitions; part++){
+                        double load = partLoad[part];
+                        if(part == from){
+                            load -= clusterAssignedCost[cluster];
+                        }else if(part == to){
+                            load += clusterAssignedCost[cluster];
+                        }
+                        newMaxLoad = std::max(newMaxLoad, load);
+                    }
+
+                    candidates.emplace_back(std::pair<double, double>(newMaxLoad, newCutBytes), std::pair<int, int>(cluster, to));
+                }
+            }
+
+            std::stable_sort(candidates.begin(), candidates.end(),
+                             [&isBetter](const std::pair<std::pair<double, double>, std::pair<int, int>> &a,
+                                         const std::pair<std::pair<double, double>, std::pair<int, int>> &b){
+                                 return isBetter(a.first, b.first);
+                             });
+
+            //Apply the best move which does not create a new communication cycle between partitions.  Each candidate
+            //is checked against the partitioning immediately before the move
+            bool moved = false;
+            std::vector<int> componentsBeforeMove = findPartitionComponents();
+            for(const std::pair<std::pair<double, double>, std::pair<int, int>> &candidate : candidates){
+                int cluster = candidate.second.first;
+                int from = clusterPart[cluster];
+                applyMove(cluster, candidate.second.second);
+                if(mergesPartitionComponents(componentsBeforeMove, findPartitionComponents())){
+                    applyMove(cluster, from);
+                }else{
+                    locked[cluster] = true;
+                    moves.emplace_back(cluster, from);
+                    moved = true;
+                    break;
+                }
+            }
+
+            if(!moved){
+                break;
+            }
+
+            std::pair<double, double> score(maxLoad(), cutBytes);
+            if(isBetter(score, bestScore)){
+                bestScore = score;
+                bestMoveCount = moves.size();
+            }
+        }
+
+        //Roll back to the best partitioning seen in this pass
+        while(moves.size() > bestMoveCount){
+            applyMove(moves.back().first, moves.back().second);
+            moves.pop_back();
+        }
+
+        if(bestMoveCount == 0){
+            break;
+        }
+    }
+
+    //==== Assign partitions ====
+    int nodesMoved = 0;
+    for(int i = 0; i<nodes.size(); i++){
+        if(nodePart[i] != -1 && partitionNums[nodePart[i]] != nodes[i]->getPartitionNum()){
+            nodesMoved++;
+            if(GeneralHelper::isType<Node, EnableNode>(nodes[i]) != nullptr){
+                //EnableNodes are placed later based on the nodes they connect to within the EnabledSubsystem
+                nodes[i]->setPartitionNum(-1);
+            }else{
+                nodes[i]->setPartitionNum(partitionNums[nodePart[i]]);
+            }
+        }
+    }
+
+    //==== Report ====
+    if(printReport){
+        double initialMaxLoad = 0;
+        for(double load : initialPartLoad){
+            initialMaxLoad = std::max(initialMaxLoad, load);
+        }
+        double refinedMaxLoad = maxLoad();
+
+        std::cout << std::endl;
+        std::cout << "========== Partition Refinement Report ==========" << std::endl;
+        std::cout << "Nodes Moved: " << nodesMoved << std::endl;
+        printf("%9s | %28s | %28s\n", "Partition", "Est. Workload Before", "Est. Workload After");
+        for(int part = 0; part<numPartitions; part++){
+            printf("%9d | %28.2f | %28.2f\n", partitionNums[part], initialPartLoad[part], partLoad[part]);
+        }
+        printf("Estimated Max Partition Workload: %.2f -> %.2f\n", initialMaxLoad, refinedMaxLoad);
+        printf("Estimated Bytes Crossing Partitions Per Base Rate Sample: %.2f -> %.2f\n", initialCutBytes, cutBytes);
+        if(refinedMaxLoad > 0){
+            printf("Estimated Relative Throughput: %.3f\n", initialMaxLoad/refinedMaxLoad);
+        }
+        std::cout << std::endl;
+    }
+
+    return nodesMoved;
+}
+
+std::vector<int> PartitioningPasses::findStronglyConnectedComponentsIndexed(const std::vector<std::vector<int>> &adjacency){
+    //Flatten the adjacency lists into the CSR form used by GraphAlgs
+    std::vector<int> childStart(1, 0);
+    std::vector<int> children;
+    for(const std::vector<int> &nodeChildren : adjacency){
+        children.insert(children.end(), nodeChildren.begin(), nodeChildren.end());
+        childStart.push_back(children.size());
+    }
+
+    int numComponents;
+    return GraphAlgs::findStronglyConnectedComponentsIndexed(childStart, children, std::vector<bool>(adjacency.size(), true), numComponents);
+}
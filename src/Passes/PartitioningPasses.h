@@ -0,0 +1,156 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_PARTITIONINGPASSES_H
+#define VITIS_PARTITIONINGPASSES_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+
+#include "GraphCore/Design.h"
+#include "Estimators/ComputationCostTable.h"
+
+/**
+ * \addtogroup Passes Design Passes/Transforms
+ *
+ * @brief A group of compiler passes which operate over a design.
+ * @{
+ */
+
+/**
+ * @brief A collection of passes for assigning the nodes of a design to partitions (threads)
+ */
+namespace PartitioningPasses {
+    /**
+     * @brief An output port with arcs to other nodes being considered for partitioning.  Used by ClusterGraph
+     */
+    struct NodeCrossing{
+        int srcNode; ///<The index of the source node
+        std::set<int> dstNodes; ///<The indexes of the destination nodes
+        double bytesPerBaseRateSample; ///<The estimated bytes transferred per base rate sample if sent to another partition (0 for order constraints)
+        NodeCrossing() : srcNode(-1), bytesPerBaseRateSample(0) {}
+    };
+
+    /**
+     * @brief The nodes being considered for partitioning grouped into clusters which should be placed in the same
+     * partition, along with the estimated compute workload of each node and the communication between them.
+     *
+     * Created by buildClusterGraph
+     */
+    struct ClusterGraph{
+        std::vector<std::shared_ptr<Node>> nodes; ///<The nodes being considered for partitioning (excludes subsystems and master nodes)
+        std::vector<double> nodeCost; ///<The estimated compute workload of each node per base rate sample
+        std::vector<int> clusterOfNode; ///<The cluster each node is a member of
+        int numClusters;
+        std::vector<double> clusterCost; ///<The estimated compute workload of each cluster per base rate sample
+        std::vector<int> clusterFirstNode; ///<The lowest index of the nodes in each cluster.  Used for deterministic ordering
+        std::vector<std::vector<int>> clusterAdjacency; ///<The (deduplicated) clusters each cluster has arcs to
+        std::vector<NodeCrossing> crossings; ///<The output ports with arcs to other nodes being considered for partitioning
+        ClusterGraph() : numClusters(0) {}
+    };
+
+    /**
+     * @brief Groups the nodes of the design into clusters which should reside in the same partition.
+     *
+     * Strongly connected components (feedback loops, including loops through delays) are kept together so that no
+     * communication cycle is created between partitions.  This avoids relying on delay absorption into FIFOs to
+     * prevent deadlock.  Nodes under the same ClockDomain (including its RateChange nodes) are also kept together.
+     *
+     * The compute workload of each node is estimated using ComputationEstimator::estimateNodeCost (with the given cost
+     * table) scaled by the rate of the ClockDomain it resides in.  The communication is estimated using
+     * CommunicationEstimator::getCommunicationBitsForType, also scaled by the rate of the source.
+     *
+     * Subsystems and master nodes are not included.  The partitions of the nodes are not modified.
+     *
+     * @param design the design to cluster
+     * @param costTable the calibrated cost table used to estimate the compute workload (may be empty)
+     * @return the cluster graph
+     */
+    ClusterGraph buildClusterGraph(Design &design, const ComputationCostTable &costTable = ComputationCostTable());
+
+    /**
+     * @brief Automatically partitions the design into the given number of partitions.
+     *
+     * The design is first grouped into clusters which must reside in the same partition (see buildClusterGraph).
+     *
+     * The clusters are then arranged in a topological order (depth first to keep chains of operations together) and
+     * split into contiguous ranges.  Because all communication flows forward in this order, the resulting partitions
+     * form a pipeline without communication cycles.  The cut point between each partition is selected from the
+     * positions which keep the partition within balanceTolerance of its target workload.  Among these, the position
+     * with the fewest bytes (per base rate sample) crossing the cut is chosen.
+     *
+     * EnableInput and EnableOutput nodes are left unassigned so that they can be placed by
+     * ContextPasses::placeEnableNodesInPartitions.  Subsystems are also left unassigned so that they can be set by
+     * DesignPasses::assignPartitionsToUnassignedSubsystems.  Any partition directives in the design are overwritten.
+     *
+     * @note This should be run after ClockDomains are specialized (so that rates are known) and before context
+     * discovery.
+     *
+     * @param design the design to partition
+     * @param numPartitions the number of partitions (typically the number of cores available for compute threads)
+     * @param balanceTolerance the allowed deviation (as a fraction of the target workload) of each partition's
+     *                         workload when selecting cut points to reduce communication
+     * @param printReport if true, a report of the estimated workload of each partition and the communication between
+     *                    them is printed
+     * @return the number of partitions which were created.  This may be less than numPartitions if the design does not
+     *         contain enough independent clusters
+     * @param costTable the calibrated cost table used to estimate the compute workload (may be empty)
+     */
+    int autoPartition(Design &design, int numPartitions, double balanceTolerance = 0.1, bool printReport = true,
+                      const ComputationCostTable &costTable = ComputationCostTable());
+
+    /**
+     * @brief Refines an existing partitioning by moving clusters of nodes between partitions.
+     *
+     * Starting from the partitions already assigned to nodes (ex. from VITIS_PARTITION directives or autoPartition),
+     * clusters (see buildClusterGraph) are moved to neighboring partitions using a Fiduccia-Mattheyses style
+     * procedure.  In each pass, the best move (the one resulting in the lowest estimated maximum partition workload,
+     * then the lowest total bytes crossing between partitions) is repeatedly applied, even if it makes the partitioning
+     * worse, and the moved cluster is locked for the remainder of the pass.  The pass is then rolled back to the best
+     * partitioning seen.  Passes are repeated until no improvement is found or maxPasses is reached.
+     *
+     * The following constraints are respected:
+     *   - Clusters are moved as a unit so feedback loops and ClockDomains are not split.
+     *   - Clusters which are already split across partitions are not moved.
+     *   - Moves which would create a new communication cycle between partitions are rejected.  A move is rejected if
+     *     it places partitions which were not in the same strongly connected component of the partition communication
+     *     graph (immediately before the move) into the same strongly connected component.
+     *   - Moves which would leave a partition empty are rejected.
+     *
+     * Nodes without an assigned partition are not moved and communication to/from them is ignored.  EnableNodes in
+     * clusters that are moved are reset to be unassigned so that they can be placed by
+     * ContextPasses::placeEnableNodesInPartitions.
+     *
+     * The estimated throughput is taken to be inversely proportional to the maximum partition workload.
+     *
+     * @note This should be run after ClockDomains are specialized (so that rates are known) and before context
+     * discovery.
+     *
+     * @param design the design to refine the partitioning of
+     * @param maxPasses the maximum number of refinement passes
+     * @param printReport if true, a report of the estimated workload, throughput, and communication before and after
+     *                    refinement is printed
+     * @param costTable the calibrated cost table used to estimate the compute workload (may be empty)
+     * @return the number of nodes which were moved to a different partition
+     */
+    int refinePartitions(Design &design, int maxPasses = 10, bool printReport = true,
+                         const ComputationCostTable &costTable = ComputationCostTable());
+
+    /**
+     * @brief Finds the strongly connected components of a graph whose nodes are described by integer indexes.
+     *
+     * Uses GraphAlgs::findStronglyConnectedComponentsIndexed.  Used when operating on clusters of nodes rather than the
+     * nodes of a design.
+     *
+     * @param adjacency the indexes of the outgoing neighbors of each node
+     * @return the component number of each node.  Components are numbered in reverse topological order
+     */
+    std::vector<int> findStronglyConnectedComponentsIndexed(const std::vector<std::vector<int>> &adjacency);
+};
+
+/*! @} */
+
+#endif //VITIS_PARTITIONINGPASSES_H
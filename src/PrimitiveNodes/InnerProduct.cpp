@@ -8,16 +8,20 @@
 #include "General/EmitterHelpers.h"
 #include "Product.h"
 #include "Blocking/BlockingHelpers.h"
+#include "Constant.h"
+#include "TappedDelay.h"
+#include <iostream>
+#include <algorithm>
 
-InnerProduct::InnerProduct() : emittedBefore(false), complexConjBehavior(ComplexConjBehavior::FIRST), subBlockingLength(1) {
+InnerProduct::InnerProduct() : emittedBefore(false), complexConjBehavior(ComplexConjBehavior::FIRST), subBlockingLength(1), simdTarget(SIMDHelpers::SIMDTarget::NONE), coefSymmetry(CoefSymmetry::NONE), blockFIRImplementation(BlockFIRHelpers::BlockFIRImplementation::DIRECT), polyphaseDecimation(1), polyphaseInterpolation(1), polyphaseInterpolationPhase(0) {
 
 }
 
-InnerProduct::InnerProduct(std::shared_ptr<SubSystem> parent) : PrimitiveNode(parent), emittedBefore(false), complexConjBehavior(ComplexConjBehavior::FIRST), subBlockingLength(1) {
+InnerProduct::InnerProduct(std::shared_ptr<SubSystem> parent) : PrimitiveNode(parent), emittedBefore(false), complexConjBehavior(ComplexConjBehavior::FIRST), subBlockingLength(1), simdTarget(SIMDHelpers::SIMDTarget::NONE), coefSymmetry(CoefSymmetry::NONE), blockFIRImplementation(BlockFIRHelpers::BlockFIRImplementation::DIRECT), polyphaseDecimation(1), polyphaseInterpolation(1), polyphaseInterpolationPhase(0) {
 
 }
 
-InnerProduct::InnerProduct(std::shared_ptr<SubSystem> parent, InnerProduct *orig) : PrimitiveNode(parent, orig), emittedBefore(orig->emittedBefore), complexConjBehavior(orig->complexConjBehavior), subBlockingLength(orig->subBlockingLength) {
+InnerProduct::InnerProduct(std::shared_ptr<SubSystem> parent, InnerProduct *orig) : PrimitiveNode(parent, orig), emittedBefore(orig->emittedBefore), complexConjBehavior(orig->complexConjBehavior), subBlockingLength(orig->subBlockingLength), simdTarget(orig->simdTarget), coefSymmetry(orig->coefSymmetry), blockFIRImplementation(orig->blockFIRImplementation), polyphaseDecimation(orig->polyphaseDecimation), polyphaseInterpolation(orig->polyphaseInterpolation), polyphaseInterpolationPhase(orig->polyphaseInterpolationPhase) {
 
 }
 
@@ -31,6 +35,16 @@ InnerProduct::createFromGraphML(int id, std::string name, std::map<std::string,
     if (dialect == GraphMLDialect::VITIS) {
         std::string complexConjBehaviorStr = dataKeyValueMap.at("ComplexConjBehavior");
         newNode->complexConjBehavior = parseComplexConjBehavior(complexConjBehaviorStr);
+
+        //The coefficient symmetry is optional
+        if(dataKeyValueMap.find("CoefSymmetry") != dataKeyValueMap.end()){
+            newNode->coefSymmetry = parseCoefSymmetry(dataKeyValueMap.at("CoefSymmetry"));
+        }
+
+        //The block FIR implementation is optional
+        if(dataKeyValueMap.find("BlockFIRImplementation") != dataKeyValueMap.end()){
+            newNode->blockFIRImplementation = BlockFIRHelpers::parseBlockFIRImplementationStr(dataKeyValueMap.at("BlockFIRImplementation"));
+        }
     } else if (dialect == GraphMLDialect::SIMULINK_EXPORT) {
         std::string blockFunction = dataKeyValueMap.at("block_function");
         if(blockFunction == "DotProduct") {
@@ -53,6 +67,8 @@ std::set<GraphMLParameter> InnerProduct::graphMLParameters() {
     std::set<GraphMLParameter> parameters;
 
     parameters.insert(GraphMLParameter("ComplexConjBehavior", "string", true));
+    parameters.insert(GraphMLParameter("CoefSymmetry", "string", true));
+    parameters.insert(GraphMLParameter("BlockFIRImplementation", "string", true));
 
     return parameters;
 }
@@ -67,6 +83,8 @@ InnerProduct::emitGraphML(xercesc::DOMDocument *doc, xercesc::DOMElement *graphN
     GraphMLHelper::addDataNode(doc, thisNode, "block_function", "InnerProduct");
 
     GraphMLHelper::addDataNode(doc, thisNode, "ComplexConjBehavior", complexConjBehaviorToString(complexConjBehavior));
+    GraphMLHelper::addDataNode(doc, thisNode, "CoefSymmetry", coefSymmetryToString(coefSymmetry));
+    GraphMLHelper::addDataNode(doc, thisNode, "BlockFIRImplementation", BlockFIRHelpers::blockFIRImplementationToString(blockFIRImplementation));
 
     return thisNode;
 }
@@ -78,7 +96,9 @@ std::string InnerProduct::typeNameStr() {
 std::string InnerProduct::labelStr() {
     std::string label = Node::labelStr();
 
-    label += "\nFunction: " + typeNameStr() + "\nComplexConjBehavior: " + complexConjBehaviorToString(complexConjBehavior);
+    label += "\nFunction: " + typeNameStr() + "\nComplexConjBehavior: " + complexConjBehaviorToString(complexConjBehavior) +
+             "\nCoefSymmetry: " + coefSymmetryToString(coefSymmetry) +
+             "\nBlockFIRImplementation: " + BlockFIRHelpers::blockFIRImplementationToString(blockFIRImplementation);
 
     return label;
 }
@@ -99,9 +119,35 @@ void InnerProduct::validate() {
 
     }
 
-    //Check that the inputs have the same dimensions
-    if(getInputPort(0)->getDataType().getDimensions() != getInputPort(1)->getDataType().getDimensions()){
-        throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - Input Ports Need to Have te Same Dimensions", getSharedPointer()));
+    if(coefSymmetry == CoefSymmetry::NONE) {
+        //Check that the inputs have the same dimensions
+        if (getInputPort(0)->getDataType().getDimensions() != getInputPort(1)->getDataType().getDimensions()) {
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - Input Ports Need to Have te Same Dimensions", getSharedPointer()));
+        }
+    }else{
+        //The coefficients are folded.  The outer (sub-blocking) dimensions should match and the coefficients should be
+        //half the length of the samples
+        std::vector<int> coefDims = getInputPort(0)->getDataType().getDimensions();
+        std::vector<int> sampleDims = getInputPort(1)->getDataType().getDimensions();
+        if(coefDims.size() != sampleDims.size() || !std::equal(coefDims.begin(), coefDims.end()-1, sampleDims.begin())){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - With Folded Coefficients, Input Ports Need to Have the Same Outer Dimensions", getSharedPointer()));
+        }
+
+        //The middle coefficient of an odd length filter is kept if symmetric and dropped if antisymmetric (it is 0)
+        int numCoefs = coefDims[coefDims.size()-1];
+        int numSamples = sampleDims[sampleDims.size()-1];
+        int oddLengthNumCoefs2 = coefSymmetry == CoefSymmetry::ANTISYMMETRIC ? numSamples-1 : numSamples+1;
+        if(numSamples < 2 || (2*numCoefs != numSamples && 2*numCoefs != oddLengthNumCoefs2)){
+            throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - With Folded Coefficients, Expect Half as Many Coefficients as Samples", getSharedPointer()));
+        }
+    }
+
+    if(polyphaseDecimation < 1 || polyphaseInterpolation < 1){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - Polyphase Decimation and Interpolation Factors should be >=1", getSharedPointer()));
+    }
+
+    if(subBlockingLength > 1 && (subBlockingLength%polyphaseDecimation != 0 || subBlockingLength%polyphaseInterpolation != 0)){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - Sub-Blocking Length Should be a Multiple of the Polyphase Decimation and Interpolation Factors", getSharedPointer()));
     }
 
     if(subBlockingLength > 1){
@@ -184,10 +230,7 @@ bool InnerProduct::hasInternalFanout(int inputPort, bool imag) {
     return foundComplex;
 }
 
-CExpr
-InnerProduct::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::SchedType schedType, int outputPortNum,
-                        bool imag) {
-    //=== Find intermediate type ===
+DataType InnerProduct::getAccumulatorType() {
     DataType input0DT = getInputPort(0)->getDataType();
     DataType input1DT = getInputPort(1)->getDataType();
 
@@ -234,7 +277,18 @@ InnerProduct::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::
     }//else, the type is floating point and additional expansion is not performed.
 
     //We need a CPU storage type for the intermediate type
-    DataType intermediateTypeCPUStore = intermediateType.getCPUStorageType();
+    return intermediateType.getCPUStorageType();
+}
+
+CExpr
+InnerProduct::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::SchedType schedType, int outputPortNum,
+                        bool imag) {
+    //=== Find intermediate type ===
+    DataType input0DT = getInputPort(0)->getDataType();
+    DataType input1DT = getInputPort(1)->getDataType();
+
+    //We need a CPU storage type for the intermediate type
+    DataType intermediateTypeCPUStore = getAccumulatorType();
 
     //When sub-blocked, allocate an accumulator per item
     intermediateTypeCPUStore.setDimensions({subBlockingLength});
@@ -289,57 +343,71 @@ InnerProduct::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::
         std::vector<int> inputDimsUnSubBlocked = BlockingHelpers::blockingDomainDimensionReduce(input0DT.getDimensions(), subBlockingLength, 1);
         input0DTUnSubBlocked.setDimensions(inputDimsUnSubBlocked);
 
-        std::vector<std::string> forLoopIndexVars;
-        std::vector<std::string> forLoopClose;
-        if(!input0DTUnSubBlocked.isScalar()){
-            //Create nested loops for a given array
-            std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> forLoopStrs =
-                    EmitterHelpers::generateVectorMatrixForLoops(input0DTUnSubBlocked.getDimensions());
-
-            std::vector<std::string> forLoopOpen = std::get<0>(forLoopStrs);
-            forLoopIndexVars = std::get<1>(forLoopStrs);
-            forLoopClose = std::get<2>(forLoopStrs);
-
-            cStatementQueue.insert(cStatementQueue.end(), forLoopOpen.begin(), forLoopOpen.end());
+        BlockFIRHelpers::BlockFIRImplementation blockImplementation = resolveBlockFIRImplementation();
+        if(blockImplementation == BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE &&
+           inputExprs_re[1].getExprType() != CExpr::ExprType::ARRAY_HANKEL_COMPRESSED){
+            //The segment of samples is not contiguous
+            std::cerr << ErrorHelpers::genWarningStr("FFT overlap-save requires the TappedDelay to present a contiguous segment, FFT overlap-save will not be used", getSharedPointer()) << std::endl;
+            blockImplementation = BlockFIRHelpers::BlockFIRImplementation::TILED;
+        }else if(blockFIRImplementation == BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE &&
+                 blockImplementation != BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE){
+            std::cerr << ErrorHelpers::genWarningStr("FFT overlap-save requires floating point constant coefficients and a sub-blocked TappedDelay, FFT overlap-save will not be used", getSharedPointer()) << std::endl;
         }
+        bool tileable = subBlockingLength > 1 && !input0DTUnSubBlocked.isScalar() && inputDimsUnSubBlocked.size() == 1;
+
+        int simdLanes = getSIMDLanes(inputExprs_re, inputExprs_im, input0DTUnSubBlocked.isScalar() ? std::vector<int>() : inputDimsUnSubBlocked, intermediateTypeCPUStore);
+        if(blockImplementation == BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE){
+            std::vector<int> input1DimsUnSubBlocked = BlockingHelpers::blockingDomainDimensionReduce(input1DT.getDimensions(), subBlockingLength, 1);
+            emitCExprFFT(cStatementQueue, inputExprs_re, inputExprs_im, input1DimsUnSubBlocked[0], accumulatorVar, intermediateTypeCPUStore);
+        }else if(isPolyphase() && (polyphaseInterpolation > 1 || coefSymmetry == CoefSymmetry::NONE)){
+            std::vector<int> input1DimsUnSubBlocked = BlockingHelpers::blockingDomainDimensionReduce(input1DT.getDimensions(), subBlockingLength, 1);
+            emitCExprPolyphase(cStatementQueue, inputExprs_re, inputExprs_im, inputDimsUnSubBlocked[0], input1DimsUnSubBlocked[0],
+                               accumulatorVar, intermediateTypeCPUStore);
+        }else if(coefSymmetry != CoefSymmetry::NONE){
+            std::vector<int> input1DimsUnSubBlocked = BlockingHelpers::blockingDomainDimensionReduce(input1DT.getDimensions(), subBlockingLength, 1);
+            emitCExprFolded(cStatementQueue, inputExprs_re, inputExprs_im, inputDimsUnSubBlocked[0], input1DimsUnSubBlocked[0],
+                            accumulatorVar, intermediateTypeCPUStore);
+        }else if(simdLanes > 1){
+            emitCExprSIMD(cStatementQueue, inputExprs_re, inputExprs_im, input0DTUnSubBlocked.isScalar() ? std::vector<int>() : inputDimsUnSubBlocked,
+                          accumulatorVar, intermediateTypeCPUStore, simdLanes);
+        }else if(blockImplementation == BlockFIRHelpers::BlockFIRImplementation::TILED && tileable){
+            emitCExprTiled(cStatementQueue, inputExprs_re, inputExprs_im, inputDimsUnSubBlocked, accumulatorVar, intermediateTypeCPUStore);
+        }else{
+            std::vector<std::string> forLoopIndexVars;
+            std::vector<std::string> forLoopClose;
+            if(!input0DTUnSubBlocked.isScalar()){
+                //Create nested loops for a given array
+                std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> forLoopStrs =
+                        EmitterHelpers::generateVectorMatrixForLoops(input0DTUnSubBlocked.getDimensions());
+
+                std::vector<std::string> forLoopOpen = std::get<0>(forLoopStrs);
+                forLoopIndexVars = std::get<1>(forLoopStrs);
+                forLoopClose = std::get<2>(forLoopStrs);
+
+                cStatementQueue.insert(cStatementQueue.end(), forLoopOpen.begin(), forLoopOpen.end());
+            }
 
-        //If sub-blocking, perform the sub-blocking as the inner loop since it
-        std::vector<std::string> subBlockingForLoopIndexVars;
-        std::vector<std::string> subBlockingForLoopClose;
-        if(subBlockingLength>1){
-            std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> subBlockingForLoopStrs =
-                    EmitterHelpers::generateVectorMatrixForLoops({subBlockingLength}, "subBlkInd");
-
-            std::vector<std::string> subBlockingForLoopOpen = std::get<0>(subBlockingForLoopStrs);
-            subBlockingForLoopIndexVars = std::get<1>(subBlockingForLoopStrs);
-            subBlockingForLoopClose = std::get<2>(subBlockingForLoopStrs);
-
-            cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopOpen.begin(), subBlockingForLoopOpen.end());
-        }
+            //If sub-blocking, perform the sub-blocking as the inner loop since it
+            std::vector<std::string> subBlockingForLoopIndexVars;
+            std::vector<std::string> subBlockingForLoopClose;
+            if(subBlockingLength>1){
+                std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> subBlockingForLoopStrs =
+                        EmitterHelpers::generateVectorMatrixForLoops({subBlockingLength}, "subBlkInd");
 
-        //=== Dereference terms ===
-        std::vector<std::string> inputExprsDeref_re;
-        std::vector<std::string> inputExprsDeref_im;
-        //There should only be 2 ports (validated above) but easy to write the loop
-        //note that the expression index is the same as the port number
+                std::vector<std::string> subBlockingForLoopOpen = std::get<0>(subBlockingForLoopStrs);
+                subBlockingForLoopIndexVars = std::get<1>(subBlockingForLoopStrs);
+                subBlockingForLoopClose = std::get<2>(subBlockingForLoopStrs);
 
-        for(int i = 0; i<inputExprs_re.size(); i++){
-            std::vector<std::string> inputIndexExprs;
-            if(!getInputPort(i)->getDataType().isScalar()){
-                inputIndexExprs = forLoopIndexVars; // If scalar, this will be empty
-            }
-            if(subBlockingLength>1){
-                //Prepend the blocking index to the input index expressions
-                inputIndexExprs.insert(inputIndexExprs.begin(), subBlockingForLoopIndexVars.begin(), subBlockingForLoopIndexVars.end());
+                cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopOpen.begin(), subBlockingForLoopOpen.end());
             }
 
-            std::string inputExpr_re_deref = inputExprs_re[i].getExprIndexed(inputIndexExprs, true);
-            std::string inputExpr_re_deref_cast = DataType::cConvertType(inputExpr_re_deref, getInputPort(i)->getDataType(), intermediateTypeCPUStore);
+            //=== Dereference terms ===
+            std::vector<std::string> inputExprsDeref_re;
+            std::vector<std::string> inputExprsDeref_im;
+            //There should only be 2 ports (validated above) but easy to write the loop
+            //note that the expression index is the same as the port number
 
-            inputExprsDeref_re.push_back(inputExpr_re_deref_cast);
-        }
-        for(int i = 0; i<inputExprs_im.size(); i++){
-            if(getInputPort(i)->getDataType().isComplex()){
+            for(int i = 0; i<inputExprs_re.size(); i++){
                 std::vector<std::string> inputIndexExprs;
                 if(!getInputPort(i)->getDataType().isScalar()){
                     inputIndexExprs = forLoopIndexVars; // If scalar, this will be empty
@@ -349,49 +417,66 @@ InnerProduct::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::
                     inputIndexExprs.insert(inputIndexExprs.begin(), subBlockingForLoopIndexVars.begin(), subBlockingForLoopIndexVars.end());
                 }
 
-                std::string inputExpr_im_deref = inputExprs_im[i].getExprIndexed(inputIndexExprs, true);
-                std::string inputExpr_im_deref_cast = DataType::cConvertType(inputExpr_im_deref, getInputPort(i)->getDataType(), intermediateTypeCPUStore);
+                std::string inputExpr_re_deref = inputExprs_re[i].getExprIndexed(inputIndexExprs, true);
+                std::string inputExpr_re_deref_cast = DataType::cConvertType(inputExpr_re_deref, getInputPort(i)->getDataType(), intermediateTypeCPUStore);
 
-                inputExprsDeref_im.push_back(inputExpr_im_deref_cast);
-            }else {
-                inputExprsDeref_im.push_back("");
+                inputExprsDeref_re.push_back(inputExpr_re_deref_cast);
+            }
+            for(int i = 0; i<inputExprs_im.size(); i++){
+                if(getInputPort(i)->getDataType().isComplex()){
+                    std::vector<std::string> inputIndexExprs;
+                    if(!getInputPort(i)->getDataType().isScalar()){
+                        inputIndexExprs = forLoopIndexVars; // If scalar, this will be empty
+                    }
+                    if(subBlockingLength>1){
+                        //Prepend the blocking index to the input index expressions
+                        inputIndexExprs.insert(inputIndexExprs.begin(), subBlockingForLoopIndexVars.begin(), subBlockingForLoopIndexVars.end());
+                    }
+
+                    std::string inputExpr_im_deref = inputExprs_im[i].getExprIndexed(inputIndexExprs, true);
+                    std::string inputExpr_im_deref_cast = DataType::cConvertType(inputExpr_im_deref, getInputPort(i)->getDataType(), intermediateTypeCPUStore);
+
+                    inputExprsDeref_im.push_back(inputExpr_im_deref_cast);
+                }else {
+                    inputExprsDeref_im.push_back("");
+                }
             }
-        }
 
-        //=== Complex conjugate ===
-        if(input0DT.isComplex() && complexConjBehavior == ComplexConjBehavior::FIRST){
-            inputExprsDeref_im[0] = "-(" + inputExprsDeref_im[0] + ")";
-        }
+            //=== Complex conjugate ===
+            if(input0DT.isComplex() && complexConjBehavior == ComplexConjBehavior::FIRST){
+                inputExprsDeref_im[0] = "-(" + inputExprsDeref_im[0] + ")";
+            }
 
-        if(input1DT.isComplex() && complexConjBehavior == ComplexConjBehavior::SECOND){
-            inputExprsDeref_im[1] = "-(" + inputExprsDeref_im[1] + ")";
-        }
+            if(input1DT.isComplex() && complexConjBehavior == ComplexConjBehavior::SECOND){
+                inputExprsDeref_im[1] = "-(" + inputExprsDeref_im[1] + ")";
+            }
 
-        //=== Multiply terms ===
-        std::string multResult_re;
-        std::string multResult_im;
-        std::string normExpr; //Not used since we are multiplying and not dividing
-        Product::generateMultExprs(inputExprsDeref_re[0], inputExprsDeref_im[0], inputExprsDeref_re[1], inputExprsDeref_im[1],
-                                   true, "", intermediateTypeCPUStore, normExpr, multResult_re, multResult_im);
+            //=== Multiply terms ===
+            std::string multResult_re;
+            std::string multResult_im;
+            std::string normExpr; //Not used since we are multiplying and not dividing
+            Product::generateMultExprs(inputExprsDeref_re[0], inputExprsDeref_im[0], inputExprsDeref_re[1], inputExprsDeref_im[1],
+                                       true, "", intermediateTypeCPUStore, normExpr, multResult_re, multResult_im);
 
-        if(!normExpr.empty()){//Sanity check TODO: Remove
-            throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - Unexpected result from gerating multiply expression", getSharedPointer()));
-        }
+            if(!normExpr.empty()){//Sanity check TODO: Remove
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Validation Failed - InnerProduct - Unexpected result from gerating multiply expression", getSharedPointer()));
+            }
 
-        //=== Add to accumulator ===
-        cStatementQueue.push_back(accumulatorVar.getCVarName(false) + (subBlockingLength>1 ? EmitterHelpers::generateIndexOperation(subBlockingForLoopIndexVars) : "") + " += " + multResult_re + ";");
-        if(intermediateTypeCPUStore.isComplex()){
-            cStatementQueue.push_back(accumulatorVar.getCVarName(true) + (subBlockingLength>1 ? EmitterHelpers::generateIndexOperation(subBlockingForLoopIndexVars) : "") + " += " + multResult_im + ";");
-        }
+            //=== Add to accumulator ===
+            cStatementQueue.push_back(accumulatorVar.getCVarName(false) + (subBlockingLength>1 ? EmitterHelpers::generateIndexOperation(subBlockingForLoopIndexVars) : "") + " += " + multResult_re + ";");
+            if(intermediateTypeCPUStore.isComplex()){
+                cStatementQueue.push_back(accumulatorVar.getCVarName(true) + (subBlockingLength>1 ? EmitterHelpers::generateIndexOperation(subBlockingForLoopIndexVars) : "") + " += " + multResult_im + ";");
+            }
 
-        //=== Close Sub-Blocking For Loop
-        if(subBlockingLength>1){
-            cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopClose.begin(), subBlockingForLoopClose.end());
-        }
+            //=== Close Sub-Blocking For Loop
+            if(subBlockingLength>1){
+                cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopClose.begin(), subBlockingForLoopClose.end());
+            }
 
-        //=== Close For Loop ===
-        if(!input0DTUnSubBlocked.isScalar()){
-            cStatementQueue.insert(cStatementQueue.end(), forLoopClose.begin(), forLoopClose.end());
+            //=== Close For Loop ===
+            if(!input0DTUnSubBlocked.isScalar()){
+                cStatementQueue.insert(cStatementQueue.end(), forLoopClose.begin(), forLoopClose.end());
+            }
         }
 
         //=== Cast accumulator vars to output type and output vars (single values) (if casting needed) ===
@@ -427,6 +512,644 @@ InnerProduct::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::
     return CExpr(outputVar.getCVarName(imag), subBlockingLength>1 ? CExpr::ExprType::ARRAY : CExpr::ExprType::SCALAR_VAR);
 }
 
+int InnerProduct::getSIMDLanes(std::vector<CExpr> &inputExprs_re, std::vector<CExpr> &inputExprs_im,
+                               const std::vector<int> &unSubBlockedDims, DataType accumType) {
+    int lanes = SIMDHelpers::getLanes(simdTarget, accumType);
+    if(lanes <= 1){
+        return 1;
+    }
+
+    //The inputs are used directly in the vector arithmetic and need to have the same type as the accumulator
+    for(unsigned long i = 0; i<inputExprs_re.size(); i++){
+        if(!SIMDHelpers::sameElementType(getInputPort(i)->getDataType(), accumType)){
+            return 1;
+        }
+    }
+
+    unsigned long numIndexExprs;
+    long vecIndexPos;
+    if(subBlockingLength > 1){
+        //The sub-blocking index is prepended to the index expressions and is vectorized
+        if(subBlockingLength < lanes){
+            return 1;
+        }
+        numIndexExprs = unSubBlockedDims.size()+1;
+        vecIndexPos = 0;
+    }else{
+        //The inner product is only vectorized for vector inputs
+        if(unSubBlockedDims.size() != 1 || unSubBlockedDims[0] < lanes){
+            return 1;
+        }
+        numIndexExprs = 1;
+        vecIndexPos = 0;
+    }
+
+    for(unsigned long i = 0; i<inputExprs_re.size(); i++){
+        DataType inputDT = getInputPort(i)->getDataType();
+        unsigned long portNumIndexExprs = inputDT.isScalar() ? 0 : numIndexExprs;
+        long portVecIndexPos = inputDT.isScalar() ? -1 : vecIndexPos;
+
+        if(SIMDHelpers::getAccessType(inputExprs_re[i], portNumIndexExprs, portVecIndexPos) == SIMDHelpers::AccessType::UNSUPPORTED){
+            return 1;
+        }
+        if(inputDT.isComplex() && SIMDHelpers::getAccessType(inputExprs_im[i], portNumIndexExprs, portVecIndexPos) == SIMDHelpers::AccessType::UNSUPPORTED){
+            return 1;
+        }
+    }
+
+    return lanes;
+}
+
+void InnerProduct::emitCExprSIMD(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                                 std::vector<CExpr> &inputExprs_im, const std::vector<int> &unSubBlockedDims,
+                                 Variable &accumulatorVar, DataType accumType, int lanes) {
+    DataType accumElementType = SIMDHelpers::getElementType(accumType);
+
+    //Open a scope for the vector type
+    cStatementQueue.push_back("{");
+    cStatementQueue.push_back(SIMDHelpers::getVectorTypeDef(accumElementType, lanes));
+
+    //Loads an operand, either as a vector (with the index at vecIndexPos being the first lane) or as a scalar (for the remainder)
+    auto loadOperand = [&](CExpr expr, std::vector<std::string> indexExprs, long vecIndexPos, bool vec) -> std::string {
+        if(vec){
+            return SIMDHelpers::emitLoad(expr, SIMDHelpers::getAccessType(expr, indexExprs.size(), vecIndexPos), indexExprs, accumElementType, lanes);
+        }
+        return SIMDHelpers::emitElement(expr, indexExprs);
+    };
+
+    //Generates the product of the 2 inputs (including the complex conjugate)
+    auto generateProduct = [&](const std::vector<std::string> &indexExprs, long vecIndexPos, bool vec, std::string &product_re, std::string &product_im){
+        std::string operands_re[2];
+        std::string operands_im[2];
+
+        for(int i = 0; i<2; i++){
+            DataType inputDT = getInputPort(i)->getDataType();
+            std::vector<std::string> portIndexExprs;
+            long portVecIndexPos = -1;
+            if(!inputDT.isScalar()){
+                portIndexExprs = indexExprs;
+                portVecIndexPos = vecIndexPos;
+            }
+
+            operands_re[i] = loadOperand(inputExprs_re[i], portIndexExprs, portVecIndexPos, vec);
+            if(inputDT.isComplex()){
+                operands_im[i] = loadOperand(inputExprs_im[i], portIndexExprs, portVecIndexPos, vec);
+            }
+        }
+
+        if(getInputPort(0)->getDataType().isComplex() && complexConjBehavior == ComplexConjBehavior::FIRST){
+            operands_im[0] = "-(" + operands_im[0] + ")";
+        }
+        if(getInputPort(1)->getDataType().isComplex() && complexConjBehavior == ComplexConjBehavior::SECOND){
+            operands_im[1] = "-(" + operands_im[1] + ")";
+        }
+
+        std::string normExpr; //Not used since we are multiplying and not dividing
+        Product::generateMultExprs(operands_re[0], operands_im[0], operands_re[1], operands_im[1],
+                                   true, "", accumType, normExpr, product_re, product_im);
+    };
+
+    std::string product_re;
+    std::string product_im;
+
+    if(subBlockingLength > 1){
+        //==== Vectorize Across Sub-Blocks ====
+        //The loop over the inner product is the outer loop so that each coefficient is broadcast to a vector of sub-blocks
+        std::vector<std::string> forLoopIndexVars;
+        std::vector<std::string> forLoopClose;
+        if(!unSubBlockedDims.empty()){
+            std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> forLoopStrs =
+                    EmitterHelpers::generateVectorMatrixForLoops(unSubBlockedDims);
+
+            std::vector<std::string> forLoopOpen = std::get<0>(forLoopStrs);
+            forLoopIndexVars = std::get<1>(forLoopStrs);
+            forLoopClose = std::get<2>(forLoopStrs);
+
+            cStatementQueue.insert(cStatementQueue.end(), forLoopOpen.begin(), forLoopOpen.end());
+        }
+
+        std::string subBlkIndVar = "subBlkInd0";
+        std::vector<std::string> indexExprs = forLoopIndexVars;
+        indexExprs.insert(indexExprs.begin(), subBlkIndVar);
+        std::vector<std::string> accumIndexExprs = {subBlkIndVar};
+
+        cStatementQueue.push_back(SIMDHelpers::emitVectorLoopOpen(subBlkIndVar, subBlockingLength, lanes));
+        generateProduct(indexExprs, 0, true, product_re, product_im);
+        for(int imag = 0; imag<(accumType.isComplex() ? 2 : 1); imag++){
+            CExpr accumExpr(accumulatorVar.getCVarName(imag), CExpr::ExprType::ARRAY);
+            std::string accumLoad = SIMDHelpers::emitLoad(accumExpr, SIMDHelpers::AccessType::CONTIGUOUS, accumIndexExprs, accumElementType, lanes);
+            cStatementQueue.push_back(SIMDHelpers::emitStore(accumExpr.getExprIndexed(accumIndexExprs, true),
+                                                             accumLoad + " + (" + (imag ? product_im : product_re) + ")",
+                                                             accumElementType, lanes));
+        }
+        cStatementQueue.push_back("}");
+
+        //Remainder of the sub-blocks
+        if(SIMDHelpers::getRemainderStart(subBlockingLength, lanes) != subBlockingLength){
+            cStatementQueue.push_back(SIMDHelpers::emitRemainderLoopOpen(subBlkIndVar, subBlockingLength, lanes));
+            generateProduct(indexExprs, 0, false, product_re, product_im);
+            cStatementQueue.push_back(accumulatorVar.getCVarName(false) + EmitterHelpers::generateIndexOperation(accumIndexExprs) + " += " + product_re + ";");
+            if(accumType.isComplex()){
+                cStatementQueue.push_back(accumulatorVar.getCVarName(true) + EmitterHelpers::generateIndexOperation(accumIndexExprs) + " += " + product_im + ";");
+            }
+            cStatementQueue.push_back("}");
+        }
+
+        cStatementQueue.insert(cStatementQueue.end(), forLoopClose.begin(), forLoopClose.end());
+    }else{
+        //==== Vectorize the Inner Product ====
+        //Partial sums are accumulated in a vector which is reduced after the loop
+        std::string indVar = "indDim0";
+        std::vector<std::string> indexExprs = {indVar};
+        int len = unSubBlockedDims[0];
+        std::string vecTypeName = SIMDHelpers::getVectorTypeName(accumElementType, lanes);
+
+        std::string accumVecName_re = accumulatorVar.getCVarName(false) + "_Vec";
+        std::string accumVecName_im;
+        cStatementQueue.push_back(vecTypeName + " " + accumVecName_re + " = {0};");
+        if(accumType.isComplex()){
+            accumVecName_im = accumulatorVar.getCVarName(true) + "_Vec";
+            cStatementQueue.push_back(vecTypeName + " " + accumVecName_im + " = {0};");
+        }
+
+        cStatementQueue.push_back(SIMDHelpers::emitVectorLoopOpen(indVar, len, lanes));
+        generateProduct(indexExprs, 0, true, product_re, product_im);
+        cStatementQueue.push_back(accumVecName_re + " += " + product_re + ";");
+        if(accumType.isComplex()){
+            cStatementQueue.push_back(accumVecName_im + " += " + product_im + ";");
+        }
+        cStatementQueue.push_back("}");
+
+        cStatementQueue.push_back(accumulatorVar.getCVarName(false) + " += " + SIMDHelpers::emitHorizontalSum(accumVecName_re, lanes) + ";");
+        if(accumType.isComplex()){
+            cStatementQueue.push_back(accumulatorVar.getCVarName(true) + " += " + SIMDHelpers::emitHorizontalSum(accumVecName_im, lanes) + ";");
+        }
+
+        //Remainder of the inner product
+        if(SIMDHelpers::getRemainderStart(len, lanes) != len){
+            cStatementQueue.push_back(SIMDHelpers::emitRemainderLoopOpen(indVar, len, lanes));
+            generateProduct(indexExprs, 0, false, product_re, product_im);
+            cStatementQueue.push_back(accumulatorVar.getCVarName(false) + " += " + product_re + ";");
+            if(accumType.isComplex()){
+                cStatementQueue.push_back(accumulatorVar.getCVarName(true) + " += " + product_im + ";");
+            }
+            cStatementQueue.push_back("}");
+        }
+    }
+
+    //Close the scope of the vector type
+    cStatementQueue.push_back("}");
+}
+
+BlockFIRHelpers::BlockFIRImplementation InnerProduct::resolveBlockFIRImplementation() {
+    if(subBlockingLength <= 1 || blockFIRImplementation == BlockFIRHelpers::BlockFIRImplementation::DIRECT){
+        return BlockFIRHelpers::BlockFIRImplementation::DIRECT;
+    }
+
+    //The block implementations are for the inner product of vectors ([subBlock][taps])
+    std::vector<int> input0Dims = getInputPort(0)->getDataType().getDimensions();
+    std::vector<int> input1Dims = getInputPort(1)->getDataType().getDimensions();
+    if(input0Dims.size() != 2 || input1Dims.size() != 2){
+        return BlockFIRHelpers::BlockFIRImplementation::DIRECT;
+    }
+    int taps = input1Dims[1];
+
+    std::vector<std::complex<double>> coefs;
+    bool fftAllowed = getFFTCoefs(coefs);
+
+    if(isPolyphase()){
+        //The polyphase form only computes the retained outputs and only accumulates the non-zero samples.  FFT
+        //overlap-save computes every output of the sub-block
+        bool fftRequested = blockFIRImplementation == BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE ||
+                            (blockFIRImplementation == BlockFIRHelpers::BlockFIRImplementation::AUTO && taps >= VITIS_BLOCK_FIR_FFT_MIN_TAPS);
+        bool complex = getInputPort(0)->getDataType().isComplex() || getInputPort(1)->getDataType().isComplex();
+        int polyphaseTaps = (taps+polyphaseInterpolation-1)/polyphaseInterpolation;
+        int polyphaseOutputs = subBlockingLength/polyphaseDecimation;
+        if(fftAllowed && fftRequested && BlockFIRHelpers::getFFTCost(taps, subBlockingLength) < BlockFIRHelpers::getDirectCost(polyphaseTaps, polyphaseOutputs, complex)){
+            return BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE;
+        }
+        return BlockFIRHelpers::BlockFIRImplementation::DIRECT;
+    }
+
+    if(blockFIRImplementation == BlockFIRHelpers::BlockFIRImplementation::AUTO){
+        bool complex = getInputPort(0)->getDataType().isComplex() || getInputPort(1)->getDataType().isComplex();
+        return BlockFIRHelpers::selectImplementation(taps, subBlockingLength, complex, fftAllowed);
+    }
+
+    if(blockFIRImplementation == BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE && !fftAllowed){
+        return BlockFIRHelpers::BlockFIRImplementation::TILED;
+    }
+
+    return blockFIRImplementation;
+}
+
+bool InnerProduct::getFFTCoefs(std::vector<std::complex<double>> &coefs) {
+    if(subBlockingLength <= 1 || !getAccumulatorType().isFloatingPt()){
+        return false;
+    }
+
+    std::shared_ptr<OutputPort> coefSrcPort = getInputPort(0)->getSrcOutputPort();
+    std::shared_ptr<OutputPort> sampleSrcPort = getInputPort(1)->getSrcOutputPort();
+    if(coefSrcPort == nullptr || sampleSrcPort == nullptr){
+        return false;
+    }
+
+    std::shared_ptr<Constant> coefNode = std::dynamic_pointer_cast<Constant>(coefSrcPort->getParent());
+    std::shared_ptr<TappedDelay> delayNode = std::dynamic_pointer_cast<TappedDelay>(sampleSrcPort->getParent());
+    //The TappedDelay must provide the contiguous segment of samples for the whole sub-block (oldest first)
+    if(coefNode == nullptr || delayNode == nullptr || delayNode->getTransactionBlockSize() != subBlockingLength ||
+       delayNode->isEarliestFirst()){
+        return false;
+    }
+
+    //The conjugate of the samples cannot be folded into the precomputed spectrum
+    if(complexConjBehavior == ComplexConjBehavior::SECOND && getInputPort(1)->getDataType().isComplex()){
+        return false;
+    }
+
+    std::vector<NumericValue> coefVals = coefNode->getValue();
+    std::vector<int> input0Dims = getInputPort(0)->getDataType().getDimensions();
+    std::vector<int> input1Dims = getInputPort(1)->getDataType().getDimensions();
+    if(input0Dims.size() != 2 || input1Dims.size() != 2 || coefVals.size() != input0Dims[1]){
+        return false;
+    }
+    int taps = input1Dims[1];
+
+    //Unfold the coefficients (if folded).  The middle coefficient of an odd length filter is 0 if it is not provided
+    coefs = std::vector<std::complex<double>>(taps, std::complex<double>(0, 0));
+    for(unsigned long i = 0; i<coefVals.size(); i++){
+        std::complex<double> coef = BlockFIRHelpers::toComplexDouble(coefVals[i]);
+        if(complexConjBehavior == ComplexConjBehavior::FIRST){
+            coef = std::conj(coef);
+        }
+        coefs[i] = coef;
+
+        unsigned long mirror = taps-1-i;
+        if(coefSymmetry != CoefSymmetry::NONE && mirror != i){
+            coefs[mirror] = coefSymmetry == CoefSymmetry::ANTISYMMETRIC ? -coef : coef;
+        }
+    }
+
+    return true;
+}
+
+std::string InnerProduct::getFFTTwiddleTableName() {
+    return name + "_n" + GeneralHelper::to_string(id) + "_FFTTwiddle";
+}
+
+std::string InnerProduct::getFFTCoefSpectrumTableName() {
+    return name + "_n" + GeneralHelper::to_string(id) + "_CoefSpectrum";
+}
+
+void InnerProduct::emitCExprFolded(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                                   std::vector<CExpr> &inputExprs_im, int numCoefs, int numSamples,
+                                   Variable &accumulatorVar, DataType accumType) {
+    int numPairs = numSamples/2;
+    bool includeMiddle = numCoefs > numPairs; //Only possible if the number of samples is odd
+    std::string preAddOp = coefSymmetry == CoefSymmetry::ANTISYMMETRIC ? " - " : " + ";
+
+    //Generates the product of a coefficient with the pre-added pair of samples (or the middle sample if mirrorIndExpr is empty)
+    auto generateProduct = [&](const std::vector<std::string> &outerIndexExprs, std::string indExpr, std::string mirrorIndExpr,
+                               std::string &product_re, std::string &product_im){
+        std::vector<std::string> indexExprs = outerIndexExprs;
+        indexExprs.push_back(indExpr);
+        std::vector<std::string> mirrorIndexExprs = outerIndexExprs;
+        mirrorIndexExprs.push_back(mirrorIndExpr);
+
+        std::string operands_re[2];
+        std::string operands_im[2];
+
+        DataType coefDT = getInputPort(0)->getDataType();
+        operands_re[0] = DataType::cConvertType(inputExprs_re[0].getExprIndexed(indexExprs, true), coefDT, accumType);
+        if(coefDT.isComplex()){
+            operands_im[0] = DataType::cConvertType(inputExprs_im[0].getExprIndexed(indexExprs, true), coefDT, accumType);
+        }
+
+        DataType sampleDT = getInputPort(1)->getDataType();
+        for(int imag = 0; imag<(sampleDT.isComplex() ? 2 : 1); imag++){
+            CExpr &sampleExpr = imag ? inputExprs_im[1] : inputExprs_re[1];
+            std::string sample = DataType::cConvertType(sampleExpr.getExprIndexed(indexExprs, true), sampleDT, accumType);
+            if(!mirrorIndExpr.empty()){
+                //Pre-add the mirrored sample
+                sample = "(" + sample + preAddOp + DataType::cConvertType(sampleExpr.getExprIndexed(mirrorIndexExprs, true), sampleDT, accumType) + ")";
+            }
+            (imag ? operands_im[1] : operands_re[1]) = sample;
+        }
+
+        //The conjugate of the pre-added samples is the pre-add of the conjugated samples
+        if(coefDT.isComplex() && complexConjBehavior == ComplexConjBehavior::FIRST){
+            operands_im[0] = "-(" + operands_im[0] + ")";
+        }
+        if(sampleDT.isComplex() && complexConjBehavior == ComplexConjBehavior::SECOND){
+            operands_im[1] = "-(" + operands_im[1] + ")";
+        }
+
+        std::string normExpr; //Not used since we are multiplying and not dividing
+        Product::generateMultExprs(operands_re[0], operands_im[0], operands_re[1], operands_im[1],
+                                   true, "", accumType, normExpr, product_re, product_im);
+    };
+
+    //Adds a product to the accumulator
+    auto accumulate = [&](const std::vector<std::string> &outerIndexExprs, const std::string &product_re, const std::string &product_im){
+        std::string accumIndex = subBlockingLength > 1 ? EmitterHelpers::generateIndexOperation(outerIndexExprs) : "";
+        cStatementQueue.push_back(accumulatorVar.getCVarName(false) + accumIndex + " += " + product_re + ";");
+        if(accumType.isComplex()){
+            cStatementQueue.push_back(accumulatorVar.getCVarName(true) + accumIndex + " += " + product_im + ";");
+        }
+    };
+
+    std::string product_re;
+    std::string product_im;
+
+    //The pairs of mirrored samples are the outer loop.  If sub-blocked, the sub-block is the inner loop (like the direct
+    //implementation)
+    std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> forLoopStrs =
+            EmitterHelpers::generateVectorMatrixForLoops({numPairs});
+    std::vector<std::string> forLoopOpen = std::get<0>(forLoopStrs);
+    std::string indVar = std::get<1>(forLoopStrs)[0];
+    std::vector<std::string> forLoopClose = std::get<2>(forLoopStrs);
+    std::string mirrorIndExpr = "(" + GeneralHelper::to_string(numSamples-1) + "-" + indVar + ")";
+
+    std::vector<std::string> subBlockingForLoopOpen;
+    std::vector<std::string> subBlockingForLoopIndexVars;
+    std::vector<std::string> subBlockingForLoopClose;
+    if(subBlockingLength > 1){
+        std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> subBlockingForLoopStrs =
+                EmitterHelpers::generateVectorMatrixForLoops({subBlockingLength}, "subBlkInd");
+        subBlockingForLoopOpen = std::get<0>(subBlockingForLoopStrs);
+        subBlockingForLoopIndexVars = std::get<1>(subBlockingForLoopStrs);
+        subBlockingForLoopClose = std::get<2>(subBlockingForLoopStrs);
+
+        if(isPolyphase()){
+            //Only the retained outputs of a decimating filter are computed
+            std::string subBlkIndVar = subBlockingForLoopIndexVars[0];
+            subBlockingForLoopOpen[0] = "for(unsigned long " + subBlkIndVar + " = 0; " + subBlkIndVar + "<" + GeneralHelper::to_string(subBlockingLength) + "; " + subBlkIndVar + "+=" + GeneralHelper::to_string(polyphaseDecimation) + "){";
+        }
+    }
+
+    cStatementQueue.insert(cStatementQueue.end(), forLoopOpen.begin(), forLoopOpen.end());
+    cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopOpen.begin(), subBlockingForLoopOpen.end());
+    generateProduct(subBlockingForLoopIndexVars, indVar, mirrorIndExpr, product_re, product_im);
+    accumulate(subBlockingForLoopIndexVars, product_re, product_im);
+    cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopClose.begin(), subBlockingForLoopClose.end());
+    cStatementQueue.insert(cStatementQueue.end(), forLoopClose.begin(), forLoopClose.end());
+
+    //The middle sample of an odd length filter does not have a mirror
+    if(includeMiddle){
+        std::string midIndExpr = GeneralHelper::to_string(numPairs);
+        cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopOpen.begin(), subBlockingForLoopOpen.end());
+        generateProduct(subBlockingForLoopIndexVars, midIndExpr, "", product_re, product_im);
+        accumulate(subBlockingForLoopIndexVars, product_re, product_im);
+        cStatementQueue.insert(cStatementQueue.end(), subBlockingForLoopClose.begin(), subBlockingForLoopClose.end());
+    }
+}
+
+bool InnerProduct::isPolyphase() {
+    if(subBlockingLength <= 1 || (polyphaseDecimation <= 1 && polyphaseInterpolation <= 1)){
+        return false;
+    }
+
+    //The polyphase form is for the inner product of vectors ([subBlock][taps])
+    return getInputPort(0)->getDataType().getDimensions().size() == 2 && getInputPort(1)->getDataType().getDimensions().size() == 2;
+}
+
+void InnerProduct::emitCExprPolyphase(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                                      std::vector<CExpr> &inputExprs_im, int numCoefs, int numSamples,
+                                      Variable &accumulatorVar, DataType accumType) {
+    std::string subBlkIndVar = "subBlkInd0";
+    std::string tapIndVar = "tapInd";
+    std::string interpStr = GeneralHelper::to_string(polyphaseInterpolation);
+
+    //Adds the product of the coefficient at coefIndExpr and the sample at tapIndVar to the accumulator
+    auto accumulateProduct = [&](std::string coefIndExpr, bool negateCoef){
+        std::vector<std::string> coefIndexExprs = {subBlkIndVar, coefIndExpr};
+        std::vector<std::string> sampleIndexExprs = {subBlkIndVar, tapIndVar};
+
+        std::string operands_re[2];
+        std::string operands_im[2];
+
+        DataType coefDT = getInputPort(0)->getDataType();
+        operands_re[0] = DataType::cConvertType(inputExprs_re[0].getExprIndexed(coefIndexExprs, true), coefDT, accumType);
+        if(coefDT.isComplex()){
+            operands_im[0] = DataType::cConvertType(inputExprs_im[0].getExprIndexed(coefIndexExprs, true), coefDT, accumType);
+        }
+
+        DataType sampleDT = getInputPort(1)->getDataType();
+        operands_re[1] = DataType::cConvertType(inputExprs_re[1].getExprIndexed(sampleIndexExprs, true), sampleDT, accumType);
+        if(sampleDT.isComplex()){
+            operands_im[1] = DataType::cConvertType(inputExprs_im[1].getExprIndexed(sampleIndexExprs, true), sampleDT, accumType);
+        }
+
+        if(coefDT.isComplex() && complexConjBehavior == ComplexConjBehavior::FIRST){
+            operands_im[0] = "-(" + operands_im[0] + ")";
+        }
+        if(sampleDT.isComplex() && complexConjBehavior == ComplexConjBehavior::SECOND){
+            operands_im[1] = "-(" + operands_im[1] + ")";
+        }
+
+        std::string product_re;
+        std::string product_im;
+        std::string normExpr; //Not used since we are multiplying and not dividing
+        Product::generateMultExprs(operands_re[0], operands_im[0], operands_re[1], operands_im[1],
+                                   true, "", accumType, normExpr, product_re, product_im);
+
+        //The coefficient of the mirrored half of an antisymmetric filter is negated
+        std::string accumOp = negateCoef ? " -= " : " += ";
+        std::string accumIndex = EmitterHelpers::generateIndexOperation(std::vector<std::string>{subBlkIndVar});
+        cStatementQueue.push_back(accumulatorVar.getCVarName(false) + accumIndex + accumOp + product_re + ";");
+        if(accumType.isComplex()){
+            cStatementQueue.push_back(accumulatorVar.getCVarName(true) + accumIndex + accumOp + product_im + ";");
+        }
+    };
+
+    //Only the retained outputs are computed
+    cStatementQueue.push_back("for(unsigned long " + subBlkIndVar + " = 0; " + subBlkIndVar + "<" + GeneralHelper::to_string(subBlockingLength) + "; " + subBlkIndVar + "+=" + GeneralHelper::to_string(polyphaseDecimation) + "){");
+
+    //The sub-block starts at phase 0 of the zero stuffed input.  The non-zero samples for this output are at the taps
+    //congruent to the phase of the first output, offset by the position of the output in the sub-block
+    if(polyphaseInterpolation > 1){
+        cStatementQueue.push_back("unsigned long " + tapIndVar + " = (" + GeneralHelper::to_string(polyphaseInterpolationPhase) + "+" + interpStr + "-" + subBlkIndVar + "%" + interpStr + ")%" + interpStr + ";");
+    }else{
+        cStatementQueue.push_back("unsigned long " + tapIndVar + " = 0;");
+    }
+
+    //The provided coefficients
+    cStatementQueue.push_back("for(; " + tapIndVar + "<" + GeneralHelper::to_string(numCoefs) + "; " + tapIndVar + "+=" + interpStr + "){");
+    accumulateProduct(tapIndVar, false);
+    cStatementQueue.push_back("}");
+
+    //The mirrored half of folded coefficients
+    if(coefSymmetry != CoefSymmetry::NONE){
+        //The middle coefficient of an odd length antisymmetric filter is 0 and is not provided
+        int mirrorStart = std::max(numCoefs, numSamples-numCoefs);
+        if(mirrorStart > numCoefs){
+            cStatementQueue.push_back("if(" + tapIndVar + "<" + GeneralHelper::to_string(mirrorStart) + "){");
+            cStatementQueue.push_back(tapIndVar + "+=" + interpStr + ";");
+            cStatementQueue.push_back("}");
+        }
+
+        cStatementQueue.push_back("for(; " + tapIndVar + "<" + GeneralHelper::to_string(numSamples) + "; " + tapIndVar + "+=" + interpStr + "){");
+        accumulateProduct("(" + GeneralHelper::to_string(numSamples-1) + "-" + tapIndVar + ")", coefSymmetry == CoefSymmetry::ANTISYMMETRIC);
+        cStatementQueue.push_back("}");
+    }
+
+    cStatementQueue.push_back("}");
+}
+
+void InnerProduct::emitCExprTiled(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                                  std::vector<CExpr> &inputExprs_im, const std::vector<int> &unSubBlockedDims,
+                                  Variable &accumulatorVar, DataType accumType) {
+    //The sub-block is split into tiles of outputs whose accumulators are held in registers.  The loop over the inner
+    //product is inside the tile so that each coefficient is loaded once per tile rather than once per output.
+    int tileLen = VITIS_BLOCK_FIR_TILE_OUTPUTS;
+    int len = unSubBlockedDims[0];
+    int remStart = subBlockingLength - subBlockingLength%tileLen;
+    std::string subBlkIndVar = "subBlkInd0";
+    std::string indVar = "indDim0";
+
+    DataType accumElementType = accumType;
+    accumElementType.setDimensions({1});
+    std::string accumElementTypeStr = accumElementType.toString(DataType::StringStyle::C, false, false);
+
+    //Generates the product of the 2 inputs (including the complex conjugate) for the given sub-block
+    auto generateProduct = [&](std::string subBlkIndExpr, std::string &product_re, std::string &product_im){
+        std::string operands_re[2];
+        std::string operands_im[2];
+
+        for(int i = 0; i<2; i++){
+            DataType inputDT = getInputPort(i)->getDataType();
+            std::vector<std::string> indexExprs = {subBlkIndExpr, indVar};
+
+            operands_re[i] = DataType::cConvertType(inputExprs_re[i].getExprIndexed(indexExprs, true), inputDT, accumType);
+            if(inputDT.isComplex()){
+                operands_im[i] = DataType::cConvertType(inputExprs_im[i].getExprIndexed(indexExprs, true), inputDT, accumType);
+            }
+        }
+
+        if(getInputPort(0)->getDataType().isComplex() && complexConjBehavior == ComplexConjBehavior::FIRST){
+            operands_im[0] = "-(" + operands_im[0] + ")";
+        }
+        if(getInputPort(1)->getDataType().isComplex() && complexConjBehavior == ComplexConjBehavior::SECOND){
+            operands_im[1] = "-(" + operands_im[1] + ")";
+        }
+
+        std::string normExpr; //Not used since we are multiplying and not dividing
+        Product::generateMultExprs(operands_re[0], operands_im[0], operands_re[1], operands_im[1],
+                                   true, "", accumType, normExpr, product_re, product_im);
+    };
+
+    std::string product_re;
+    std::string product_im;
+
+    if(remStart > 0){
+        cStatementQueue.push_back("for(unsigned long " + subBlkIndVar + " = 0; " + subBlkIndVar + "<" + GeneralHelper::to_string(remStart) + "; " + subBlkIndVar + "+=" + GeneralHelper::to_string(tileLen) + "){");
+
+        for(int t = 0; t<tileLen; t++){
+            for(int imag = 0; imag<(accumType.isComplex() ? 2 : 1); imag++){
+                cStatementQueue.push_back(accumElementTypeStr + " " + accumulatorVar.getCVarName(imag) + "_Tile" + GeneralHelper::to_string(t) + " = 0;");
+            }
+        }
+
+        cStatementQueue.push_back("for(unsigned long " + indVar + " = 0; " + indVar + "<" + GeneralHelper::to_string(len) + "; " + indVar + "++){");
+        for(int t = 0; t<tileLen; t++){
+            generateProduct("(" + subBlkIndVar + "+" + GeneralHelper::to_string(t) + ")", product_re, product_im);
+            cStatementQueue.push_back(accumulatorVar.getCVarName(false) + "_Tile" + GeneralHelper::to_string(t) + " += " + product_re + ";");
+            if(accumType.isComplex()){
+                cStatementQueue.push_back(accumulatorVar.getCVarName(true) + "_Tile" + GeneralHelper::to_string(t) + " += " + product_im + ";");
+            }
+        }
+        cStatementQueue.push_back("}");
+
+        for(int t = 0; t<tileLen; t++){
+            for(int imag = 0; imag<(accumType.isComplex() ? 2 : 1); imag++){
+                cStatementQueue.push_back(accumulatorVar.getCVarName(imag) + "[" + subBlkIndVar + "+" + GeneralHelper::to_string(t) + "] += " +
+                                          accumulatorVar.getCVarName(imag) + "_Tile" + GeneralHelper::to_string(t) + ";");
+            }
+        }
+
+        cStatementQueue.push_back("}");
+    }
+
+    //Remainder of the sub-block
+    if(remStart != subBlockingLength){
+        cStatementQueue.push_back("for(unsigned long " + subBlkIndVar + " = " + GeneralHelper::to_string(remStart) + "; " + subBlkIndVar + "<" + GeneralHelper::to_string(subBlockingLength) + "; " + subBlkIndVar + "++){");
+        cStatementQueue.push_back("for(unsigned long " + indVar + " = 0; " + indVar + "<" + GeneralHelper::to_string(len) + "; " + indVar + "++){");
+        generateProduct(subBlkIndVar, product_re, product_im);
+        cStatementQueue.push_back(accumulatorVar.getCVarName(false) + "[" + subBlkIndVar + "] += " + product_re + ";");
+        if(accumType.isComplex()){
+            cStatementQueue.push_back(accumulatorVar.getCVarName(true) + "[" + subBlkIndVar + "] += " + product_im + ";");
+        }
+        cStatementQueue.push_back("}");
+        cStatementQueue.push_back("}");
+    }
+}
+
+void InnerProduct::emitCExprFFT(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                                std::vector<CExpr> &inputExprs_im, int taps, Variable &accumulatorVar,
+                                DataType accumType) {
+    int fftLen = BlockFIRHelpers::getFFTLength(taps, subBlockingLength);
+    int segmentLen = taps-1+subBlockingLength;
+
+    DataType elementType = accumType;
+    elementType.setDimensions({1});
+    elementType.setComplex(false);
+    std::string elementTypeStr = elementType.toString(DataType::StringStyle::C, false, false);
+
+    DataType tableType = elementType;
+    tableType.setComplex(true);
+    tableType.setDimensions({fftLen});
+    Variable fftBufVar(name + "_n" + GeneralHelper::to_string(id) + "_FFTBuf", tableType);
+    Variable twiddleVar(getFFTTwiddleTableName(), tableType);
+    Variable spectrumVar(getFFTCoefSpectrumTableName(), tableType);
+    std::string fftBuf_re = fftBufVar.getCVarName(false);
+    std::string fftBuf_im = fftBufVar.getCVarName(true);
+    std::string fftFn = BlockFIRHelpers::getFFTFunctionName(elementType);
+    std::string indVar = "fftInd";
+
+    //Open a scope for the FFT buffer
+    cStatementQueue.push_back("{");
+    cStatementQueue.push_back(fftBufVar.getCVarDecl(false, true, false, true) + ";");
+    cStatementQueue.push_back(fftBufVar.getCVarDecl(true, true, false, true) + ";");
+
+    //Copy the segment of samples (the history followed by the new samples of the sub-block) and zero pad
+    bool samplesComplex = getInputPort(1)->getDataType().isComplex();
+    std::vector<std::string> segmentIndexExprs = {"0", indVar};
+    cStatementQueue.push_back("for(int " + indVar + " = 0; " + indVar + "<" + GeneralHelper::to_string(segmentLen) + "; " + indVar + "++){");
+    cStatementQueue.push_back(fftBuf_re + "[" + indVar + "] = (" + elementTypeStr + ") " + inputExprs_re[1].getExprIndexed(segmentIndexExprs, true) + ";");
+    cStatementQueue.push_back(fftBuf_im + "[" + indVar + "] = " + (samplesComplex ? "(" + elementTypeStr + ") " + inputExprs_im[1].getExprIndexed(segmentIndexExprs, true) : "0") + ";");
+    cStatementQueue.push_back("}");
+    if(segmentLen < fftLen){
+        cStatementQueue.push_back("for(int " + indVar + " = " + GeneralHelper::to_string(segmentLen) + "; " + indVar + "<" + GeneralHelper::to_string(fftLen) + "; " + indVar + "++){");
+        cStatementQueue.push_back(fftBuf_re + "[" + indVar + "] = 0;");
+        cStatementQueue.push_back(fftBuf_im + "[" + indVar + "] = 0;");
+        cStatementQueue.push_back("}");
+    }
+
+    cStatementQueue.push_back(fftFn + "(" + fftBuf_re + ", " + fftBuf_im + ", " + twiddleVar.getCVarName(false) + ", " + twiddleVar.getCVarName(true) + ", " + GeneralHelper::to_string(fftLen) + ", 0);");
+
+    //Multiply by the coefficient spectrum (which includes the scaling of the inverse transform)
+    cStatementQueue.push_back("for(int " + indVar + " = 0; " + indVar + "<" + GeneralHelper::to_string(fftLen) + "; " + indVar + "++){");
+    cStatementQueue.push_back(elementTypeStr + " prodRe = " + fftBuf_re + "[" + indVar + "]*" + spectrumVar.getCVarName(false) + "[" + indVar + "] - " + fftBuf_im + "[" + indVar + "]*" + spectrumVar.getCVarName(true) + "[" + indVar + "];");
+    cStatementQueue.push_back(elementTypeStr + " prodIm = " + fftBuf_re + "[" + indVar + "]*" + spectrumVar.getCVarName(true) + "[" + indVar + "] + " + fftBuf_im + "[" + indVar + "]*" + spectrumVar.getCVarName(false) + "[" + indVar + "];");
+    cStatementQueue.push_back(fftBuf_re + "[" + indVar + "] = prodRe;");
+    cStatementQueue.push_back(fftBuf_im + "[" + indVar + "] = prodIm;");
+    cStatementQueue.push_back("}");
+
+    cStatementQueue.push_back(fftFn + "(" + fftBuf_re + ", " + fftBuf_im + ", " + twiddleVar.getCVarName(false) + ", " + twiddleVar.getCVarName(true) + ", " + GeneralHelper::to_string(fftLen) + ", 1);");
+
+    //The first taps-1 outputs of the circular convolution wrap around and are discarded
+    std::string subBlkIndVar = "subBlkInd0";
+    cStatementQueue.push_back("for(int " + subBlkIndVar + " = 0; " + subBlkIndVar + "<" + GeneralHelper::to_string(subBlockingLength) + "; " + subBlkIndVar + "++){");
+    cStatementQueue.push_back(accumulatorVar.getCVarName(false) + "[" + subBlkIndVar + "] = " + fftBuf_re + "[" + subBlkIndVar + "+" + GeneralHelper::to_string(taps-1) + "];");
+    if(accumType.isComplex()){
+        cStatementQueue.push_back(accumulatorVar.getCVarName(true) + "[" + subBlkIndVar + "] = " + fftBuf_im + "[" + subBlkIndVar + "+" + GeneralHelper::to_string(taps-1) + "];");
+    }
+    cStatementQueue.push_back("}");
+
+    //Close the scope of the FFT buffer
+    cStatementQueue.push_back("}");
+}
+
 std::string InnerProduct::complexConjBehaviorToString(InnerProduct::ComplexConjBehavior complexConjBehavior) {
     if(complexConjBehavior == ComplexConjBehavior::FIRST){
         return "First";
@@ -451,6 +1174,30 @@ InnerProduct::ComplexConjBehavior InnerProduct::parseComplexConjBehavior(std::st
     throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown ComplexConjBehavior: " + string));
 }
 
+std::string InnerProduct::coefSymmetryToString(InnerProduct::CoefSymmetry coefSymmetry) {
+    if(coefSymmetry == CoefSymmetry::NONE){
+        return "None";
+    }else if(coefSymmetry == CoefSymmetry::SYMMETRIC){
+        return "Symmetric";
+    }else if(coefSymmetry == CoefSymmetry::ANTISYMMETRIC){
+        return "Antisymmetric";
+    }
+
+    throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown CoefSymmetry"));
+}
+
+InnerProduct::CoefSymmetry InnerProduct::parseCoefSymmetry(std::string string) {
+    if(string == "None"){
+        return CoefSymmetry::NONE;
+    }else if(string == "Symmetric"){
+        return CoefSymmetry::SYMMETRIC;
+    }else if(string == "Antisymmetric"){
+        return CoefSymmetry::ANTISYMMETRIC;
+    }
+
+    throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown CoefSymmetry: " + string));
+}
+
 InnerProduct::ComplexConjBehavior InnerProduct::getComplexConjBehavior() const {
     return complexConjBehavior;
 }
@@ -459,6 +1206,22 @@ void InnerProduct::setComplexConjBehavior(InnerProduct::ComplexConjBehavior comp
     InnerProduct::complexConjBehavior = complexConjBehavior;
 }
 
+InnerProduct::CoefSymmetry InnerProduct::getCoefSymmetry() const {
+    return coefSymmetry;
+}
+
+void InnerProduct::setCoefSymmetry(InnerProduct::CoefSymmetry coefSymmetry) {
+    InnerProduct::coefSymmetry = coefSymmetry;
+}
+
+SIMDHelpers::SIMDTarget InnerProduct::getSimdTarget() const {
+    return simdTarget;
+}
+
+void InnerProduct::setSimdTarget(SIMDHelpers::SIMDTarget simdTarget) {
+    InnerProduct::simdTarget = simdTarget;
+}
+
 bool InnerProduct::specializesForBlocking() {
     return true;
 }
@@ -488,3 +1251,64 @@ void InnerProduct::specializeForBlocking(int localBlockingLength,
     //The arcs should be expanded to the block length
     BlockingHelpers::requestDeferredBlockingExpansionOfNodeArcs(getSharedPointer(), localBlockingLength, localBlockingLength, arcsWithDeferredBlockingExpansion);
 }
+
+BlockFIRHelpers::BlockFIRImplementation InnerProduct::getBlockFIRImplementation() const {
+    return blockFIRImplementation;
+}
+
+void InnerProduct::setBlockFIRImplementation(BlockFIRHelpers::BlockFIRImplementation blockFIRImplementation) {
+    InnerProduct::blockFIRImplementation = blockFIRImplementation;
+}
+
+int InnerProduct::getSubBlockingLength() const {
+    return subBlockingLength;
+}
+
+int InnerProduct::getPolyphaseDecimation() const {
+    return polyphaseDecimation;
+}
+
+void InnerProduct::setPolyphaseDecimation(int polyphaseDecimation) {
+    InnerProduct::polyphaseDecimation = polyphaseDecimation;
+}
+
+int InnerProduct::getPolyphaseInterpolation() const {
+    return polyphaseInterpolation;
+}
+
+int InnerProduct::getPolyphaseInterpolationPhase() const {
+    return polyphaseInterpolationPhase;
+}
+
+void InnerProduct::setPolyphaseInterpolation(int polyphaseInterpolation, int polyphaseInterpolationPhase) {
+    InnerProduct::polyphaseInterpolation = polyphaseInterpolation;
+    InnerProduct::polyphaseInterpolationPhase = polyphaseInterpolationPhase;
+}
+
+bool InnerProduct::hasGlobalDecl() {
+    return resolveBlockFIRImplementation() == BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE;
+}
+
+std::string InnerProduct::getGlobalDecl() {
+    std::vector<std::complex<double>> coefs;
+    if(!hasGlobalDecl() || !getFFTCoefs(coefs)){
+        return "";
+    }
+
+    int fftLen = BlockFIRHelpers::getFFTLength(coefs.size(), subBlockingLength);
+
+    DataType elementType = getAccumulatorType();
+    elementType.setComplex(false);
+
+    DataType tableType = elementType;
+    tableType.setComplex(true);
+    tableType.setDimensions({fftLen/2});
+    Variable twiddleVar(getFFTTwiddleTableName(), tableType);
+
+    tableType.setDimensions({fftLen});
+    Variable spectrumVar(getFFTCoefSpectrumTableName(), tableType);
+
+    return BlockFIRHelpers::emitFFTFunction(elementType) + "\n" +
+           BlockFIRHelpers::emitComplexTable(twiddleVar, BlockFIRHelpers::getTwiddleFactors(fftLen)) + "\n" +
+           BlockFIRHelpers::emitComplexTable(spectrumVar, BlockFIRHelpers::getCoefSpectrum(coefs, fftLen));
+}
@@ -8,6 +8,8 @@
 #include "PrimitiveNode.h"
 #include "GraphMLTools/GraphMLDialect.h"
 #include "GraphCore/NodeFactory.h"
+#include "General/SIMDHelpers.h"
+#include "General/BlockFIRHelpers.h"
 
 /**
  * \addtogroup PrimitiveNodes Primitives
@@ -20,6 +22,12 @@
  * the convention followed by Matlab and "Statistical Digital Signal Processing and Modeling" by Monson H. Hayes.
  *
  * If different behavior is desired, it can be set via the
+ *
+ * When sub-blocked, the InnerProduct of a FIR filter (a TappedDelay feeding port 1 with the coefficients on port 0)
+ * can be emitted with a block implementation (see BlockFIRHelpers)
+ *
+ * When a sub-blocked FIR feeds a Downsample or is fed by an Upsample in a vector mode clock domain, it can be emitted as
+ * a polyphase filter (see DomainPasses::fusePolyphaseFIRs)
  */
 class InnerProduct : public PrimitiveNode {
     friend NodeFactory;
@@ -33,10 +41,32 @@ public:
     static std::string complexConjBehaviorToString(ComplexConjBehavior complexConjBehavior);
     static ComplexConjBehavior parseComplexConjBehavior(std::string string);
 
+    /**
+     * @brief Indicates if the coefficients on port 0 are folded because they are symmetric or antisymmetric
+     *
+     * When folded, port 0 contains the first half of the N coefficients (including the middle coefficient of an odd
+     * length filter if it is non-zero) and port 1 contains all N samples.  Mirrored samples are pre-added (or
+     * subtracted) before being multiplied by the shared coefficient, halving the number of multiplies.
+     */
+    enum class CoefSymmetry{
+        NONE, ///<The coefficients are not folded.  Both ports have the same dimensions
+        SYMMETRIC, ///<c[k] == c[N-1-k].  The result is sum(c[k]*(x[k]+x[N-1-k])) (+ c[mid]*x[mid] if N is odd)
+        ANTISYMMETRIC ///<c[k] == -c[N-1-k].  The result is sum(c[k]*(x[k]-x[N-1-k]))
+    };
+
+    static std::string coefSymmetryToString(CoefSymmetry coefSymmetry);
+    static CoefSymmetry parseCoefSymmetry(std::string string);
+
 private:
     ComplexConjBehavior complexConjBehavior; ///<Controls how complex conjugates are taken.  The default is to take the complex conjugate of the first which follows the Matlab convention.  None is helpful for convolution where neither term has the complex conjugate taken.  Correlation does use the complex conjugation
     bool emittedBefore; ///<Tracks if this InnerProduct has been emitted before (used in emit - not a parameter to save to XML)
     int subBlockingLength; ///<Indicates the sub-blocking length
+    SIMDHelpers::SIMDTarget simdTarget; ///<The SIMD target to emit explicit vector code for (not a parameter to save to XML)
+    CoefSymmetry coefSymmetry; ///<Indicates if the coefficients on port 0 are folded.  Defaults to NONE
+    BlockFIRHelpers::BlockFIRImplementation blockFIRImplementation; ///<The implementation used when sub-blocked.  Defaults to DIRECT.  Set to AUTO by DiscreteFIR so the implementation is selected by the cost model
+    int polyphaseDecimation; ///<If >1, only every polyphaseDecimation-th output of the sub-block (starting with the first) is consumed and computed.  Defaults to 1 (not a parameter to save to XML)
+    int polyphaseInterpolation; ///<If >1, only every polyphaseInterpolation-th sample on port 1 is non-zero and only those taps are computed.  Defaults to 1 (not a parameter to save to XML)
+    int polyphaseInterpolationPhase; ///<The index (mod polyphaseInterpolation) of the first non-zero tap for the first output of the sub-block (not a parameter to save to XML)
 
     //==== Constructors ====
     /**
@@ -69,10 +99,131 @@ private:
      */
     InnerProduct(std::shared_ptr<SubSystem> parent, InnerProduct* orig);
 
+    /**
+     * @brief Get the number of lanes to use when emitting the InnerProduct with explicit vector code
+     *
+     * When sub-blocked, the sub-blocking dimension is vectorized.  This allows a coefficient to be broadcast across a
+     * vector of sub-blocks (which are contiguous in a tapped delay).  When not sub-blocked, the inner product itself is
+     * vectorized with a vector accumulator which is reduced after the loop.
+     *
+     * @return the number of lanes or 1 if the InnerProduct cannot be emitted with explicit vector code
+     */
+    int getSIMDLanes(std::vector<CExpr> &inputExprs_re, std::vector<CExpr> &inputExprs_im,
+                     const std::vector<int> &unSubBlockedDims, DataType accumType);
+
+    /**
+     * @brief Emits the InnerProduct loops with explicit vector code
+     *
+     * The accumulators are expected to be declared and initialized before this is called
+     */
+    void emitCExprSIMD(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                       std::vector<CExpr> &inputExprs_im, const std::vector<int> &unSubBlockedDims,
+                       Variable &accumulatorVar, DataType accumType, int lanes);
+
+    /**
+     * @brief Emits the InnerProduct with folded coefficients (see CoefSymmetry).  Mirrored samples are pre-added
+     * before being multiplied by the coefficient.  If sub-blocked, the sub-block is the inner loop.
+     *
+     * The accumulators are expected to be declared and initialized before this is called
+     */
+    void emitCExprFolded(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                         std::vector<CExpr> &inputExprs_im, int numCoefs, int numSamples,
+                         Variable &accumulatorVar, DataType accumType);
+
+    /**
+     * @brief Get the type of the accumulator (a scalar CPU storage type)
+     */
+    DataType getAccumulatorType();
+
+    /**
+     * @brief Get the coefficients of a FIR filter if this InnerProduct can be emitted with FFT overlap-save
+     *
+     * Requires floating point accumulation, a Constant driving port 0 (the coefficients), and a sub-blocked
+     * TappedDelay driving port 1.  The complex conjugate (if any) is applied to the returned coefficients and folded
+     * coefficients are unfolded.
+     *
+     * @param coefs set to the coefficients (oldest first) if FFT overlap-save can be used
+     * @return true if FFT overlap-save can be used
+     */
+    bool getFFTCoefs(std::vector<std::complex<double>> &coefs);
+
+    /**
+     * @brief Resolves the block FIR implementation used by this node (considering the sub-blocking length and the
+     * cost model if the implementation is AUTO)
+     *
+     * @return the implementation to use (never AUTO).  DIRECT if not sub-blocked
+     */
+    BlockFIRHelpers::BlockFIRImplementation resolveBlockFIRImplementation();
+
+    /**
+     * @brief Get the name of the FFT twiddle factor table
+     */
+    std::string getFFTTwiddleTableName();
+
+    /**
+     * @brief Get the name of the coefficient spectrum table
+     */
+    std::string getFFTCoefSpectrumTableName();
+
+    /**
+     * @brief Check if this InnerProduct is emitted as a polyphase filter (see polyphaseDecimation and
+     * polyphaseInterpolation)
+     *
+     * @return true if the InnerProduct is sub-blocked and a polyphase decimation or interpolation factor is set
+     */
+    bool isPolyphase();
+
+    /**
+     * @brief Emits the sub-blocked InnerProduct as a polyphase filter.  Only the retained outputs are computed and, if
+     * interpolating, only the taps aligned with non-zero samples are accumulated.  Folded coefficients are indexed from
+     * their mirror rather than pre-added since mirrored samples are not necessarily both non-zero.
+     *
+     * The accumulators are expected to be declared and initialized before this is called
+     */
+    void emitCExprPolyphase(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                            std::vector<CExpr> &inputExprs_im, int numCoefs, int numSamples,
+                            Variable &accumulatorVar, DataType accumType);
+
+    /**
+     * @brief Emits the sub-blocked InnerProduct with a tile of outputs accumulated in registers
+     *
+     * The accumulators are expected to be declared and initialized before this is called
+     */
+    void emitCExprTiled(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                        std::vector<CExpr> &inputExprs_im, const std::vector<int> &unSubBlockedDims,
+                        Variable &accumulatorVar, DataType accumType);
+
+    /**
+     * @brief Emits the sub-blocked InnerProduct of a FIR filter with FFT overlap-save
+     *
+     * The accumulators are expected to be declared before this is called.  They are overwritten with the result.
+     */
+    void emitCExprFFT(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                      std::vector<CExpr> &inputExprs_im, int taps, Variable &accumulatorVar, DataType accumType);
+
 public:
     //====Getters/Setters====
     ComplexConjBehavior getComplexConjBehavior() const;
     void setComplexConjBehavior(ComplexConjBehavior complexConjBehavior);
+    SIMDHelpers::SIMDTarget getSimdTarget() const;
+    void setSimdTarget(SIMDHelpers::SIMDTarget simdTarget);
+    CoefSymmetry getCoefSymmetry() const;
+    void setCoefSymmetry(CoefSymmetry coefSymmetry);
+    BlockFIRHelpers::BlockFIRImplementation getBlockFIRImplementation() const;
+    void setBlockFIRImplementation(BlockFIRHelpers::BlockFIRImplementation blockFIRImplementation);
+    int getSubBlockingLength() const;
+    int getPolyphaseDecimation() const;
+    void setPolyphaseDecimation(int polyphaseDecimation);
+    int getPolyphaseInterpolation() const;
+    int getPolyphaseInterpolationPhase() const;
+
+    /**
+     * @brief Sets the polyphase interpolation factor
+     * @param polyphaseInterpolation the number of samples on port 1 per non-zero sample
+     * @param polyphaseInterpolationPhase the index (mod polyphaseInterpolation) of the first non-zero tap for the first
+     * output of the sub-block
+     */
+    void setPolyphaseInterpolation(int polyphaseInterpolation, int polyphaseInterpolationPhase);
 
     //====Factories====
     /**
@@ -111,6 +262,14 @@ public:
      *
      * @note if the first input is complex, it's complex conjugate is taken
      *
+     * If a SIMD target is set and the input types match the accumulator type, the loops are emitted with explicit
+     * vector code
+     *
+     * If sub-blocked, the block FIR implementation is used (see resolveBlockFIRImplementation).  FFT overlap-save
+     * takes precedence over the polyphase implementation which takes precedence over folded coefficients (see
+     * CoefSymmetry) which take precedence over explicit vector code which takes precedence over the tiled
+     * implementation.  A folded decimating filter keeps the pre-add and only computes the retained outputs
+     *
      */
     CExpr emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::SchedType schedType, int outputPortNum,
                     bool imag = false) override;
@@ -127,6 +286,14 @@ public:
 
     bool specializesForBlocking() override;
 
+    /**
+     * @brief The FFT overlap-save implementation declares the FFT function, the twiddle factors, and the coefficient
+     * spectrum globally
+     */
+    bool hasGlobalDecl() override;
+
+    std::string getGlobalDecl() override;
+
 //    EstimatorCommon::ComputeWorkload getComputeWorkloadEstimate(bool expandComplexOperators, bool expandHighLevelOperators, ComputationEstimator::EstimatorOption includeIntermediateLoadStore, ComputationEstimator::EstimatorOption includeInputOutputLoadStores) override;
 };
 
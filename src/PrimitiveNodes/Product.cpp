@@ -9,11 +9,11 @@
 #include "General/ErrorHelpers.h"
 #include "General/EmitterHelpers.h"
 
-Product::Product() : emittedBefore(false) {
+Product::Product() : emittedBefore(false), simdTarget(SIMDHelpers::SIMDTarget::NONE) {
 
 }
 
-Product::Product(std::shared_ptr<SubSystem> parent) : PrimitiveNode(parent), emittedBefore(false) {
+Product::Product(std::shared_ptr<SubSystem> parent) : PrimitiveNode(parent), emittedBefore(false), simdTarget(SIMDHelpers::SIMDTarget::NONE) {
 
 }
 
@@ -25,6 +25,14 @@ void Product::setInputOp(const std::vector<bool> &inputOp) {
     Product::inputOp = inputOp;
 }
 
+SIMDHelpers::SIMDTarget Product::getSimdTarget() const {
+    return simdTarget;
+}
+
+void Product::setSimdTarget(SIMDHelpers::SIMDTarget simdTarget) {
+    Product::simdTarget = simdTarget;
+}
+
 std::shared_ptr<Product> Product::createFromGraphML(int id, std::string name,
                                                     std::map<std::string, std::string> dataKeyValueMap,
                                                     std::shared_ptr<SubSystem> parent, GraphMLDialect dialect) {
@@ -260,6 +268,12 @@ CExpr Product::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams:
             }
         }
 
+        int simdLanes = getSIMDLanes(inputExprs_re, inputExprs_im);
+        if(simdLanes > 1){
+            emittedBefore = true;
+            return emitCExprSIMD(cStatementQueue, inputExprs_re, inputExprs_im, imag, simdLanes);
+        }
+
         //Declare the variable here in case it is a vector
         Variable outputVar = Variable(outputVarName, outputType);
 
@@ -456,7 +470,7 @@ CExpr Product::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams:
     return CExpr("", CExpr::ExprType::SCALAR_EXPR);
 }
 
-Product::Product(std::shared_ptr<SubSystem> parent, Product* orig) : PrimitiveNode(parent, orig), inputOp(orig->inputOp), emittedBefore(orig->emittedBefore){
+Product::Product(std::shared_ptr<SubSystem> parent, Product* orig) : PrimitiveNode(parent, orig), inputOp(orig->inputOp), emittedBefore(orig->emittedBefore), simdTarget(orig->simdTarget){
 
 }
 
@@ -544,4 +558,155 @@ void Product::generateMultExprs(const std::string &a_re, const std::string &a_im
     }
 }
 
+int Product::getSIMDLanes(std::vector<CExpr> &inputExprs_re, std::vector<CExpr> &inputExprs_im) {
+    DataType outputDT = getOutputPort(0)->getDataType();
+    int lanes = SIMDHelpers::getLanes(simdTarget, outputDT);
+    if(lanes <= 1 || outputDT.isScalar() || outputDT.getDimensions().back() < lanes){
+        return 1;
+    }
+
+    unsigned long numIndexExprs = outputDT.getDimensions().size();
+    for(unsigned long i = 0; i<inputExprs_re.size(); i++){
+        DataType inputDT = getInputPort(i)->getDataType();
+        if(!inputOp[i] || !SIMDHelpers::sameElementType(inputDT, outputDT)){
+            return 1;
+        }
+
+        if(!inputDT.isScalar()){
+            if(SIMDHelpers::getAccessType(inputExprs_re[i], numIndexExprs, numIndexExprs-1) == SIMDHelpers::AccessType::UNSUPPORTED){
+                return 1;
+            }
+            if(inputDT.isComplex() && SIMDHelpers::getAccessType(inputExprs_im[i], numIndexExprs, numIndexExprs-1) == SIMDHelpers::AccessType::UNSUPPORTED){
+                return 1;
+            }
+        }
+    }
+
+    return lanes;
+}
+
+CExpr Product::emitCExprSIMD(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                             std::vector<CExpr> &inputExprs_im, bool imag, int lanes) {
+    DataType outputType = getOutputPort(0)->getDataType();
+    DataType elementType = SIMDHelpers::getElementType(outputType);
+    std::vector<int> dims = outputType.getDimensions();
+    std::string vecTypeName = SIMDHelpers::getVectorTypeName(elementType, lanes);
+
+    std::string outputVarName = name + "_n" + GeneralHelper::to_string(id) + "_out";
+    Variable outputVar = Variable(outputVarName, outputType);
+
+    //Emit variable declaration
+    cStatementQueue.push_back(outputVar.getCVarDecl(false, true, false, true) + ";");
+    if(outputType.isComplex()){
+        cStatementQueue.push_back(outputVar.getCVarDecl(true, true, false, true) + ";");
+    }
+
+    //Open a scope for the vector type
+    cStatementQueue.push_back("{");
+    cStatementQueue.push_back(SIMDHelpers::getVectorTypeDef(elementType, lanes));
 
+    //The outer dimensions are scalar loops, the innermost dimension is vectorized
+    std::vector<int> outerDims(dims.begin(), dims.end()-1);
+    std::vector<std::string> forLoopIndexVars;
+    std::vector<std::string> forLoopClose;
+    if(!outerDims.empty()){
+        std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> forLoopStrs =
+                EmitterHelpers::generateVectorMatrixForLoops(outerDims);
+
+        std::vector<std::string> forLoopOpen = std::get<0>(forLoopStrs);
+        forLoopIndexVars = std::get<1>(forLoopStrs);
+        forLoopClose = std::get<2>(forLoopStrs);
+
+        cStatementQueue.insert(cStatementQueue.end(), forLoopOpen.begin(), forLoopOpen.end());
+    }
+
+    std::string vecIndVar = "indDim" + GeneralHelper::to_string(dims.size()-1);
+    std::vector<std::string> indexExprs = forLoopIndexVars;
+    indexExprs.push_back(vecIndVar);
+    long vecIndexPos = indexExprs.size()-1;
+
+    std::string intermediate_var_name_prefix = name + "_n" + GeneralHelper::to_string(id) + "_intermediate";
+
+    //Emits the product with operands either loaded as vectors or as scalars (for the remainder)
+    auto emitProduct = [&](bool vec){
+        std::string typeName = vec ? vecTypeName : elementType.toString(DataType::StringStyle::C, false, false);
+        std::string prev_expr_re = "";
+        std::string prev_expr_im = "";
+
+        for(unsigned long i = 0; i<inputExprs_re.size(); i++){
+            DataType inputDT = getInputPort(i)->getDataType();
+            std::vector<std::string> portIndexExprs;
+            long portVecIndexPos = -1;
+            if(!inputDT.isScalar()){
+                portIndexExprs = indexExprs;
+                portVecIndexPos = vecIndexPos;
+            }
+
+            std::string operand_re;
+            std::string operand_im;
+            if(vec){
+                operand_re = SIMDHelpers::emitLoad(inputExprs_re[i], SIMDHelpers::getAccessType(inputExprs_re[i], portIndexExprs.size(), portVecIndexPos),
+                                                   portIndexExprs, elementType, lanes);
+                if(inputDT.isComplex()){
+                    operand_im = SIMDHelpers::emitLoad(inputExprs_im[i], SIMDHelpers::getAccessType(inputExprs_im[i], portIndexExprs.size(), portVecIndexPos),
+                                                       portIndexExprs, elementType, lanes);
+                }
+            }else{
+                operand_re = SIMDHelpers::emitElement(inputExprs_re[i], portIndexExprs);
+                if(inputDT.isComplex()){
+                    operand_im = SIMDHelpers::emitElement(inputExprs_im[i], portIndexExprs);
+                }
+            }
+
+            if(i == 0){
+                prev_expr_re = operand_re;
+                prev_expr_im = operand_im;
+            }else{
+                std::string operand_a_re = prev_expr_re;
+                std::string operand_a_im = prev_expr_im;
+                if(i > 1){
+                    //Store the previous intermediate result to avoid repeating it in the complex product expressions
+                    std::string prevVarName = intermediate_var_name_prefix + "_" + GeneralHelper::to_string(i - 1);
+                    cStatementQueue.push_back(typeName + " " + prevVarName + "_re = " + prev_expr_re + ";");
+                    operand_a_re = prevVarName + "_re";
+                    if(!prev_expr_im.empty()){
+                        cStatementQueue.push_back(typeName + " " + prevVarName + "_im = " + prev_expr_im + ";");
+                        operand_a_im = prevVarName + "_im";
+                    }
+                }
+
+                std::string norm_expr = ""; //Not used since only multiplication is vectorized
+                generateMultExprs(operand_a_re, operand_a_im, operand_re, operand_im, true, "", elementType, norm_expr,
+                                  prev_expr_re, prev_expr_im);
+            }
+        }
+
+        for(int imagComp = 0; imagComp<(outputType.isComplex() ? 2 : 1); imagComp++){
+            std::string outputElement = outputVar.getCVarName(imagComp) + EmitterHelpers::generateIndexOperation(indexExprs);
+            std::string result = imagComp ? prev_expr_im : prev_expr_re;
+            if(vec){
+                cStatementQueue.push_back(SIMDHelpers::emitStore(outputElement, result, elementType, lanes));
+            }else{
+                cStatementQueue.push_back(outputElement + " = " + result + ";");
+            }
+        }
+    };
+
+    cStatementQueue.push_back(SIMDHelpers::emitVectorLoopOpen(vecIndVar, dims.back(), lanes));
+    emitProduct(true);
+    cStatementQueue.push_back("}");
+
+    //Remainder of the innermost dimension
+    if(SIMDHelpers::getRemainderStart(dims.back(), lanes) != dims.back()){
+        cStatementQueue.push_back(SIMDHelpers::emitRemainderLoopOpen(vecIndVar, dims.back(), lanes));
+        emitProduct(false);
+        cStatementQueue.push_back("}");
+    }
+
+    cStatementQueue.insert(cStatementQueue.end(), forLoopClose.begin(), forLoopClose.end());
+
+    //Close the scope of the vector type
+    cStatementQueue.push_back("}");
+
+    return CExpr(outputVar.getCVarName(imag), CExpr::ExprType::ARRAY);
+}
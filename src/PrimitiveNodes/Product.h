@@ -12,6 +12,7 @@
 
 #include "PrimitiveNode.h"
 #include "GraphMLTools/GraphMLDialect.h"
+#include "General/SIMDHelpers.h"
 
 /**
  * \addtogroup PrimitiveNodes Primitives
@@ -26,6 +27,7 @@ class Product : public PrimitiveNode{
 private:
     std::vector<bool> inputOp; ///<An array of *, / to indicate the operation on the input.  * (true) = Multiply (Numerator), / (false) = Divide (Denominator)
     bool emittedBefore; ///<Tracks if this multiply has been emitted before (used in emit)
+    SIMDHelpers::SIMDTarget simdTarget; ///<The SIMD target to emit explicit vector code for (not a parameter to save to XML)
 
     //==== Constructors ====
     /**
@@ -58,6 +60,23 @@ private:
      */
     Product(std::shared_ptr<SubSystem> parent, Product* orig);
 
+    /**
+     * @brief Get the number of lanes to use when emitting an element-wise product with explicit vector code
+     *
+     * The innermost dimension of the output is vectorized.  All inputs and the output are required to have the same
+     * type and all inputs are required to be multiplied (no division).  For integer types, this is equivalent to
+     * multiplying in the wider intermediate type and truncating the result to the output type.
+     *
+     * @return the number of lanes or 1 if the product cannot be emitted with explicit vector code
+     */
+    int getSIMDLanes(std::vector<CExpr> &inputExprs_re, std::vector<CExpr> &inputExprs_im);
+
+    /**
+     * @brief Emits an element-wise product with explicit vector code
+     */
+    CExpr emitCExprSIMD(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs_re,
+                        std::vector<CExpr> &inputExprs_im, bool imag, int lanes);
+
 public:
     //Make generateMultExprs public so it can be used by InnerProduct
 
@@ -99,6 +118,8 @@ public:
     //====Getters/Setters====
     std::vector<bool> getInputOp() const;
     void setInputOp(const std::vector<bool> &inputOp);
+    SIMDHelpers::SIMDTarget getSimdTarget() const;
+    void setSimdTarget(SIMDHelpers::SIMDTarget simdTarget);
 
     //====Factories====
     /**
@@ -151,6 +172,9 @@ public:
      *
      * @note Masking can be (is) omitted (in the case of the output having the same type as the first input) if the total number of bits is a standard CPU type.
      *
+     * If a SIMD target is set, element-wise products where the inputs and output have the same type are emitted with
+     * explicit vector code
+     *
      */
     CExpr emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::SchedType schedType, int outputPortNum,
                     bool imag = false) override;
@@ -8,11 +8,11 @@
 #include "General/ErrorHelpers.h"
 #include "General/EmitterHelpers.h"
 
-Sum::Sum() : collapseDimension(-1) {
+Sum::Sum() : collapseDimension(-1), simdTarget(SIMDHelpers::SIMDTarget::NONE) {
 
 }
 
-Sum::Sum(std::shared_ptr<SubSystem> parent) : PrimitiveNode(parent), collapseDimension(-1) {
+Sum::Sum(std::shared_ptr<SubSystem> parent) : PrimitiveNode(parent), collapseDimension(-1), simdTarget(SIMDHelpers::SIMDTarget::NONE) {
 
 }
 
@@ -325,12 +325,17 @@ CExpr Sum::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::Sch
 
         //floating point numbers
 
-        //TODO: Possibly introduce an explicit vector intrinsic version or a version utilizing a linear alg library
+        //TODO: Possibly introduce a version utilizing a linear alg library
 
         DataType outputDT = getOutputPort(0)->getDataType();
 
         if(collapseDimension < 0) {
             //==== No Collapsing ====
+            int simdLanes = getSIMDLanes(inputExprs);
+            if(simdLanes > 1){
+                return emitCExprSIMD(cStatementQueue, inputExprs, imag, simdLanes);
+            }
+
             Variable vecOutVar;
             std::vector<std::string> forLoopIndexVars;
             std::vector<std::string> forLoopClose;
@@ -476,7 +481,7 @@ CExpr Sum::emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::Sch
     return CExpr("", CExpr::ExprType::SCALAR_EXPR);
 }
 
-Sum::Sum(std::shared_ptr<SubSystem> parent, Sum* orig) : PrimitiveNode(parent, orig), inputSign(orig->inputSign), collapseDimension(orig->collapseDimension){
+Sum::Sum(std::shared_ptr<SubSystem> parent, Sum* orig) : PrimitiveNode(parent, orig), inputSign(orig->inputSign), collapseDimension(orig->collapseDimension), simdTarget(orig->simdTarget){
 
 }
 
@@ -491,3 +496,116 @@ int Sum::getCollapseDimension() const {
 void Sum::setCollapseDimension(int collapseDimension) {
     Sum::collapseDimension = collapseDimension;
 }
+
+SIMDHelpers::SIMDTarget Sum::getSimdTarget() const {
+    return simdTarget;
+}
+
+void Sum::setSimdTarget(SIMDHelpers::SIMDTarget simdTarget) {
+    Sum::simdTarget = simdTarget;
+}
+
+int Sum::getSIMDLanes(std::vector<CExpr> &inputExprs) {
+    DataType outputDT = getOutputPort(0)->getDataType();
+    int lanes = SIMDHelpers::getLanes(simdTarget, outputDT);
+    if(lanes <= 1 || outputDT.isScalar() || outputDT.getDimensions().back() < lanes){
+        return 1;
+    }
+
+    unsigned long numIndexExprs = outputDT.getDimensions().size();
+    for(unsigned long i = 0; i<inputExprs.size(); i++){
+        DataType inputDT = getInputPort(i)->getDataType();
+        if(!SIMDHelpers::sameElementType(inputDT, outputDT)){
+            return 1;
+        }
+
+        if(!inputDT.isScalar() && SIMDHelpers::getAccessType(inputExprs[i], numIndexExprs, numIndexExprs-1) == SIMDHelpers::AccessType::UNSUPPORTED){
+            return 1;
+        }
+    }
+
+    return lanes;
+}
+
+CExpr Sum::emitCExprSIMD(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs, bool imag, int lanes) {
+    DataType outputDT = getOutputPort(0)->getDataType();
+    DataType elementType = SIMDHelpers::getElementType(outputDT);
+    std::vector<int> dims = outputDT.getDimensions();
+
+    //Declare tmp array
+    std::string vecOutName = name + "_n" + GeneralHelper::to_string(id) + "_outVec";
+    Variable vecOutVar = Variable(vecOutName, outputDT);
+    cStatementQueue.push_back(vecOutVar.getCVarDecl(imag, true, false, true, false) + ";");
+
+    //Open a scope for the vector type
+    cStatementQueue.push_back("{");
+    cStatementQueue.push_back(SIMDHelpers::getVectorTypeDef(elementType, lanes));
+
+    //The outer dimensions are scalar loops, the innermost dimension is vectorized
+    std::vector<int> outerDims(dims.begin(), dims.end()-1);
+    std::vector<std::string> forLoopIndexVars;
+    std::vector<std::string> forLoopClose;
+    if(!outerDims.empty()){
+        std::tuple<std::vector<std::string>, std::vector<std::string>, std::vector<std::string>> forLoopStrs =
+                EmitterHelpers::generateVectorMatrixForLoops(outerDims);
+
+        std::vector<std::string> forLoopOpen = std::get<0>(forLoopStrs);
+        forLoopIndexVars = std::get<1>(forLoopStrs);
+        forLoopClose = std::get<2>(forLoopStrs);
+
+        cStatementQueue.insert(cStatementQueue.end(), forLoopOpen.begin(), forLoopOpen.end());
+    }
+
+    std::string vecIndVar = "indDim" + GeneralHelper::to_string(dims.size()-1);
+    std::vector<std::string> indexExprs = forLoopIndexVars;
+    indexExprs.push_back(vecIndVar);
+    long vecIndexPos = indexExprs.size()-1;
+
+    //Generates the sum with operands either loaded as vectors or as scalars (for the remainder)
+    auto generateSum = [&](bool vec) -> std::string {
+        std::string expr = "";
+        for(unsigned long i = 0; i<inputExprs.size(); i++){
+            std::vector<std::string> portIndexExprs;
+            long portVecIndexPos = -1;
+            if(!getInputPort(i)->getDataType().isScalar()){
+                portIndexExprs = indexExprs;
+                portVecIndexPos = vecIndexPos;
+            }
+
+            std::string operand;
+            if(vec){
+                operand = SIMDHelpers::emitLoad(inputExprs[i], SIMDHelpers::getAccessType(inputExprs[i], portIndexExprs.size(), portVecIndexPos),
+                                                portIndexExprs, elementType, lanes);
+            }else{
+                operand = SIMDHelpers::emitElement(inputExprs[i], portIndexExprs);
+            }
+
+            if(i == 0){
+                expr = inputSign[0] ? operand : "(-" + operand + ")";
+            }else{
+                expr += (inputSign[i] ? "+" : "-") + operand;
+            }
+        }
+        return expr;
+    };
+
+    std::string outputElement = vecOutVar.getCVarName(imag) + EmitterHelpers::generateIndexOperation(indexExprs);
+
+    cStatementQueue.push_back(SIMDHelpers::emitVectorLoopOpen(vecIndVar, dims.back(), lanes));
+    cStatementQueue.push_back(SIMDHelpers::emitStore(outputElement, generateSum(true), elementType, lanes));
+    cStatementQueue.push_back("}");
+
+    //Remainder of the innermost dimension
+    if(SIMDHelpers::getRemainderStart(dims.back(), lanes) != dims.back()){
+        cStatementQueue.push_back(SIMDHelpers::emitRemainderLoopOpen(vecIndVar, dims.back(), lanes));
+        cStatementQueue.push_back(outputElement + " = " + generateSum(false) + ";");
+        cStatementQueue.push_back("}");
+    }
+
+    cStatementQueue.insert(cStatementQueue.end(), forLoopClose.begin(), forLoopClose.end());
+
+    //Close the scope of the vector type
+    cStatementQueue.push_back("}");
+
+    return CExpr(vecOutVar.getCVarName(imag), CExpr::ExprType::ARRAY);
+}
@@ -12,6 +12,7 @@
 
 #include "PrimitiveNode.h"
 #include "GraphMLTools/GraphMLDialect.h"
+#include "General/SIMDHelpers.h"
 
 /**
  * \addtogroup PrimitiveNodes Primitives
@@ -29,6 +30,7 @@ class Sum : public PrimitiveNode{
 private:
     std::vector<bool> inputSign; ///<An array of input signs to the sum operation.  True = positive, False = negative.  Or a number indicating the number of + inputs
     int collapseDimension; ///< Specifies the dimension along which summation occurs.  If summing across all dimensions, will be <0.  NOTE: If >=0, the sum expects a single input port
+    SIMDHelpers::SIMDTarget simdTarget; ///<The SIMD target to emit explicit vector code for (not a parameter to save to XML)
 
     //==== Constructors ====
     /**
@@ -61,12 +63,30 @@ private:
      */
     Sum(std::shared_ptr<SubSystem> parent, Sum* orig);
 
+    /**
+     * @brief Get the number of lanes to use when emitting an element-wise sum with explicit vector code
+     *
+     * The innermost dimension of the output is vectorized.  All inputs and the output are required to have the same
+     * type.  For integer types, this is equivalent to summing in the wider accumulator type and truncating the result
+     * to the output type.
+     *
+     * @return the number of lanes or 1 if the sum cannot be emitted with explicit vector code
+     */
+    int getSIMDLanes(std::vector<CExpr> &inputExprs);
+
+    /**
+     * @brief Emits an element-wise sum with explicit vector code
+     */
+    CExpr emitCExprSIMD(std::vector<std::string> &cStatementQueue, std::vector<CExpr> &inputExprs, bool imag, int lanes);
+
 public:
     //====Getters/Setters====
     std::vector<bool> getInputSign() const;
     void setInputSign(const std::vector<bool> &inputSign);
     int getCollapseDimension() const;
     void setCollapseDimension(int collapsDimension);
+    SIMDHelpers::SIMDTarget getSimdTarget() const;
+    void setSimdTarget(SIMDHelpers::SIMDTarget simdTarget);
 
     //====Factories====
     /**
@@ -116,6 +136,9 @@ public:
      *
      * @note Masking can be (is) omitted (in the case of the output having the same type as the first input) if the total number of bits is a standard CPU type.
      *
+     * If a SIMD target is set, element-wise sums where the inputs and output have the same type are emitted with
+     * explicit vector code
+     *
      */
     CExpr emitCExpr(std::vector<std::string> &cStatementQueue, SchedParams::SchedType schedType, int outputPortNum,
                     bool imag = false) override;
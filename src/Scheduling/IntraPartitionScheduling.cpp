@@ -13,8 +13,102 @@
 #include "Passes/ContextPasses.h"
 #include "Passes/DesignPasses.h"
 #include "MultiThread/ThreadCrossingFIFO.h"
+#include "ScheduleGraph.h"
 
 unsigned long IntraPartitionScheduling::scheduleTopologicalStort(Design &design, TopologicalSortParameters params, bool prune, bool rewireContexts, std::string designName, std::string dir, bool printNodeSched, bool schedulePartitions) {
+    //Pruning modifies the graph being scheduled so it is performed on a copy of the design
+    if(!prune){
+        try{
+            std::map<int, unsigned long> peakLiveBytes = scheduleTopologicalSortIndexed(design, params, rewireContexts, printNodeSched, schedulePartitions);
+
+            if(printNodeSched || params.getHeuristic() == TopologicalSortParameters::Heuristic::MIN_LIVE_BYTES) {
+                for (auto it = peakLiveBytes.begin(); it != peakLiveBytes.end(); it++) {
+                    if(schedulePartitions) {
+                        std::cout << "Peak Live Temporary Bytes [Partition: " << it->first << "]: " << it->second << std::endl;
+                    }else{
+                        std::cout << "Peak Live Temporary Bytes: " << it->second << std::endl;
+                    }
+                }
+            }
+
+            return 0;
+        }catch(const std::exception &e){
+            //Re-run the scheduler on a copy of the design which reports the nodes involved and exports the partially
+            //scheduled graph
+            std::cerr << e.what() << std::endl;
+            std::cerr << "Re-running the scheduler on a copy of the design to report the error" << std::endl;
+        }
+    }else if(params.getHeuristic() == TopologicalSortParameters::Heuristic::MIN_LIVE_BYTES){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("The MIN_LIVE_BYTES scheduling heuristic does not support pruning during scheduling"));
+    }
+
+    //The destructive sort does not implement the MIN_LIVE_BYTES heuristic.  When reporting an error, the heuristic does
+    //not matter since the same cycle will be encountered
+    TopologicalSortParameters copyParams = params;
+    if(copyParams.getHeuristic() == TopologicalSortParameters::Heuristic::MIN_LIVE_BYTES){
+        copyParams.setHeuristic(TopologicalSortParameters::Heuristic::BFS);
+    }
+
+    return scheduleTopologicalSortOnCopy(design, copyParams, prune, rewireContexts, designName, dir, printNodeSched, schedulePartitions);
+}
+
+std::map<int, unsigned long> IntraPartitionScheduling::scheduleTopologicalSortIndexed(Design &design, TopologicalSortParameters params, bool rewireContexts, bool printNodeSched, bool schedulePartitions) {
+    //The snapshot performs the same pre-processing (removing the input master, constants, and arcs from state elements
+    //as well as rewiring arcs to contexts) as scheduleTopologicalSortOnCopy without modifying the design
+    ScheduleGraph scheduleGraph(design, rewireContexts);
+    std::map<int, unsigned long> peakLiveBytes;
+
+    if(schedulePartitions) {
+        std::set<int> partitions = design.listPresentPartitions();
+
+        //The in degrees in the snapshot are carried from one partition to the next (as in the destructive sort)
+        for(auto partitionBeingScheduled = partitions.begin(); partitionBeingScheduled != partitions.end(); partitionBeingScheduled++) {
+            std::vector<std::shared_ptr<Node>> topLevelContextNodesInPartition = GraphAlgs::findNodesStopAtContextFamilyContainers(design.getTopLevelNodes(), *partitionBeingScheduled);
+
+            if(*partitionBeingScheduled == IO_PARTITION_NUM) {
+                topLevelContextNodesInPartition.push_back(design.getOutputMaster());
+                topLevelContextNodesInPartition.push_back(design.getVisMaster());
+            }
+
+            std::vector<std::shared_ptr<Node>> schedule = scheduleGraph.topologicalSort(params, topLevelContextNodesInPartition, true, *partitionBeingScheduled);
+            peakLiveBytes[*partitionBeingScheduled] = scheduleGraph.getPeakLiveBytes();
+
+            if (printNodeSched) {
+                std::cout << "Schedule [Partition: " << *partitionBeingScheduled << "]" << std::endl;
+                for (unsigned long i = 0; i < schedule.size(); i++) {
+                    std::cout << i << ": " << schedule[i]->getFullyQualifiedName() << std::endl;
+                }
+                std::cout << std::endl;
+            }
+
+            for (unsigned long i = 0; i < schedule.size(); i++) {
+                schedule[i]->setSchedOrder(i);
+            }
+        }
+    }else{
+        std::vector<std::shared_ptr<Node>> topLevelContextNodes = GraphAlgs::findNodesStopAtContextFamilyContainers(design.getTopLevelNodes());
+        topLevelContextNodes.push_back(design.getOutputMaster());
+
+        std::vector<std::shared_ptr<Node>> schedule = scheduleGraph.topologicalSort(params, topLevelContextNodes, false, -1);
+        peakLiveBytes[-1] = scheduleGraph.getPeakLiveBytes();
+
+        if (printNodeSched) {
+            std::cout << "Schedule" << std::endl;
+            for (unsigned long i = 0; i < schedule.size(); i++) {
+                std::cout << i << ": " << schedule[i]->getFullyQualifiedName() << std::endl;
+            }
+            std::cout << std::endl;
+        }
+
+        for (unsigned long i = 0; i < schedule.size(); i++) {
+            schedule[i]->setSchedOrder(i);
+        }
+    }
+
+    return peakLiveBytes;
+}
+
+unsigned long IntraPartitionScheduling::scheduleTopologicalSortOnCopy(Design &design, TopologicalSortParameters params, bool prune, bool rewireContexts, std::string designName, std::string dir, bool printNodeSched, bool schedulePartitions) {
     //TODO: WARNING: UpsampleClockDomains currently rely on all of their nodes being scheduled together (ie not being split up).
     //This currently is provided by the hierarchical implementation of the scheduler.  However, if this were to be changed
     //later, a method for having vector intermediates would be required.
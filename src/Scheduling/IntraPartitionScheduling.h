@@ -5,6 +5,7 @@
 #ifndef VITIS_INTRAPARTITIONSCHEDULING_H
 #define VITIS_INTRAPARTITIONSCHEDULING_H
 
+#include <map>
 #include "GraphCore/Design.h"
 #include "General/TopologicalSortParameters.h"
 
@@ -24,6 +25,13 @@ namespace IntraPartitionScheduling {
     /**
      * @brief Schedule the nodes using topological sort.
      *
+     * If prune is false, the schedule is found with @ref scheduleTopologicalSortIndexed which does not copy or modify
+     * the design.  Otherwise (or if the indexed scheduler encounters an error, such as a cycle), the destructive
+     * scheduler is run on a copy of the design with @ref scheduleTopologicalSortOnCopy.  Both produce the same schedule.
+     *
+     * The peak bytes of live temporaries in each partition are printed if printNodeSched is true or the MIN_LIVE_BYTES
+     * heuristic is used.  MIN_LIVE_BYTES is only supported when prune is false.
+     *
      * @param params the parameters used by the scheduler (ex. what heuristic to use, random seed (if applicable))
      * @param prune if true, prune the design before scheduling.  Pruned nodes will not be scheduled but will also not be removed from the origional graph.
      * @param rewireContexts if true, arcs between a node outside a context to a node inside a context are rewired to the context itself (for scheduling, the origional is left untouched).  If false, no rewiring operation is made for scheduling
@@ -41,6 +49,35 @@ namespace IntraPartitionScheduling {
      */
     unsigned long scheduleTopologicalStort(Design &design, TopologicalSortParameters params, bool prune, bool rewireContexts, std::string designName, std::string dir, bool printNodeSched, bool schedulePartitions);
 
+    /**
+     * @brief Schedule the nodes using topological sort on a copy of the design.
+     *
+     * The design is copied, pre-processed (pruned, arcs from state elements removed, arcs rewired to contexts), and then
+     * sorted with the destructive topological sort.  The schedule is then back propagated to the original design.
+     *
+     * In the event of an error, the partially scheduled copy is exported to dir.
+     *
+     * See @ref scheduleTopologicalStort for a description of the parameters
+     *
+     * @return the number of nodes pruned (if prune is true)
+     */
+    unsigned long scheduleTopologicalSortOnCopy(Design &design, TopologicalSortParameters params, bool prune, bool rewireContexts, std::string designName, std::string dir, bool printNodeSched, bool schedulePartitions);
+
+    /**
+     * @brief Schedule the nodes using topological sort on an integer indexed snapshot of the design (see ScheduleGraph).
+     *
+     * Produces the same schedule as @ref scheduleTopologicalSortOnCopy (without pruning) but does not copy the design
+     * or disconnect any arcs.  The only modification made to the design is setting the schedule order of the nodes.
+     *
+     * @param params the parameters used by the scheduler (ex. what heuristic to use, random seed (if applicable))
+     * @param rewireContexts if true, arcs between a node outside a context to a node inside a context are treated as arcs to the context itself
+     * @param printNodeSched if true, print the node schedule to the console
+     * @param schedulePartitions if true, each partition in the design is scheduled seperatly
+     *
+     * @return the peak number of bytes of live temporaries in each partition (partition -1 if schedulePartitions is false)
+     */
+    std::map<int, unsigned long> scheduleTopologicalSortIndexed(Design &design, TopologicalSortParameters params, bool rewireContexts, bool printNodeSched, bool schedulePartitions);
+
     /**
      * @brief Topological sort the current graph.
      *
@@ -0,0 +1,659 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "ScheduleGraph.h"
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <map>
+
+#include "GraphCore/Arc.h"
+#include "GraphCore/Port.h"
+#include "GraphCore/OrderConstraintOutputPort.h"
+#include "GraphCore/SubSystem.h"
+#include "GraphCore/ContextFamilyContainer.h"
+#include "GraphCore/ContextContainer.h"
+#include "GraphCore/ContextRoot.h"
+#include "GraphCore/EnabledSubSystem.h"
+#include "GraphCore/DummyReplica.h"
+#include "GraphCore/StateUpdate.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+#include "MasterNodes/MasterUnconnected.h"
+#include "PrimitiveNodes/Mux.h"
+#include "PrimitiveNodes/Constant.h"
+#include "PrimitiveNodes/BlackBox.h"
+#include "MultiRate/DownsampleClockDomain.h"
+#include "Blocking/BlockingDomain.h"
+#include "MultiThread/ThreadCrossingFIFO.h"
+#include "Passes/ContextPasses.h"
+#include "General/GraphAlgs.h"
+#include "General/GeneralHelper.h"
+#include "General/ErrorHelpers.h"
+
+ScheduleGraph::ScheduleGraph(Design &design, bool rewireContexts) : numArcs(0), levelCount(0), liveBytes(0),
+                                                                   peakLiveBytes(0), readySequence(0) {
+    //==== Index Nodes ====
+    std::vector<std::shared_ptr<Node>> designNodes = design.getNodes();
+    for(unsigned long i = 0; i<designNodes.size(); i++){
+        addNode(designNodes[i]);
+    }
+    outputMaster = addNode(design.getOutputMaster());
+    inputMaster = addNode(design.getInputMaster());
+    terminatorMaster = addNode(design.getTerminatorMaster());
+    unconnectedMaster = addNode(design.getUnconnectedMaster());
+    visMaster = addNode(design.getVisMaster());
+
+    //==== Find the arcs used for scheduling ====
+    //The context driver arcs are replaced by the order constraint arcs created during encapsulation
+    std::set<std::shared_ptr<Arc>> contextDriverArcs;
+    if(rewireContexts){
+        std::vector<std::shared_ptr<ContextRoot>> contextRoots = design.findContextRoots();
+        for(unsigned long i = 0; i<contextRoots.size(); i++){
+            std::vector<std::shared_ptr<Arc>> driverArcs = contextRoots[i]->getContextDecisionDriver();
+            contextDriverArcs.insert(driverArcs.begin(), driverArcs.end());
+        }
+    }
+
+    std::vector<std::pair<unsigned long, unsigned long>> schedArcs; //(src, dst)
+    std::vector<std::tuple<OutputPort*, unsigned long, unsigned long, unsigned long>> valueArcs; //(orig src port, src, dst, bytes)
+    std::vector<std::shared_ptr<Arc>> arcs = design.getArcs();
+    for(unsigned long i = 0; i<arcs.size(); i++){
+        std::shared_ptr<Arc> arc = arcs[i];
+        std::shared_ptr<Node> srcNode = arc->getSrcPort()->getParent();
+        std::shared_ptr<Node> dstNode = arc->getDstPort()->getParent();
+
+        //The input master and constants are disconnected
+        if(srcNode == design.getInputMaster() || dstNode == design.getInputMaster()){
+            continue;
+        }
+        if(GeneralHelper::isType<Node, Constant>(srcNode) != nullptr || GeneralHelper::isType<Node, Constant>(dstNode) != nullptr){
+            continue;
+        }
+
+        std::shared_ptr<StateUpdate> dstAsStateUpdate = GeneralHelper::isType<Node, StateUpdate>(dstNode);
+        if(GeneralHelper::isType<Node, BlackBox>(srcNode) != nullptr){
+            //Arcs from registered outputs are removed unless they go to the BlackBox's StateUpdate
+            std::shared_ptr<BlackBox> asBlackBox = std::static_pointer_cast<BlackBox>(srcNode);
+            std::vector<int> registeredPortNumbers = asBlackBox->getRegisteredOutputPorts();
+
+            std::vector<std::shared_ptr<OutputPort>> outputPorts = srcNode->getOutputPorts();
+            bool fromRegisteredPort = std::find(outputPorts.begin(), outputPorts.end(), arc->getSrcPort()) != outputPorts.end() &&
+                                      std::find(registeredPortNumbers.begin(), registeredPortNumbers.end(), arc->getSrcPort()->getPortNum()) != registeredPortNumbers.end();
+
+            if(fromRegisteredPort && (dstAsStateUpdate == nullptr || dstAsStateUpdate->getPrimaryNode() != srcNode)){
+                continue;
+            }
+        }else if(srcNode->hasState() && !srcNode->hasCombinationalPath()){
+            //Output arcs of state elements are removed unless they go to a StateUpdate
+            if(dstAsStateUpdate == nullptr){
+                continue;
+            }else if(GeneralHelper::isType<Node, ThreadCrossingFIFO>(srcNode) != nullptr){
+                //See IntraPartitionScheduling::scheduleTopologicalStort for why these are removed
+                if(srcNode->getPartitionNum() != dstAsStateUpdate->getPartitionNum()){
+                    if(dstAsStateUpdate->getPrimaryNode() == srcNode){
+                        throw std::runtime_error(ErrorHelpers::genErrorStr(
+                                "Arc from ThreadCrossingFIFO to its own state update in another partition",
+                                srcNode));
+                    }
+                    continue;
+                }
+            }
+        }
+
+        if(rewireContexts){
+            if(contextDriverArcs.find(arc) != contextDriverArcs.end()){
+                continue;
+            }
+
+            std::shared_ptr<OutputPort> rewiredSrcPort;
+            std::shared_ptr<InputPort> rewiredDstPort;
+            if(ContextPasses::findContextRewiredPorts(arc, rewiredSrcPort, rewiredDstPort)){
+                srcNode = rewiredSrcPort->getParent();
+                dstNode = rewiredDstPort->getParent();
+            }
+        }
+
+        unsigned long src = addNode(srcNode);
+        unsigned long dst = addNode(dstNode);
+
+        //Arcs to the terminator and unconnected masters create false dependencies
+        if(src == terminatorMaster || dst == terminatorMaster || src == unconnectedMaster || dst == unconnectedMaster){
+            continue;
+        }
+
+        schedArcs.emplace_back(src, dst);
+
+        //Order constraint arcs do not carry data
+        if(GeneralHelper::isType<OutputPort, OrderConstraintOutputPort>(arc->getSrcPort()) == nullptr){
+            valueArcs.emplace_back(arc->getSrcPort().get(), src, dst, getTemporaryBytes(arc->getDataType()));
+        }
+    }
+
+    //Nodes removed from the graph for scheduling
+    for(unsigned long i = 0; i<nodes.size(); i++){
+        removed[i] = GeneralHelper::isType<Node, Constant>(nodes[i]) != nullptr;
+    }
+
+    //==== Build the CSR adjacency ====
+    //Successors are sorted by ID (then pointer) to match the ordering used by GraphAlgs::topologicalSortDestructive
+    std::sort(schedArcs.begin(), schedArcs.end(), [this](const std::pair<unsigned long, unsigned long> &a, const std::pair<unsigned long, unsigned long> &b){
+        if(a.first != b.first){
+            return a.first < b.first;
+        }
+        int aID = nodes[a.second]->getId();
+        int bID = nodes[b.second]->getId();
+        return std::tie(aID, nodes[a.second]) < std::tie(bID, nodes[b.second]);
+    });
+
+    numArcs = schedArcs.size();
+    outNeighborStart.assign(nodes.size()+1, 0);
+    initialInDegree.assign(nodes.size(), 0);
+    for(unsigned long i = 0; i<schedArcs.size(); i++){
+        unsigned long src = schedArcs[i].first;
+        unsigned long dst = schedArcs[i].second;
+        initialInDegree[dst]++;
+
+        if(i > 0 && schedArcs[i-1] == schedArcs[i]){
+            outNeighborArcs.back()++;
+        }else{
+            outNeighbors.push_back(dst);
+            outNeighborArcs.push_back(1);
+            outNeighborStart[src+1]++;
+        }
+    }
+    for(unsigned long i = 0; i<nodes.size(); i++){
+        outNeighborStart[i+1] += outNeighborStart[i];
+    }
+
+    //==== Build the live value structures ====
+    //Values are identified by the port they originate from and the node producing them in the snapshot (arcs from the
+    //same port may be rewired to different ContextFamilyContainers).  Only consumers in the same partition are considered
+    std::map<std::pair<OutputPort*, unsigned long>, unsigned long> valueIndexes;
+    std::vector<std::vector<unsigned long>> consumersOfValues;
+    std::vector<std::vector<unsigned long>> valuesProducedByNodes(nodes.size());
+    std::vector<std::vector<unsigned long>> valuesConsumedByNodes(nodes.size());
+    for(unsigned long i = 0; i<valueArcs.size(); i++){
+        unsigned long src = std::get<1>(valueArcs[i]);
+        unsigned long dst = std::get<2>(valueArcs[i]);
+        if(src == dst || nodes[src]->getPartitionNum() != nodes[dst]->getPartitionNum()){
+            continue;
+        }
+
+        std::pair<OutputPort*, unsigned long> valueKey(std::get<0>(valueArcs[i]), src);
+        auto found = valueIndexes.find(valueKey);
+        unsigned long value;
+        if(found == valueIndexes.end()){
+            value = valueBytes.size();
+            valueIndexes[valueKey] = value;
+            valueBytes.push_back(std::get<3>(valueArcs[i]));
+            consumersOfValues.emplace_back();
+            valuesProducedByNodes[src].push_back(value);
+        }else{
+            value = found->second;
+        }
+
+        std::vector<unsigned long> &consumers = consumersOfValues[value];
+        if(std::find(consumers.begin(), consumers.end(), dst) == consumers.end()){
+            consumers.push_back(dst);
+            valuesConsumedByNodes[dst].push_back(value);
+        }
+    }
+
+    valueConsumerStart.push_back(0);
+    for(unsigned long i = 0; i<consumersOfValues.size(); i++){
+        valueConsumers.insert(valueConsumers.end(), consumersOfValues[i].begin(), consumersOfValues[i].end());
+        valueConsumerStart.push_back(valueConsumers.size());
+    }
+    producedValueStart.push_back(0);
+    consumedValueStart.push_back(0);
+    for(unsigned long i = 0; i<nodes.size(); i++){
+        producedValues.insert(producedValues.end(), valuesProducedByNodes[i].begin(), valuesProducedByNodes[i].end());
+        producedValueStart.push_back(producedValues.size());
+        consumedValues.insert(consumedValues.end(), valuesConsumedByNodes[i].begin(), valuesConsumedByNodes[i].end());
+        consumedValueStart.push_back(consumedValues.size());
+    }
+
+    levelMark.assign(nodes.size(), 0);
+    discoveredMark.assign(nodes.size(), 0);
+    reset();
+}
+
+unsigned long ScheduleGraph::getTemporaryBytes(DataType dataType) {
+    //Fixed point types are stored in the smallest standard CPU integer type which can hold them
+    int bits = dataType.getTotalBits();
+    unsigned long storageBits = bits;
+    if(!dataType.isFloatingPt() && bits > 1 && bits <= 64){
+        storageBits = GeneralHelper::roundUpToCPUBits(bits);
+    }
+
+    unsigned long bytes = (storageBits+7)/8;
+    if(dataType.isComplex()){
+        bytes *= 2;
+    }
+
+    int elements = dataType.numberOfElements();
+    return elements > 0 ? bytes*elements : bytes;
+}
+
+unsigned long ScheduleGraph::addNode(std::shared_ptr<Node> node) {
+    auto found = nodeIndexes.find(node.get());
+    if(found != nodeIndexes.end()){
+        return found->second;
+    }
+
+    unsigned long ind = nodes.size();
+    nodes.push_back(node);
+    nodeIndexes[node.get()] = ind;
+    removed.push_back(false);
+    schedulable.push_back(GeneralHelper::isType<Node, SubSystem>(node) == nullptr || GeneralHelper::isType<Node, ContextFamilyContainer>(node) != nullptr);
+    familyContainer.push_back(GeneralHelper::isType<Node, ContextFamilyContainer>(node) != nullptr);
+
+    return ind;
+}
+
+unsigned long ScheduleGraph::getNodeIndex(std::shared_ptr<Node> node) const {
+    auto found = nodeIndexes.find(node.get());
+    if(found == nodeIndexes.end()){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Node to schedule was not found in the schedule graph", node));
+    }
+
+    return found->second;
+}
+
+std::vector<unsigned long> ScheduleGraph::getSortableNodeIndexes(const std::vector<std::shared_ptr<Node>> &nodesToConvert) const {
+    std::vector<unsigned long> indexes;
+    indexes.reserve(nodesToConvert.size());
+
+    for(unsigned long i = 0; i<nodesToConvert.size(); i++){
+        unsigned long ind = getNodeIndex(nodesToConvert[i]);
+        if(!removed[ind]){
+            indexes.push_back(ind);
+        }
+    }
+
+    return indexes;
+}
+
+void ScheduleGraph::disconnectNode(unsigned long node, std::vector<unsigned long> &connectedOutputNodes) {
+    if(disconnected[node]){
+        return;
+    }
+
+    //All arcs into the node are removed
+    disconnected[node] = true;
+    inDegree[node] = 0;
+
+    //Remove the arcs to successors which have not already been disconnected
+    for(unsigned long i = outNeighborStart[node]; i<outNeighborStart[node+1]; i++){
+        unsigned long dst = outNeighbors[i];
+        if(!disconnected[dst]){
+            inDegree[dst] -= outNeighborArcs[i];
+            connectedOutputNodes.push_back(dst);
+        }
+    }
+}
+
+std::vector<std::shared_ptr<Node>> ScheduleGraph::topologicalSort(TopologicalSortParameters parameters,
+                                                                  std::vector<std::shared_ptr<Node>> nodesToSort,
+                                                                  bool limitRecursionToPartition, int partition) {
+    std::vector<std::shared_ptr<Node>> schedule;
+
+    //The live bytes are reported for each call (ex. for each partition)
+    liveBytes = 0;
+    peakLiveBytes = 0;
+    valueLive.assign(valueBytes.size(), false);
+
+    topologicalSortLevel(parameters, getSortableNodeIndexes(nodesToSort), limitRecursionToPartition, partition, schedule);
+    return schedule;
+}
+
+void ScheduleGraph::topologicalSortLevel(const TopologicalSortParameters &parameters,
+                                         const std::vector<unsigned long> &nodesToSort, bool limitRecursionToPartition,
+                                         int partition, std::vector<std::shared_ptr<Node>> &schedule) {
+    unsigned long levelID = ++levelCount;
+
+    //Mark the nodes at this level.  The previous marks are restored on return in case a node is sorted at multiple levels
+    std::vector<std::tuple<unsigned long, unsigned long, unsigned long>> prevMarks;
+    prevMarks.reserve(nodesToSort.size());
+    for(unsigned long i = 0; i<nodesToSort.size(); i++){
+        prevMarks.emplace_back(nodesToSort[i], levelMark[nodesToSort[i]], discoveredMark[nodesToSort[i]]);
+        levelMark[nodesToSort[i]] = levelID;
+    }
+
+    //Find nodes with 0 in degree at this context level
+    std::deque<unsigned long> nodesWithZeroInDeg;
+    for(unsigned long i = 0; i<nodesToSort.size(); i++){
+        if(schedulable[nodesToSort[i]] && inDegree[nodesToSort[i]] == 0){
+            nodesWithZeroInDeg.push_back(nodesToSort[i]);
+        }
+    }
+
+    //Matches the handling of an output master with no remaining arcs in GraphAlgs::topologicalSortDestructive
+    if(levelMark[outputMaster] == levelID && inDegree[outputMaster] == 0){
+        nodesWithZeroInDeg.push_back(outputMaster);
+    }
+
+    //Discovered nodes are tracked to detect cycles
+    unsigned long numDiscovered = 0;
+    for(unsigned long i = 0; i<nodesWithZeroInDeg.size(); i++){
+        if(discoveredMark[nodesWithZeroInDeg[i]] != levelID){
+            discoveredMark[nodesWithZeroInDeg[i]] = levelID;
+            numDiscovered++;
+        }
+    }
+
+    //The MIN_LIVE_BYTES heuristic uses an ordered set (updated as values are freed) rather than a queue
+    bool minLiveBytes = parameters.getHeuristic() == TopologicalSortParameters::Heuristic::MIN_LIVE_BYTES;
+    std::set<LiveBytesReadyKey> nodesWithZeroInDegByLiveBytes;
+    unsigned long liveBytesDepth = liveBytesReadyQueues.size();
+    if(minLiveBytes){
+        liveBytesReadyQueues.push_back(&nodesWithZeroInDegByLiveBytes);
+        for(unsigned long i = 0; i<nodesWithZeroInDeg.size(); i++){
+            pushLiveBytesReady(nodesWithZeroInDeg[i], liveBytesDepth);
+        }
+        nodesWithZeroInDeg.clear();
+    }
+
+    std::default_random_engine rndGen(parameters.getRandSeed());
+
+    std::vector<unsigned long> nodesWithZeroInDegHolding; //Used by the DFS blocking heuristic
+    int schedInDFSBlock = 0;
+
+    std::vector<unsigned long> candidateNodes;
+
+    while(!nodesWithZeroInDeg.empty() || !nodesWithZeroInDegByLiveBytes.empty()){
+        unsigned long toSched;
+
+        if(minLiveBytes){
+            toSched = std::get<2>(*nodesWithZeroInDegByLiveBytes.begin());
+            nodesWithZeroInDegByLiveBytes.erase(nodesWithZeroInDegByLiveBytes.begin());
+            readyQueueDepth[toSched] = -1;
+        }else{
+            unsigned long ind;
+
+            switch(parameters.getHeuristic()) {
+                case TopologicalSortParameters::Heuristic::BFS:
+                    ind = 0;
+                    break;
+
+                case TopologicalSortParameters::Heuristic::DFS:
+                    ind = nodesWithZeroInDeg.size() - 1;
+                    break;
+
+                case TopologicalSortParameters::Heuristic::DFS_BLOCKED:
+                    ind = nodesWithZeroInDeg.size() - 1;
+                    break;
+
+                case TopologicalSortParameters::Heuristic::RANDOM: {
+                    std::uniform_int_distribution<unsigned long> dist(0, nodesWithZeroInDeg.size() - 1);
+                    ind = dist(rndGen);
+                    break;
+                }
+
+                default:
+                    throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown Scheduling Heuristic"));
+                    break;
+            }
+
+            toSched = nodesWithZeroInDeg[ind];
+            if(ind == 0){
+                nodesWithZeroInDeg.pop_front();
+            }else if(ind == nodesWithZeroInDeg.size() - 1){
+                nodesWithZeroInDeg.pop_back();
+            }else{
+                nodesWithZeroInDeg.erase(nodesWithZeroInDeg.begin()+ind);
+            }
+        }
+
+        candidateNodes.clear();
+        disconnectNode(toSched, candidateNodes);
+
+        if(discoveredMark[toSched] == levelID){
+            discoveredMark[toSched] = 0;
+            numDiscovered--;
+        }
+
+        if(familyContainer[toSched]){
+            std::shared_ptr<ContextFamilyContainer> familyContainerNode = std::static_pointer_cast<ContextFamilyContainer>(nodes[toSched]);
+            schedule.push_back(familyContainerNode);
+
+            //Recursively schedule the subcontexts
+            std::vector<std::shared_ptr<ContextContainer>> subContextContainers = familyContainerNode->getSubContextContainers();
+            for(unsigned long i = 0; i<subContextContainers.size(); i++){
+                std::set<std::shared_ptr<Node>> childrenSetPtrOrdered = subContextContainers[i]->getChildren();
+                std::set<std::shared_ptr<Node>, Node::PtrID_Compare> childrenSet;
+                childrenSet.insert(childrenSetPtrOrdered.begin(), childrenSetPtrOrdered.end()); //Need to order by ID for consistency between runs
+                std::vector<std::shared_ptr<Node>> childrenVector;
+                childrenVector.insert(childrenVector.end(), childrenSet.begin(), childrenSet.end());
+
+                std::vector<std::shared_ptr<Node>> nextLvlNodes;
+                if(limitRecursionToPartition){
+                    nextLvlNodes = GraphAlgs::findNodesStopAtContextFamilyContainers(childrenVector, partition);
+                }else {
+                    nextLvlNodes = GraphAlgs::findNodesStopAtContextFamilyContainers(childrenVector);
+                }
+
+                topologicalSortLevel(parameters, getSortableNodeIndexes(nextLvlNodes), limitRecursionToPartition, partition, schedule);
+            }
+
+            //Schedule the contextRoot if in the correct partition
+            std::shared_ptr<ContextRoot> contextRoot = familyContainerNode->getContextRoot();
+            bool schedContextRoot = true;
+
+            std::shared_ptr<Node> contextRootAsNode = GeneralHelper::isType<ContextRoot, Node>(contextRoot);
+            if(contextRootAsNode) {
+                if(limitRecursionToPartition) {
+                    schedContextRoot = (contextRootAsNode->getPartitionNum() == partition);
+                }
+            }else{
+                throw std::runtime_error(ErrorHelpers::genErrorStr("Unable to cast a ContextRoot to a Node"));
+            }
+
+            if(schedContextRoot) {
+                if (GeneralHelper::isType<ContextRoot, Mux>(contextRoot) != nullptr) {
+                    schedule.push_back(contextRootAsNode);
+                    updateLiveValues(getNodeIndex(contextRootAsNode));
+                } else if (GeneralHelper::isType<ContextRoot, EnabledSubSystem>(contextRoot) != nullptr) {
+                    //Nodes in the enabled subsystem are scheduled as part of the context
+                } else if (GeneralHelper::isType<ContextRoot, DownsampleClockDomain>(contextRoot) != nullptr) {
+                    //The context drivers go directly to the DownsampleClockDomain so it is explicitly scheduled
+                    schedule.push_back(contextRootAsNode);
+                    updateLiveValues(getNodeIndex(contextRootAsNode));
+                } else if (GeneralHelper::isType<ContextRoot, BlockingDomain>(contextRoot) != nullptr) {
+                    //Nodes in the blocking domain are scheduled as part of the context
+                }else {
+                    throw std::runtime_error(ErrorHelpers::genErrorStr(
+                            "When scheduling, a context root was encountered which is not yet implemented"));
+                }
+            }
+
+            //Schedule the Dummy Node if it is the correct partition (and it exists)
+            std::shared_ptr<DummyReplica> dummyNode = familyContainerNode->getDummyNode();
+            if(dummyNode != nullptr && (!limitRecursionToPartition || dummyNode->getPartitionNum() == partition)){
+                schedule.push_back(dummyNode);
+                updateLiveValues(getNodeIndex(dummyNode));
+            }
+
+            //Values consumed by the context are live until the context completes
+            updateLiveValues(toSched);
+        }else{
+            schedule.push_back(nodes[toSched]);
+            updateLiveValues(toSched);
+        }
+
+        //Find discovered nodes from the candidate list (that are in the nodes to be sorted at this level)
+        //Also, find nodes with zero in degree
+        for(unsigned long i = 0; i<candidateNodes.size(); i++){
+            unsigned long candidateNode = candidateNodes[i];
+
+            if(candidateNode != unconnectedMaster && candidateNode != terminatorMaster && candidateNode != visMaster &&
+               candidateNode != inputMaster && levelMark[candidateNode] == levelID){
+                if(discoveredMark[candidateNode] != levelID){
+                    discoveredMark[candidateNode] = levelID;
+                    numDiscovered++;
+                }
+
+                if(inDegree[candidateNode] == 0){
+                    if(parameters.getHeuristic() == TopologicalSortParameters::Heuristic::BFS || parameters.getHeuristic() == TopologicalSortParameters::Heuristic::DFS) {
+                        nodesWithZeroInDeg.push_back(candidateNode);
+                    }else if(parameters.getHeuristic() == TopologicalSortParameters::Heuristic::DFS_BLOCKED){
+                        nodesWithZeroInDegHolding.push_back(candidateNode);
+                    }else if(minLiveBytes){
+                        pushLiveBytesReady(candidateNode, liveBytesDepth);
+                    }else{
+                        throw std::runtime_error(ErrorHelpers::genErrorStr("Unknown Scheduling Heuristic"));
+                    }
+                }
+            }
+        }
+
+        if(parameters.getHeuristic() == TopologicalSortParameters::Heuristic::DFS_BLOCKED){
+            if(nodesWithZeroInDeg.empty() || schedInDFSBlock >= parameters.getRandSeed()){ //RandomSeed is a temporary standin for the dfs block size
+                nodesWithZeroInDeg.insert(nodesWithZeroInDeg.end(), nodesWithZeroInDegHolding.begin(), nodesWithZeroInDegHolding.end());
+                nodesWithZeroInDegHolding.clear();
+                schedInDFSBlock = 0;
+            }else{
+                schedInDFSBlock++;
+            }
+        }
+    }
+
+    //If there are still discovered nodes, there was a cycle.
+    if(numDiscovered != 0){
+        throw std::runtime_error(ErrorHelpers::genErrorStr("Topological Sort: Encountered Cycle, Unable to Sort.  Candidate Nodes: " + GeneralHelper::to_string(numDiscovered)));
+    }
+
+    if(minLiveBytes){
+        liveBytesReadyQueues.pop_back();
+    }
+
+    for(auto it = prevMarks.rbegin(); it != prevMarks.rend(); it++){
+        levelMark[std::get<0>(*it)] = std::get<1>(*it);
+        discoveredMark[std::get<0>(*it)] = std::get<2>(*it);
+    }
+}
+
+void ScheduleGraph::updateLiveValues(unsigned long node) {
+    if(liveValuesUpdated[node]){
+        return;
+    }
+    liveValuesUpdated[node] = true;
+
+    for(unsigned long i = producedValueStart[node]; i<producedValueStart[node+1]; i++){
+        unsigned long value = producedValues[i];
+        if(valueRemainingConsumers[value] > 0 && !valueLive[value]){
+            valueLive[value] = true;
+            liveBytes += valueBytes[value];
+
+            if(valueRemainingConsumers[value] == 1){
+                updateLastConsumerPriority(value);
+            }
+        }
+    }
+
+    //The inputs and outputs of the node are live at the same time
+    peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+
+    for(unsigned long i = consumedValueStart[node]; i<consumedValueStart[node+1]; i++){
+        unsigned long value = consumedValues[i];
+        if(valueRemainingConsumers[value] > 0){
+            valueRemainingConsumers[value]--;
+
+            if(valueLive[value]){
+                if(valueRemainingConsumers[value] == 0){
+                    valueLive[value] = false;
+                    liveBytes -= valueBytes[value];
+                }else if(valueRemainingConsumers[value] == 1){
+                    updateLastConsumerPriority(value);
+                }
+            }
+        }
+    }
+}
+
+long ScheduleGraph::getLiveBytesDelta(unsigned long node) const {
+    long delta = 0;
+
+    for(unsigned long i = producedValueStart[node]; i<producedValueStart[node+1]; i++){
+        unsigned long value = producedValues[i];
+        if(valueRemainingConsumers[value] > 0 && !valueLive[value]){
+            delta += valueBytes[value];
+        }
+    }
+
+    //If this node is the last consumer of a live value, the value is freed
+    for(unsigned long i = consumedValueStart[node]; i<consumedValueStart[node+1]; i++){
+        unsigned long value = consumedValues[i];
+        if(valueLive[value] && valueRemainingConsumers[value] == 1){
+            delta -= valueBytes[value];
+        }
+    }
+
+    return delta;
+}
+
+void ScheduleGraph::pushLiveBytesReady(unsigned long node, unsigned long depth) {
+    LiveBytesReadyKey key(getLiveBytesDelta(node), -(readySequence++), node);
+    liveBytesReadyQueues[depth]->insert(key);
+    readyQueueDepth[node] = depth;
+    readyQueueKey[node] = key;
+}
+
+void ScheduleGraph::updateLiveBytesPriority(unsigned long node) {
+    if(readyQueueDepth[node] < 0){
+        return;
+    }
+
+    std::set<LiveBytesReadyKey> *readyQueue = liveBytesReadyQueues[readyQueueDepth[node]];
+    readyQueue->erase(readyQueueKey[node]);
+    LiveBytesReadyKey key(getLiveBytesDelta(node), std::get<1>(readyQueueKey[node]), node);
+    readyQueue->insert(key);
+    readyQueueKey[node] = key;
+}
+
+void ScheduleGraph::updateLastConsumerPriority(unsigned long value) {
+    for(unsigned long i = valueConsumerStart[value]; i<valueConsumerStart[value+1]; i++){
+        if(!liveValuesUpdated[valueConsumers[i]]){
+            updateLiveBytesPriority(valueConsumers[i]);
+            return;
+        }
+    }
+}
+
+void ScheduleGraph::reset() {
+    inDegree = initialInDegree;
+    disconnected.assign(nodes.size(), false);
+
+    valueRemainingConsumers.resize(valueBytes.size());
+    for(unsigned long i = 0; i<valueBytes.size(); i++){
+        valueRemainingConsumers[i] = valueConsumerStart[i+1] - valueConsumerStart[i];
+    }
+    valueLive.assign(valueBytes.size(), false);
+    liveValuesUpdated.assign(nodes.size(), false);
+    liveBytes = 0;
+    peakLiveBytes = 0;
+
+    liveBytesReadyQueues.clear();
+    readyQueueDepth.assign(nodes.size(), -1);
+    readyQueueKey.assign(nodes.size(), LiveBytesReadyKey(0, 0, 0));
+    readySequence = 0;
+}
+
+bool ScheduleGraph::isRemoved(std::shared_ptr<Node> node) const {
+    return removed[getNodeIndex(node)];
+}
+
+unsigned long ScheduleGraph::getNumNodes() const {
+    return nodes.size();
+}
+
+unsigned long ScheduleGraph::getPeakLiveBytes() const {
+    return peakLiveBytes;
+}
+
+unsigned long ScheduleGraph::getNumArcs() const {
+    return numArcs;
+}
@@ -0,0 +1,215 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_SCHEDULEGRAPH_H
+#define VITIS_SCHEDULEGRAPH_H
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <set>
+#include <tuple>
+
+#include "GraphCore/Design.h"
+#include "GraphCore/Node.h"
+#include "GraphCore/DataType.h"
+#include "General/TopologicalSortParameters.h"
+
+/**
+ * \addtogroup Scheduling Schedulers
+ * @{
+ */
+
+/**
+ * @brief A compact, integer indexed snapshot of the dependency graph used by the topological sort scheduler.
+ *
+ * The snapshot contains the arcs which remain after the same preprocessing that IntraPartitionScheduling::scheduleTopologicalStort
+ * performs on its copy of the design:
+ *   - Arcs to/from the input master and Constant nodes are removed
+ *   - Arcs from registered outputs of BlackBoxes are removed (except to their own StateUpdate)
+ *   - Output arcs of stateful nodes without combinational paths are removed (except to StateUpdates, with the
+ *     ThreadCrossingFIFO exception)
+ *   - Optionally, context driver arcs are removed and other arcs are rewired to ContextFamilyContainers (see
+ *     ContextPasses::rewireArcsToContexts)
+ *   - Arcs to/from the terminator and unconnected masters are removed
+ *
+ * The arcs are stored in a CSR (compressed sparse row) structure where each node has a contiguous list of its
+ * distinct successor nodes (ordered by ID as in GraphAlgs::topologicalSortDestructive) along with the number of arcs
+ * to each.  The in degree of each node is tracked with a counter.
+ *
+ * Scheduling a node "disconnects" it by marking it as scheduled and decrementing the in degree counters of its successors.
+ * The design itself is never copied or modified.  Like the destructive sort, this state persists between calls to
+ * topologicalSort so that partitions can be scheduled one after another.  Call reset to restore the original in degrees.
+ *
+ * topologicalSort produces the same schedule as GraphAlgs::topologicalSortDestructive run on a pre-processed copy of
+ * the design (assuming node IDs are unique).
+ *
+ * The bytes of live temporaries are also tracked during scheduling, based on the DataTypes of the arcs.  This is used by
+ * the MIN_LIVE_BYTES heuristic which, at each step, schedules the ready node that results in the smallest increase (or
+ * largest decrease) in live bytes, breaking ties in favor of the most recently ready node.  The ready nodes are kept in
+ * an ordered set whose keys are updated as values are freed.  Values passed to other partitions (via ThreadCrossingFIFOs)
+ * and outputs of state elements are not considered temporaries.
+ */
+class ScheduleGraph {
+private:
+    std::vector<std::shared_ptr<Node>> nodes; ///<The nodes in the snapshot.  The position in this vector is the node's index
+    std::unordered_map<Node*, unsigned long> nodeIndexes; ///<Map from node to index in the snapshot
+
+    std::vector<bool> removed; ///<True if the node is removed from the graph for scheduling (ex. Constants)
+    std::vector<bool> schedulable; ///<True if the node can be scheduled directly (ie. not a SubSystem or is a ContextFamilyContainer)
+    std::vector<bool> familyContainer; ///<True if the node is a ContextFamilyContainer
+
+    std::vector<unsigned long> outNeighborStart; ///<Index into outNeighbors where the successors of each node start.  Has an additional entry at the end
+    std::vector<unsigned long> outNeighbors; ///<The distinct successors of each node, ordered by ID
+    std::vector<unsigned long> outNeighborArcs; ///<The number of arcs to the corresponding entry in outNeighbors
+    std::vector<unsigned long> initialInDegree; ///<The in degree of each node when the snapshot was taken
+    unsigned long numArcs;
+
+    std::vector<unsigned long> inDegree; ///<The number of arcs into each node from nodes which have not yet been scheduled
+    std::vector<bool> disconnected; ///<True if the node has been scheduled (and its arcs disconnected)
+
+    std::vector<unsigned long> levelMark; ///<The ID of the call to topologicalSortLevel the node is being sorted by
+    std::vector<unsigned long> discoveredMark; ///<The ID of the call to topologicalSortLevel the node has been discovered by
+    unsigned long levelCount; ///<The number of calls to topologicalSortLevel
+
+    //Live temporary tracking.  A value is the output of a (data) port as seen by a node in the snapshot.  It is live from
+    //when its producer is scheduled until all of its consumers in the same partition are scheduled
+    std::vector<unsigned long> valueBytes; ///<The size of each value in bytes
+    std::vector<unsigned long> valueConsumerStart; ///<Index into valueConsumers where the consumers of each value start.  Has an additional entry at the end
+    std::vector<unsigned long> valueConsumers; ///<The distinct consumers of each value
+    std::vector<unsigned long> producedValueStart; ///<Index into producedValues where the values produced by each node start.  Has an additional entry at the end
+    std::vector<unsigned long> producedValues; ///<The values produced by each node
+    std::vector<unsigned long> consumedValueStart; ///<Index into consumedValues where the values consumed by each node start.  Has an additional entry at the end
+    std::vector<unsigned long> consumedValues; ///<The values consumed by each node
+
+    std::vector<unsigned long> valueRemainingConsumers; ///<The number of consumers of each value which have not yet been scheduled
+    std::vector<bool> valueLive; ///<True if the value's producer has been scheduled but not all of its consumers have
+    std::vector<bool> liveValuesUpdated; ///<True if the node's produced and consumed values have been updated (the node has been placed in the schedule)
+    unsigned long liveBytes; ///<The number of bytes of live values
+    unsigned long peakLiveBytes; ///<The peak number of bytes of live values since the start of the last call to topologicalSort
+
+    //Ready queues used by the MIN_LIVE_BYTES heuristic, one per level of recursion.  Ordered by (change in live bytes, -readySequence, node)
+    typedef std::tuple<long, long, unsigned long> LiveBytesReadyKey;
+    std::vector<std::set<LiveBytesReadyKey>*> liveBytesReadyQueues;
+    std::vector<long> readyQueueDepth; ///<The level of liveBytesReadyQueues the node is in (-1 if not in a ready queue)
+    std::vector<LiveBytesReadyKey> readyQueueKey; ///<The key of the node in its ready queue
+    long readySequence; ///<Incremented each time a node is added to a ready queue.  Used to break ties (most recently ready first)
+
+    unsigned long outputMaster;
+    unsigned long inputMaster;
+    unsigned long terminatorMaster;
+    unsigned long unconnectedMaster;
+    unsigned long visMaster;
+
+    /**
+     * @brief Add a node to the snapshot (if not already present)
+     * @return the index of the node
+     */
+    unsigned long addNode(std::shared_ptr<Node> node);
+
+    /**
+     * @brief Get the index of a node in the snapshot
+     */
+    unsigned long getNodeIndex(std::shared_ptr<Node> node) const;
+
+    /**
+     * @brief Convert a list of nodes to indexes, dropping any removed nodes
+     */
+    std::vector<unsigned long> getSortableNodeIndexes(const std::vector<std::shared_ptr<Node>> &nodesToConvert) const;
+
+    /**
+     * @brief Marks a node as scheduled and decrements the in degree of its successors
+     * @param node the node to disconnect
+     * @param connectedOutputNodes the successors of the node which had not yet been disconnected (in ID order) are appended to this vector
+     */
+    void disconnectNode(unsigned long node, std::vector<unsigned long> &connectedOutputNodes);
+
+    /**
+     * @brief Updates the live values when a node is placed in the schedule.  The values produced by the node become live
+     * and values which have no remaining consumers are no longer live.  The peak live bytes includes both the values
+     * consumed and produced by the node.
+     */
+    void updateLiveValues(unsigned long node);
+
+    /**
+     * @brief Get the change in the number of live bytes that would result from scheduling the node next
+     */
+    long getLiveBytesDelta(unsigned long node) const;
+
+    /**
+     * @brief Adds a node to the MIN_LIVE_BYTES ready queue at the given depth
+     */
+    void pushLiveBytesReady(unsigned long node, unsigned long depth);
+
+    /**
+     * @brief Updates the position of a node in its MIN_LIVE_BYTES ready queue after the live values change (if it is in one)
+     */
+    void updateLiveBytesPriority(unsigned long node);
+
+    /**
+     * @brief Update the priority of the last unscheduled consumer of a live value (scheduling it would free the value)
+     */
+    void updateLastConsumerPriority(unsigned long value);
+
+    /**
+     * @brief Topologically sorts a single level of the context hierarchy.  Mirrors GraphAlgs::topologicalSortDestructive
+     * (including recursion into ContextFamilyContainers)
+     */
+    void topologicalSortLevel(const TopologicalSortParameters &parameters, const std::vector<unsigned long> &nodesToSort,
+                              bool limitRecursionToPartition, int partition, std::vector<std::shared_ptr<Node>> &schedule);
+
+public:
+    /**
+     * @brief Take a snapshot of the design for scheduling
+     * @param design the design to snapshot.  It is not modified
+     * @param rewireContexts if true, arcs are rewired to ContextFamilyContainers as in ContextPasses::rewireArcsToContexts
+     */
+    ScheduleGraph(Design &design, bool rewireContexts);
+
+    /**
+     * @brief Topologically sort the given nodes.  Equivalent to GraphAlgs::topologicalSortDestructive
+     *
+     * @param parameters the parameters to use when scheduling (ex. heuristic type and random seed)
+     * @param nodesToSort a vector of nodes to schedule, including ContextFamilyContainers.  Should not contain nodes in
+     * lower levels of the context hierarchy.  Nodes removed from the snapshot (ex. Constants) are ignored
+     * @param limitRecursionToPartition if true, when scheduling ContextFamilyContainers, limit to the given partition
+     * @param partition partition to limit to if limitRecursionToPartition is true
+     * @return A vector of nodes arranged in topological order
+     */
+    std::vector<std::shared_ptr<Node>> topologicalSort(TopologicalSortParameters parameters,
+                                                       std::vector<std::shared_ptr<Node>> nodesToSort,
+                                                       bool limitRecursionToPartition, int partition);
+
+    /**
+     * @brief Restores the in degrees of all nodes so that the graph can be scheduled again
+     */
+    void reset();
+
+    /**
+     * @brief Returns true if the node was removed from the snapshot for scheduling (ex. Constants)
+     */
+    bool isRemoved(std::shared_ptr<Node> node) const;
+
+    unsigned long getNumNodes() const;
+
+    /**
+     * @brief Get the peak number of bytes of live temporaries (values passed between nodes) during the last call to
+     * topologicalSort
+     */
+    unsigned long getPeakLiveBytes() const;
+
+    /**
+     * @brief Get the number of bytes needed to store a value of the given DataType in C
+     */
+    static unsigned long getTemporaryBytes(DataType dataType);
+
+    /**
+     * @brief Get the number of arcs in the snapshot
+     */
+    unsigned long getNumArcs() const;
+};
+
+/*! @} */
+
+#endif //VITIS_SCHEDULEGRAPH_H
@@ -0,0 +1,75 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <set>
+#include "GraphMLTools/GraphMLImporter.h"
+#include "GraphCore/Design.h"
+#include "GraphMLTools/GraphMLDialect.h"
+#include "General/FileIOHelpers.h"
+#include "Estimators/ComputationCostTable.h"
+
+int main(int argc, char* argv[]) {
+
+    if(argc < 3 || argc > 4)
+    {
+        std::cout << "computeCostCalibrationGenerator: Emit a microbenchmark harness which measures the cost of the operations in a design stored in a Vitis GraphML File" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage: " << std::endl;
+        std::cout << "    computeCostCalibrationGenerator inputfile.graphml outputDir <harnessName>" << std::endl;
+        std::cout << std::endl;
+        std::cout << "The harness is built with make -f Makefile_<harnessName>.mk (harnessName defaults to costCalibration)." << std::endl;
+        std::cout << "When run on the target machine, it writes a cost table file (the first argument or costTable.csv)" << std::endl;
+        std::cout << "which can be passed to multiThreadedGenerator using --costTable" << std::endl;
+
+        return 1;
+    }
+
+    std::string inputFilename = argv[1];
+    std::string outputDir = argv[2];
+    std::string harnessName = argc > 3 ? argv[3] : "costCalibration";
+
+    std::cout << "Importing vitis GraphML File: " << inputFilename << std::endl;
+
+    std::unique_ptr<Design> design;
+
+    //Import
+    try{
+        design = GraphMLImporter::importGraphML(inputFilename, GraphMLDialect::VITIS);
+    }catch(std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    //Expand the design to primitives
+    try{
+        design->expandToPrimitive();
+    }catch(std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    //Assign node and arc IDs (needed for expanded nodes)
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    //Find the operations in the design (the master nodes are not included)
+    std::vector<std::shared_ptr<Node>> nodes = design->getNodes();
+    std::set<ComputationCostTable::OperationKey> operations = ComputationCostTable::findOperations(nodes);
+    std::cout << "Found " << operations.size() << " Distinct Operations" << std::endl;
+
+    FileIOHelpers::createDirectoryIfDoesNotExist(outputDir, true);
+
+    try{
+        int calibrated = ComputationCostTable::emitCalibrationHarness(outputDir, harnessName, operations);
+        std::cout << "Calibrating " << calibrated << " Operations" << std::endl;
+    }catch(std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,282 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <sys/wait.h>
+
+#include <boost/filesystem.hpp>
+
+#include "Flows/DesignSpaceExploration.h"
+#include "General/FileIOHelpers.h"
+#include "General/GeneralHelper.h"
+
+/**
+ * @brief Runs a shell command and checks if it exited with one of the expected exit codes
+ */
+bool runCommand(std::string command, std::vector<int> expectedExitCodes){
+    int status = std::system(command.c_str());
+    if(status == -1 || !WIFEXITED(status)){
+        return false;
+    }
+
+    int exitCode = WEXITSTATUS(status);
+    for(int expected : expectedExitCodes){
+        if(exitCode == expected){
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Finds the value of an option in the generator arguments (the last occurrence wins, as in multiThreadedGenerator)
+ */
+std::string findArgValue(const std::vector<std::string> &args, std::string option, std::string defaultValue){
+    std::string value = defaultValue;
+    for(unsigned long i = 0; i+1<args.size(); i++){
+        if(args[i] == option){
+            value = args[i+1];
+        }
+    }
+    return value;
+}
+
+/**
+ * @brief Reads the throughput of the slowest compute partition from the telemetry dump files in a variant directory
+ *
+ * @param telemDumpFilePrefix the prefix of the telemetry dump files (see DesignSpaceExploration::getTelemDumpFilePrefix)
+ */
+bool readVariantThroughput(std::string variantDir, std::string telemDumpFilePrefix, double &throughputMSps){
+    bool found = false;
+    boost::filesystem::directory_iterator end;
+    for(boost::filesystem::directory_iterator it(variantDir); it != end; it++){
+        std::string name = it->path().filename().string();
+        if(!DesignSpaceExploration::isPartitionTelemDumpFile(name, telemDumpFilePrefix)){
+            continue;
+        }
+
+        double partitionRate;
+        if(!DesignSpaceExploration::readTelemetryRate(it->path().string(), partitionRate)){
+            //A partition which never reported telemetry did not make progress
+            return false;
+        }
+        if(!found || partitionRate < throughputMSps){
+            throughputMSps = partitionRate;
+        }
+        found = true;
+    }
+
+    return found;
+}
+
+int main(int argc, char* argv[]) {
+    //Print usage help
+    if(argc < 4)
+    {
+        std::cout << "designSpaceExplorer: Sweep multiThreadedGenerator parameters, benchmark each configuration, and select the Pareto-best configuration" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Usage: " << std::endl;
+        std::cout << "    designSpaceExplorer inputfile.graphml outputDir designName --sweep <NAME=V1,V2,...> [--sweep ...]" << std::endl;
+        std::cout << "                        --randomSearch <BUDGET> --randSeed <SEED> --runSeconds <RUN_SECONDS>" << std::endl;
+        std::cout << "                        --generator <GENERATOR> --makeJobs <MAKE_JOBS>" << std::endl;
+        std::cout << "                        [-- <multiThreadedGenerator options used for every configuration>]" << std::endl;
+        std::cout << std::endl;
+        std::cout << "NAME is the name of a multiThreadedGenerator option without the leading -- (ex. blockSize," << std::endl;
+        std::cout << "subBlockSize, fifoLength, fifoCachedIndexes, fifoDoubleBuffering).  Values of true/false are" << std::endl;
+        std::cout << "treated as flags (ex. --sweep fifoEarlyPublish=false,true)." << std::endl;
+        std::cout << std::endl;
+        std::cout << "Every combination of the swept values is tried unless --randomSearch is given, in which case" << std::endl;
+        std::cout << "BUDGET distinct combinations are selected at random." << std::endl;
+        std::cout << std::endl;
+        std::cout << "Each configuration is generated into outputDir/variantN, built with the emitted constant I/O" << std::endl;
+        std::cout << "benchmark Makefile, and run for RUN_SECONDS (default 10) with telemetry dumps enabled." << std::endl;
+        std::cout << "GENERATOR is the multiThreadedGenerator executable (default: next to designSpaceExplorer)." << std::endl;
+        std::cout << "The results are written to outputDir/dseResults.csv" << std::endl;
+        return 1;
+    }
+
+    std::string inputFilename = argv[1];
+    std::string outputDir = argv[2];
+    std::string designName = argv[3];
+
+    std::vector<DesignSpaceExploration::SweepParameter> sweepParams;
+    unsigned long randomSearchBudget = 0;
+    unsigned long randSeed = 4;
+    unsigned long runSeconds = 10;
+    unsigned long makeJobs = 1;
+    std::string generator = (boost::filesystem::path(argv[0]).parent_path() / "multiThreadedGenerator").string();
+    std::vector<std::string> generatorArgs;
+
+    //Check for command line parameters
+    for(unsigned long i = 4; i<argc; i++){
+        if(strcmp(argv[i], "--") == 0){
+            for(i++; i<argc; i++){
+                generatorArgs.push_back(argv[i]);
+            }
+        }else if(i+1 >= argc){
+            std::cerr << "Missing value for command line option: " << argv[i] << std::endl;
+            exit(1);
+        }else if(strcmp(argv[i], "--sweep") == 0) {
+            i++;
+            try{
+                sweepParams.push_back(DesignSpaceExploration::parseSweepParameter(argv[i]));
+            }catch(std::runtime_error &e){
+                std::cerr << e.what() << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--generator") == 0) {
+            i++;
+            generator = argv[i];
+        }else if(strcmp(argv[i], "--randomSearch") == 0 || strcmp(argv[i], "--randSeed") == 0 ||
+                 strcmp(argv[i], "--runSeconds") == 0 || strcmp(argv[i], "--makeJobs") == 0) {
+            std::string option = argv[i];
+            i++;
+            std::string argStr = argv[i];
+            try {
+                unsigned long parsed = std::stoul(argStr);
+                if(option == "--randomSearch"){
+                    randomSearchBudget = parsed;
+                }else if(option == "--randSeed"){
+                    randSeed = parsed;
+                }else if(option == "--runSeconds"){
+                    runSeconds = parsed;
+                }else{
+                    makeJobs = parsed;
+                }
+            } catch (std::invalid_argument &e) {
+                std::cerr << "Invalid command line option type: " << option << " " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else{
+            std::cerr << "Unknown command line option: " << argv[i] << std::endl;
+            exit(1);
+        }
+    }
+
+    if(sweepParams.empty()){
+        std::cerr << "At least one --sweep parameter is required" << std::endl;
+        return 1;
+    }
+
+    std::vector<DesignSpaceExploration::Configuration> configs;
+    if(randomSearchBudget > 0){
+        configs = DesignSpaceExploration::sampleRandom(sweepParams, randomSearchBudget, randSeed);
+    }else{
+        configs = DesignSpaceExploration::enumerateGrid(sweepParams);
+    }
+
+    std::cout << "Design Space Exploration: " << inputFilename << std::endl;
+    std::cout << "Grid Size: " << DesignSpaceExploration::getGridSize(sweepParams) << ", Configurations: " << configs.size() << std::endl;
+    std::cout << "Generator: " << generator << std::endl;
+    std::cout << "Run Time per Configuration: " << runSeconds << " s" << std::endl;
+
+    FileIOHelpers::createDirectoryIfDoesNotExist(outputDir, true);
+
+    //The telemetry level is only set if not given in the generator options
+    const std::string telemDumpPrefix = "dseTelem_";
+    const std::string telemDumpFilePrefix = DesignSpaceExploration::getTelemDumpFilePrefix(designName, telemDumpPrefix);
+    std::vector<std::string> telemArgs = {"--telemDumpPrefix", telemDumpPrefix};
+    if(findArgValue(generatorArgs, "--telemLevel", "").empty()){
+        telemArgs.push_back("--telemLevel");
+        telemArgs.push_back("rateOnly");
+    }
+
+    //The constant I/O benchmark is used so that the throughput reflects the compute partitions
+    std::string benchmarkName = "benchmark_" + designName + "_io_const";
+    std::string makefileName = "Makefile_" + designName + "_io_const.mk";
+
+    std::vector<DesignSpaceExploration::Result> results;
+    for(unsigned long i = 0; i<configs.size(); i++){
+        DesignSpaceExploration::Result result;
+        result.config = configs[i];
+
+        std::string variantDir = outputDir + "/variant" + GeneralHelper::to_string(i);
+        std::cout << std::endl << "==== Variant " << i << " of " << configs.size() << ": " << DesignSpaceExploration::configurationToString(configs[i]) << " ====" << std::endl;
+
+        //Start from a clean directory so that telemetry from an earlier run is not picked up
+        if(boost::filesystem::exists(variantDir)){
+            FileIOHelpers::deleteDirectoryRecursive(variantDir, false);
+        }
+        FileIOHelpers::createDirectoryIfDoesNotExist(variantDir, false);
+
+        //The swept parameters are appended after the common options so that they take precedence
+        std::vector<std::string> args = generatorArgs;
+        std::vector<std::string> configArgs = DesignSpaceExploration::configurationToArgs(configs[i]);
+        args.insert(args.end(), configArgs.begin(), configArgs.end());
+        args.insert(args.end(), telemArgs.begin(), telemArgs.end());
+
+        std::string generateCmd = DesignSpaceExploration::shellQuote(generator) + " " + DesignSpaceExploration::shellQuote(inputFilename) + " " +
+                                  DesignSpaceExploration::shellQuote(variantDir) + " " + DesignSpaceExploration::shellQuote(designName);
+        for(const std::string &arg : args){
+            generateCmd += " " + DesignSpaceExploration::shellQuote(arg);
+        }
+        generateCmd += " > " + DesignSpaceExploration::shellQuote(variantDir + "/generate.log") + " 2>&1";
+
+        std::string buildCmd = "make -C " + DesignSpaceExploration::shellQuote(variantDir) + " -f " + makefileName +
+                               " -j" + GeneralHelper::to_string(makeJobs) + " > " +
+                               DesignSpaceExploration::shellQuote(variantDir + "/build.log") + " 2>&1";
+
+        //The benchmark runs until stopped.  timeout exits with 124 when it stops the benchmark
+        std::string runCmd = "cd " + DesignSpaceExploration::shellQuote(variantDir) + " && timeout --kill-after=5 " +
+                             GeneralHelper::to_string(runSeconds) + " ./" + benchmarkName + " > run.log 2>&1";
+
+        if(!runCommand(generateCmd, {0})){
+            result.failedStage = "generate";
+        }else if(!runCommand(buildCmd, {0})){
+            result.failedStage = "build";
+        }else if(!runCommand(runCmd, {0, 124})){
+            result.failedStage = "run";
+        }else if(!readVariantThroughput(variantDir, telemDumpFilePrefix, result.throughputMSps)){
+            result.failedStage = "telemetry";
+        }else{
+            unsigned long blockSize = std::stoul(findArgValue(args, "--blockSize", "1"));
+            unsigned long fifoLength = std::stoul(findArgValue(args, "--fifoLength", "16"));
+            result.latencyEstimateUs = DesignSpaceExploration::estimateLatencyUs(blockSize, fifoLength, result.throughputMSps);
+            result.success = true;
+        }
+
+        if(result.success){
+            std::cout << "Throughput: " << result.throughputMSps << " Msps, Latency Estimate: " << result.latencyEstimateUs << " us" << std::endl;
+        }else{
+            std::cerr << "Variant " << i << " failed during " << result.failedStage << " (see logs in " << variantDir << ")" << std::endl;
+        }
+
+        results.push_back(result);
+    }
+
+    std::vector<unsigned long> paretoFront = DesignSpaceExploration::findParetoFront(results);
+    std::string resultsFile = outputDir + "/dseResults.csv";
+    DesignSpaceExploration::writeResultsCSV(resultsFile, sweepParams, results, paretoFront);
+
+    std::cout << std::endl << "==== Results ====" << std::endl;
+    printf("%-8s %-50s %16s %20s %8s\n", "Variant", "Configuration", "Throughput (Msps)", "Latency Est. (us)", "Pareto");
+    std::vector<bool> onFront(results.size(), false);
+    for(unsigned long ind : paretoFront){
+        onFront[ind] = true;
+    }
+    for(unsigned long i = 0; i<results.size(); i++){
+        std::string configStr = DesignSpaceExploration::configurationToString(results[i].config);
+        if(results[i].success){
+            printf("%-8lu %-50s %16.4f %20.4f %8s\n", i, configStr.c_str(), results[i].throughputMSps, results[i].latencyEstimateUs, onFront[i] ? "*" : "");
+        }else{
+            printf("%-8lu %-50s %16s %20s %8s\n", i, configStr.c_str(), (results[i].failedStage + " failed").c_str(), "-", "");
+        }
+    }
+    std::cout << "Results written to: " << resultsFile << std::endl;
+
+    long best = DesignSpaceExploration::selectBest(results, paretoFront);
+    if(best < 0){
+        std::cerr << "No configuration was benchmarked successfully" << std::endl;
+        return 1;
+    }
+
+    std::cout << std::endl << "Best Configuration (Variant " << best << "): " << DesignSpaceExploration::configurationToString(results[best].config) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,180 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include "GraphMLTools/GraphMLImporter.h"
+#include "GraphCore/Design.h"
+#include "GraphMLTools/GraphMLDialect.h"
+
+/**
+ * @brief The result of importing a design in a child process
+ */
+struct ImportResult{
+    bool success;
+    unsigned long nodes;
+    unsigned long arcs;
+    double secondsPerImport;
+    long maxRSSKB;
+};
+
+/**
+ * @brief Imports the design in a forked child process so that the peak RSS of each import method can be measured
+ * independently using the resource usage of the child.
+ *
+ * @param inputFilename the GraphML file to import
+ * @param dialect the dialect of the GraphML file
+ * @param streaming if true, GraphMLImporter::importGraphMLStreaming is used.  Otherwise, GraphMLImporter::importGraphML
+ * @param repeats the number of times the design is imported (the time is averaged)
+ * @param skipImport if true, the child exits without importing.  Used to measure the baseline RSS
+ * @return the result of the import
+ */
+ImportResult runImport(std::string inputFilename, GraphMLDialect dialect, bool streaming, int repeats, bool skipImport){
+    ImportResult result;
+    result.success = false;
+    result.nodes = 0;
+    result.arcs = 0;
+    result.secondsPerImport = 0;
+    result.maxRSSKB = 0;
+
+    int resultPipe[2];
+    if(pipe(resultPipe) != 0){
+        std::cerr << "Unable to create pipe" << std::endl;
+        return result;
+    }
+
+    pid_t pid = fork();
+    if(pid < 0){
+        std::cerr << "Unable to fork" << std::endl;
+        close(resultPipe[0]);
+        close(resultPipe[1]);
+        return result;
+    }
+
+    if(pid == 0){
+        //Child
+        close(resultPipe[0]);
+
+        ImportResult childResult = result;
+        childResult.success = true;
+
+        if(!skipImport) {
+            try {
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                for (int i = 0; i < repeats; i++) {
+                    std::unique_ptr<Design> design;
+                    if (streaming) {
+                        design = GraphMLImporter::importGraphMLStreaming(inputFilename, dialect);
+                    } else {
+                        design = GraphMLImporter::importGraphML(inputFilename, dialect);
+                    }
+                    childResult.nodes = design->getNodes().size();
+                    childResult.arcs = design->getArcs().size();
+                }
+                std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+                childResult.secondsPerImport = std::chrono::duration<double>(stop - start).count() / repeats;
+            } catch (std::exception &e) {
+                std::cerr << e.what() << std::endl;
+                childResult.success = false;
+            }
+        }
+
+        ssize_t written = write(resultPipe[1], &childResult, sizeof(childResult));
+        close(resultPipe[1]);
+        _exit(written == sizeof(childResult) && childResult.success ? 0 : 1);
+    }
+
+    //Parent
+    close(resultPipe[1]);
+    ImportResult childResult;
+    ssize_t bytesRead = read(resultPipe[0], &childResult, sizeof(childResult));
+    close(resultPipe[0]);
+
+    int status;
+    struct rusage usage;
+    if(wait4(pid, &status, 0, &usage) < 0){
+        std::cerr << "Unable to wait for child" << std::endl;
+        return result;
+    }
+
+    if(bytesRead == sizeof(childResult)){
+        result = childResult;
+    }
+    result.success = result.success && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    result.maxRSSKB = usage.ru_maxrss; //Reported in KB on Linux
+
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+
+    if(argc < 2 || argc > 4)
+    {
+        std::cout << "graphMLImportBenchmark: Compare the DOM based and streaming (SAX2) GraphML importers" << std::endl;
+        std::cout << "Usage: " << std::endl;
+        std::cout << "    graphMLImportBenchmark inputfile.graphml [vitis|simulink] [repeats]" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Each importer is run in a separate process.  The wall time per import and the peak resident set" << std::endl;
+        std::cout << "size (RSS) of the process are reported along with the peak RSS of a process which does not" << std::endl;
+        std::cout << "import the design (baseline).  The dialect defaults to vitis and repeats defaults to 1." << std::endl;
+
+        return 1;
+    }
+
+    std::string inputFilename = argv[1];
+
+    GraphMLDialect dialect = GraphMLDialect::VITIS;
+    if(argc >= 3){
+        if(strcmp(argv[2], "vitis") == 0){
+            dialect = GraphMLDialect::VITIS;
+        }else if(strcmp(argv[2], "simulink") == 0){
+            dialect = GraphMLDialect::SIMULINK_EXPORT;
+        }else{
+            std::cerr << "Unknown GraphML dialect: " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+
+    int repeats = 1;
+    if(argc >= 4){
+        repeats = std::stoi(argv[3]);
+        if(repeats < 1){
+            std::cerr << "repeats must be >= 1" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Benchmarking GraphML Import: " << inputFilename << std::endl;
+
+    ImportResult baseline = runImport(inputFilename, dialect, false, repeats, true);
+    ImportResult dom = runImport(inputFilename, dialect, false, repeats, false);
+    ImportResult sax = runImport(inputFilename, dialect, true, repeats, false);
+
+    if(!dom.success || !sax.success){
+        std::cerr << "Import Failed" << std::endl;
+        return 1;
+    }
+
+    printf("%-10s %10s %10s %14s %14s %18s\n", "Importer", "Nodes", "Arcs", "Time (ms)", "Peak RSS (KB)", "RSS - Base (KB)");
+    printf("%-10s %10s %10s %14s %14ld %18s\n", "Baseline", "-", "-", "-", baseline.maxRSSKB, "-");
+    printf("%-10s %10lu %10lu %14.3f %14ld %18ld\n", "DOM", dom.nodes, dom.arcs, dom.secondsPerImport*1000, dom.maxRSSKB, dom.maxRSSKB-baseline.maxRSSKB);
+    printf("%-10s %10lu %10lu %14.3f %14ld %18ld\n", "SAX2", sax.nodes, sax.arcs, sax.secondsPerImport*1000, sax.maxRSSKB, sax.maxRSSKB-baseline.maxRSSKB);
+
+    if(dom.nodes != sax.nodes || dom.arcs != sax.arcs){
+        std::cerr << "Error: The DOM and streaming importers produced designs with different numbers of nodes or arcs" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
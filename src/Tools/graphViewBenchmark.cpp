@@ -0,0 +1,192 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <cstdio>
+
+#include "GraphCore/Design.h"
+#include "GraphCore/Node.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "GraphCore/DesignGraphView.h"
+#include "PrimitiveNodes/Sum.h"
+#include "PrimitiveNodes/Delay.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+
+/**
+ * @brief Creates a synthetic design with the given number of nodes
+ *
+ * The design is a long chain of Sum nodes where each node also has an input from a node a short distance before it in
+ * the chain.  Every feedbackPeriod nodes, a Delay is inserted which feeds back to a node feedbackPeriod/2 nodes earlier,
+ * creating cycles (through state) like those found in IIR filters and control loops.  No feedback is created if
+ * feedbackPeriod is <= 1
+ */
+std::unique_ptr<Design> createSyntheticDesign(unsigned long numNodes, unsigned long feedbackPeriod){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+    DataType dt(false, true, false, 32, 0, {1});
+
+    std::vector<std::shared_ptr<Node>> chain;
+    chain.reserve(numNodes);
+
+    for(unsigned long i = 0; i<numNodes; i++){
+        std::shared_ptr<Node> node;
+        if(i > 0 && feedbackPeriod > 1 && i % feedbackPeriod == 0){
+            std::shared_ptr<Delay> delay = NodeFactory::createNode<Delay>(nullptr);
+            delay->setDelayValue(1);
+            delay->setInitCondition({NumericValue((long int) 0)});
+            node = delay;
+        }else{
+            node = NodeFactory::createNode<Sum>(nullptr);
+        }
+        node->setName("node" + GeneralHelper::to_string(i));
+        node->setId(i);
+        design->addNode(node);
+        design->addTopLevelNode(node);
+
+        if(i == 0){
+            design->addArc(Arc::connectNodes(design->getInputMaster(), 0, node, 0, dt));
+        }else{
+            design->addArc(Arc::connectNodes(chain[i-1], 0, node, 0, dt));
+
+            if((feedbackPeriod <= 1 || i % feedbackPeriod != 0) && i >= 2){
+                unsigned long skipFrom = i - 2 - (i % 7);
+                if(i < 2 + (i % 7)){
+                    skipFrom = 0;
+                }
+                design->addArc(Arc::connectNodes(chain[skipFrom], 0, node, 1, dt));
+            }
+        }
+
+        chain.push_back(node);
+
+        if(i > 0 && feedbackPeriod > 1 && i % feedbackPeriod == 0 && i >= feedbackPeriod/2){
+            design->addArc(Arc::connectNodes(node, 0, chain[i-feedbackPeriod/2], 2, dt));
+        }
+    }
+
+    design->addArc(Arc::connectNodes(chain[numNodes-1], 0, design->getOutputMaster(), 0, dt));
+
+    return design;
+}
+
+/**
+ * @brief Finds the nodes reachable from the root by traversing the design with Node::getConnectedOutputNodes or
+ * Node::getConnectedInputNodes
+ */
+unsigned long countReachableNodeAPI(std::shared_ptr<Node> root, bool forward){
+    std::set<std::shared_ptr<Node>> reached = {root};
+    std::vector<std::shared_ptr<Node>> toVisit = {root};
+
+    while(!toVisit.empty()){
+        std::shared_ptr<Node> node = toVisit.back();
+        toVisit.pop_back();
+
+        std::set<std::shared_ptr<Node>> nextNodes = forward ? node->getConnectedOutputNodes() : node->getConnectedInputNodes();
+        for(const std::shared_ptr<Node> &next : nextNodes){
+            if(reached.insert(next).second){
+                toVisit.push_back(next);
+            }
+        }
+    }
+
+    return reached.size();
+}
+
+/**
+ * @brief Finds the nodes reachable from the root using a DesignGraphView
+ */
+unsigned long countReachableView(const DesignGraphView &view, DesignGraphView::Index root, bool forward){
+    std::vector<bool> reached = view.findReachable({root}, forward);
+
+    unsigned long count = 0;
+    for(unsigned long i = 0; i<reached.size(); i++){
+        if(reached[i]){
+            count++;
+        }
+    }
+
+    return count;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start){
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    if(argc > 3)
+    {
+        std::cout << "graphViewBenchmark: Compare traversing a design using the Node/Port/Arc objects and a DesignGraphView" << std::endl;
+        std::cout << "Usage: " << std::endl;
+        std::cout << "    graphViewBenchmark [numNodes] [feedbackPeriod]" << std::endl;
+        std::cout << std::endl;
+        std::cout << "A synthetic design with numNodes nodes (default 1000000) is created with a feedback loop every" << std::endl;
+        std::cout << "feedbackPeriod nodes (default 64).  The time for a forward and backward reachability traversal" << std::endl;
+        std::cout << "is reported for both methods along with the time to build the DesignGraphView." << std::endl;
+
+        return 1;
+    }
+
+    unsigned long numNodes = 1000000;
+    if(argc >= 2){
+        numNodes = std::stoul(argv[1]);
+        if(numNodes < 2){
+            std::cerr << "numNodes must be >= 2" << std::endl;
+            return 1;
+        }
+    }
+
+    unsigned long feedbackPeriod = 64;
+    if(argc >= 3){
+        feedbackPeriod = std::stoul(argv[2]);
+    }
+
+    std::cout << "Creating Synthetic Design: " << numNodes << " Nodes" << std::endl;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::unique_ptr<Design> design = createSyntheticDesign(numNodes, feedbackPeriod);
+    double createTime = secondsSince(start);
+    std::cout << "Nodes: " << design->getNodes().size() << ", Arcs: " << design->getArcs().size() << ", Created in " << createTime*1000 << " ms" << std::endl;
+
+    std::shared_ptr<Node> forwardRoot = design->getInputMaster();
+    std::shared_ptr<Node> backwardRoot = design->getOutputMaster();
+
+    //==== Node/Port/Arc Objects ====
+    start = std::chrono::steady_clock::now();
+    unsigned long forwardNodeAPI = countReachableNodeAPI(forwardRoot, true);
+    double forwardNodeAPITime = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    unsigned long backwardNodeAPI = countReachableNodeAPI(backwardRoot, false);
+    double backwardNodeAPITime = secondsSince(start);
+
+    //==== DesignGraphView ====
+    start = std::chrono::steady_clock::now();
+    DesignGraphView view(*design);
+    double buildTime = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    unsigned long forwardView = countReachableView(view, view.getNodeIndex(forwardRoot), true);
+    double forwardViewTime = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    unsigned long backwardView = countReachableView(view, view.getNodeIndex(backwardRoot), false);
+    double backwardViewTime = secondsSince(start);
+
+    printf("%-20s %14s %14s %14s %14s\n", "Method", "Build (ms)", "Forward (ms)", "Backward (ms)", "Reached");
+    printf("%-20s %14s %14.3f %14.3f %14lu\n", "Node/Port/Arc", "-", forwardNodeAPITime*1000, backwardNodeAPITime*1000, forwardNodeAPI);
+    printf("%-20s %14.3f %14.3f %14.3f %14lu\n", "DesignGraphView", buildTime*1000, forwardViewTime*1000, backwardViewTime*1000, forwardView);
+    printf("Traversal Speedup (Forward): %.2fx, (Backward): %.2fx\n", forwardNodeAPITime/forwardViewTime, backwardNodeAPITime/backwardViewTime);
+
+    if(forwardNodeAPI != forwardView || backwardNodeAPI != backwardView){
+        std::cerr << "Error: The traversals reached different numbers of nodes" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -16,6 +16,7 @@
 #include "General/FileIOHelpers.h"
 #include "General/TopologicalSortParameters.h"
 #include "Flows/MultiThreadGenerator.h"
+#include "Estimators/ComputationCostTable.h"
 
 int main(int argc, char* argv[]) {
 
@@ -27,28 +28,50 @@ int main(int argc, char* argv[]) {
         std::cout << std::endl;
         std::cout << "Usage: " << std::endl;
         std::cout << "    multiThreadedGenerator inputfile.graphml outputDir designName --partitioner <PARTITIONER> " << std::endl;
+        std::cout << "                           --numPartitions <NUM_PARTITIONS> <--refinePartitions> " << std::endl;
+        std::cout << "                           --costTable <COST_TABLE> " << std::endl;
         std::cout << "                           --fifoType <FIFO_TYPE> --schedHeur <SCHED_HEUR> --randSeed <SCHED_RAND_SEED> " << std::endl;
         std::cout << "                           --blockSize <BLOCK_SIZE> --subBlockSize <SUB_BLOCK_SIZE>" << std::endl;
         std::cout << "                           --fifoLength <FIFO_LENGTH> --ioFifoSize <IO_FIFO_SIZE> " << std::endl;
+        std::cout << "                           --fifoCommitBatch <FIFO_COMMIT_BATCH> " << std::endl;
+        std::cout << "                           --socketBatchBlocks <SOCKET_BATCH_BLOCKS> --socketBufferSize <SOCKET_BUFFER_SIZE> <--socketZeroCopy>" << std::endl;
+        std::cout << "                           <--sharedMemFutex> <--sharedMemHugePages>" << std::endl;
         std::cout << "                           --partitionMap <PARTITION_MAP> <--emitGraphMLSched> <--printSched> " << std::endl;
         std::cout << "                           <--threadDebugPrint> <--printTelem> <--telemDumpPrefix> " << std::endl;
         std::cout << "                           --memAlignment <MEM_ALIGNMENT>" << std::endl;
         std::cout << "                           --fifoCachedIndexes <INDEX_CACHE_BEHAVIOR>" << std::endl;
         std::cout << "                           --fifoDoubleBuffering <FIFO_DOUBLE_BUFFERING>" << std::endl;
+        std::cout << "                           --fifoWaitPolicy <FIFO_WAIT_POLICY> --fifoWaitSpins <FIFO_WAIT_SPINS>" << std::endl;
 		std::cout << "                           <--useSCHED_FIFO> --pipeNameSuffix <PIPE_NAME_SUFFIX>" << std::endl;
+        std::cout << "                           <--streamingImport> --passTimingReport <PASS_TIMING_REPORT> --jobs <JOBS>" << std::endl;
+        std::cout << "                           <--incrementalEmit> <--fifoEarlyPublish>" << std::endl;
+        std::cout << "                           --numaAllocPolicy <NUMA_ALLOC_POLICY> --fifoPlacement <FIFO_PLACEMENT>" << std::endl;
+        std::cout << "                           --simdTarget <SIMD_TARGET> --complexLayout <COMPLEX_LAYOUT>" << std::endl;
         std::cout << "                           --telemLevel <TELEM_LEVEL> <--telemCheckBlockFreq> <--telemReportPeriodSec>" << std::endl;
         std::cout << std::endl;
         std::cout << "Possible PARTITIONER:" << std::endl;
         std::cout << "    manual <DEFAULT> = Partitioning is accomplished manually using VITIS_PARTITION directives" << std::endl;
+        std::cout << "    auto             = Partitioning is accomplished automatically by balancing the estimated compute workload" << std::endl;
+        std::cout << "                       of each partition while limiting communication between partitions.  VITIS_PARTITION" << std::endl;
+        std::cout << "                       directives are ignored" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible NUM_PARTITIONS (only applies to the auto partitioner):" << std::endl;
+        std::cout << "    int numPartitions <DEFAULT = number of compute partitions in PARTITION_MAP>" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible COST_TABLE:" << std::endl;
+        std::cout << "    path to a compute cost table produced by a harness from computeCostCalibrationGenerator <DEFAULT = none>" << std::endl;
         std::cout << std::endl;
         std::cout << "Possible FIFO_TYPE:" << std::endl;
         std::cout << "    lockeless_x86 = Lockless single producer, single consumer, FIFOs suitable for x86 based systems (coping to/from local buffers)" << std::endl;
         std::cout << "    lockeless_inplace_x86 <DEFAULT> = Lockless single producer, single consumer, FIFOs suitable for x86 based systems (using in place operations)" << std::endl;
+        std::cout << "    lockeless_batched_commit_x86 = Lockless single producer, single consumer, FIFOs suitable for x86 based systems (coping to/from local buffers)." << std::endl;
+        std::cout << "                                   FIFO indexes are published once every FIFO_COMMIT_BATCH blocks (or when a thread stalls) to reduce coherence traffic" << std::endl;
         std::cout << std::endl;
         std::cout << "Possible SCHED_HEUR:" << std::endl;
         std::cout << "    bfs <DEFAULT> = Breadth First Search Style" << std::endl;
         std::cout << "    dfs           = Depth First Search Style" << std::endl;
         std::cout << "    random        = Random Style" << std::endl;
+        std::cout << "    min_live_bytes = Schedule the ready node which minimizes the bytes of live temporaries (reports the peak per partition)" << std::endl;
         std::cout << std::endl;
         std::cout << "Possible SCHED_RAND_SEED (only applies to topological and topological_context):" << std::endl;
         std::cout << "    unsigned long seed <DEFAULT = 0>" << std::endl;
@@ -62,9 +85,29 @@ int main(int argc, char* argv[]) {
         std::cout << "Possible FIFO_LENGTH (length of FIFOs in blocks):" << std::endl;
         std::cout << "    unsigned long fifoLength <DEFAULT = 16>" << std::endl;
         std::cout << std::endl;
-        std::cout << "Possible IO_FIFO_SIZE (size of IO FIFO in blocks - shared memory FIFOs only):" << std::endl;
+        std::cout << "Possible FIFO_COMMIT_BATCH (blocks read/written before FIFO indexes are published - lockeless_batched_commit_x86 only):" << std::endl;
+        std::cout << "    unsigned long fifoCommitBatch <DEFAULT = 1>" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible IO_FIFO_SIZE (size of IO FIFO in blocks - shared memory FIFOs and io_uring buffers only):" << std::endl;
         std::cout << "    unsigned long fifoLength <DEFAULT = 16>" << std::endl;
         std::cout << std::endl;
+        std::cout << "Possible SOCKET_BATCH_BLOCKS (socket I/O receive/transmit buffer size in blocks):" << std::endl;
+        std::cout << "    unsigned long socketBatchBlocks <DEFAULT = 0>" << std::endl;
+        std::cout << "    If >0, the socket I/O thread moves many blocks per system call using non-blocking recvmsg/sendmsg." << std::endl;
+        std::cout << "    If 0, each block is moved with a blocking recv/send" << std::endl;
+        std::cout << "    --socketZeroCopy additionally sends with MSG_ZEROCOPY (Linux 4.14+, requires SOCKET_BATCH_BLOCKS > 0)" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible SOCKET_BUFFER_SIZE (SO_RCVBUF/SO_SNDBUF in bytes for the socket I/O thread and client library):" << std::endl;
+        std::cout << "    unsigned long socketBufferSize <DEFAULT = 0 (OS default)>" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Lockless shared memory I/O (io_posix_shared_mem_lockless) options:" << std::endl;
+        std::cout << "    --sharedMemFutex     = Blocking FIFO reads/writes sleep on a futex after spinning (woken only when parked)" << std::endl;
+        std::cout << "    --sharedMemHugePages = FIFOs are created on hugetlbfs (falls back to shm_open with transparent huge pages)" << std::endl;
+        std::cout << std::endl;
+        std::cout << "GraphML import options:" << std::endl;
+        std::cout << "    --streamingImport = Import the design with the streaming (SAX2) importer rather than building a DOM tree" << std::endl;
+        std::cout << "                        Reduces the memory required to import large designs" << std::endl;
+        std::cout << std::endl;
         std::cout << "Possible PARTITION_MAP (mapping of partition numbers to logical CPUs):" << std::endl;
         std::cout << "    A comma separated array without spaces (ex. [0,1,2,3])" << std::endl;
         std::cout << "    The first element of the array corresponds to the I/O thread.  The subsequent elements" << std::endl;
@@ -86,6 +129,51 @@ int main(int argc, char* argv[]) {
         std::cout << "    input            = Double buffering on inputs only" << std::endl;
         std::cout << "    output           = Double buffering on outputs only" << std::endl;
         std::cout << std::endl;
+        std::cout << "Possible FIFO_WAIT_POLICY (what threads do while waiting on FIFOs):" << std::endl;
+        std::cout << "    spin <Default> = The FIFO check is repeated immediately.  Lowest latency but each thread fully occupies a core" << std::endl;
+        std::cout << "    spin_pause     = A pause instruction is executed between FIFO checks" << std::endl;
+        std::cout << "    backoff        = An exponentially increasing number of pause instructions (up to 1024) is executed between FIFO checks" << std::endl;
+        std::cout << "    futex          = Pauses between FIFO checks for FIFO_WAIT_SPINS attempts, then sleeps on a futex until another" << std::endl;
+        std::cout << "                     thread publishes a FIFO update.  Allows idle threads to release their cores" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible NUMA_ALLOC_POLICY (how FIFO arrays are allocated):" << std::endl;
+        std::cout << "    first_touch <Default> = Allocated with the aligned allocator and first touched by the producer's core" << std::endl;
+        std::cout << "    bind                  = Mapped, bound to the NUMA node of the consumer's core (mbind), and pre-faulted at startup" << std::endl;
+        std::cout << "    bind_thp              = Like bind but transparent huge pages are requested (madvise) for arrays >= 2 MiB" << std::endl;
+        std::cout << "    bind_hugetlb          = Like bind but arrays >= 2 MiB are mapped with MAP_HUGETLB (falls back to bind_thp)" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible FIFO_PLACEMENT (where FIFOs without an arc_fifo_placement annotation are allocated):" << std::endl;
+        std::cout << "    default <Default> = producer for the first_touch NUMA_ALLOC_POLICY, consumer otherwise" << std::endl;
+        std::cout << "    producer          = The offsets and array are allocated on the producer's core" << std::endl;
+        std::cout << "    consumer          = The offsets and array are allocated on the consumer's core" << std::endl;
+        std::cout << "    interleaved       = The pages of the array are interleaved across the NUMA nodes of the producer and consumer" << std::endl;
+        std::cout << "    split             = Each offset is allocated on the core which writes it, the array on the consumer's core" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible SIMD_TARGET (explicit vector code for InnerProduct and element-wise Sum/Product/Gain):" << std::endl;
+        std::cout << "    none <Default> = Rely on the C compiler's auto-vectorizer" << std::endl;
+        std::cout << "    sse            = 128 bit vectors" << std::endl;
+        std::cout << "    avx2           = 256 bit vectors" << std::endl;
+        std::cout << "    avx512         = 512 bit vectors" << std::endl;
+        std::cout << "    neon           = 128 bit vectors" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible COMPLEX_LAYOUT (placement of the real/imag planes in FIFO and state structures):" << std::endl;
+        std::cout << "    split_packed <Default> = Real and imag planes are placed back to back with their natural alignment" << std::endl;
+        std::cout << "    planar_aligned         = Each real and imag array plane starts on a MEM_ALIGNMENT boundary" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible FIFO_WAIT_SPINS (failed FIFO checks before a thread sleeps - futex only):" << std::endl;
+        std::cout << "    unsigned long fifoWaitSpins <DEFAULT = 1000>" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible PASS_TIMING_REPORT (file to write the compiler pass timing report to):" << std::endl;
+        std::cout << "    If specified, the wall time, node/arc counts, and peak RSS delta of each compiler pass are reported" << std::endl;
+        std::cout << "    A CSV file is written if the filename ends in .csv, otherwise a JSON file is written" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible JOBS (number of worker threads used to emit partitions concurrently):" << std::endl;
+        std::cout << "    int jobs <DEFAULT = 1>.  If 0, one worker is used per hardware thread.  The emitted files do not depend on the number of jobs" << std::endl;
+        std::cout << std::endl;
+        std::cout << "Possible EMIT_CACHE (directory used to cache the emitted partition files between runs):" << std::endl;
+        std::cout << "    If specified, partition C files whose contents did not change since the last run are not rewritten" << std::endl;
+        std::cout << "    so that their timestamps are preserved and they are not recompiled" << std::endl;
+        std::cout << std::endl;
         std::cout << "Possible TELEM_LEVEL (Telemetry Collection Level):" << std::endl;
         std::cout << "    none <Default>  = No telemetry collection" << std::endl;
         std::cout << "    breakdown       = Collects timing telemetry with a breakdown of the different phases of thread execution" << std::endl;
@@ -107,8 +195,18 @@ int main(int argc, char* argv[]) {
     unsigned long blockSize = 1;
     unsigned long subBlockSize = 0;
     unsigned long fifoLength = 16;
+    unsigned long fifoCommitBatch = 1;
     unsigned long ioFifoSize = 16;
+    unsigned long socketBatchBlocks = 0;
+    unsigned long socketBufferSize = 0;
+    bool socketZeroCopy = false;
+    bool sharedMemFutex = false;
+    bool sharedMemHugePages = false;
+    bool streamingImport = false;
     std::vector<int> partitionMap;
+    int numPartitions = 0;
+    bool refinePartitions = false;
+    std::string costTableFile = "";
     unsigned long memAlignment = 64;
 
     bool emitGraphMLSched = false;
@@ -118,8 +216,18 @@ int main(int argc, char* argv[]) {
     bool useSCHEDFIFO = false;
     std::string telemDumpPrefix = "";
     std::string pipeNameSuffix = "";
+    std::string passTimingReport = "";
+    int jobs = 1;
+    bool incrementalEmit = false;
+    bool fifoEarlyPublish = false;
     PartitionParams::FIFOIndexCachingBehavior fifoIndexCachingBehavior = PartitionParams::FIFOIndexCachingBehavior::NONE;
     MultiThreadEmit::ComputeIODoubleBufferType fifoDoubleBuffer = MultiThreadEmit::ComputeIODoubleBufferType::NONE;
+    PartitionParams::FIFOWaitPolicy fifoWaitPolicy = PartitionParams::FIFOWaitPolicy::SPIN;
+    unsigned long fifoWaitSpins = 1000;
+    PartitionParams::NUMAAllocPolicy numaAllocPolicy = PartitionParams::NUMAAllocPolicy::FIRST_TOUCH;
+    ThreadCrossingFIFOParameters::FIFOPlacement fifoPlacement = ThreadCrossingFIFOParameters::FIFOPlacement::DEFAULT;
+    SIMDHelpers::SIMDTarget simdTarget = SIMDHelpers::SIMDTarget::NONE;
+    EmitterHelpers::ComplexLayout complexLayout = EmitterHelpers::ComplexLayout::SPLIT_PACKED;
 
     EmitterHelpers::TelemetryLevel telemLevel = EmitterHelpers::TelemetryLevel::NONE;
     int telemCheckBlockFreq = 100;
@@ -136,6 +244,25 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Unknown command line option selection: --partitioner " << argv[i] << std::endl;
                 exit(1);
             }
+        }else if(strcmp(argv[i], "--numPartitions") == 0) {
+            i++;
+            std::string argStr = argv[i];
+            try {
+                int parsedNumPartitions = std::stoi(argStr);
+                numPartitions = parsedNumPartitions;
+                if(numPartitions<1){
+                    std::cerr << "Invalid command line option type: --numPartitions must be >= 1.  Currently:  " << argv[i] << std::endl;
+                    exit(1);
+                }
+            } catch (std::invalid_argument e) {
+                std::cerr << "Invalid command line option type: --numPartitions " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--costTable") == 0) {
+            i++;
+            costTableFile = argv[i];
+        }else if(strcmp(argv[i], "--refinePartitions") == 0) {
+            refinePartitions = true;
         }else if(strcmp(argv[i], "--fifoType") == 0) {
             i++; //Get the actual argument
             try {
@@ -206,6 +333,20 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Invalid command line option type: --fifoLength " << argv[i] << std::endl;
                 exit(1);
             }
+        }else if(strcmp(argv[i], "--fifoCommitBatch") == 0) {
+            i++;
+            std::string argStr = argv[i];
+            try {
+                unsigned long parsedFIFOCommitBatch = std::stoul(argStr);
+                fifoCommitBatch = parsedFIFOCommitBatch;
+                if(fifoCommitBatch<1){
+                    std::cerr << "Invalid command line option type: --fifoCommitBatch must be >= 1.  Currently:  " << argv[i] << std::endl;
+                    exit(1);
+                }
+            } catch (std::invalid_argument e) {
+                std::cerr << "Invalid command line option type: --fifoCommitBatch " << argv[i] << std::endl;
+                exit(1);
+            }
         }else if(strcmp(argv[i], "--ioFifoSize") == 0) {
             i++;
             std::string argStr = argv[i];
@@ -220,6 +361,26 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Invalid command line option type: --fifoLength " << argv[i] << std::endl;
                 exit(1);
             }
+        }else if(strcmp(argv[i], "--socketBatchBlocks") == 0) {
+            i++;
+            std::string argStr = argv[i];
+            try {
+                unsigned long parsedSocketBatchBlocks = std::stoul(argStr);
+                socketBatchBlocks = parsedSocketBatchBlocks;
+            } catch (std::invalid_argument e) {
+                std::cerr << "Invalid command line option type: --socketBatchBlocks " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--socketBufferSize") == 0) {
+            i++;
+            std::string argStr = argv[i];
+            try {
+                unsigned long parsedSocketBufferSize = std::stoul(argStr);
+                socketBufferSize = parsedSocketBufferSize;
+            } catch (std::invalid_argument e) {
+                std::cerr << "Invalid command line option type: --socketBufferSize " << argv[i] << std::endl;
+                exit(1);
+            }
         }else if(strcmp(argv[i], "--memAlignment") == 0) {
             i++;
             std::string argStr = argv[i];
@@ -307,6 +468,61 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Unknown command line option selection: --fifoCachedIndexes " << argv[i] << std::endl;
                 exit(1);
             }
+        }else if(strcmp(argv[i], "--fifoWaitPolicy") == 0){
+            i++; //Get the actual argument
+            try{
+                PartitionParams::FIFOWaitPolicy parsedFIFOWaitPolicy = PartitionParams::parseFIFOWaitPolicy(argv[i]);
+                fifoWaitPolicy = parsedFIFOWaitPolicy;
+            }catch(std::runtime_error e){
+                std::cerr << "Unknown command line option selection: --fifoWaitPolicy " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--numaAllocPolicy") == 0){
+            i++; //Get the actual argument
+            try{
+                PartitionParams::NUMAAllocPolicy parsedNUMAAllocPolicy = PartitionParams::parseNUMAAllocPolicy(argv[i]);
+                numaAllocPolicy = parsedNUMAAllocPolicy;
+            }catch(std::runtime_error e){
+                std::cerr << "Unknown command line option selection: --numaAllocPolicy " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--fifoPlacement") == 0){
+            i++; //Get the actual argument
+            try{
+                ThreadCrossingFIFOParameters::FIFOPlacement parsedFIFOPlacement = ThreadCrossingFIFOParameters::parseFIFOPlacement(argv[i]);
+                fifoPlacement = parsedFIFOPlacement;
+            }catch(std::runtime_error e){
+                std::cerr << "Unknown command line option selection: --fifoPlacement " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--simdTarget") == 0){
+            i++; //Get the actual argument
+            try{
+                SIMDHelpers::SIMDTarget parsedSIMDTarget = SIMDHelpers::parseSIMDTargetStr(argv[i]);
+                simdTarget = parsedSIMDTarget;
+            }catch(std::runtime_error e){
+                std::cerr << "Unknown command line option selection: --simdTarget " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--complexLayout") == 0){
+            i++; //Get the actual argument
+            try{
+                EmitterHelpers::ComplexLayout parsedComplexLayout = EmitterHelpers::parseComplexLayoutStr(argv[i]);
+                complexLayout = parsedComplexLayout;
+            }catch(std::runtime_error e){
+                std::cerr << "Unknown command line option selection: --complexLayout " << argv[i] << std::endl;
+                exit(1);
+            }
+        }else if(strcmp(argv[i], "--fifoWaitSpins") == 0) {
+            i++;
+            std::string argStr = argv[i];
+            try {
+                unsigned long parsedFIFOWaitSpins = std::stoul(argStr);
+                fifoWaitSpins = parsedFIFOWaitSpins;
+            } catch (std::invalid_argument e) {
+                std::cerr << "Invalid command line option type: --fifoWaitSpins " << argv[i] << std::endl;
+                exit(1);
+            }
         }else if(strcmp(argv[i], "--fifoDoubleBuffering") == 0){
             i++; //Get the actual argument
             try{
@@ -322,12 +538,40 @@ int main(int argc, char* argv[]) {
         }else if(strcmp(argv[i], "--pipeNameSuffix") == 0) {
             i++;
             pipeNameSuffix = argv[i];
+        }else if(strcmp(argv[i], "--passTimingReport") == 0) {
+            i++;
+            passTimingReport = argv[i];
+        }else if(strcmp(argv[i], "--incrementalEmit") == 0) {
+            incrementalEmit = true;
+        }else if(strcmp(argv[i], "--fifoEarlyPublish") == 0) {
+            fifoEarlyPublish = true;
+        }else if(strcmp(argv[i], "--jobs") == 0) {
+            i++;
+            std::string argStr = argv[i];
+            try {
+                int parsedJobs = std::stoi(argStr);
+                if(parsedJobs < 0){
+                    throw std::invalid_argument("Jobs must be >= 0");
+                }
+                jobs = parsedJobs;
+            } catch (std::invalid_argument e) {
+                std::cerr << "Invalid command line option type: --jobs " << argv[i] << std::endl;
+                exit(1);
+            }
         }else if(strcmp(argv[i],  "--emitGraphMLSched") == 0){
             emitGraphMLSched = true;
         }else if(strcmp(argv[i],  "--printSched") == 0){
             printNodeSched = true;
         }else if(strcmp(argv[i],  "--threadDebugPrint") == 0){
             threadDebugPrint = true;
+        }else if(strcmp(argv[i],  "--socketZeroCopy") == 0){
+            socketZeroCopy = true;
+        }else if(strcmp(argv[i],  "--sharedMemFutex") == 0){
+            sharedMemFutex = true;
+        }else if(strcmp(argv[i],  "--sharedMemHugePages") == 0){
+            sharedMemHugePages = true;
+        }else if(strcmp(argv[i],  "--streamingImport") == 0){
+            streamingImport = true;
         }else if(strcmp(argv[i],  "--printTelem") == 0){
             printTelem = true;
         }else if(strcmp(argv[i],  "--useSCHED_FIFO") == 0){
@@ -357,7 +601,11 @@ int main(int argc, char* argv[]) {
 
     //Import
     try{
-        design = GraphMLImporter::importGraphML(inputFilename, GraphMLDialect::VITIS);
+        if(streamingImport){
+            design = GraphMLImporter::importGraphMLStreaming(inputFilename, GraphMLDialect::VITIS);
+        }else {
+            design = GraphMLImporter::importGraphML(inputFilename, GraphMLDialect::VITIS);
+        }
     }catch(std::exception& e) {
         std::cerr << e.what() << std::endl;
         return 1;
@@ -378,11 +626,33 @@ int main(int argc, char* argv[]) {
     //Validate after expansion
     design->validateNodes();
 
+    ComputationCostTable costTable;
+    if(!costTableFile.empty()){
+        try{
+            costTable = ComputationCostTable::load(costTableFile);
+        }catch(std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
+
     //Print Partitioner and Scheduler
     std::cout << "PARTITIONER: " << PartitionParams::partitionTypeToString(partitioner) << std::endl;
+    std::cout << "REFINE_PARTITIONS: " << (refinePartitions ? "true" : "false") << std::endl;
+    if(!costTableFile.empty()){
+        std::cout << "COST_TABLE: " << costTableFile << std::endl;
+    }
     std::cout << "FIFO_TYPE: " << ThreadCrossingFIFOParameters::threadCrossingFIFOTypeToString(fifoType) << std::endl;
     std::cout << "FIFO_DOUBLE_BUFFERING: " << MultiThreadEmit::computeIODoubleBufferTypeToString(fifoDoubleBuffer) << std::endl;
     std::cout << "FIFO_INDEX_CACHE_BEHAVIOR: " << PartitionParams::fifoIndexCachingBehaviorToString(fifoIndexCachingBehavior) << std::endl;
+    std::cout << "FIFO_WAIT_POLICY: " << PartitionParams::fifoWaitPolicyToString(fifoWaitPolicy) << std::endl;
+    if(fifoWaitPolicy == PartitionParams::FIFOWaitPolicy::FUTEX){
+        std::cout << "FIFO_WAIT_SPINS: " << fifoWaitSpins << std::endl;
+    }
+    std::cout << "NUMA_ALLOC_POLICY: " << PartitionParams::numaAllocPolicyToString(numaAllocPolicy) << std::endl;
+    std::cout << "FIFO_PLACEMENT: " << ThreadCrossingFIFOParameters::fifoPlacementToString(fifoPlacement) << std::endl;
+    std::cout << "SIMD_TARGET: " << SIMDHelpers::simdTargetToString(simdTarget) << std::endl;
+    std::cout << "COMPLEX_LAYOUT: " << EmitterHelpers::complexLayoutToString(complexLayout) << std::endl;
     std::cout << "SCHED: " << SchedParams::schedTypeToString(sched) << std::endl;
     if(sched == SchedParams::SchedType::TOPOLOGICAL_CONTEXT || sched == SchedParams::SchedType::TOPOLOGICAL){
         std::cout << "SCHED_HEUR: " << TopologicalSortParameters::heuristicToString(topoParams.getHeuristic()) << std::endl;
@@ -391,13 +661,55 @@ int main(int argc, char* argv[]) {
     std::cout << "Block Size: " << blockSize << std::endl;
     std::cout << "Sub-Block Size: " << subBlockSize << std::endl;
     std::cout << "FIFO Size: " << fifoLength << std::endl;
+    if(fifoType == ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_BATCHED_COMMIT_X86){
+        std::cout << "FIFO Commit Batch: " << fifoCommitBatch << std::endl;
+    }
+    std::cout << "SOCKET_BATCH_BLOCKS: " << socketBatchBlocks << std::endl;
+    if(socketBufferSize > 0){
+        std::cout << "SOCKET_BUFFER_SIZE: " << socketBufferSize << std::endl;
+    }
+    if(socketZeroCopy){
+        if(socketBatchBlocks < 1){
+            std::cerr << "--socketZeroCopy requires --socketBatchBlocks > 0" << std::endl;
+            return 1;
+        }
+        std::cout << "SOCKET_ZERO_COPY: true" << std::endl;
+    }
+    if(sharedMemFutex){
+        std::cout << "SHARED_MEM_FUTEX: true" << std::endl;
+    }
+    if(sharedMemHugePages){
+        std::cout << "SHARED_MEM_HUGE_PAGES: true" << std::endl;
+    }
+    if(!passTimingReport.empty()){
+        std::cout << "PASS_TIMING_REPORT: " << passTimingReport << std::endl;
+    }
+    std::cout << "JOBS: " << jobs << std::endl;
+    if(incrementalEmit){
+        std::cout << "INCREMENTAL_EMIT: true" << std::endl;
+    }
+    if(fifoEarlyPublish){
+        std::cout << "FIFO_EARLY_PUBLISH: true" << std::endl;
+    }
 
     bool propagatePartitionsFromSubsystems = true;
 
     if(partitioner == PartitionParams::PartitionType::MANUAL){
         propagatePartitionsFromSubsystems = true;
-    }else{
-        //TODO: Other cases?
+    }else if(partitioner == PartitionParams::PartitionType::AUTO){
+        //Partition directives in the design are ignored by the automatic partitioner
+        propagatePartitionsFromSubsystems = false;
+
+        if(numPartitions<1){
+            //Default to the number of compute partitions in the partition map (the first entry is the I/O thread)
+            if(partitionMap.size()>1){
+                numPartitions = partitionMap.size()-1;
+            }else{
+                std::cerr << "The auto partitioner requires --numPartitions or a --partitionMap with at least 1 compute partition" << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "NUM_PARTITIONS: " << numPartitions << std::endl;
     }
 
     FileIOHelpers::createDirectoryIfDoesNotExist(outputDir, true);
@@ -407,14 +719,20 @@ int main(int argc, char* argv[]) {
     //Emit threads, kernel (starter function), benchmarking driver, and makefile
     try{
         MultiThreadGenerator::emitMultiThreadedC(*design, outputDir, designName, designName, sched, topoParams,
-                                                 fifoType, emitGraphMLSched, printNodeSched, fifoLength, blockSize,
-                                                 subBlockSize, propagatePartitionsFromSubsystems,
+                                                 fifoType, emitGraphMLSched, printNodeSched, fifoLength, fifoCommitBatch, blockSize,
+                                                 subBlockSize, partitioner, numPartitions, refinePartitions, costTable,
+                                                 propagatePartitionsFromSubsystems,
                                                  propagateSubBlockingLengthFromSubSystems,
                                                  partitionMap, threadDebugPrint,
-                                                 ioFifoSize, printTelem, telemDumpPrefix, telemLevel,
+                                                 ioFifoSize, socketBatchBlocks, socketBufferSize, socketZeroCopy,
+                                                 sharedMemFutex, sharedMemHugePages,
+                                                 printTelem, telemDumpPrefix, telemLevel,
                                                  telemCheckBlockFreq, telemReportPeriodSec, memAlignment,
-                                                 useSCHEDFIFO, fifoIndexCachingBehavior, fifoDoubleBuffer,
-                                                 pipeNameSuffix);
+                                                 useSCHEDFIFO, fifoIndexCachingBehavior, fifoWaitPolicy, fifoWaitSpins,
+                                                 fifoDoubleBuffer,
+                                                 pipeNameSuffix, passTimingReport, jobs, incrementalEmit,
+                                                 fifoEarlyPublish, numaAllocPolicy, fifoPlacement, simdTarget,
+                                                 complexLayout);
     }catch(std::exception& e) {
         std::cerr << e.what() << std::endl;
         return 1;
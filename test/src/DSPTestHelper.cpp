@@ -73,12 +73,14 @@ void DSPTestHelper::runMultithreadGenForSinglePartitionDefaultSettings(Design &d
     design.setSinglePartition(0);
 
     MultiThreadGenerator::emitMultiThreadedC(design, outputDir, designName, designName, sched, topoParams,
-                                             fifoType, emitGraphMLSched, printNodeSched, fifoLength, blockSize,
-                                             subBlockSize, propagatePartitionsFromSubsystems, propagateSubBlockingLengthFromSubSystems,
+                                             fifoType, emitGraphMLSched, printNodeSched, fifoLength, 1, blockSize,
+                                             subBlockSize, partitioner, 0, false, ComputationCostTable(),
+                                             propagatePartitionsFromSubsystems, propagateSubBlockingLengthFromSubSystems,
                                              partitionMap, threadDebugPrint,
-                                             ioFifoSize, printTelem, telemDumpPrefix, telemLevel,
+                                             ioFifoSize, 0, 0, false, false, false, printTelem, telemDumpPrefix, telemLevel,
                                              telemCheckBlockFreq, telemReportPeriodSec, memAlignment,
-                                             useSCHEDFIFO, fifoIndexCachingBehavior, fifoDoubleBuffer,
+                                             useSCHEDFIFO, fifoIndexCachingBehavior,
+                                             PartitionParams::FIFOWaitPolicy::SPIN, 0, fifoDoubleBuffer,
                                              pipeNameSuffix);
 
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include "NodeEmitTestHelper.h"
+#include "GraphCore/OutputPort.h"
+#include "GraphCore/CExpr.h"
+#include "GraphCore/SchedParams.h"
+#include "General/GeneralHelper.h"
+#include "General/FileIOHelpers.h"
+#include <fstream>
+#include <cstdlib>
+#include <stdexcept>
+
+std::vector<double> NodeEmitTestHelper::emitCompileAndRun(Design &design, std::shared_ptr<Node> node, int outputPortNum,
+                                                          std::string workDir, std::string name){
+    DataType outputType = node->getOutputPort(outputPortNum)->getDataType();
+    int numElements = outputType.numberOfElements();
+
+    std::vector<std::string> cStatementQueue;
+    std::vector<CExpr> outputExprs = {node->emitC(cStatementQueue, SchedParams::SchedType::TOPOLOGICAL_CONTEXT, outputPortNum, false, false, false)};
+    if(outputType.isComplex()){
+        outputExprs.push_back(node->emitC(cStatementQueue, SchedParams::SchedType::TOPOLOGICAL_CONTEXT, outputPortNum, true, false, false));
+    }
+
+    FileIOHelpers::createDirectoryIfDoesNotExist(workDir, true);
+    std::string srcPath = workDir + "/" + name + ".c";
+    std::string exePath = workDir + "/" + name;
+    std::string resultPath = workDir + "/" + name + ".txt";
+
+    std::ofstream srcFile(srcPath);
+    srcFile << "#include <stdio.h>" << std::endl;
+    srcFile << "#include <stdint.h>" << std::endl;
+    srcFile << "#include <stdbool.h>" << std::endl;
+    srcFile << "#include <math.h>" << std::endl;
+    srcFile << "#define VITIS_MEM_ALIGNMENT 64" << std::endl;
+    for(const std::shared_ptr<Node> &designNode : design.getNodes()){
+        if(designNode->hasGlobalDecl()){
+            srcFile << designNode->getGlobalDecl() << std::endl;
+        }
+    }
+    srcFile << "int main(){" << std::endl;
+    for(const std::string &statement : cStatementQueue){
+        srcFile << statement << std::endl;
+    }
+    for(int i = 0; i<numElements; i++){
+        for(CExpr &outputExpr : outputExprs){
+            std::vector<std::string> indexExprs;
+            if(!outputType.isScalar()){
+                indexExprs.push_back(GeneralHelper::to_string(i));
+            }
+            srcFile << "printf(\"%.17g\\n\", (double) (" << outputExpr.getExprIndexed(indexExprs, true) << "));" << std::endl;
+        }
+    }
+    srcFile << "return 0;" << std::endl;
+    srcFile << "}" << std::endl;
+    srcFile.close();
+
+    std::string compileCmd = "cc -std=gnu11 -O2 -o " + exePath + " " + srcPath + " -lm";
+    if(system(compileCmd.c_str()) != 0){
+        throw std::runtime_error("Unable to compile emitted C: " + srcPath);
+    }
+    std::string runCmd = exePath + " > " + resultPath;
+    if(system(runCmd.c_str()) != 0){
+        throw std::runtime_error("Unable to run emitted C: " + exePath);
+    }
+
+    std::vector<double> result;
+    std::ifstream resultFile(resultPath);
+    double val;
+    while(resultFile >> val){
+        result.push_back(val);
+    }
+
+    return result;
+}
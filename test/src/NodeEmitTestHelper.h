@@ -0,0 +1,35 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#ifndef VITIS_NODEEMITTESTHELPER_H
+#define VITIS_NODEEMITTESTHELPER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "GraphCore/Design.h"
+#include "GraphCore/Node.h"
+
+/**
+ * @brief Helpers for checking the numerical result of the C emitted for a node
+ *
+ * The node is emitted into a standalone C program which prints the elements of its output.  The program is compiled
+ * with the system C compiler (cc) and run.  The inputs of the node are expected to be Constants (or other nodes which
+ * do not depend on design I/O).
+ */
+namespace NodeEmitTestHelper {
+    /**
+     * @brief Emits the given output port of a node, compiles the emitted C, and runs it
+     * @param design the design containing the node.  Global declarations (ex. constant arrays) of the nodes in the design are included
+     * @param node the node to emit
+     * @param outputPortNum the output port to emit
+     * @param workDir the directory the C program is written to and compiled in
+     * @param name the name of the C program
+     * @return the elements of the output.  If the output is complex, the real and imaginary components are interleaved
+     */
+    std::vector<double> emitCompileAndRun(Design &design, std::shared_ptr<Node> node, int outputPortNum,
+                                          std::string workDir, std::string name);
+};
+
+#endif //VITIS_NODEEMITTESTHELPER_H
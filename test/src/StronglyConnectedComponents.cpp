@@ -95,4 +95,27 @@ expectedSCCs.insert(scc9);
     SCOPED_TRACE("Check content of strongly connected components");
     ASSERT_EQ(stronglyConnectedComponents, expectedSCCs);
 }
-}
\ No newline at end of file
+}
+TEST(StronglyConnectedComponents, Indexed) {
+//Graph (in CSR form): 0 -> 1 -> 2 -> 0 (cycle), 2 -> 3, 3 -> 4 -> 3 (cycle), 4 -> 5, 5 -> 6 (6 is not searched), 6 -> 5
+std::vector<int> childStart = {0, 1, 2, 4, 5, 7, 8, 9};
+std::vector<int> children = {1, 2, 0, 3, 4, 3, 5, 6, 5};
+std::vector<bool> searchNodes = {true, true, true, true, true, true, false};
+
+int numComponents;
+std::vector<int> components = GraphAlgs::findStronglyConnectedComponentsIndexed(childStart, children, searchNodes, numComponents);
+
+ASSERT_EQ(numComponents, 3);
+ASSERT_EQ(components.size(), 7);
+ASSERT_EQ(components[0], components[1]);
+ASSERT_EQ(components[1], components[2]);
+ASSERT_EQ(components[3], components[4]);
+ASSERT_NE(components[0], components[3]);
+ASSERT_NE(components[3], components[5]);
+ASSERT_NE(components[0], components[5]);
+ASSERT_EQ(components[6], -1);
+
+//Components are numbered in reverse topological order
+ASSERT_LT(components[5], components[3]);
+ASSERT_LT(components[3], components[0]);
+}
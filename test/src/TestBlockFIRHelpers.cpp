@@ -0,0 +1,97 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <vector>
+#include <complex>
+#include <cmath>
+#include "gtest/gtest.h"
+#include "General/BlockFIRHelpers.h"
+
+TEST(BlockFIRHelpers, FFTLength) {
+    ASSERT_EQ(BlockFIRHelpers::getFFTLength(64, 64), 128);
+    ASSERT_EQ(BlockFIRHelpers::getFFTLength(65, 64), 128);
+    ASSERT_EQ(BlockFIRHelpers::getFFTLength(66, 64), 256);
+    ASSERT_EQ(BlockFIRHelpers::getFFTLength(1, 1), 2);
+}
+
+TEST(BlockFIRHelpers, SelectImplementation) {
+    //Long filters with a long sub-block use the FFT if allowed
+    ASSERT_EQ(BlockFIRHelpers::selectImplementation(256, 256, false, true), BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE);
+    ASSERT_EQ(BlockFIRHelpers::selectImplementation(256, 256, false, false), BlockFIRHelpers::BlockFIRImplementation::TILED);
+    //Short filters do not
+    ASSERT_EQ(BlockFIRHelpers::selectImplementation(16, 256, false, true), BlockFIRHelpers::BlockFIRImplementation::TILED);
+    //Sub-blocks shorter than a tile are direct
+    ASSERT_EQ(BlockFIRHelpers::selectImplementation(16, 2, false, true), BlockFIRHelpers::BlockFIRImplementation::DIRECT);
+
+    ASSERT_EQ(BlockFIRHelpers::parseBlockFIRImplementationStr("fft_overlap_save"), BlockFIRHelpers::BlockFIRImplementation::FFT_OVERLAP_SAVE);
+    ASSERT_THROW(BlockFIRHelpers::parseBlockFIRImplementationStr("polyphase"), std::runtime_error);
+}
+
+TEST(BlockFIRHelpers, FFTMatchesDFT) {
+    int n = 16;
+    std::vector<std::complex<double>> vals;
+    for(int i = 0; i<n; i++){
+        vals.emplace_back(std::sin(0.3*i)+0.1*i, std::cos(0.7*i));
+    }
+
+    std::vector<std::complex<double>> transformed = vals;
+    BlockFIRHelpers::fft(transformed, false);
+
+    for(int k = 0; k<n; k++){
+        std::complex<double> expected(0, 0);
+        for(int i = 0; i<n; i++){
+            expected += vals[i]*std::polar(1.0, -2.0*M_PI*i*k/n);
+        }
+        ASSERT_NEAR(transformed[k].real(), expected.real(), 1e-9);
+        ASSERT_NEAR(transformed[k].imag(), expected.imag(), 1e-9);
+    }
+
+    //The inverse transform (without scaling) returns n times the original values
+    BlockFIRHelpers::fft(transformed, true);
+    for(int i = 0; i<n; i++){
+        ASSERT_NEAR(transformed[i].real()/n, vals[i].real(), 1e-9);
+        ASSERT_NEAR(transformed[i].imag()/n, vals[i].imag(), 1e-9);
+    }
+}
+
+TEST(BlockFIRHelpers, OverlapSaveMatchesDirect) {
+    //Mirrors the emitted kernel: the segment (taps-1 history samples followed by the sub-block) is transformed,
+    //multiplied by the coefficient spectrum, and inverse transformed.  The last blockLen outputs are kept.
+    int taps = 7;
+    int blockLen = 5;
+    int segmentLen = taps-1+blockLen;
+
+    std::vector<std::complex<double>> coefsOldestFirst;
+    for(int i = 0; i<taps; i++){
+        coefsOldestFirst.emplace_back(0.25*i-0.5, 0);
+    }
+
+    std::vector<std::complex<double>> segment;
+    for(int i = 0; i<segmentLen; i++){
+        segment.emplace_back(std::cos(0.4*i)+0.2, 0);
+    }
+
+    int fftLen = BlockFIRHelpers::getFFTLength(taps, blockLen);
+    std::vector<std::complex<double>> spectrum = BlockFIRHelpers::getCoefSpectrum(coefsOldestFirst, fftLen);
+
+    std::vector<std::complex<double>> buf(fftLen, std::complex<double>(0, 0));
+    for(int i = 0; i<segmentLen; i++){
+        buf[i] = segment[i];
+    }
+    BlockFIRHelpers::fft(buf, false);
+    for(int i = 0; i<fftLen; i++){
+        buf[i] *= spectrum[i];
+    }
+    BlockFIRHelpers::fft(buf, true);
+
+    for(int i = 0; i<blockLen; i++){
+        //The InnerProduct of the i-th row of the Hankel matrix with the (oldest first) coefficients
+        std::complex<double> expected(0, 0);
+        for(int k = 0; k<taps; k++){
+            expected += coefsOldestFirst[k]*segment[i+k];
+        }
+        ASSERT_NEAR(buf[taps-1+i].real(), expected.real(), 1e-9);
+        ASSERT_NEAR(buf[taps-1+i].imag(), expected.imag(), 1e-9);
+    }
+}
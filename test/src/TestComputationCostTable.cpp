@@ -0,0 +1,222 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <set>
+#include <map>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "General/FileIOHelpers.h"
+#include "Estimators/ComputationCostTable.h"
+#include "Estimators/ComputationEstimator.h"
+#include "PrimitiveNodes/Sum.h"
+#include "PrimitiveNodes/Product.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+
+/**
+ * @brief Creates a design where a Sum adds 2 design inputs and a Product multiplies the result by a third design input.
+ * All values are vectors of 4 single precision floats.  The nodes are placed in partition 0
+ */
+static std::unique_ptr<Design> createSumProductDesign(std::shared_ptr<Sum> &sum, std::shared_ptr<Product> &product){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+    DataType dt(true, true, false, 32, 0, {4});
+
+    sum = NodeFactory::createNode<Sum>(nullptr);
+    sum->setName("sum");
+    sum->setInputSign({true, true});
+    sum->setPartitionNum(0);
+    design->addNode(sum);
+    design->addTopLevelNode(sum);
+
+    product = NodeFactory::createNode<Product>(nullptr);
+    product->setName("product");
+    product->setInputOp({true, true});
+    product->setPartitionNum(0);
+    design->addNode(product);
+    design->addTopLevelNode(product);
+
+    design->addArc(Arc::connectNodes(design->getInputMaster(), 0, sum, 0, dt));
+    design->addArc(Arc::connectNodes(design->getInputMaster(), 1, sum, 1, dt));
+    design->addArc(Arc::connectNodes(sum, 0, product, 0, dt));
+    design->addArc(Arc::connectNodes(design->getInputMaster(), 2, product, 1, dt));
+    design->addArc(Arc::connectNodes(product, 0, design->getOutputMaster(), 0, dt));
+
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    return design;
+}
+
+static void writeFile(std::string filename, std::string contents){
+    std::ofstream file(filename, std::ofstream::out | std::ofstream::trunc);
+    file << contents;
+    file.close();
+}
+
+TEST(ComputationCostTable, CalibrationHarnessRoundTrip) {
+    std::string workDir = "./costTableTest";
+    FileIOHelpers::createDirectoryIfDoesNotExist(workDir, true);
+
+    std::shared_ptr<Sum> sum;
+    std::shared_ptr<Product> product;
+    std::unique_ptr<Design> design = createSumProductDesign(sum, product);
+
+    std::set<ComputationCostTable::OperationKey> operations = ComputationCostTable::findOperations(design->getNodes());
+    ASSERT_EQ(operations.size(), 2);
+
+    //Operations without a known C implementation are omitted from the harness
+    ComputationCostTable::OperationKey unsupported("UnsupportedOperation", EstimatorCommon::OperandType::FLOAT, 32, 1, 0, 4);
+    operations.insert(unsupported);
+
+    int calibrated = ComputationCostTable::emitCalibrationHarness(workDir, "costCalibration", operations);
+    ASSERT_EQ(calibrated, 2);
+
+    std::string buildCmd = "make -s -C " + workDir + " -f Makefile_costCalibration.mk";
+    ASSERT_EQ(system(buildCmd.c_str()), 0) << "Calibration harness failed to compile";
+    std::string runCmd = "cd " + workDir + " && ./costCalibration costTable.csv > /dev/null";
+    ASSERT_EQ(system(runCmd.c_str()), 0) << "Calibration harness failed to run";
+
+    ComputationCostTable costTable = ComputationCostTable::load(workDir + "/costTable.csv");
+    ASSERT_FALSE(costTable.empty());
+    ASSERT_GT(costTable.getFallbackNsPerOperandElement(), 0);
+
+    ComputationCostTable::OperationKey sumKey, productKey;
+    ASSERT_TRUE(ComputationCostTable::getOperationKey(sum, sumKey));
+    ASSERT_TRUE(ComputationCostTable::getOperationKey(product, productKey));
+    ASSERT_GT(costTable.getNsPerSample(sumKey), 0);
+    ASSERT_GT(costTable.getNsPerSample(productKey), 0);
+    ASSERT_EQ(costTable.getNsPerSample(unsupported), -1);
+
+    //The calibrated costs are used for the nodes in the table
+    ASSERT_EQ(ComputationEstimator::estimateNodeCost(sum, costTable), costTable.getNsPerSample(sumKey));
+
+    FileIOHelpers::deleteDirectoryRecursive(workDir, false);
+}
+
+TEST(ComputationCostTable, LoadWellFormed) {
+    std::string filename = "./costTableLoadTest.csv";
+    writeFile(filename, "# Comment\r\n"
+                        "fallbackNsPerOperandElement,0.5\n"
+                        "\n"
+                        "Sum,FLOAT,32,2,0,4,1.25\r\n"
+                        "Product,INT,16,1,1,1,3e-1\n");
+
+    ComputationCostTable costTable = ComputationCostTable::load(filename);
+    ASSERT_EQ(costTable.getFallbackNsPerOperandElement(), 0.5);
+    ASSERT_EQ(costTable.getNsPerSample(ComputationCostTable::OperationKey("Sum", EstimatorCommon::OperandType::FLOAT, 32, 2, 0, 4)), 1.25);
+    ASSERT_EQ(costTable.getNsPerSample(ComputationCostTable::OperationKey("Product", EstimatorCommon::OperandType::INT, 16, 1, 1, 1)), 0.3);
+
+    //Missing rows are reported as not being in the table
+    ASSERT_EQ(costTable.getNsPerSample(ComputationCostTable::OperationKey("Sum", EstimatorCommon::OperandType::FLOAT, 32, 2, 0, 8)), -1);
+
+    remove(filename.c_str());
+}
+
+TEST(ComputationCostTable, LoadMissingRows) {
+    std::string filename = "./costTableLoadTest.csv";
+
+    //A table with no rows is empty
+    writeFile(filename, "# Comment\n\n");
+    ComputationCostTable emptyTable = ComputationCostTable::load(filename);
+    ASSERT_TRUE(emptyTable.empty());
+    ASSERT_LT(emptyTable.getFallbackNsPerOperandElement(), 0);
+
+    //A table without the fallback row has no fallback cost
+    writeFile(filename, "Sum,FLOAT,32,2,0,4,1.25\n");
+    ComputationCostTable noFallbackTable = ComputationCostTable::load(filename);
+    ASSERT_FALSE(noFallbackTable.empty());
+    ASSERT_LT(noFallbackTable.getFallbackNsPerOperandElement(), 0);
+
+    //A table with only the fallback row is not empty
+    writeFile(filename, "fallbackNsPerOperandElement,0.5\n");
+    ComputationCostTable fallbackOnlyTable = ComputationCostTable::load(filename);
+    ASSERT_FALSE(fallbackOnlyTable.empty());
+    ASSERT_EQ(fallbackOnlyTable.getFallbackNsPerOperandElement(), 0.5);
+
+    remove(filename.c_str());
+
+    //A missing file is an error
+    ASSERT_THROW(ComputationCostTable::load("./costTableDoesNotExist.csv"), std::runtime_error);
+}
+
+TEST(ComputationCostTable, LoadMalformed) {
+    std::string filename = "./costTableLoadTest.csv";
+
+    std::vector<std::string> malformedRows = {
+            "Sum,FLOAT,32,2,0,4", //Missing cost
+            "Sum,FLOAT,32,2,0,4,1.25,7", //Extra field
+            "Sum,DOUBLE,32,2,0,4,1.25", //Unknown operand type
+            "Sum,FLOAT,thirtyTwo,2,0,4,1.25", //Non-numeric field
+            "Sum,FLOAT,32,2,0,4,1.25ns", //Trailing characters
+            "Sum,FLOAT,32.5,2,0,4,1.25", //Non-integer width
+            "Sum,FLOAT,99999999999,2,0,4,1.25", //Out of range
+            "fallbackNsPerOperandElement", //Missing fallback cost
+            "fallbackNsPerOperandElement,", //Empty fallback cost
+            "fallbackNsPerOperandElement,abc" //Non-numeric fallback cost
+    };
+
+    for(const std::string &row : malformedRows){
+        writeFile(filename, "fallbackNsPerOperandElement,0.5\n" + row + "\n");
+        ASSERT_THROW(ComputationCostTable::load(filename), std::runtime_error) << row;
+    }
+
+    remove(filename.c_str());
+}
+
+TEST(ComputationCostTable, PartitionComputeTimeUnits) {
+    std::shared_ptr<Sum> sum;
+    std::shared_ptr<Product> product;
+    std::unique_ptr<Design> design = createSumProductDesign(sum, product);
+    std::map<int, std::vector<std::shared_ptr<Node>>> partitions = {{0, {sum, product}}};
+
+    ComputationCostTable::OperationKey sumKey;
+    ASSERT_TRUE(ComputationCostTable::getOperationKey(sum, sumKey));
+
+    //Product is not in the table and there is no fallback so its cost cannot be given in ns
+    ComputationCostTable noFallbackTable;
+    noFallbackTable.setNsPerSample(sumKey, 2);
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    ComputationEstimator::printEstimatedPartitionComputeTime(partitions, noFallbackTable);
+    fflush(stdout);
+    std::string warnings = testing::internal::GetCapturedStderr();
+    std::string report = testing::internal::GetCapturedStdout();
+    ASSERT_EQ(report.find("ns/"), std::string::npos) << report;
+    ASSERT_NE(report.find("Operand Elements"), std::string::npos) << report;
+    ASSERT_NE(warnings.find("Product"), std::string::npos) << warnings;
+    //Both nodes are costed in operand elements (2 operands * 4 elements each)
+    ASSERT_NE(report.find("16.000"), std::string::npos) << report;
+
+    //With a fallback cost, all nodes are costed in ns
+    ComputationCostTable fallbackTable = noFallbackTable;
+    fallbackTable.setFallbackNsPerOperandElement(0.5);
+    testing::internal::CaptureStdout();
+    ComputationEstimator::printEstimatedPartitionComputeTime(partitions, fallbackTable);
+    fflush(stdout);
+    report = testing::internal::GetCapturedStdout();
+    ASSERT_NE(report.find("ns/"), std::string::npos) << report;
+    //Sum from the table (2 ns) + Product from the fallback (2 operands * 4 elements * 0.5 ns)
+    ASSERT_NE(report.find("6.000"), std::string::npos) << report;
+
+    //All nodes in the table
+    ComputationCostTable::OperationKey productKey;
+    ASSERT_TRUE(ComputationCostTable::getOperationKey(product, productKey));
+    ComputationCostTable fullTable = noFallbackTable;
+    fullTable.setNsPerSample(productKey, 3);
+    testing::internal::CaptureStdout();
+    ComputationEstimator::printEstimatedPartitionComputeTime(partitions, fullTable);
+    fflush(stdout);
+    report = testing::internal::GetCapturedStdout();
+    ASSERT_NE(report.find("ns/"), std::string::npos) << report;
+    ASSERT_NE(report.find("5.000"), std::string::npos) << report;
+}
@@ -0,0 +1,191 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <memory>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "GraphMLTools/GraphMLImporter.h"
+#include "GraphMLTools/GraphMLDialect.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Node.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/Port.h"
+#include "GraphCore/DesignGraphView.h"
+#include "GraphCore/NodeFactory.h"
+#include "General/GraphAlgs.h"
+#include "General/GeneralHelper.h"
+#include "PrimitiveNodes/Sum.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+
+/**
+ * @brief Finds the strongly connected components of the design (excluding the master nodes) using the DesignGraphView
+ */
+static std::set<std::set<std::shared_ptr<Node>>> findSCCsWithView(Design &design){
+    DesignGraphView view(design);
+    std::vector<bool> searchNodes(view.getNumNodes(), true);
+    std::set<std::shared_ptr<Node>> masterNodes = design.getMasterNodes();
+    for(const std::shared_ptr<Node> &masterNode : masterNodes){
+        searchNodes[view.getNodeIndex(masterNode)] = false;
+    }
+
+    DesignGraphView::StronglyConnectedComponents sccs = view.findStronglyConnectedComponents(searchNodes);
+
+    std::set<std::set<std::shared_ptr<Node>>> components;
+    for(DesignGraphView::Index component = 0; component<sccs.getNumComponents(); component++){
+        std::set<std::shared_ptr<Node>> componentNodes;
+        for(const DesignGraphView::Index *node = sccs.componentBegin(component); node != sccs.componentEnd(component); node++){
+            EXPECT_EQ(sccs.nodeComponents[*node], component);
+            componentNodes.insert(view.getNode(*node));
+        }
+        components.insert(componentNodes);
+    }
+
+    return components;
+}
+
+/**
+ * @brief Creates a design which is a chain of Sum nodes where every feedbackPeriod nodes, a node feeds back to the node
+ * feedbackPeriod/2 nodes before it.  This creates numNodes/feedbackPeriod cycles (strongly connected components with
+ * feedbackPeriod/2+1 nodes)
+ */
+static std::unique_ptr<Design> createCyclicDesign(unsigned long numNodes, unsigned long feedbackPeriod){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+    DataType dt(false, true, false, 32, 0, {1});
+
+    std::vector<std::shared_ptr<Node>> chain;
+    for(unsigned long i = 0; i<numNodes; i++){
+        std::shared_ptr<Sum> node = NodeFactory::createNode<Sum>(nullptr);
+        node->setName("node" + GeneralHelper::to_string(i));
+        node->setId(i);
+        design->addNode(node);
+        design->addTopLevelNode(node);
+
+        if(i == 0){
+            design->addArc(Arc::connectNodes(design->getInputMaster(), 0, node, 0, dt));
+        }else{
+            design->addArc(Arc::connectNodes(chain[i-1], 0, node, 0, dt));
+        }
+        chain.push_back(node);
+
+        if(i > 0 && i % feedbackPeriod == 0){
+            design->addArc(Arc::connectNodes(node, 0, chain[i-feedbackPeriod/2], 1, dt));
+        }
+    }
+    design->addArc(Arc::connectNodes(chain[numNodes-1], 0, design->getOutputMaster(), 0, dt));
+
+    return design;
+}
+
+TEST(DesignGraphView, AGCMatchesDesign) {
+    std::unique_ptr<Design> design = GraphMLImporter::importGraphML("./stimulus/simulink/dsp/agc.graphml", GraphMLDialect::SIMULINK_EXPORT);
+    design->expandToPrimitive();
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    DesignGraphView view(*design);
+
+    //The nodes plus the 5 master nodes
+    ASSERT_EQ(view.getNumNodes(), design->getNodes().size() + 5);
+    ASSERT_EQ(view.getNumArcs(), design->getArcs().size());
+
+    for(DesignGraphView::Index arc = 0; arc<view.getNumArcs(); arc++){
+        std::shared_ptr<Arc> origArc = view.getArc(arc);
+        ASSERT_EQ(view.getNode(view.getArcSrc(arc)), origArc->getSrcPort()->getParent());
+        ASSERT_EQ(view.getNode(view.getArcDst(arc)), origArc->getDstPort()->getParent());
+        ASSERT_EQ(view.getArcSrcPortNum(arc), origArc->getSrcPort()->getPortNum());
+        ASSERT_EQ(view.getArcDstPortNum(arc), origArc->getDstPort()->getPortNum());
+    }
+
+    for(DesignGraphView::Index node = 0; node<view.getNumNodes(); node++){
+        std::shared_ptr<Node> origNode = view.getNode(node);
+        ASSERT_EQ(view.getNodeIndex(origNode), node);
+        ASSERT_EQ(view.getNodeId(node), origNode->getId());
+
+        //Every arc in the CSR lists should be connected to the node
+        std::set<std::shared_ptr<Arc>> outArcs;
+        for(const DesignGraphView::Index *arc = view.outArcsBegin(node); arc != view.outArcsEnd(node); arc++){
+            ASSERT_EQ(view.getArcSrc(*arc), node);
+            outArcs.insert(view.getArc(*arc));
+        }
+        ASSERT_EQ(outArcs, origNode->getOutputArcs());
+
+        std::set<std::shared_ptr<Arc>> inArcs;
+        for(const DesignGraphView::Index *arc = view.inArcsBegin(node); arc != view.inArcsEnd(node); arc++){
+            ASSERT_EQ(view.getArcDst(*arc), node);
+            inArcs.insert(view.getArc(*arc));
+        }
+        ASSERT_EQ(inArcs, origNode->getInputArcs());
+
+        if(origNode->getParent() == nullptr){
+            ASSERT_EQ(view.getNodeParent(node), DesignGraphView::NO_INDEX);
+        }else{
+            ASSERT_EQ(view.getNode(view.getNodeParent(node)), origNode->getParent());
+        }
+    }
+
+    //The nodes reachable from the input master should match a traversal of the design
+    std::set<std::shared_ptr<Node>> reachedNodes = {design->getInputMaster()};
+    std::vector<std::shared_ptr<Node>> toVisit = {design->getInputMaster()};
+    while(!toVisit.empty()){
+        std::shared_ptr<Node> node = toVisit.back();
+        toVisit.pop_back();
+
+        std::set<std::shared_ptr<Arc>> outArcs = node->getOutputArcs();
+        for(const std::shared_ptr<Arc> &arc : outArcs){
+            std::shared_ptr<Node> dst = arc->getDstPort()->getParent();
+            if(reachedNodes.insert(dst).second){
+                toVisit.push_back(dst);
+            }
+        }
+    }
+
+    std::vector<bool> reached = view.findReachable({view.getNodeIndex(design->getInputMaster())}, true);
+    std::set<std::shared_ptr<Node>> reachedNodesView;
+    for(DesignGraphView::Index node = 0; node<view.getNumNodes(); node++){
+        if(reached[node]){
+            reachedNodesView.insert(view.getNode(node));
+        }
+    }
+    ASSERT_EQ(reachedNodes, reachedNodesView);
+}
+
+TEST(DesignGraphView, SCCMatchesGraphAlgs) {
+    std::unique_ptr<Design> design = GraphMLImporter::importGraphML("./stimulus/simulink/stronglyConnectedComponents/simpleConnectedComponentTest.graphml", GraphMLDialect::SIMULINK_EXPORT);
+    design->expandToPrimitive();
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    std::set<std::shared_ptr<Node>> masterNodes = design->getMasterNodes();
+    std::set<std::set<std::shared_ptr<Node>>> expectedSCCs = GraphAlgs::findStronglyConnectedComponents(design->getNodes(), masterNodes);
+
+    ASSERT_EQ(findSCCsWithView(*design), expectedSCCs);
+}
+
+TEST(DesignGraphView, SCCBenchmarkSyntheticCyclic) {
+    unsigned long numNodes = 100000;
+    unsigned long feedbackPeriod = 16;
+    std::unique_ptr<Design> design = createCyclicDesign(numNodes, feedbackPeriod);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::set<std::shared_ptr<Node>> masterNodes = design->getMasterNodes();
+    std::set<std::set<std::shared_ptr<Node>>> expectedSCCs = GraphAlgs::findStronglyConnectedComponents(design->getNodes(), masterNodes);
+    double graphAlgsTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    //Includes the time to build the view
+    start = std::chrono::steady_clock::now();
+    std::set<std::set<std::shared_ptr<Node>>> viewSCCs = findSCCsWithView(*design);
+    double viewTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "SCC of " << numNodes << " Nodes - GraphAlgs: " << graphAlgsTime*1000 << " ms, DesignGraphView: "
+              << viewTime*1000 << " ms" << std::endl;
+
+    //Each cycle is one component, every other node is in its own component
+    unsigned long numCycles = (numNodes-1)/feedbackPeriod;
+    ASSERT_EQ(expectedSCCs.size(), numNodes - numCycles*(feedbackPeriod/2));
+    ASSERT_EQ(viewSCCs, expectedSCCs);
+}
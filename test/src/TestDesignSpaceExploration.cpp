@@ -0,0 +1,199 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <vector>
+#include <string>
+#include <set>
+#include <fstream>
+#include <cstdio>
+#include <algorithm>
+#include <memory>
+#include <boost/filesystem.hpp>
+#include "gtest/gtest.h"
+#include "Flows/DesignSpaceExploration.h"
+#include "Flows/MultiThreadGenerator.h"
+#include "Emitter/MultiThreadEmit.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "GraphCore/SchedParams.h"
+#include "General/GeneralHelper.h"
+#include "General/FileIOHelpers.h"
+#include "General/TopologicalSortParameters.h"
+#include "Estimators/ComputationCostTable.h"
+#include "MultiThread/PartitionParams.h"
+#include "MultiThread/ThreadCrossingFIFOParameters.h"
+#include "PrimitiveNodes/Sum.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+
+TEST(DesignSpaceExploration, GridEnumeration) {
+    std::vector<DesignSpaceExploration::SweepParameter> params = {
+            DesignSpaceExploration::parseSweepParameter("blockSize=1,4,16"),
+            DesignSpaceExploration::parseSweepParameter("--fifoLength=8,16")
+    };
+
+    ASSERT_EQ(params[1].name, "fifoLength");
+    ASSERT_EQ(DesignSpaceExploration::getGridSize(params), 6);
+
+    std::vector<DesignSpaceExploration::Configuration> grid = DesignSpaceExploration::enumerateGrid(params);
+    ASSERT_EQ(grid.size(), 6);
+
+    //The last parameter varies fastest
+    ASSERT_EQ(DesignSpaceExploration::configurationToString(grid[0]), "blockSize=1 fifoLength=8");
+    ASSERT_EQ(DesignSpaceExploration::configurationToString(grid[1]), "blockSize=1 fifoLength=16");
+    ASSERT_EQ(DesignSpaceExploration::configurationToString(grid[5]), "blockSize=16 fifoLength=16");
+
+    //Random search selects distinct configurations from the grid
+    std::vector<DesignSpaceExploration::Configuration> sampled = DesignSpaceExploration::sampleRandom(params, 4, 7);
+    ASSERT_EQ(sampled.size(), 4);
+    std::set<DesignSpaceExploration::Configuration> distinct(sampled.begin(), sampled.end());
+    ASSERT_EQ(distinct.size(), 4);
+    for(const DesignSpaceExploration::Configuration &config : sampled){
+        ASSERT_NE(std::find(grid.begin(), grid.end(), config), grid.end());
+    }
+    ASSERT_EQ(DesignSpaceExploration::sampleRandom(params, 10, 7), grid);
+
+    ASSERT_THROW(DesignSpaceExploration::parseSweepParameter("blockSize"), std::runtime_error);
+    ASSERT_THROW(DesignSpaceExploration::parseSweepParameter("blockSize=1,,2"), std::runtime_error);
+}
+
+TEST(DesignSpaceExploration, ConfigurationArgs) {
+    DesignSpaceExploration::Configuration config = {{"blockSize", "4"}, {"fifoEarlyPublish", "true"}, {"sharedMemFutex", "false"}};
+    std::vector<std::string> expected = {"--blockSize", "4", "--fifoEarlyPublish"};
+    ASSERT_EQ(DesignSpaceExploration::configurationToArgs(config), expected);
+
+    ASSERT_EQ(DesignSpaceExploration::shellQuote("it's"), "'it'\\''s'");
+}
+
+TEST(DesignSpaceExploration, ParetoFront) {
+    std::vector<DesignSpaceExploration::Result> results(5);
+    double throughput[] = {10, 20, 15, 20, 5};
+    double latency[] = {5, 8, 4, 9, 1};
+    for(unsigned long i = 0; i<results.size(); i++){
+        results[i].success = true;
+        results[i].throughputMSps = throughput[i];
+        results[i].latencyEstimateUs = latency[i];
+    }
+    //A failed configuration is never on the front
+    DesignSpaceExploration::Result failed;
+    failed.failedStage = "build";
+    results.push_back(failed);
+
+    //0 is dominated by 2, 3 is dominated by 1
+    std::vector<unsigned long> expectedFront = {1, 2, 4};
+    std::vector<unsigned long> front = DesignSpaceExploration::findParetoFront(results);
+    ASSERT_EQ(front, expectedFront);
+    ASSERT_EQ(DesignSpaceExploration::selectBest(results, front), 1);
+}
+
+TEST(DesignSpaceExploration, TelemetryRate) {
+    std::string filename = "./dseTelemTest.csv";
+    std::ofstream file(filename);
+    //Each report is the average rate since the start of the benchmark.  1, 8, and 18 Msamples have been processed at
+    //1, 2, and 3 s
+    file << "TimeStamp_s,TimeStamp_ns,Rate_msps,TotalTime_s" << std::endl;
+    file << "1,0,1.000000e+00,1.000000e+00" << std::endl;
+    file << "2,0,4.000000e+00,2.000000e+00" << std::endl;
+    file << "3,0,6.000000e+00,3.000000e+00" << std::endl;
+    file << "4,0,"; //Partial line
+    file.close();
+
+    //10 Msamples were processed between the last 2 reports
+    double rate = 0;
+    ASSERT_TRUE(DesignSpaceExploration::readTelemetryRate(filename, rate));
+    ASSERT_DOUBLE_EQ(rate, 10.0);
+
+    //With a single report, its rate is used
+    file.open(filename, std::ofstream::out | std::ofstream::trunc);
+    file << "TimeStamp_s,TimeStamp_ns,Rate_msps,TotalTime_s" << std::endl;
+    file << "1,0,3.000000e+00,1.000000e+00" << std::endl;
+    file.close();
+    ASSERT_TRUE(DesignSpaceExploration::readTelemetryRate(filename, rate));
+    ASSERT_DOUBLE_EQ(rate, 3.0);
+    std::remove(filename.c_str());
+
+    ASSERT_FALSE(DesignSpaceExploration::readTelemetryRate("./dseTelemDoesNotExist.csv", rate));
+
+    //4 samples per block at 2 Msps is a 2 us block period
+    ASSERT_DOUBLE_EQ(DesignSpaceExploration::estimateLatencyUs(4, 3, 2.0), 8.0);
+}
+
+TEST(DesignSpaceExploration, PartitionTelemDumpFiles) {
+    std::string designName = "dseTelemFileTest";
+    std::string outputDir = "./dseTelemFileTest";
+    std::string telemDumpPrefix = "dseTelem_";
+
+    //Emit a 2 partition design with telemetry, as designSpaceExplorer does through multiThreadedGenerator
+    {
+        std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+        DataType dt(true, true, false, 32, 0, {1});
+
+        std::shared_ptr<Node> prev = design->getInputMaster();
+        for(int i = 0; i<2; i++){
+            std::shared_ptr<Sum> node = NodeFactory::createNode<Sum>(nullptr);
+            node->setName("sum" + GeneralHelper::to_string(i));
+            node->setInputSign({true, true});
+            node->setPartitionNum(i);
+            design->addNode(node);
+            design->addTopLevelNode(node);
+
+            design->addArc(Arc::connectNodes(prev, 0, node, 0, dt));
+            design->addArc(Arc::connectNodes(design->getInputMaster(), i+1, node, 1, dt));
+            prev = node;
+        }
+        design->addArc(Arc::connectNodes(prev, 0, design->getOutputMaster(), 0, dt));
+        design->assignNodeIDs();
+        design->assignArcIDs();
+
+        FileIOHelpers::createDirectoryIfDoesNotExist(outputDir, true);
+        TopologicalSortParameters topoParams = TopologicalSortParameters(TopologicalSortParameters::Heuristic::BFS, 4);
+        MultiThreadGenerator::emitMultiThreadedC(*design, outputDir, designName, designName,
+                                                 SchedParams::SchedType::TOPOLOGICAL_CONTEXT, topoParams,
+                                                 ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_X86,
+                                                 false, false, 16, 1, 120,
+                                                 1, PartitionParams::PartitionType::MANUAL, 0, false, ComputationCostTable(),
+                                                 true, false,
+                                                 std::vector<int>(), false,
+                                                 16, 0, 0, false, false, false, false, telemDumpPrefix,
+                                                 EmitterHelpers::TelemetryLevel::RATE_ONLY,
+                                                 100, 1.0, 64,
+                                                 false, PartitionParams::FIFOIndexCachingBehavior::NONE,
+                                                 PartitionParams::FIFOWaitPolicy::SPIN, 0, MultiThreadEmit::ComputeIODoubleBufferType::NONE,
+                                                 "", "", 1);
+    }
+
+    std::string telemDumpFilePrefix = DesignSpaceExploration::getTelemDumpFilePrefix(designName, telemDumpPrefix);
+
+    //Find the telemetry files opened by the emitted partitions
+    std::set<std::string> partitionTelemFiles;
+    for(int partition = 0; partition<2; partition++){
+        std::ifstream partitionFile(outputDir + "/" + designName + "_partition" + GeneralHelper::to_string(partition) + ".c");
+        ASSERT_TRUE(partitionFile.is_open());
+        std::string line;
+        while(std::getline(partitionFile, line)){
+            std::string::size_type fopenPos = line.find("fopen(\"");
+            if(fopenPos != std::string::npos){
+                std::string::size_type nameStart = fopenPos + 7;
+                partitionTelemFiles.insert(line.substr(nameStart, line.find('"', nameStart) - nameStart));
+            }
+        }
+    }
+    std::set<std::string> expectedTelemFiles = {telemDumpFilePrefix + "0.csv", telemDumpFilePrefix + "1.csv"};
+    ASSERT_EQ(partitionTelemFiles, expectedTelemFiles);
+    for(const std::string &telemFile : partitionTelemFiles){
+        ASSERT_TRUE(DesignSpaceExploration::isPartitionTelemDumpFile(telemFile, telemDumpFilePrefix)) << telemFile;
+    }
+
+    //The telemetry configuration written by the generator shares the prefix but is not a partition telemetry file
+    ASSERT_TRUE(boost::filesystem::exists(outputDir + "/" + telemDumpFilePrefix + "telemConfig.json"));
+    ASSERT_FALSE(DesignSpaceExploration::isPartitionTelemDumpFile(telemDumpFilePrefix + "telemConfig.json", telemDumpFilePrefix));
+    ASSERT_FALSE(DesignSpaceExploration::isPartitionTelemDumpFile(telemDumpFilePrefix + "IO.csv", telemDumpFilePrefix));
+    ASSERT_FALSE(DesignSpaceExploration::isPartitionTelemDumpFile(telemDumpFilePrefix + ".csv", telemDumpFilePrefix));
+    ASSERT_FALSE(DesignSpaceExploration::isPartitionTelemDumpFile(telemDumpFilePrefix + "-.csv", telemDumpFilePrefix));
+    ASSERT_FALSE(DesignSpaceExploration::isPartitionTelemDumpFile(telemDumpPrefix + "0.csv", telemDumpFilePrefix));
+    ASSERT_TRUE(DesignSpaceExploration::isPartitionTelemDumpFile(telemDumpFilePrefix + "-1.csv", telemDumpFilePrefix));
+
+    FileIOHelpers::deleteDirectoryRecursive(outputDir, false);
+}
@@ -0,0 +1,177 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <complex>
+#include <cmath>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "GraphCore/NumericValue.h"
+#include "General/GeneralHelper.h"
+#include "General/FileIOHelpers.h"
+#include "PrimitiveNodes/Constant.h"
+#include "PrimitiveNodes/InnerProduct.h"
+#include "HighLevelNodes/DiscreteFIR.h"
+#include "MasterNodes/MasterOutput.h"
+#include "Estimators/ComputationCostTable.h"
+#include "NodeEmitTestHelper.h"
+
+static std::vector<NumericValue> toNumericValues(const std::vector<std::complex<double>> &vals, bool complex){
+    std::vector<NumericValue> numericVals;
+    for(const std::complex<double> &val : vals){
+        numericVals.push_back(NumericValue(0, 0, val, complex, true));
+    }
+    return numericVals;
+}
+
+/**
+ * @brief Creates a design with an InnerProduct fed by constant coefficients (port 0) and constant samples (port 1)
+ */
+static std::unique_ptr<Design> createInnerProductDesign(const std::vector<std::complex<double>> &coefs,
+                                                        const std::vector<std::complex<double>> &samples, bool complex,
+                                                        InnerProduct::CoefSymmetry coefSymmetry,
+                                                        std::shared_ptr<InnerProduct> &innerProduct){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+
+    innerProduct = NodeFactory::createNode<InnerProduct>(nullptr);
+    innerProduct->setName("innerProduct");
+    innerProduct->setCoefSymmetry(coefSymmetry);
+    design->addNode(innerProduct);
+    design->addTopLevelNode(innerProduct);
+
+    std::vector<std::vector<std::complex<double>>> inputs = {coefs, samples};
+    for(int i = 0; i<2; i++){
+        std::shared_ptr<Constant> constant = NodeFactory::createNode<Constant>(nullptr);
+        constant->setName(i == 0 ? "coefs" : "samples");
+        constant->setValue(toNumericValues(inputs[i], complex));
+        design->addNode(constant);
+        design->addTopLevelNode(constant);
+
+        DataType inputType(true, true, complex, 32, 0, {(int) inputs[i].size()});
+        design->addArc(Arc::connectNodes(constant, 0, innerProduct, i, inputType));
+    }
+    DataType outputType(true, true, complex, 32, 0, {1});
+    design->addArc(Arc::connectNodes(innerProduct, 0, design->getOutputMaster(), 0, outputType));
+
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    return design;
+}
+
+/**
+ * @brief Emits an InnerProduct with the full coefficients and one with the folded coefficients and checks the results match
+ */
+static void checkFoldedMatchesUnfolded(const std::vector<std::complex<double>> &coefs, bool complex, std::string name){
+    std::string workDir = "./foldedFIRTest";
+
+    InnerProduct::CoefSymmetry coefSymmetry = DiscreteFIR::findCoefSymmetry(toNumericValues(coefs, complex));
+    ASSERT_NE(coefSymmetry, InnerProduct::CoefSymmetry::NONE) << name;
+
+    //The middle coefficient of an odd length antisymmetric filter is 0 and is dropped
+    unsigned long numCoefsFolded = coefSymmetry == InnerProduct::CoefSymmetry::SYMMETRIC ? (coefs.size()+1)/2 : coefs.size()/2;
+    std::vector<std::complex<double>> coefsFolded(coefs.begin(), coefs.begin()+numCoefsFolded);
+
+    std::vector<std::complex<double>> samples;
+    for(int i = 0; i<(int) coefs.size(); i++){
+        samples.emplace_back(((i*7+3)%11)-5+0.25*i, complex ? ((i*3+1)%5)-2.5 : 0);
+    }
+
+    std::shared_ptr<InnerProduct> unfolded;
+    std::unique_ptr<Design> unfoldedDesign = createInnerProductDesign(coefs, samples, complex, InnerProduct::CoefSymmetry::NONE, unfolded);
+    std::vector<double> expected = NodeEmitTestHelper::emitCompileAndRun(*unfoldedDesign, unfolded, 0, workDir, name + "_unfolded");
+
+    std::shared_ptr<InnerProduct> folded;
+    std::unique_ptr<Design> foldedDesign = createInnerProductDesign(coefsFolded, samples, complex, coefSymmetry, folded);
+    folded->validate();
+    std::vector<double> result = NodeEmitTestHelper::emitCompileAndRun(*foldedDesign, folded, 0, workDir, name + "_folded");
+
+    ASSERT_EQ(expected.size(), complex ? 2 : 1) << name;
+    ASSERT_EQ(result.size(), expected.size()) << name;
+    for(unsigned long i = 0; i<expected.size(); i++){
+        EXPECT_NEAR(result[i], expected[i], 1e-4*std::max(1.0, std::fabs(expected[i]))) << name << " element " << i;
+    }
+
+    FileIOHelpers::deleteDirectoryRecursive(workDir, false);
+}
+
+TEST(FoldedFIR, FindCoefSymmetry) {
+    auto findSymmetry = [](const std::vector<std::complex<double>> &coefs, bool complex){
+        return DiscreteFIR::findCoefSymmetry(toNumericValues(coefs, complex));
+    };
+
+    //Even and odd length
+    ASSERT_EQ(findSymmetry({1, 2, 2, 1}, false), InnerProduct::CoefSymmetry::SYMMETRIC);
+    ASSERT_EQ(findSymmetry({1, 2, 3, 2, 1}, false), InnerProduct::CoefSymmetry::SYMMETRIC);
+    ASSERT_EQ(findSymmetry({1, 2, -2, -1}, false), InnerProduct::CoefSymmetry::ANTISYMMETRIC);
+    ASSERT_EQ(findSymmetry({1, 2, 0, -2, -1}, false), InnerProduct::CoefSymmetry::ANTISYMMETRIC);
+
+    //The middle coefficient of an odd length antisymmetric filter must be 0
+    ASSERT_EQ(findSymmetry({1, 2, 3, -2, -1}, false), InnerProduct::CoefSymmetry::NONE);
+
+    //Complex coefficients are compared without conjugation
+    ASSERT_EQ(findSymmetry({{1, 1}, {2, -1}, {2, -1}, {1, 1}}, true), InnerProduct::CoefSymmetry::SYMMETRIC);
+    ASSERT_EQ(findSymmetry({{1, 1}, {2, -1}, {-2, 1}, {-1, -1}}, true), InnerProduct::CoefSymmetry::ANTISYMMETRIC);
+    ASSERT_EQ(findSymmetry({{1, 1}, {2, -1}, {2, 1}, {1, -1}}, true), InnerProduct::CoefSymmetry::NONE);
+
+    //Near symmetric coefficients are not folded since the result would differ from the unfolded filter
+    ASSERT_EQ(findSymmetry({0.5, 0.25, 0.25, 0.5+1e-12}, false), InnerProduct::CoefSymmetry::NONE);
+    ASSERT_EQ(findSymmetry({0.5, 0.25, -0.25, -0.5+1e-12}, false), InnerProduct::CoefSymmetry::NONE);
+
+    //Degenerate cases
+    ASSERT_EQ(findSymmetry({1}, false), InnerProduct::CoefSymmetry::NONE);
+    ASSERT_EQ(findSymmetry({}, false), InnerProduct::CoefSymmetry::NONE);
+    ASSERT_EQ(findSymmetry({0, 0}, false), InnerProduct::CoefSymmetry::SYMMETRIC);
+}
+
+TEST(FoldedFIR, FoldedMatchesUnfolded) {
+    checkFoldedMatchesUnfolded({0.5, -1.25, 2, 3.5, 3.5, 2, -1.25, 0.5}, false, "symmetricEven");
+    checkFoldedMatchesUnfolded({0.5, -1.25, 2, 3.5, 4, 3.5, 2, -1.25, 0.5}, false, "symmetricOdd");
+    checkFoldedMatchesUnfolded({0.5, -1.25, 2, 3.5, -3.5, -2, 1.25, -0.5}, false, "antisymmetricEven");
+    checkFoldedMatchesUnfolded({0.5, -1.25, 2, 3.5, 0, -3.5, -2, 1.25, -0.5}, false, "antisymmetricOdd");
+    checkFoldedMatchesUnfolded({{0.5, 1}, {-1.25, 0.5}, {2, -2}, {2, -2}, {-1.25, 0.5}, {0.5, 1}}, true, "symmetricComplex");
+    checkFoldedMatchesUnfolded({{0.5, 1}, {-1.25, 0.5}, {0, 0}, {1.25, -0.5}, {-0.5, -1}}, true, "antisymmetricComplexOdd");
+}
+
+TEST(FoldedFIR, ValidateFoldedLength) {
+    std::vector<std::complex<double>> samples = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::shared_ptr<InnerProduct> innerProduct;
+
+    //An odd length symmetric filter keeps the middle coefficient
+    std::unique_ptr<Design> symmetricDesign = createInnerProductDesign({1, 2, 3, 4, 5}, samples, false, InnerProduct::CoefSymmetry::SYMMETRIC, innerProduct);
+    ASSERT_NO_THROW(innerProduct->validate());
+    symmetricDesign = createInnerProductDesign({1, 2, 3, 4}, samples, false, InnerProduct::CoefSymmetry::SYMMETRIC, innerProduct);
+    ASSERT_THROW(innerProduct->validate(), std::runtime_error);
+
+    //An odd length antisymmetric filter drops the middle coefficient (it is 0)
+    std::unique_ptr<Design> antisymmetricDesign = createInnerProductDesign({1, 2, 3, 4}, samples, false, InnerProduct::CoefSymmetry::ANTISYMMETRIC, innerProduct);
+    ASSERT_NO_THROW(innerProduct->validate());
+    antisymmetricDesign = createInnerProductDesign({1, 2, 3, 4, 5}, samples, false, InnerProduct::CoefSymmetry::ANTISYMMETRIC, innerProduct);
+    ASSERT_THROW(innerProduct->validate(), std::runtime_error);
+}
+
+TEST(FoldedFIR, CostTableWidth) {
+    std::vector<std::complex<double>> samples = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::shared_ptr<InnerProduct> innerProduct;
+    ComputationCostTable::OperationKey key;
+
+    //The width of an unfolded InnerProduct is the number of samples
+    std::unique_ptr<Design> unfoldedDesign = createInnerProductDesign({1, 2, 3, 4, 5, 4, 3, 2, 1}, samples, false, InnerProduct::CoefSymmetry::NONE, innerProduct);
+    ASSERT_TRUE(ComputationCostTable::getOperationKey(innerProduct, key));
+    ASSERT_EQ(key.vectorWidth, 9);
+
+    //The width of a folded InnerProduct is the number of coefficients (multiplies)
+    std::unique_ptr<Design> symmetricDesign = createInnerProductDesign({1, 2, 3, 4, 5}, samples, false, InnerProduct::CoefSymmetry::SYMMETRIC, innerProduct);
+    ASSERT_TRUE(ComputationCostTable::getOperationKey(innerProduct, key));
+    ASSERT_EQ(key.vectorWidth, 5);
+
+    std::unique_ptr<Design> antisymmetricDesign = createInnerProductDesign({1, 2, 3, 4}, samples, false, InnerProduct::CoefSymmetry::ANTISYMMETRIC, innerProduct);
+    ASSERT_TRUE(ComputationCostTable::getOperationKey(innerProduct, key));
+    ASSERT_EQ(key.vectorWidth, 4);
+}
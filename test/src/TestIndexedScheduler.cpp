@@ -0,0 +1,90 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <memory>
+#include <vector>
+#include <map>
+#include <string>
+#include "gtest/gtest.h"
+#include "GraphMLTools/GraphMLImporter.h"
+#include "GraphMLTools/GraphMLDialect.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Node.h"
+#include "Scheduling/IntraPartitionScheduling.h"
+#include "General/TopologicalSortParameters.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/Port.h"
+
+/**
+ * @brief Get the schedule order of each node, indexed by the node's fully qualified name
+ */
+static std::map<std::string, int> getScheduleOrders(Design &design){
+    std::map<std::string, int> schedOrders;
+
+    std::vector<std::shared_ptr<Node>> nodes = design.getNodes();
+    for(unsigned long i = 0; i<nodes.size(); i++){
+        schedOrders[nodes[i]->getFullyQualifiedName()] = nodes[i]->getSchedOrder();
+        nodes[i]->setSchedOrder(-1);
+    }
+
+    return schedOrders;
+}
+
+/**
+ * @brief Checks that the indexed scheduler produces the same schedule as the destructive scheduler run on a copy of the design
+ */
+static void checkIndexedMatchesCopy(std::string inputFile, TopologicalSortParameters params, bool schedulePartitions){
+    std::unique_ptr<Design> design = GraphMLImporter::importGraphML(inputFile, GraphMLDialect::SIMULINK_EXPORT);
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    unsigned long numArcs = design->getArcs().size();
+
+    IntraPartitionScheduling::scheduleTopologicalSortOnCopy(*design, params, false, true, "test", ".", false, schedulePartitions);
+    std::map<std::string, int> copySchedule = getScheduleOrders(*design);
+
+    IntraPartitionScheduling::scheduleTopologicalSortIndexed(*design, params, true, false, schedulePartitions);
+    std::map<std::string, int> indexedSchedule = getScheduleOrders(*design);
+
+    ASSERT_EQ(copySchedule, indexedSchedule);
+
+    //The indexed scheduler should not modify the design
+    ASSERT_EQ(numArcs, design->getArcs().size());
+}
+
+TEST(IndexedScheduler, AGCMatchesCopyBFS) {
+    SCOPED_TRACE("");
+    checkIndexedMatchesCopy("./stimulus/simulink/dsp/agc.graphml", TopologicalSortParameters(TopologicalSortParameters::Heuristic::BFS), false);
+}
+
+TEST(IndexedScheduler, AGCMatchesCopyDFS) {
+    SCOPED_TRACE("");
+    checkIndexedMatchesCopy("./stimulus/simulink/dsp/agc.graphml", TopologicalSortParameters(TopologicalSortParameters::Heuristic::DFS), true);
+}
+
+TEST(IndexedScheduler, AGCMatchesCopyDFSBlocked) {
+    SCOPED_TRACE("");
+    checkIndexedMatchesCopy("./stimulus/simulink/dsp/agc.graphml", TopologicalSortParameters(TopologicalSortParameters::Heuristic::DFS_BLOCKED, 2), true);
+}
+
+TEST(IndexedScheduler, AGCMinLiveBytesIsTopological) {
+    std::unique_ptr<Design> design = GraphMLImporter::importGraphML("./stimulus/simulink/dsp/agc.graphml", GraphMLDialect::SIMULINK_EXPORT);
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    std::map<int, unsigned long> peakLiveBytes = IntraPartitionScheduling::scheduleTopologicalSortIndexed(*design, TopologicalSortParameters(TopologicalSortParameters::Heuristic::MIN_LIVE_BYTES), true, false, true);
+    ASSERT_FALSE(peakLiveBytes.empty());
+
+    //Every arc which is not from a state element or constant must go from an earlier node to a later node in the schedule
+    std::vector<std::shared_ptr<Arc>> arcs = design->getArcs();
+    for(unsigned long i = 0; i<arcs.size(); i++){
+        std::shared_ptr<Node> src = arcs[i]->getSrcPort()->getParent();
+        std::shared_ptr<Node> dst = arcs[i]->getDstPort()->getParent();
+        if(src->getSchedOrder() < 0 || dst->getSchedOrder() < 0 || (src->hasState() && !src->hasCombinationalPath())){
+            continue;
+        }
+
+        EXPECT_LT(src->getSchedOrder(), dst->getSchedOrder()) << src->getFullyQualifiedName() << " -> " << dst->getFullyQualifiedName();
+    }
+}
@@ -0,0 +1,287 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <ctime>
+#include <map>
+#include <cstdlib>
+#include <stdexcept>
+#include <boost/filesystem.hpp>
+#include "gtest/gtest.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "GraphCore/SchedParams.h"
+#include "General/GeneralHelper.h"
+#include "General/TopologicalSortParameters.h"
+#include "General/FileIOHelpers.h"
+#include "Flows/MultiThreadGenerator.h"
+#include "Emitter/MultiThreadEmit.h"
+#include "Estimators/ComputationCostTable.h"
+#include "MultiThread/PartitionParams.h"
+#include "MultiThread/ThreadCrossingFIFOParameters.h"
+#include "PrimitiveNodes/Sum.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+
+/**
+ * @brief Creates a design which is a chain of 2 input Sum nodes, each of which adds a design input to the output of the
+ * previous node in the chain.  The chain is split into numPartitions contiguous partitions so that the partitions form a
+ * pipeline
+ */
+static std::unique_ptr<Design> createPartitionedChainDesign(int numNodes, int numPartitions){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+    DataType dt(true, true, false, 32, 0, {1});
+
+    std::shared_ptr<Node> prev;
+    for(int i = 0; i<numNodes; i++){
+        std::shared_ptr<Sum> node = NodeFactory::createNode<Sum>(nullptr);
+        node->setName("sum" + GeneralHelper::to_string(i));
+        node->setInputSign({true, true});
+        node->setPartitionNum(i*numPartitions/numNodes);
+        design->addNode(node);
+        design->addTopLevelNode(node);
+
+        design->addArc(Arc::connectNodes(design->getInputMaster(), i, node, 0, dt));
+        if(i == 0){
+            design->addArc(Arc::connectNodes(design->getInputMaster(), numNodes, node, 1, dt));
+        }else{
+            design->addArc(Arc::connectNodes(prev, 0, node, 1, dt));
+        }
+        prev = node;
+    }
+    design->addArc(Arc::connectNodes(prev, 0, design->getOutputMaster(), 0, dt));
+
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    return design;
+}
+
+/**
+ * @brief Creates a 2 partition design where 2 signals (a and b) cross from partition 0 to partition 1.  Signal a fans out
+ * to 2 nodes in partition 1 (c and e) and e is the last node scheduled in partition 1 to read from partition 0
+ *
+ * Partition 0: a = in0 + in1, b = in1 + in2
+ * Partition 1: c = a + in3, d = c + b, e = d + a
+ */
+static std::unique_ptr<Design> createFanoutDesign(){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+    DataType dt(true, true, false, 32, 0, {1});
+
+    std::map<std::string, std::shared_ptr<Node>> nodes;
+    auto addSum = [&](std::string name, int partition, std::shared_ptr<Node> in0, int in0Port, std::shared_ptr<Node> in1, int in1Port){
+        std::shared_ptr<Sum> node = NodeFactory::createNode<Sum>(nullptr);
+        node->setName(name);
+        node->setInputSign({true, true});
+        node->setPartitionNum(partition);
+        design->addNode(node);
+        design->addTopLevelNode(node);
+        design->addArc(Arc::connectNodes(in0, in0Port, node, 0, dt));
+        design->addArc(Arc::connectNodes(in1, in1Port, node, 1, dt));
+        nodes[name] = node;
+    };
+
+    std::shared_ptr<Node> inputMaster = design->getInputMaster();
+    addSum("a", 0, inputMaster, 0, inputMaster, 1);
+    addSum("b", 0, inputMaster, 1, inputMaster, 2);
+    addSum("c", 1, nodes["a"], 0, inputMaster, 3);
+    addSum("d", 1, nodes["c"], 0, nodes["b"], 0);
+    addSum("e", 1, nodes["d"], 0, nodes["a"], 0);
+    design->addArc(Arc::connectNodes(nodes["e"], 0, design->getOutputMaster(), 0, dt));
+
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    return design;
+}
+
+/**
+ * @brief Emits a multi-partition design using the given number of emit workers
+ */
+static void emitPartitionedDesign(Design &design, std::string outputDir, std::string designName, int jobs, bool incrementalEmit = false,
+                                  bool fifoEarlyPublish = false,
+                                  ThreadCrossingFIFOParameters::ThreadCrossingFIFOType fifoType = ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_X86,
+                                  MultiThreadEmit::ComputeIODoubleBufferType fifoDoubleBuffer = MultiThreadEmit::ComputeIODoubleBufferType::NONE,
+                                  EmitterHelpers::TelemetryLevel telemLevel = EmitterHelpers::TelemetryLevel::NONE){
+    FileIOHelpers::createDirectoryIfDoesNotExist(outputDir, true);
+
+    TopologicalSortParameters topoParams = TopologicalSortParameters(TopologicalSortParameters::Heuristic::BFS, 4);
+
+    MultiThreadGenerator::emitMultiThreadedC(design, outputDir, designName, designName,
+                                             SchedParams::SchedType::TOPOLOGICAL_CONTEXT, topoParams,
+                                             fifoType,
+                                             false, false, 16, 1, 120,
+                                             1, PartitionParams::PartitionType::MANUAL, 0, false, ComputationCostTable(),
+                                             true, false,
+                                             std::vector<int>(), false,
+                                             16, 0, 0, false, false, false, false, "", telemLevel,
+                                             100, 1.0, 64,
+                                             false, PartitionParams::FIFOIndexCachingBehavior::NONE,
+                                             PartitionParams::FIFOWaitPolicy::SPIN, 0, fifoDoubleBuffer,
+                                             "", "", jobs, incrementalEmit, fifoEarlyPublish);
+}
+
+static std::string readFile(const std::string &path){
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+//Checks that emitting the partitions concurrently produces byte for byte the same files as emitting them serially
+TEST(MultiThreadGenerator, ParallelEmitMatchesSerial) {
+    std::string serialDir = "./multiThreadGenerator_jobs1";
+    std::string parallelDir = "./multiThreadGenerator_jobs4";
+    std::string designName = "partitionedChain";
+
+    FileIOHelpers::deleteDirectoryRecursive(serialDir, false);
+    FileIOHelpers::deleteDirectoryRecursive(parallelDir, false);
+
+    {
+        SCOPED_TRACE("Emitting with 1 Job");
+        std::unique_ptr<Design> design = createPartitionedChainDesign(12, 4);
+        emitPartitionedDesign(*design, serialDir, designName, 1);
+    }
+
+    {
+        SCOPED_TRACE("Emitting with 4 Jobs");
+        std::unique_ptr<Design> design = createPartitionedChainDesign(12, 4);
+        emitPartitionedDesign(*design, parallelDir, designName, 4);
+    }
+
+    unsigned long numFiles = 0;
+    unsigned long numPartitionFiles = 0;
+    for(boost::filesystem::directory_iterator it(serialDir); it != boost::filesystem::directory_iterator(); it++){
+        std::string name = it->path().filename().string();
+        SCOPED_TRACE(name);
+        ASSERT_TRUE(boost::filesystem::exists(parallelDir + "/" + name));
+        ASSERT_EQ(readFile(serialDir + "/" + name), readFile(parallelDir + "/" + name));
+        numFiles++;
+        if(name.find("_partition") != std::string::npos){
+            numPartitionFiles++;
+        }
+    }
+
+    //The 4 compute partitions each have a .c and .h file
+    ASSERT_GE(numPartitionFiles, 8);
+
+    unsigned long numParallelFiles = 0;
+    for(boost::filesystem::directory_iterator it(parallelDir); it != boost::filesystem::directory_iterator(); it++){
+        numParallelFiles++;
+    }
+    ASSERT_EQ(numParallelFiles, numFiles);
+}
+
+//Checks that incremental emit only rewrites the partition files whose contents changed
+TEST(MultiThreadGenerator, IncrementalEmitPreservesUnchangedFiles) {
+    std::string outputDir = "./multiThreadGenerator_incremental";
+    std::string designName = "partitionedChain";
+
+    FileIOHelpers::deleteDirectoryRecursive(outputDir, false);
+
+    {
+        SCOPED_TRACE("Initial Emit");
+        std::unique_ptr<Design> design = createPartitionedChainDesign(12, 4);
+        emitPartitionedDesign(*design, outputDir, designName, 1, true);
+    }
+
+    std::string unchangedFile = outputDir + "/" + designName + "_partition0.c";
+    std::string modifiedFile = outputDir + "/" + designName + "_partition1.c";
+    std::string expectedContents = readFile(modifiedFile);
+
+    //Backdate the files so that a rewrite is detectable
+    std::time_t oldTime = boost::filesystem::last_write_time(unchangedFile) - 1000;
+    boost::filesystem::last_write_time(unchangedFile, oldTime);
+    boost::filesystem::last_write_time(modifiedFile, oldTime);
+
+    {
+        std::ofstream modified(modifiedFile, std::ios::app);
+        modified << "//Modified" << std::endl;
+    }
+
+    {
+        SCOPED_TRACE("Incremental Emit");
+        std::unique_ptr<Design> design = createPartitionedChainDesign(12, 4);
+        emitPartitionedDesign(*design, outputDir, designName, 1, true);
+    }
+
+    ASSERT_EQ(boost::filesystem::last_write_time(unchangedFile), oldTime);
+    ASSERT_NE(boost::filesystem::last_write_time(modifiedFile), oldTime);
+    ASSERT_EQ(readFile(modifiedFile), expectedContents);
+}
+
+//Checks that, with early publishing, an input FIFO is acquired before the first node reading from it and released after
+//the last node reading from any of its ports (including nodes reading a port which fans out)
+TEST(MultiThreadGenerator, EarlyPublishReleaseAfterLastRead) {
+    std::string outputDir = "./multiThreadGenerator_earlyPublish";
+    std::string designName = "fanout";
+
+    FileIOHelpers::deleteDirectoryRecursive(outputDir, false);
+
+    {
+        SCOPED_TRACE("Emitting with Early Publish");
+        std::unique_ptr<Design> design = createFanoutDesign();
+        emitPartitionedDesign(*design, outputDir, designName, 1, false, true,
+                              ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_INPLACE_X86);
+    }
+
+    std::string partition1 = readFile(outputDir + "/" + designName + "_partition1.c");
+
+    //The FIFO aliases are real locals rather than macros
+    ASSERT_EQ(partition1.find("#define"), std::string::npos);
+
+    std::string::size_type acquire = partition1.find("//Acquire Input FIFO: PartitionCrossingFIFO_0_TO_1_0");
+    std::string::size_type release = partition1.find("//Release Input FIFO: PartitionCrossingFIFO_0_TO_1_0");
+    ASSERT_NE(acquire, std::string::npos);
+    ASSERT_NE(release, std::string::npos);
+
+    for(const std::string &reader : std::vector<std::string>{"c", "d", "e"}){
+        SCOPED_TRACE("Reader: " + reader);
+        std::string::size_type readerCalc = partition1.find("/" + reader + " ----");
+        ASSERT_NE(readerCalc, std::string::npos);
+        ASSERT_LT(acquire, readerCalc);
+        ASSERT_GT(release, readerCalc);
+    }
+
+    //The emitted partition should compile
+    std::string compileCmd = "cc -std=gnu11 -fsyntax-only -Werror=incompatible-pointer-types -Werror=int-conversion -I" + outputDir + " " + outputDir + "/" + designName + "_partition1.c";
+    ASSERT_EQ(system(compileCmd.c_str()), 0);
+}
+
+//Checks that early publishing is rejected with FIFO double buffering and with telemetry broken down by phase
+TEST(MultiThreadGenerator, EarlyPublishUnsupportedCombinations) {
+    std::string outputDir = "./multiThreadGenerator_earlyPublishUnsupported";
+    std::string designName = "fanout";
+
+    {
+        SCOPED_TRACE("Double Buffering");
+        std::unique_ptr<Design> design = createFanoutDesign();
+        try{
+            emitPartitionedDesign(*design, outputDir, designName, 1, false, true,
+                                  ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_INPLACE_X86,
+                                  MultiThreadEmit::ComputeIODoubleBufferType::INPUT_AND_OUTPUT);
+            FAIL() << "Expected an error";
+        }catch(const std::runtime_error &e){
+            ASSERT_NE(std::string(e.what()).find("not supported with FIFO double buffering"), std::string::npos) << e.what();
+        }
+    }
+
+    for(EmitterHelpers::TelemetryLevel telemLevel : std::vector<EmitterHelpers::TelemetryLevel>{EmitterHelpers::TelemetryLevel::BREAKDOWN, EmitterHelpers::TelemetryLevel::PAPI_COMPUTE_ONLY}){
+        SCOPED_TRACE("Telemetry Level: " + EmitterHelpers::telemetryLevelToString(telemLevel));
+        std::unique_ptr<Design> design = createFanoutDesign();
+        try{
+            emitPartitionedDesign(*design, outputDir, designName, 1, false, true,
+                                  ThreadCrossingFIFOParameters::ThreadCrossingFIFOType::LOCKLESS_INPLACE_X86,
+                                  MultiThreadEmit::ComputeIODoubleBufferType::NONE, telemLevel);
+            FAIL() << "Expected an error";
+        }catch(const std::runtime_error &e){
+            ASSERT_NE(std::string(e.what()).find("not supported with telemetry which is broken down by phase"), std::string::npos) << e.what();
+        }
+    }
+}
@@ -0,0 +1,632 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <set>
+#include <map>
+#include <cmath>
+#include "gtest/gtest.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "GraphCore/SubSystem.h"
+#include "GraphCore/EnabledSubSystem.h"
+#include "GraphCore/EnableInput.h"
+#include "GraphCore/EnableOutput.h"
+#include "General/GeneralHelper.h"
+#include "Passes/PartitioningPasses.h"
+#include "Estimators/ComputationEstimator.h"
+#include "MultiRate/DownsampleClockDomain.h"
+#include "MultiRate/MultiRateHelpers.h"
+#include "PrimitiveNodes/Sum.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+
+/**
+ * @brief Adds a 2 input Sum node to the design under the given parent (nullptr for the top level)
+ */
+static std::shared_ptr<Sum> addSum(Design &design, std::shared_ptr<SubSystem> parent, std::string name){
+    std::shared_ptr<Sum> sum = NodeFactory::createNode<Sum>(parent);
+    sum->setName(name);
+    sum->setInputSign({true, true});
+    design.addNode(sum);
+    if(parent == nullptr){
+        design.addTopLevelNode(sum);
+    }
+    return sum;
+}
+
+static void connect(Design &design, std::shared_ptr<Node> src, int srcPort, std::shared_ptr<Node> dst, int dstPort, int width = 1){
+    DataType dt(true, true, false, 32, 0, {width});
+    design.addArc(Arc::connectNodes(src, srcPort, dst, dstPort, dt));
+}
+
+/**
+ * @brief Creates a chain of Sum nodes.  Node i adds the output of node i-1 (or a design input for the first node) to a
+ * design input.  The last node drives a design output.  The arcs into node i carry vectors of widths[i] elements so that
+ * the workload of each node can be varied
+ */
+static std::vector<std::shared_ptr<Node>> addChain(Design &design, std::vector<int> widths, std::string prefix, int &nextInputPort, int outputPort){
+    std::vector<std::shared_ptr<Node>> chain;
+    for(int i = 0; i<widths.size(); i++){
+        std::shared_ptr<Sum> node = addSum(design, nullptr, prefix + GeneralHelper::to_string(i));
+        if(i == 0){
+            connect(design, design.getInputMaster(), nextInputPort++, node, 0, widths[i]);
+        }else{
+            connect(design, chain[i-1], 0, node, 0, widths[i]);
+        }
+        connect(design, design.getInputMaster(), nextInputPort++, node, 1, widths[i]);
+        chain.push_back(node);
+    }
+    connect(design, chain[chain.size()-1], 0, design.getOutputMaster(), outputPort, widths[widths.size()-1]);
+    return chain;
+}
+
+static void finalizeDesign(Design &design){
+    design.assignNodeIDs();
+    design.assignArcIDs();
+}
+
+/**
+ * @brief Gets the estimated workload of each partition (the same estimate used by the partitioner)
+ */
+static std::map<int, double> getPartitionLoads(Design &design){
+    std::map<int, double> loads;
+    std::set<std::shared_ptr<Node>> masterNodes = design.getMasterNodes();
+    for(const std::shared_ptr<Node> &node : design.getNodes()){
+        if(GeneralHelper::isType<Node, SubSystem>(node) != nullptr || masterNodes.find(node) != masterNodes.end() || node->getPartitionNum() < 0){
+            continue;
+        }
+        double rate = 1;
+        std::shared_ptr<ClockDomain> clockDomain = MultiRateHelpers::findClockDomain(node);
+        if(clockDomain != nullptr){
+            std::pair<int, int> rateRelToBase = clockDomain->getRateRelativeToBase();
+            rate = ((double) rateRelToBase.first)/rateRelToBase.second;
+        }
+        loads[node->getPartitionNum()] += ComputationEstimator::estimateNodeCost(node)*rate;
+    }
+    return loads;
+}
+
+/**
+ * @brief Gets the strongly connected component of each partition in the graph of communication between partitions.
+ * Partitions are expected to be numbered from 0 to numPartitions-1
+ */
+static std::vector<int> getPartitionComponents(Design &design, int numPartitions){
+    std::set<std::shared_ptr<Node>> masterNodes = design.getMasterNodes();
+    std::vector<std::set<int>> partitionAdjacencySet(numPartitions);
+    for(const std::shared_ptr<Arc> &arc : design.getArcs()){
+        std::shared_ptr<Node> src = arc->getSrcPort()->getParent();
+        std::shared_ptr<Node> dst = arc->getDstPort()->getParent();
+        if(masterNodes.find(src) != masterNodes.end() || masterNodes.find(dst) != masterNodes.end()){
+            continue;
+        }
+        int srcPart = src->getPartitionNum();
+        int dstPart = dst->getPartitionNum();
+        if(srcPart >= 0 && dstPart >= 0 && srcPart != dstPart){
+            partitionAdjacencySet[srcPart].insert(dstPart);
+        }
+    }
+
+    std::vector<std::vector<int>> partitionAdjacency(numPartitions);
+    for(int part = 0; part<numPartitions; part++){
+        partitionAdjacency[part].insert(partitionAdjacency[part].end(), partitionAdjacencySet[part].begin(), partitionAdjacencySet[part].end());
+    }
+    return PartitioningPasses::findStronglyConnectedComponentsIndexed(partitionAdjacency);
+}
+
+static void assertPartitionGraphAcyclic(Design &design, int numPartitions){
+    std::vector<int> components = getPartitionComponents(design, numPartitions);
+    std::set<int> distinctComponents(components.begin(), components.end());
+    ASSERT_EQ(distinctComponents.size(), numPartitions) << "Communication cycle between partitions";
+}
+
+/**
+ * @brief Gets the bytes per sample crossing between partitions.  Values from one output port sent to a partition are
+ * counted once
+ */
+static double getCutBytes(Design &design){
+    std::set<std::shared_ptr<Node>> masterNodes = design.getMasterNodes();
+    std::set<std::pair<std::shared_ptr<OutputPort>, int>> crossings;
+    double bytes = 0;
+    for(const std::shared_ptr<Arc> &arc : design.getArcs()){
+        std::shared_ptr<Node> src = arc->getSrcPort()->getParent();
+        std::shared_ptr<Node> dst = arc->getDstPort()->getParent();
+        if(masterNodes.find(src) != masterNodes.end() || masterNodes.find(dst) != masterNodes.end()){
+            continue;
+        }
+        if(src->getPartitionNum() != dst->getPartitionNum() &&
+           crossings.insert(std::pair<std::shared_ptr<OutputPort>, int>(arc->getSrcPort(), dst->getPartitionNum())).second){
+            bytes += arc->getDataType().numberOfElements()*4;
+        }
+    }
+    return bytes;
+}
+
+//==== autoPartition ====
+
+TEST(AutoPartition, BalanceWithinTolerance) {
+    Design design;
+    int nextInputPort = 0;
+    std::vector<int> widths;
+    for(int i = 0; i<30; i++){
+        widths.push_back(i%3+1);
+    }
+    addChain(design, widths, "node", nextInputPort, 0);
+    finalizeDesign(design);
+
+    int numPartitions = 4;
+    double balanceTolerance = 0.1;
+    ASSERT_EQ(PartitioningPasses::autoPartition(design, numPartitions, balanceTolerance, false), numPartitions);
+
+    //Each partition is within the tolerance of its target, which is the workload remaining after the previous
+    //partitions divided evenly among the remaining partitions
+    std::map<int, double> loads = getPartitionLoads(design);
+    ASSERT_EQ(loads.size(), numPartitions);
+    double remaining = 0;
+    for(auto it = loads.begin(); it != loads.end(); it++){
+        remaining += it->second;
+    }
+    for(int part = 0; part<numPartitions; part++){
+        double target = remaining/(numPartitions-part);
+        EXPECT_LE(std::fabs(loads[part] - target), balanceTolerance*target) << "Partition " << part;
+        remaining -= loads[part];
+    }
+
+    assertPartitionGraphAcyclic(design, numPartitions);
+}
+
+TEST(AutoPartition, CutAtNarrowestArcWithinTolerance) {
+    //A chain of 10 nodes with equal workloads.  The arc from node 5 to node 6 is narrower than the others
+    Design design;
+    std::vector<std::shared_ptr<Node>> chain;
+    for(int i = 0; i<10; i++){
+        std::shared_ptr<Sum> node = addSum(design, nullptr, "node" + GeneralHelper::to_string(i));
+        connect(design, i == 0 ? design.getInputMaster() : chain[i-1], i == 0 ? 10 : 0, node, 0, i == 6 ? 1 : 2);
+        connect(design, design.getInputMaster(), i, node, 1, 2);
+        chain.push_back(node);
+    }
+    connect(design, chain[9], 0, design.getOutputMaster(), 0, 2);
+    finalizeDesign(design);
+
+    //The even split (after node 4) is used when the narrow arc is outside of the tolerance
+    ASSERT_EQ(PartitioningPasses::autoPartition(design, 2, 0.1, false), 2);
+    EXPECT_EQ(chain[4]->getPartitionNum(), 0);
+    EXPECT_EQ(chain[5]->getPartitionNum(), 1);
+    EXPECT_EQ(getCutBytes(design), 8);
+
+    //The cut moves to the narrow arc when it is within the tolerance
+    ASSERT_EQ(PartitioningPasses::autoPartition(design, 2, 0.25, false), 2);
+    EXPECT_EQ(chain[5]->getPartitionNum(), 0);
+    EXPECT_EQ(chain[6]->getPartitionNum(), 1);
+    EXPECT_EQ(getCutBytes(design), 4);
+}
+
+TEST(AutoPartition, SCCsAndClockDomainsKeptTogether) {
+    Design design;
+    int nextInputPort = 0;
+
+    //A chain with a feedback loop from c3 to c1, making {c1, c2, c3} a strongly connected component
+    std::vector<std::shared_ptr<Node>> chain;
+    for(int i = 0; i<6; i++){
+        std::shared_ptr<Sum> node = addSum(design, nullptr, "c" + GeneralHelper::to_string(i));
+        connect(design, i == 0 ? design.getInputMaster() : chain[i-1], i == 0 ? nextInputPort++ : 0, node, 0);
+        if(i != 1){
+            connect(design, design.getInputMaster(), nextInputPort++, node, 1);
+        }
+        chain.push_back(node);
+    }
+    connect(design, chain[3], 0, chain[1], 1);
+
+    //A downsampling ClockDomain containing a chain of nodes fed by the main chain
+    std::shared_ptr<DownsampleClockDomain> clockDomain = NodeFactory::createNode<DownsampleClockDomain>(nullptr);
+    clockDomain->setName("clockDomain");
+    clockDomain->setDownsampleRatio(2);
+    design.addNode(clockDomain);
+    design.addTopLevelNode(clockDomain);
+    std::vector<std::shared_ptr<Node>> clockDomainNodes;
+    for(int i = 0; i<4; i++){
+        std::shared_ptr<Sum> node = addSum(design, clockDomain, "d" + GeneralHelper::to_string(i));
+        connect(design, i == 0 ? chain[5] : clockDomainNodes[i-1], 0, node, 0);
+        connect(design, design.getInputMaster(), nextInputPort++, node, 1);
+        clockDomainNodes.push_back(node);
+    }
+    connect(design, clockDomainNodes[3], 0, design.getOutputMaster(), 0);
+    finalizeDesign(design);
+
+    for(int numPartitions = 1; numPartitions<=5; numPartitions++) {
+        int partitionsCreated = PartitioningPasses::autoPartition(design, numPartitions, 0.1, false);
+        ASSERT_EQ(partitionsCreated, numPartitions);
+
+        EXPECT_EQ(chain[1]->getPartitionNum(), chain[2]->getPartitionNum());
+        EXPECT_EQ(chain[1]->getPartitionNum(), chain[3]->getPartitionNum());
+        for(const std::shared_ptr<Node> &node : clockDomainNodes){
+            EXPECT_EQ(node->getPartitionNum(), clockDomainNodes[0]->getPartitionNum());
+        }
+        //Subsystems are left to be assigned later
+        EXPECT_EQ(clockDomain->getPartitionNum(), -1);
+
+        assertPartitionGraphAcyclic(design, partitionsCreated);
+    }
+}
+
+TEST(AutoPartition, PartitionGraphAcyclic) {
+    //A design with branches and joins so that the topological order interleaves independent paths
+    Design design;
+    int nextInputPort = 0;
+    std::vector<std::shared_ptr<Node>> nodes;
+    for(int i = 0; i<16; i++){
+        nodes.push_back(addSum(design, nullptr, "n" + GeneralHelper::to_string(i)));
+    }
+    for(int i = 0; i<16; i++){
+        //Each node takes inputs from up to 2 earlier nodes
+        int srcA = i-1;
+        int srcB = i >= 5 ? (i*7)%(i-2) : -1;
+        connect(design, srcA >= 0 ? nodes[srcA] : design.getInputMaster(), srcA >= 0 ? 0 : nextInputPort++, nodes[i], 0, i%4+1);
+        connect(design, srcB >= 0 ? nodes[srcB] : design.getInputMaster(), srcB >= 0 ? 0 : nextInputPort++, nodes[i], 1, i%4+1);
+    }
+    connect(design, nodes[15], 0, design.getOutputMaster(), 0);
+    finalizeDesign(design);
+
+    for(int numPartitions = 1; numPartitions<=16; numPartitions++){
+        int partitionsCreated = PartitioningPasses::autoPartition(design, numPartitions, 0.2, false);
+        ASSERT_EQ(partitionsCreated, numPartitions);
+        assertPartitionGraphAcyclic(design, partitionsCreated);
+    }
+}
+
+TEST(AutoPartition, EnableNodesUnassigned) {
+    Design design;
+    int nextInputPort = 0;
+
+    std::shared_ptr<Sum> before = addSum(design, nullptr, "before");
+    connect(design, design.getInputMaster(), nextInputPort++, before, 0);
+    connect(design, design.getInputMaster(), nextInputPort++, before, 1);
+
+    std::shared_ptr<EnabledSubSystem> enabledSubSystem = NodeFactory::createNode<EnabledSubSystem>(nullptr);
+    enabledSubSystem->setName("enabledSubSystem");
+    design.addNode(enabledSubSystem);
+    design.addTopLevelNode(enabledSubSystem);
+
+    std::shared_ptr<EnableInput> enableInput = NodeFactory::createNode<EnableInput>(enabledSubSystem);
+    enableInput->setName("enableInput");
+    enabledSubSystem->addEnableInput(enableInput);
+    design.addNode(enableInput);
+    std::shared_ptr<Sum> inner = addSum(design, enabledSubSystem, "inner");
+    std::shared_ptr<EnableOutput> enableOutput = NodeFactory::createNode<EnableOutput>(enabledSubSystem);
+    enableOutput->setName("enableOutput");
+    enabledSubSystem->addEnableOutput(enableOutput);
+    design.addNode(enableOutput);
+
+    connect(design, before, 0, enableInput, 0);
+    connect(design, enableInput, 0, inner, 0);
+    connect(design, design.getInputMaster(), nextInputPort++, inner, 1);
+    connect(design, inner, 0, enableOutput, 0);
+
+    std::shared_ptr<Sum> after = addSum(design, nullptr, "after");
+    connect(design, enableOutput, 0, after, 0);
+    connect(design, design.getInputMaster(), nextInputPort++, after, 1);
+    connect(design, after, 0, design.getOutputMaster(), 0);
+    finalizeDesign(design);
+
+    //Existing assignments are overwritten
+    enableInput->setPartitionNum(7);
+    enableOutput->setPartitionNum(7);
+
+    for(int numPartitions = 1; numPartitions<=3; numPartitions++) {
+        PartitioningPasses::autoPartition(design, numPartitions, 0.1, false);
+        EXPECT_EQ(enableInput->getPartitionNum(), -1);
+        EXPECT_EQ(enableOutput->getPartitionNum(), -1);
+        EXPECT_EQ(enabledSubSystem->getPartitionNum(), -1);
+        EXPECT_GE(before->getPartitionNum(), 0);
+        EXPECT_GE(inner->getPartitionNum(), 0);
+        EXPECT_GE(after->getPartitionNum(), 0);
+    }
+}
+
+TEST(AutoPartition, MorePartitionsThanClusters) {
+    Design design;
+    int nextInputPort = 0;
+    std::vector<std::shared_ptr<Node>> chain = addChain(design, {1, 1, 1}, "node", nextInputPort, 0);
+    finalizeDesign(design);
+
+    testing::internal::CaptureStderr();
+    int partitionsCreated = PartitioningPasses::autoPartition(design, 8, 0.1, false);
+    std::string warnings = testing::internal::GetCapturedStderr();
+    ASSERT_EQ(partitionsCreated, 3);
+    EXPECT_NE(warnings.find("Creating 3 partitions"), std::string::npos) << warnings;
+
+    //Each partition is used and there are no partitions beyond the number created
+    std::set<int> partitionsUsed;
+    for(const std::shared_ptr<Node> &node : chain){
+        ASSERT_GE(node->getPartitionNum(), 0);
+        ASSERT_LT(node->getPartitionNum(), partitionsCreated);
+        partitionsUsed.insert(node->getPartitionNum());
+    }
+    ASSERT_EQ(partitionsUsed.size(), partitionsCreated);
+    assertPartitionGraphAcyclic(design, partitionsCreated);
+
+    ASSERT_THROW(PartitioningPasses::autoPartition(design, 0, 0.1, false), std::runtime_error);
+
+    //A design which is a single feedback loop can only be placed in 1 partition
+    Design loopDesign;
+    std::vector<std::shared_ptr<Node>> loop;
+    for(int i = 0; i<3; i++){
+        std::shared_ptr<Sum> node = addSum(loopDesign, nullptr, "loop" + GeneralHelper::to_string(i));
+        connect(loopDesign, loopDesign.getInputMaster(), i, node, 1);
+        if(i > 0){
+            connect(loopDesign, loop[i-1], 0, node, 0);
+        }
+        loop.push_back(node);
+    }
+    connect(loopDesign, loop[2], 0, loop[0], 0);
+    connect(loopDesign, loop[2], 0, loopDesign.getOutputMaster(), 0);
+    finalizeDesign(loopDesign);
+
+    testing::internal::CaptureStderr();
+    partitionsCreated = PartitioningPasses::autoPartition(loopDesign, 4, 0.1, false);
+    testing::internal::GetCapturedStderr();
+    ASSERT_EQ(partitionsCreated, 1);
+    for(const std::shared_ptr<Node> &node : loop){
+        ASSERT_EQ(node->getPartitionNum(), 0);
+    }
+}
+
+//==== refinePartitions ====
+
+static void setPartitions(const std::vector<std::shared_ptr<Node>> &nodes, const std::vector<int> &partitions){
+    for(int i = 0; i<nodes.size(); i++){
+        nodes[i]->setPartitionNum(partitions[i]);
+    }
+}
+
+static double maxLoad(const std::map<int, double> &loads){
+    double maxPartLoad = 0;
+    for(auto it = loads.begin(); it != loads.end(); it++){
+        maxPartLoad = std::max(maxPartLoad, it->second);
+    }
+    return maxPartLoad;
+}
+
+TEST(RefinePartitions, ImprovesBalance) {
+    Design design;
+    int nextInputPort = 0;
+    std::vector<std::shared_ptr<Node>> chain = addChain(design, {1, 1, 1, 1}, "node", nextInputPort, 0);
+    finalizeDesign(design);
+    setPartitions(chain, {0, 1, 1, 1});
+
+    double maxLoadBefore = maxLoad(getPartitionLoads(design));
+    ASSERT_EQ(PartitioningPasses::refinePartitions(design, 10, false), 1);
+    double maxLoadAfter = maxLoad(getPartitionLoads(design));
+    EXPECT_LT(maxLoadAfter, maxLoadBefore);
+    EXPECT_EQ(chain[1]->getPartitionNum(), 0);
+    EXPECT_EQ(chain[2]->getPartitionNum(), 1);
+    assertPartitionGraphAcyclic(design, 2);
+}
+
+TEST(RefinePartitions, ReducesCutBytes) {
+    //Two independent chains with each chain split across the partitions.  The workload is already balanced but each
+    //chain could reside in a single partition
+    Design design;
+    int nextInputPort = 0;
+    std::vector<std::shared_ptr<Node>> chainA = addChain(design, {1, 1}, "a", nextInputPort, 0);
+    std::vector<std::shared_ptr<Node>> chainB = addChain(design, {1, 1}, "b", nextInputPort, 1);
+    finalizeDesign(design);
+    setPartitions(chainA, {0, 1});
+    setPartitions(chainB, {0, 1});
+
+    double maxLoadBefore = maxLoad(getPartitionLoads(design));
+    ASSERT_GT(getCutBytes(design), 0);
+    PartitioningPasses::refinePartitions(design, 10, false);
+    EXPECT_EQ(getCutBytes(design), 0);
+    EXPECT_EQ(maxLoad(getPartitionLoads(design)), maxLoadBefore);
+    EXPECT_EQ(chainA[0]->getPartitionNum(), chainA[1]->getPartitionNum());
+    EXPECT_EQ(chainB[0]->getPartitionNum(), chainB[1]->getPartitionNum());
+    EXPECT_NE(chainA[0]->getPartitionNum(), chainB[0]->getPartitionNum());
+}
+
+TEST(RefinePartitions, RejectsNewCycles) {
+    //Partitions 0 and 1 start in a communication cycle (a0 -> a1 -> a2).  Partition 3 only contains a node feeding
+    //b1.  Moving b1 from partition 2 to partition 3 would reduce the maximum workload but would create a cycle between
+    //partitions 2 and 3.  This must be rejected even after the cycle between partitions 0 and 1 is broken by another
+    //move (which leaves the number of partition level SCCs unchanged by the 2 moves)
+    Design design;
+    int nextInputPort = 0;
+    std::vector<std::shared_ptr<Node>> chainA = addChain(design, {1, 1, 1}, "a", nextInputPort, 0);
+    std::shared_ptr<Sum> isolated = addSum(design, nullptr, "isolated");
+    connect(design, design.getInputMaster(), nextInputPort++, isolated, 0);
+    connect(design, design.getInputMaster(), nextInputPort++, isolated, 1);
+    connect(design, isolated, 0, design.getOutputMaster(), 1);
+
+    //Chain b has a higher workload than chain a so that partition 2 has the largest workload
+    std::shared_ptr<Sum> feed = addSum(design, nullptr, "feed");
+    connect(design, design.getInputMaster(), nextInputPort++, feed, 0, 2);
+    connect(design, design.getInputMaster(), nextInputPort++, feed, 1, 2);
+    std::vector<std::shared_ptr<Node>> chainB;
+    for(int i = 0; i<3; i++){
+        std::shared_ptr<Sum> node = addSum(design, nullptr, "b" + GeneralHelper::to_string(i));
+        connect(design, i == 0 ? design.getInputMaster() : chainB[i-1], i == 0 ? nextInputPort++ : 0, node, 0, 2);
+        if(i == 1){
+            connect(design, feed, 0, node, 1, 2);
+        }else{
+            connect(design, design.getInputMaster(), nextInputPort++, node, 1, 2);
+        }
+        chainB.push_back(node);
+    }
+    connect(design, chainB[2], 0, design.getOutputMaster(), 2, 2);
+    finalizeDesign(design);
+
+    setPartitions(chainA, {0, 1, 0});
+    isolated->setPartitionNum(1);
+    setPartitions(chainB, {2, 2, 2});
+    feed->setPartitionNum(3);
+
+    std::vector<int> componentsBefore = getPartitionComponents(design, 4);
+    ASSERT_EQ(componentsBefore[0], componentsBefore[1]);
+
+    PartitioningPasses::refinePartitions(design, 10, false);
+
+    //Partitions may only share an SCC after refinement if they did before
+    std::vector<int> componentsAfter = getPartitionComponents(design, 4);
+    for(int a = 0; a<4; a++){
+        for(int b = a+1; b<4; b++){
+            if(componentsAfter[a] == componentsAfter[b]){
+                EXPECT_EQ(componentsBefore[a], componentsBefore[b]) << "Partitions " << a << " and " << b << " are in a new communication cycle";
+            }
+        }
+    }
+    EXPECT_EQ(chainB[1]->getPartitionNum(), 2);
+}
+
+TEST(RefinePartitions, SCCsAndClockDomainsMoveTogether) {
+    {
+        //A chain with a feedback loop between n2 and n1.  Moving {n1, n2} to partition 0 improves the balance
+        Design design;
+        std::vector<std::shared_ptr<Node>> chain;
+        for(int i = 0; i<5; i++){
+            std::shared_ptr<Sum> node = addSum(design, nullptr, "n" + GeneralHelper::to_string(i));
+            connect(design, i == 0 ? design.getInputMaster() : chain[i-1], i == 0 ? 10 : 0, node, 0);
+            if(i != 1){
+                connect(design, design.getInputMaster(), i, node, 1);
+            }
+            chain.push_back(node);
+        }
+        connect(design, chain[2], 0, chain[1], 1);
+        connect(design, chain[4], 0, design.getOutputMaster(), 0);
+        finalizeDesign(design);
+        setPartitions(chain, {0, 1, 1, 1, 1});
+
+        ASSERT_EQ(PartitioningPasses::refinePartitions(design, 10, false), 2);
+        EXPECT_EQ(chain[1]->getPartitionNum(), 0);
+        EXPECT_EQ(chain[2]->getPartitionNum(), 0);
+        EXPECT_EQ(chain[3]->getPartitionNum(), 1);
+        assertPartitionGraphAcyclic(design, 2);
+    }
+
+    {
+        //A downsampling ClockDomain between n0 and the rest of the chain.  Moving the ClockDomain to partition 0
+        //improves the balance
+        Design design;
+        std::shared_ptr<Sum> first = addSum(design, nullptr, "n0");
+        connect(design, design.getInputMaster(), 0, first, 0);
+        connect(design, design.getInputMaster(), 1, first, 1);
+
+        std::shared_ptr<DownsampleClockDomain> clockDomain = NodeFactory::createNode<DownsampleClockDomain>(nullptr);
+        clockDomain->setName("clockDomain");
+        clockDomain->setDownsampleRatio(2);
+        design.addNode(clockDomain);
+        design.addTopLevelNode(clockDomain);
+        std::vector<std::shared_ptr<Node>> clockDomainNodes;
+        for(int i = 0; i<3; i++){
+            std::shared_ptr<Sum> node = addSum(design, clockDomain, "d" + GeneralHelper::to_string(i));
+            connect(design, i == 0 ? first : clockDomainNodes[i-1], 0, node, 0);
+            connect(design, design.getInputMaster(), i+2, node, 1);
+            clockDomainNodes.push_back(node);
+        }
+
+        std::vector<std::shared_ptr<Node>> after;
+        for(int i = 0; i<2; i++){
+            std::shared_ptr<Sum> node = addSum(design, nullptr, "n" + GeneralHelper::to_string(i+1));
+            connect(design, i == 0 ? clockDomainNodes[2] : after[i-1], 0, node, 0);
+            connect(design, design.getInputMaster(), i+5, node, 1);
+            after.push_back(node);
+        }
+        connect(design, after[1], 0, design.getOutputMaster(), 0);
+        finalizeDesign(design);
+
+        first->setPartitionNum(0);
+        setPartitions(clockDomainNodes, {1, 1, 1});
+        setPartitions(after, {1, 1});
+
+        ASSERT_EQ(PartitioningPasses::refinePartitions(design, 10, false), 3);
+        for(const std::shared_ptr<Node> &node : clockDomainNodes){
+            EXPECT_EQ(node->getPartitionNum(), 0);
+        }
+        EXPECT_EQ(after[0]->getPartitionNum(), 1);
+        assertPartitionGraphAcyclic(design, 2);
+    }
+}
+
+TEST(RefinePartitions, EnableNodes) {
+    //An EnabledSubsystem inside of a ClockDomain is moved to partition 0 with the rest of the ClockDomain.  A second
+    //EnabledSubsystem at the end of the chain is not moved
+    Design design;
+    int nextInputPort = 0;
+    std::shared_ptr<Sum> first = addSum(design, nullptr, "first");
+    connect(design, design.getInputMaster(), nextInputPort++, first, 0);
+    connect(design, design.getInputMaster(), nextInputPort++, first, 1);
+
+    std::shared_ptr<DownsampleClockDomain> clockDomain = NodeFactory::createNode<DownsampleClockDomain>(nullptr);
+    clockDomain->setName("clockDomain");
+    clockDomain->setDownsampleRatio(2);
+    design.addNode(clockDomain);
+    design.addTopLevelNode(clockDomain);
+
+    std::vector<std::shared_ptr<EnableNode>> enableNodes;
+    std::vector<std::shared_ptr<Node>> enabledNodes;
+    std::shared_ptr<Node> driver = first;
+    for(int subsys = 0; subsys<2; subsys++){
+        std::shared_ptr<EnabledSubSystem> enabledSubSystem = NodeFactory::createNode<EnabledSubSystem>(subsys == 0 ? clockDomain : nullptr);
+        enabledSubSystem->setName("enabledSubSystem" + GeneralHelper::to_string(subsys));
+        design.addNode(enabledSubSystem);
+        if(subsys != 0){
+            design.addTopLevelNode(enabledSubSystem);
+        }
+
+        std::shared_ptr<EnableInput> enableInput = NodeFactory::createNode<EnableInput>(enabledSubSystem);
+        enableInput->setName("enableInput" + GeneralHelper::to_string(subsys));
+        enabledSubSystem->addEnableInput(enableInput);
+        design.addNode(enableInput);
+        std::shared_ptr<Sum> inner = addSum(design, enabledSubSystem, "inner" + GeneralHelper::to_string(subsys));
+        std::shared_ptr<EnableOutput> enableOutput = NodeFactory::createNode<EnableOutput>(enabledSubSystem);
+        enableOutput->setName("enableOutput" + GeneralHelper::to_string(subsys));
+        enabledSubSystem->addEnableOutput(enableOutput);
+        design.addNode(enableOutput);
+
+        connect(design, driver, 0, enableInput, 0);
+        connect(design, enableInput, 0, inner, 0);
+        connect(design, design.getInputMaster(), nextInputPort++, inner, 1);
+        connect(design, inner, 0, enableOutput, 0);
+        enableNodes.push_back(enableInput);
+        enableNodes.push_back(enableOutput);
+        enabledNodes.push_back(inner);
+
+        if(subsys == 0){
+            //Nodes between the EnabledSubsystems
+            for(int i = 0; i<3; i++){
+                std::shared_ptr<Sum> node = addSum(design, nullptr, "between" + GeneralHelper::to_string(i));
+                connect(design, i == 0 ? std::static_pointer_cast<Node>(enableOutput) : enabledNodes[enabledNodes.size()-1], 0, node, 0);
+                connect(design, design.getInputMaster(), nextInputPort++, node, 1);
+                enabledNodes.push_back(node);
+            }
+            driver = enabledNodes[enabledNodes.size()-1];
+        }else{
+            connect(design, enableOutput, 0, design.getOutputMaster(), 0);
+        }
+    }
+    finalizeDesign(design);
+
+    first->setPartitionNum(0);
+    for(const std::shared_ptr<EnableNode> &enableNode : enableNodes){
+        enableNode->setPartitionNum(1);
+    }
+    for(const std::shared_ptr<Node> &node : enabledNodes){
+        node->setPartitionNum(1);
+    }
+
+    ASSERT_GT(PartitioningPasses::refinePartitions(design, 10, false), 0);
+
+    //The inner node of the first EnabledSubsystem moved with the ClockDomain.  Its EnableNodes are left to be placed
+    //by ContextPasses::placeEnableNodesInPartitions
+    EXPECT_EQ(enabledNodes[0]->getPartitionNum(), 0);
+    EXPECT_EQ(enableNodes[0]->getPartitionNum(), -1);
+    EXPECT_EQ(enableNodes[1]->getPartitionNum(), -1);
+
+    //The second EnabledSubsystem was not moved
+    EXPECT_EQ(enabledNodes[4]->getPartitionNum(), 1);
+    EXPECT_EQ(enableNodes[2]->getPartitionNum(), 1);
+    EXPECT_EQ(enableNodes[3]->getPartitionNum(), 1);
+}
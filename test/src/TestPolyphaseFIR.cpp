@@ -0,0 +1,280 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <map>
+#include <tuple>
+#include <cmath>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "GraphCore/NumericValue.h"
+#include "General/GeneralHelper.h"
+#include "General/FileIOHelpers.h"
+#include "PrimitiveNodes/Constant.h"
+#include "PrimitiveNodes/InnerProduct.h"
+#include "PrimitiveNodes/TappedDelay.h"
+#include "MultiRate/DownsampleInput.h"
+#include "MultiRate/UpsampleOutput.h"
+#include "MasterNodes/MasterInput.h"
+#include "MasterNodes/MasterOutput.h"
+#include "Passes/DomainPasses.h"
+#include "NodeEmitTestHelper.h"
+
+/**
+ * @brief Sets the sub-blocking length of an InnerProduct through its blocking specialization.  The arcs are expected to
+ * already have the sub-blocked dimensions
+ */
+static void setInnerProductSubBlocking(std::shared_ptr<InnerProduct> innerProduct, int subBlockingLength){
+    std::vector<std::shared_ptr<Node>> nodesToAdd, nodesToRemove, nodesToRemoveFromTopLevel;
+    std::vector<std::shared_ptr<Arc>> arcsToAdd, arcsToRemove;
+    std::map<std::shared_ptr<Arc>, std::tuple<int, int, bool, bool>> arcsWithDeferredBlockingExpansion;
+    innerProduct->specializeForBlocking(subBlockingLength, 1, nodesToAdd, nodesToRemove, arcsToAdd, arcsToRemove,
+                                        nodesToRemoveFromTopLevel, arcsWithDeferredBlockingExpansion);
+}
+
+/**
+ * @brief Creates a sub-blocked FIR (TappedDelay feeding an InnerProduct) as it is after blocking.  The FIR is either
+ * fed by an Upsample (interpolation > 1) or feeds a Downsample (decimation > 1)
+ */
+static std::unique_ptr<Design> createPolyphaseFIRDesign(int subBlockingLength, int numCoefs, int decimation, int interpolation,
+                                                        bool allocateExtraSpace, NumericValue initCond,
+                                                        std::shared_ptr<InnerProduct> &innerProduct){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+    DataType scalarType(true, true, false, 32, 0, {subBlockingLength});
+    DataType sampleType(true, true, false, 32, 0, {subBlockingLength, numCoefs});
+
+    std::shared_ptr<OutputPort> delaySrc = design->getInputMaster()->getOutputPortCreateIfNot(0);
+    if(interpolation > 1){
+        std::shared_ptr<UpsampleOutput> upsample = NodeFactory::createNode<UpsampleOutput>(nullptr);
+        upsample->setName("upsample");
+        upsample->setUpsampleRatio(interpolation);
+        upsample->setUseVectorSamplingMode(true);
+        design->addNode(upsample);
+        design->addTopLevelNode(upsample);
+        design->addArc(Arc::connectNodes(delaySrc, upsample->getInputPortCreateIfNot(0), scalarType));
+        delaySrc = upsample->getOutputPortCreateIfNot(0);
+    }
+
+    std::shared_ptr<TappedDelay> tappedDelay = NodeFactory::createNode<TappedDelay>(nullptr);
+    tappedDelay->setName("tappedDelay");
+    int delayValue = allocateExtraSpace ? numCoefs-1 : numCoefs;
+    tappedDelay->setDelayValue(delayValue);
+    tappedDelay->setInitCondition(std::vector<NumericValue>(delayValue, initCond));
+    tappedDelay->setAllocateExtraSpace(allocateExtraSpace);
+    tappedDelay->setTransactionBlockSize(subBlockingLength);
+    design->addNode(tappedDelay);
+    design->addTopLevelNode(tappedDelay);
+    design->addArc(Arc::connectNodes(delaySrc, tappedDelay->getInputPortCreateIfNot(0), scalarType));
+
+    std::shared_ptr<Constant> coefs = NodeFactory::createNode<Constant>(nullptr);
+    coefs->setName("coefs");
+    coefs->setValue(std::vector<NumericValue>(numCoefs, NumericValue(1.0)));
+    coefs->setSubBlockingLength(subBlockingLength);
+    design->addNode(coefs);
+    design->addTopLevelNode(coefs);
+
+    innerProduct = NodeFactory::createNode<InnerProduct>(nullptr);
+    innerProduct->setName("innerProduct");
+    design->addNode(innerProduct);
+    design->addTopLevelNode(innerProduct);
+    design->addArc(Arc::connectNodes(coefs, 0, innerProduct, 0, sampleType));
+    design->addArc(Arc::connectNodes(tappedDelay, 0, innerProduct, 1, sampleType));
+
+    if(decimation > 1){
+        std::shared_ptr<DownsampleInput> downsample = NodeFactory::createNode<DownsampleInput>(nullptr);
+        downsample->setName("downsample");
+        downsample->setDownsampleRatio(decimation);
+        downsample->setUseVectorSamplingMode(true);
+        design->addNode(downsample);
+        design->addTopLevelNode(downsample);
+        design->addArc(Arc::connectNodes(innerProduct, 0, downsample, 0, scalarType));
+        design->addArc(Arc::connectNodes(downsample->getOutputPortCreateIfNot(0), design->getOutputMaster()->getInputPortCreateIfNot(0), scalarType));
+    }else{
+        design->addArc(Arc::connectNodes(innerProduct, 0, design->getOutputMaster(), 0, scalarType));
+    }
+
+    setInnerProductSubBlocking(innerProduct, subBlockingLength);
+
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    return design;
+}
+
+/**
+ * @brief Creates a design with a sub-blocked InnerProduct fed by constant coefficients (repeated for each sub-block) and a
+ * constant matrix of samples ([subBlock][tap], oldest first)
+ */
+static std::unique_ptr<Design> createConstantFIRDesign(int subBlockingLength, const std::vector<double> &coefVals,
+                                                        const std::vector<double> &sampleVals, int numSamples,
+                                                        InnerProduct::CoefSymmetry coefSymmetry,
+                                                        std::shared_ptr<InnerProduct> &innerProduct){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+
+    innerProduct = NodeFactory::createNode<InnerProduct>(nullptr);
+    innerProduct->setName("innerProduct");
+    innerProduct->setCoefSymmetry(coefSymmetry);
+    design->addNode(innerProduct);
+    design->addTopLevelNode(innerProduct);
+
+    std::shared_ptr<Constant> coefs = NodeFactory::createNode<Constant>(nullptr);
+    coefs->setName("coefs");
+    std::vector<NumericValue> coefNumericVals;
+    for(double coef : coefVals){
+        coefNumericVals.push_back(NumericValue(coef));
+    }
+    coefs->setValue(coefNumericVals);
+    coefs->setSubBlockingLength(subBlockingLength);
+    design->addNode(coefs);
+    design->addTopLevelNode(coefs);
+    design->addArc(Arc::connectNodes(coefs, 0, innerProduct, 0, DataType(true, true, false, 32, 0, {subBlockingLength, (int) coefVals.size()})));
+
+    std::shared_ptr<Constant> samples = NodeFactory::createNode<Constant>(nullptr);
+    samples->setName("samples");
+    std::vector<NumericValue> sampleNumericVals;
+    for(double sample : sampleVals){
+        sampleNumericVals.push_back(NumericValue(sample));
+    }
+    samples->setValue(sampleNumericVals);
+    design->addNode(samples);
+    design->addTopLevelNode(samples);
+    design->addArc(Arc::connectNodes(samples, 0, innerProduct, 1, DataType(true, true, false, 32, 0, {subBlockingLength, numSamples})));
+
+    design->addArc(Arc::connectNodes(innerProduct, 0, design->getOutputMaster(), 0, DataType(true, true, false, 32, 0, {subBlockingLength})));
+
+    setInnerProductSubBlocking(innerProduct, subBlockingLength);
+
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    return design;
+}
+
+/**
+ * @brief Runs fusePolyphaseFIRs on a FIR adjacent to a rate change, emits the resulting polyphase filter, and compares
+ * it to the direct form filter
+ *
+ * The samples presented by the TappedDelay are modeled as a matrix ([subBlock][tap], oldest first).  When interpolating,
+ * only the samples at phase 0 of the zero stuffed input are non-zero.  The direct form filter is unfolded and uses all
+ * of the taps.  When decimating, only the retained outputs are compared.
+ */
+static void checkPolyphaseMatchesDirect(int subBlockingLength, int decimation, int interpolation, bool folded,
+                                        bool allocateExtraSpace, std::string name){
+    std::string workDir = "./polyphaseFIRTest";
+
+    //Symmetric coefficients
+    std::vector<double> coefs = {0.5, -1.25, 2, 3.5, 0.75, 3.5, 2, -1.25, 0.5};
+    int numCoefs = coefs.size();
+
+    std::shared_ptr<InnerProduct> fusedFIR;
+    std::unique_ptr<Design> fusedDesign = createPolyphaseFIRDesign(subBlockingLength, numCoefs, decimation, interpolation,
+                                                                   allocateExtraSpace, NumericValue(0.0), fusedFIR);
+    DomainPasses::fusePolyphaseFIRs(*fusedDesign);
+    ASSERT_EQ(fusedFIR->getPolyphaseDecimation(), std::max(decimation, 1)) << name;
+    ASSERT_EQ(fusedFIR->getPolyphaseInterpolation(), std::max(interpolation, 1)) << name;
+
+    //The sample at tap k of output i in the sub-block is from time i-(numCoefs-1-k) (-1 if the TappedDelay does not
+    //include the current sample) relative to the start of the sub-block
+    int newestTapDelay = allocateExtraSpace ? 0 : 1;
+    std::vector<double> samples;
+    for(int i = 0; i<subBlockingLength; i++){
+        for(int k = 0; k<numCoefs; k++){
+            int time = i-(numCoefs-1-k)-newestTapDelay;
+            bool zeroStuffed = interpolation > 1 && ((time%interpolation)+interpolation)%interpolation != 0;
+            samples.push_back(zeroStuffed ? 0 : ((time*7+30)%11)-5+0.25*time);
+        }
+    }
+
+    std::shared_ptr<InnerProduct> direct;
+    std::unique_ptr<Design> directDesign = createConstantFIRDesign(subBlockingLength, coefs, samples, numCoefs, InnerProduct::CoefSymmetry::NONE, direct);
+    std::vector<double> expected = NodeEmitTestHelper::emitCompileAndRun(*directDesign, direct, 0, workDir, name + "_direct");
+
+    std::vector<double> polyphaseCoefs = coefs;
+    if(folded){
+        polyphaseCoefs.resize((numCoefs+1)/2);
+    }
+    std::shared_ptr<InnerProduct> polyphase;
+    std::unique_ptr<Design> polyphaseDesign = createConstantFIRDesign(subBlockingLength, polyphaseCoefs, samples, numCoefs,
+                                                                      folded ? InnerProduct::CoefSymmetry::SYMMETRIC : InnerProduct::CoefSymmetry::NONE,
+                                                                      polyphase);
+    polyphase->setPolyphaseDecimation(fusedFIR->getPolyphaseDecimation());
+    polyphase->setPolyphaseInterpolation(fusedFIR->getPolyphaseInterpolation(), fusedFIR->getPolyphaseInterpolationPhase());
+    polyphase->validate();
+    std::vector<double> result = NodeEmitTestHelper::emitCompileAndRun(*polyphaseDesign, polyphase, 0, workDir, name + "_polyphase");
+
+    ASSERT_EQ(expected.size(), subBlockingLength) << name;
+    ASSERT_EQ(result.size(), expected.size()) << name;
+    int retainedStride = std::max(decimation, 1);
+    for(int i = 0; i<subBlockingLength; i+=retainedStride){
+        EXPECT_NEAR(result[i], expected[i], 1e-4*std::max(1.0, std::fabs(expected[i]))) << name << " output " << i;
+    }
+
+    FileIOHelpers::deleteDirectoryRecursive(workDir, false);
+}
+
+TEST(PolyphaseFIR, DecimationMatchesDirect) {
+    checkPolyphaseMatchesDirect(8, 2, 1, false, true, "decim2");
+    checkPolyphaseMatchesDirect(12, 3, 1, false, false, "decim3");
+    checkPolyphaseMatchesDirect(8, 4, 1, true, true, "decim4Folded");
+    checkPolyphaseMatchesDirect(12, 3, 1, true, false, "decim3Folded");
+}
+
+TEST(PolyphaseFIR, InterpolationMatchesDirect) {
+    checkPolyphaseMatchesDirect(8, 1, 2, false, true, "interp2");
+    checkPolyphaseMatchesDirect(8, 1, 2, false, false, "interp2NoExtraSpace");
+    checkPolyphaseMatchesDirect(12, 1, 3, false, true, "interp3");
+    checkPolyphaseMatchesDirect(12, 1, 3, false, false, "interp3NoExtraSpace");
+    checkPolyphaseMatchesDirect(8, 1, 4, true, true, "interp4Folded");
+    checkPolyphaseMatchesDirect(12, 1, 3, true, false, "interp3FoldedNoExtraSpace");
+}
+
+TEST(PolyphaseFIR, FallbackWarnings) {
+    std::shared_ptr<InnerProduct> innerProduct;
+
+    //The sub-blocking length is not a multiple of the downsample ratio
+    {
+        std::unique_ptr<Design> design = createPolyphaseFIRDesign(6, 9, 4, 1, true, NumericValue(0.0), innerProduct);
+        testing::internal::CaptureStderr();
+        DomainPasses::fusePolyphaseFIRs(*design);
+        std::string warnings = testing::internal::GetCapturedStderr();
+        ASSERT_NE(warnings.find("not a multiple of the downsample ratio"), std::string::npos) << warnings;
+        ASSERT_EQ(innerProduct->getPolyphaseDecimation(), 1);
+    }
+
+    //The sub-blocking length is not a multiple of the upsample ratio
+    {
+        std::unique_ptr<Design> design = createPolyphaseFIRDesign(6, 9, 1, 4, true, NumericValue(0.0), innerProduct);
+        testing::internal::CaptureStderr();
+        DomainPasses::fusePolyphaseFIRs(*design);
+        std::string warnings = testing::internal::GetCapturedStderr();
+        ASSERT_NE(warnings.find("not a multiple of the upsample ratio"), std::string::npos) << warnings;
+        ASSERT_EQ(innerProduct->getPolyphaseInterpolation(), 1);
+    }
+
+    //The history of an upsampled FIR is only zero stuffed if the initial conditions are 0
+    {
+        std::unique_ptr<Design> design = createPolyphaseFIRDesign(8, 9, 1, 2, true, NumericValue(1.0), innerProduct);
+        testing::internal::CaptureStderr();
+        DomainPasses::fusePolyphaseFIRs(*design);
+        std::string warnings = testing::internal::GetCapturedStderr();
+        ASSERT_NE(warnings.find("non-zero initial conditions"), std::string::npos) << warnings;
+        ASSERT_EQ(innerProduct->getPolyphaseInterpolation(), 1);
+    }
+
+    //A FIR which is not adjacent to a rate change is left unchanged without a warning
+    {
+        std::unique_ptr<Design> design = createPolyphaseFIRDesign(8, 9, 1, 1, true, NumericValue(0.0), innerProduct);
+        testing::internal::CaptureStderr();
+        DomainPasses::fusePolyphaseFIRs(*design);
+        std::string warnings = testing::internal::GetCapturedStderr();
+        ASSERT_EQ(warnings, "");
+        ASSERT_EQ(innerProduct->getPolyphaseDecimation(), 1);
+        ASSERT_EQ(innerProduct->getPolyphaseInterpolation(), 1);
+    }
+}
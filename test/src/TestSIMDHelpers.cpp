@@ -0,0 +1,189 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <complex>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <functional>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "General/SIMDHelpers.h"
+#include "General/FileIOHelpers.h"
+#include "General/GeneralHelper.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/NodeFactory.h"
+#include "GraphCore/NumericValue.h"
+#include "PrimitiveNodes/Constant.h"
+#include "PrimitiveNodes/Sum.h"
+#include "PrimitiveNodes/Product.h"
+#include "PrimitiveNodes/InnerProduct.h"
+#include "MasterNodes/MasterOutput.h"
+#include "NodeEmitTestHelper.h"
+
+TEST(SIMDHelpers, Lanes) {
+    DataType floatType(true, true, true, 32, 0, {4, 16});
+    DataType int16Type(false, true, false, 16, 0, {1});
+    DataType fixedType(false, true, false, 16, 8, {1});
+    DataType boolType(false, false, false, 1, 0, {1});
+
+    //Dimensions and complexity are ignored
+    ASSERT_EQ(SIMDHelpers::getLanes(SIMDHelpers::SIMDTarget::AVX2, floatType), 8);
+    ASSERT_EQ(SIMDHelpers::getLanes(SIMDHelpers::SIMDTarget::NEON, floatType), 4);
+    ASSERT_EQ(SIMDHelpers::getLanes(SIMDHelpers::SIMDTarget::AVX512, int16Type), 32);
+
+    ASSERT_EQ(SIMDHelpers::getLanes(SIMDHelpers::SIMDTarget::NONE, floatType), 1);
+    ASSERT_EQ(SIMDHelpers::getLanes(SIMDHelpers::SIMDTarget::AVX2, fixedType), 1);
+    ASSERT_EQ(SIMDHelpers::getLanes(SIMDHelpers::SIMDTarget::AVX2, boolType), 1);
+
+    ASSERT_EQ(SIMDHelpers::parseSIMDTargetStr("avx512"), SIMDHelpers::SIMDTarget::AVX512);
+    ASSERT_THROW(SIMDHelpers::parseSIMDTargetStr("avx3"), std::runtime_error);
+}
+
+TEST(SIMDHelpers, AccessType) {
+    CExpr scalar("x", CExpr::ExprType::SCALAR_VAR);
+    CExpr array("arr", CExpr::ExprType::ARRAY);
+    CExpr hankel("buf", "(off-3)");
+    CExpr repeat("coef", 4, 4, CExpr::ExprType::ARRAY_REPEAT);
+    CExpr circular("cb", 16, "off");
+
+    ASSERT_EQ(SIMDHelpers::getAccessType(scalar, 0, -1), SIMDHelpers::AccessType::BROADCAST);
+    ASSERT_EQ(SIMDHelpers::getAccessType(array, 2, 1), SIMDHelpers::AccessType::CONTIGUOUS);
+    ASSERT_EQ(SIMDHelpers::getAccessType(array, 2, 0), SIMDHelpers::AccessType::UNSUPPORTED);
+    //Each row of a Hankel matrix is offset by 1 element, so the rows are contiguous as well
+    ASSERT_EQ(SIMDHelpers::getAccessType(hankel, 2, 0), SIMDHelpers::AccessType::CONTIGUOUS);
+    ASSERT_EQ(SIMDHelpers::getAccessType(repeat, 2, 0), SIMDHelpers::AccessType::BROADCAST);
+    ASSERT_EQ(SIMDHelpers::getAccessType(repeat, 2, 1), SIMDHelpers::AccessType::CONTIGUOUS);
+    ASSERT_EQ(SIMDHelpers::getAccessType(circular, 1, 0), SIMDHelpers::AccessType::UNSUPPORTED);
+}
+
+TEST(SIMDHelpers, Emit) {
+    DataType floatType(true, true, false, 32, 0, {1});
+    std::vector<std::string> indexExprs = {"subBlkInd0", "indDim0"};
+
+    ASSERT_EQ(SIMDHelpers::getVectorTypeDef(floatType, 8),
+              "typedef float vitis_simd_float_x8 __attribute__((vector_size(32), aligned(4), may_alias));");
+
+    CExpr hankel("buf", "(off-3)");
+    ASSERT_EQ(SIMDHelpers::emitLoad(hankel, SIMDHelpers::AccessType::CONTIGUOUS, indexExprs, floatType, 8),
+              "(*((vitis_simd_float_x8*) &(((buf) + ((off-3)+subBlkInd0))[indDim0])))");
+
+    CExpr repeat("coef", 4, 4, CExpr::ExprType::ARRAY_REPEAT);
+    ASSERT_EQ(SIMDHelpers::emitLoad(repeat, SIMDHelpers::AccessType::BROADCAST, indexExprs, floatType, 8),
+              "(((vitis_simd_float_x8){0}) + ((float) (coef[indDim0])))");
+
+    //13 elements with 8 lanes has a remainder of 5
+    ASSERT_EQ(SIMDHelpers::emitVectorLoopOpen("indDim0", 13, 8), "for(unsigned long indDim0 = 0; indDim0<8; indDim0+=8){");
+    ASSERT_EQ(SIMDHelpers::emitRemainderLoopOpen("indDim0", 13, 8), "for(unsigned long indDim0 = 8; indDim0<13; indDim0++){");
+}
+
+/**
+ * @brief Creates a constant vector node with deterministic values
+ */
+static std::shared_ptr<Constant> createConstantVector(Design &design, std::string name, int len, bool complex, int seed){
+    std::vector<NumericValue> values;
+    for(int i = 0; i<len; i++){
+        double re = ((i*7+seed)%11)-5+0.25*i;
+        double im = complex ? ((i*3+seed)%5)-2.5 : 0;
+        values.push_back(NumericValue(0, 0, std::complex<double>(re, im), complex, true));
+    }
+
+    std::shared_ptr<Constant> constant = NodeFactory::createNode<Constant>(nullptr);
+    constant->setName(name);
+    constant->setValue(values);
+    design.addNode(constant);
+    design.addTopLevelNode(constant);
+    return constant;
+}
+
+/**
+ * @brief Creates a design where the given node is fed by 2 constant vectors of length 13.  13 is not a multiple of the
+ * vector length so both the vector loop and the scalar remainder are emitted
+ */
+static std::unique_ptr<Design> createSIMDTestDesign(std::shared_ptr<Node> node, bool complex, DataType outputType){
+    std::unique_ptr<Design> design = std::unique_ptr<Design>(new Design());
+    DataType inputType(true, true, complex, 32, 0, {13});
+
+    node->setName("op");
+    design->addNode(node);
+    design->addTopLevelNode(node);
+
+    for(int i = 0; i<2; i++){
+        std::shared_ptr<Constant> constant = createConstantVector(*design, "in" + GeneralHelper::to_string(i), 13, complex, i);
+        design->addArc(Arc::connectNodes(constant, 0, node, i, inputType));
+    }
+    design->addArc(Arc::connectNodes(node, 0, design->getOutputMaster(), 0, outputType));
+
+    design->assignNodeIDs();
+    design->assignArcIDs();
+
+    return design;
+}
+
+/**
+ * @brief Emits the node with and without SIMD, checks that the SIMD version used vector code, and checks that the results match
+ */
+static void checkSIMDMatchesScalar(std::function<std::shared_ptr<Node>(SIMDHelpers::SIMDTarget)> createNode, bool complex,
+                                   DataType outputType, std::string name){
+    std::string workDir = "./simdEmitTest";
+    std::vector<std::vector<double>> results;
+    for(SIMDHelpers::SIMDTarget target : {SIMDHelpers::SIMDTarget::NONE, SIMDHelpers::SIMDTarget::AVX2}){
+        std::shared_ptr<Node> node = createNode(target);
+        std::unique_ptr<Design> design = createSIMDTestDesign(node, complex, outputType);
+        std::string progName = name + "_" + SIMDHelpers::simdTargetToString(target);
+        results.push_back(NodeEmitTestHelper::emitCompileAndRun(*design, node, 0, workDir, progName));
+
+        std::ifstream srcFile(workDir + "/" + progName + ".c");
+        std::stringstream src;
+        src << srcFile.rdbuf();
+        bool usesVector = src.str().find("vector_size") != std::string::npos;
+        ASSERT_EQ(usesVector, target != SIMDHelpers::SIMDTarget::NONE) << progName;
+    }
+
+    ASSERT_EQ(results[0].size(), outputType.numberOfElements()*(complex ? 2 : 1));
+    ASSERT_EQ(results[1].size(), results[0].size());
+    for(unsigned long i = 0; i<results[0].size(); i++){
+        //The vectorized accumulation may be performed in a different order
+        EXPECT_NEAR(results[1][i], results[0][i], 1e-5*std::max(1.0, std::fabs(results[0][i]))) << name << " element " << i;
+    }
+
+    FileIOHelpers::deleteDirectoryRecursive(workDir, false);
+}
+
+TEST(SIMDHelpers, EmittedVectorCodeMatchesScalar) {
+    DataType realVec(true, true, false, 32, 0, {13});
+    DataType complexVec(true, true, true, 32, 0, {13});
+    DataType realScalar(true, true, false, 32, 0, {1});
+    DataType complexScalar(true, true, true, 32, 0, {1});
+
+    checkSIMDMatchesScalar([](SIMDHelpers::SIMDTarget target){
+        std::shared_ptr<Sum> sum = NodeFactory::createNode<Sum>(nullptr);
+        sum->setInputSign({true, false});
+        sum->setSimdTarget(target);
+        return std::static_pointer_cast<Node>(sum);
+    }, false, realVec, "sum");
+
+    checkSIMDMatchesScalar([](SIMDHelpers::SIMDTarget target){
+        std::shared_ptr<Product> product = NodeFactory::createNode<Product>(nullptr);
+        product->setInputOp({true, true});
+        product->setSimdTarget(target);
+        return std::static_pointer_cast<Node>(product);
+    }, true, complexVec, "product");
+
+    checkSIMDMatchesScalar([](SIMDHelpers::SIMDTarget target){
+        std::shared_ptr<InnerProduct> innerProduct = NodeFactory::createNode<InnerProduct>(nullptr);
+        innerProduct->setSimdTarget(target);
+        return std::static_pointer_cast<Node>(innerProduct);
+    }, false, realScalar, "innerProduct");
+
+    checkSIMDMatchesScalar([](SIMDHelpers::SIMDTarget target){
+        std::shared_ptr<InnerProduct> innerProduct = NodeFactory::createNode<InnerProduct>(nullptr);
+        innerProduct->setSimdTarget(target);
+        return std::static_pointer_cast<Node>(innerProduct);
+    }, true, complexScalar, "innerProductComplex");
+}
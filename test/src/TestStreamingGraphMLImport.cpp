@@ -0,0 +1,103 @@
+//
+// Created by Christopher Yarp on 10/17/26.
+//
+
+#include <memory>
+#include <vector>
+#include <set>
+#include <map>
+#include <string>
+#include "gtest/gtest.h"
+#include "GraphMLTools/GraphMLImporter.h"
+#include "GraphMLTools/GraphMLDialect.h"
+#include "GraphCore/Design.h"
+#include "GraphCore/Node.h"
+#include "GraphCore/Arc.h"
+#include "GraphCore/Port.h"
+
+#include "GraphTestHelper.h"
+#include "SimpleDesignValidator.h"
+#include "NestedSubSystemValidator.h"
+#include "LUTDesignValidator.h"
+
+TEST(StreamingImport, SimpleDesign) {
+    std::string inputFile = "./stimulus/simulink/basic/simple.graphml";
+    std::unique_ptr<Design> design = GraphMLImporter::importGraphMLStreaming(inputFile, GraphMLDialect::SIMULINK_EXPORT);
+
+    {
+        SCOPED_TRACE("");
+        SimpleDesignValidator::validate(*design);
+    }
+}
+
+TEST(StreamingImport, NestedSubSystem) {
+    std::string inputFile = "./stimulus/simulink/basic/nested.graphml";
+    std::unique_ptr<Design> design = GraphMLImporter::importGraphMLStreaming(inputFile, GraphMLDialect::SIMULINK_EXPORT);
+
+    {
+        SCOPED_TRACE("");
+        NestedSubSystemValidator::validate(*design);
+    }
+}
+
+TEST(StreamingImport, LUTSubsystem) {
+    std::string inputFile = "./stimulus/simulink/basic/lut_subsystem.graphml";
+    std::unique_ptr<Design> design = GraphMLImporter::importGraphMLStreaming(inputFile, GraphMLDialect::SIMULINK_EXPORT);
+
+    {
+        SCOPED_TRACE("");
+        LUTDesignValidator::validate(*design);
+    }
+}
+
+/**
+ * @brief Describes each arc by the fully qualified names and port numbers of its endpoints
+ */
+static std::multiset<std::string> arcDescriptions(Design &design){
+    std::multiset<std::string> descriptions;
+
+    std::vector<std::shared_ptr<Arc>> arcs = design.getArcs();
+    for(unsigned long i = 0; i<arcs.size(); i++){
+        std::shared_ptr<Port> src = arcs[i]->getSrcPort();
+        std::shared_ptr<Port> dst = arcs[i]->getDstPort();
+        descriptions.insert(src->getParent()->getFullyQualifiedName() + ":" + GeneralHelper::to_string(src->getPortNum()) + " -> " +
+                            dst->getParent()->getFullyQualifiedName() + ":" + GeneralHelper::to_string(dst->getPortNum()));
+    }
+
+    return descriptions;
+}
+
+/**
+ * @brief Checks that the streaming import produces the same nodes (including hierarchy) and arcs as the DOM import
+ */
+static void checkStreamingMatchesDOM(std::string inputFile, GraphMLDialect dialect){
+    std::unique_ptr<Design> domDesign = GraphMLImporter::importGraphML(inputFile, dialect);
+    std::unique_ptr<Design> saxDesign = GraphMLImporter::importGraphMLStreaming(inputFile, dialect);
+
+    std::vector<std::shared_ptr<Node>> domNodes = domDesign->getNodes();
+    std::vector<std::shared_ptr<Node>> saxNodes = saxDesign->getNodes();
+    ASSERT_EQ(domNodes.size(), saxNodes.size());
+    ASSERT_EQ(domDesign->getTopLevelNodes().size(), saxDesign->getTopLevelNodes().size());
+
+    std::map<std::string, std::string> domNodeTypes;
+    for(unsigned long i = 0; i<domNodes.size(); i++){
+        domNodeTypes[domNodes[i]->getFullyQualifiedName()] = domNodes[i]->typeNameStr();
+    }
+    std::map<std::string, std::string> saxNodeTypes;
+    for(unsigned long i = 0; i<saxNodes.size(); i++){
+        saxNodeTypes[saxNodes[i]->getFullyQualifiedName()] = saxNodes[i]->typeNameStr();
+    }
+    ASSERT_EQ(domNodeTypes, saxNodeTypes);
+
+    ASSERT_EQ(arcDescriptions(*domDesign), arcDescriptions(*saxDesign));
+}
+
+TEST(StreamingImport, EnabledSubsystemMatchesDOM) {
+    SCOPED_TRACE("");
+    checkStreamingMatchesDOM("./stimulus/simulink/basic/enabled_float.graphml", GraphMLDialect::SIMULINK_EXPORT);
+}
+
+TEST(StreamingImport, AGCMatchesDOM) {
+    SCOPED_TRACE("");
+    checkStreamingMatchesDOM("./stimulus/simulink/dsp/agc.graphml", GraphMLDialect::SIMULINK_EXPORT);
+}